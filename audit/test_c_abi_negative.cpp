@@ -30,6 +30,8 @@
 //   ufsecp_bip32_*             (HD key derivation)
 //   ufsecp_taproot_*           (BIP-341 Taproot)
 //   ufsecp_pubkey_add / negate / tweak_add / tweak_mul
+//   ufsecp_thread_pool_* / ufsecp_ctx_*threads* (thread pools)
+//   ufsecp_*_batch             (pooled batch entry points)
 // ============================================================================
 
 #include <cstdio>
@@ -1420,6 +1422,581 @@ static void run_neg22_abi_version(void) {
     CHECK(ver > 0, "NEG-22.7: ufsecp_version() returns non-zero");
 }
 
+// ---------------------------------------------------------------------------
+// NEG-23: Thread pools and pooled batch entry points
+// ---------------------------------------------------------------------------
+
+static void run_neg23_thread_pool(ufsecp_ctx* ctx, const uint8_t* pubkey33) {
+    constexpr size_t kOverMax = (size_t{1} << 20) + 1;  // kMaxBatchN + 1
+    const int cpus[1] = { 0 };
+
+    // ufsecp_thread_pool_create
+    ufsecp_thread_pool* pool = nullptr;
+    CHECK_CODE(ufsecp_thread_pool_create(2, nullptr, 0, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-23.1: thread_pool_create(null_out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_thread_pool_create(2, nullptr, 1, &pool), UFSECP_ERR_NULL_ARG,
+               "NEG-23.2: thread_pool_create(null cpu_ids, n_cpu_ids=1) -> NULL_ARG");
+    CHECK(pool == nullptr, "NEG-23.3: thread_pool_create error leaves *pool_out NULL");
+    CHECK_OK(ufsecp_thread_pool_create(100000u, nullptr, 0, &pool),
+             "NEG-23.4: thread_pool_create(bad n_threads=100000) is clamped, not rejected");
+    CHECK(pool != nullptr && ufsecp_thread_pool_size(pool) <= 256,
+          "NEG-23.5: oversized thread count capped at 256");
+    ufsecp_thread_pool_destroy(pool);
+    pool = nullptr;
+    CHECK_OK(ufsecp_thread_pool_create(0, nullptr, 0, &pool),
+             "NEG-23.6: thread_pool_create(zero n_threads) -> hardware concurrency");
+    CHECK(pool != nullptr && ufsecp_thread_pool_size(pool) >= 1,
+          "NEG-23.7: zero thread count yields >= 1 participant");
+
+    // ufsecp_thread_pool_size / ufsecp_thread_pool_destroy
+    CHECK(ufsecp_thread_pool_size(nullptr) == 0, "NEG-23.8: thread_pool_size(null) -> 0");
+    ufsecp_thread_pool_destroy(nullptr);
+    CHECK(true, "NEG-23.9: thread_pool_destroy(null) is a no-op");
+
+    // ufsecp_ctx_set_thread_pool
+    CHECK_CODE(ufsecp_ctx_set_thread_pool(nullptr, pool), UFSECP_ERR_NULL_ARG,
+               "NEG-23.10: ctx_set_thread_pool(null_ctx) -> NULL_ARG");
+    CHECK_OK(ufsecp_ctx_set_thread_pool(ctx, pool), "NEG-23.11: ctx_set_thread_pool valid");
+    ufsecp_thread_pool_destroy(pool);  // ctx keeps the pool alive
+    CHECK(ufsecp_ctx_threads(ctx) >= 1,
+          "NEG-23.12: ctx pool survives thread_pool_destroy of the handle");
+    CHECK_OK(ufsecp_ctx_set_thread_pool(ctx, nullptr),
+             "NEG-23.13: ctx_set_thread_pool(null pool) detaches");
+
+    // ufsecp_ctx_set_threads / ufsecp_ctx_threads
+    CHECK_CODE(ufsecp_ctx_set_threads(nullptr, 2, nullptr, 0), UFSECP_ERR_NULL_ARG,
+               "NEG-23.14: ctx_set_threads(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_ctx_set_threads(ctx, 2, nullptr, 1), UFSECP_ERR_NULL_ARG,
+               "NEG-23.15: ctx_set_threads(null cpu_ids, n_cpu_ids=1) -> NULL_ARG");
+    CHECK_OK(ufsecp_ctx_set_threads(ctx, 100000u, cpus, 1),
+             "NEG-23.16: ctx_set_threads(bad n_threads=100000) is clamped, not rejected");
+    CHECK(ufsecp_ctx_threads(ctx) <= 256, "NEG-23.17: ctx_threads capped at 256");
+    CHECK_OK(ufsecp_ctx_set_threads(ctx, 0, nullptr, 0),
+             "NEG-23.18: ctx_set_threads(zero n_threads) -> hardware concurrency");
+    CHECK(ufsecp_ctx_threads(ctx) >= 1, "NEG-23.18b: zero thread count yields >= 1 thread");
+    CHECK_OK(ufsecp_ctx_set_threads(ctx, 1, nullptr, 0), "NEG-23.18c: ctx_set_threads(1) valid");
+    CHECK(ufsecp_ctx_threads(ctx) == 1, "NEG-23.19: ctx_threads reports 1 after set_threads(1)");
+    CHECK(ufsecp_ctx_threads(nullptr) == 0, "NEG-23.20: ctx_threads(null_ctx) -> 0");
+    CHECK_OK(ufsecp_ctx_set_thread_pool(ctx, nullptr), "NEG-23.21: revert to the global pool");
+
+    // ufsecp_pubkey_create_batch
+    uint8_t keys[2 * 32];
+    std::memcpy(keys, VALID_KEY1, 32);
+    std::memcpy(keys + 32, VALID_KEY2, 32);
+    uint8_t pubs[2 * 33];
+    CHECK_CODE(ufsecp_pubkey_create_batch(nullptr, 2, keys, pubs), UFSECP_ERR_NULL_ARG,
+               "NEG-23.22: pubkey_create_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_pubkey_create_batch(ctx, 2, nullptr, pubs), UFSECP_ERR_NULL_ARG,
+               "NEG-23.23: pubkey_create_batch(null privkeys) -> NULL_ARG");
+    CHECK_CODE(ufsecp_pubkey_create_batch(ctx, 2, keys, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-23.24: pubkey_create_batch(null out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_pubkey_create_batch(ctx, kOverMax, keys, pubs), UFSECP_ERR_BAD_INPUT,
+               "NEG-23.25: pubkey_create_batch(count > kMaxBatchN) -> BAD_INPUT");
+    CHECK_OK(ufsecp_pubkey_create_batch(ctx, 0, keys, pubs),
+             "NEG-23.26: pubkey_create_batch(count=0) -> OK (empty batch)");
+    std::memcpy(keys + 32, ZERO_KEY, 32);
+    CHECK_CODE(ufsecp_pubkey_create_batch(ctx, 2, keys, pubs), UFSECP_ERR_BAD_KEY,
+               "NEG-23.27: pubkey_create_batch(zero key in batch) -> BAD_KEY");
+    bool zeroed = true;
+    for (uint8_t b : pubs) zeroed = zeroed && b == 0;
+    CHECK(zeroed, "NEG-23.28: pubkey_create_batch bad key zeroes every output");
+
+    // ufsecp_hash160_pubkey_batch
+    uint8_t digests[2 * 20];
+    CHECK_CODE(ufsecp_hash160_pubkey_batch(nullptr, pubkey33, 1, digests), UFSECP_ERR_NULL_ARG,
+               "NEG-23.29: hash160_pubkey_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_hash160_pubkey_batch(ctx, nullptr, 1, digests), UFSECP_ERR_NULL_ARG,
+               "NEG-23.30: hash160_pubkey_batch(null pubkeys) -> NULL_ARG");
+    CHECK_CODE(ufsecp_hash160_pubkey_batch(ctx, pubkey33, 1, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-23.31: hash160_pubkey_batch(null out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_hash160_pubkey_batch(ctx, pubkey33, kOverMax, digests), UFSECP_ERR_BAD_INPUT,
+               "NEG-23.32: hash160_pubkey_batch(count > kMaxBatchN) -> BAD_INPUT");
+    CHECK_OK(ufsecp_hash160_pubkey_batch(ctx, pubkey33, 0, digests),
+             "NEG-23.33: hash160_pubkey_batch(count=0) -> OK (empty batch)");
+
+    // ufsecp_silent_payment_scan_batch
+    uint64_t prefix[1] = { ~uint64_t{0} };
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(nullptr, VALID_KEY1, pubkey33, pubkey33, 1, prefix),
+               UFSECP_ERR_NULL_ARG, "NEG-23.34: silent_payment_scan_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, nullptr, pubkey33, pubkey33, 1, prefix),
+               UFSECP_ERR_NULL_ARG, "NEG-23.35: silent_payment_scan_batch(null scan key) -> NULL_ARG");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, VALID_KEY1, nullptr, pubkey33, 1, prefix),
+               UFSECP_ERR_NULL_ARG, "NEG-23.36: silent_payment_scan_batch(null spend key) -> NULL_ARG");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, VALID_KEY1, pubkey33, nullptr, 1, prefix),
+               UFSECP_ERR_NULL_ARG, "NEG-23.37: silent_payment_scan_batch(null tweaks) -> NULL_ARG");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, VALID_KEY1, pubkey33, pubkey33, 1, nullptr),
+               UFSECP_ERR_NULL_ARG, "NEG-23.38: silent_payment_scan_batch(null out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, VALID_KEY1, pubkey33, pubkey33, kOverMax, prefix),
+               UFSECP_ERR_BAD_INPUT, "NEG-23.39: silent_payment_scan_batch(count > kMaxBatchN) -> BAD_INPUT");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, ZERO_KEY, pubkey33, pubkey33, 1, prefix),
+               UFSECP_ERR_BAD_KEY, "NEG-23.40: silent_payment_scan_batch(zero scan key) -> BAD_KEY");
+    CHECK(prefix[0] == 0, "NEG-23.41: silent_payment_scan_batch error zeroes the prefixes");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, VALID_KEY1, ZERO_PUBKEY33, pubkey33, 1, prefix),
+               UFSECP_ERR_BAD_PUBKEY, "NEG-23.42: silent_payment_scan_batch(invalid spend pubkey) -> BAD_PUBKEY");
+    CHECK_CODE(ufsecp_silent_payment_scan_batch(ctx, VALID_KEY1, pubkey33, ZERO_PUBKEY33, 1, prefix),
+               UFSECP_ERR_BAD_PUBKEY, "NEG-23.43: silent_payment_scan_batch(invalid tweak pubkey) -> BAD_PUBKEY");
+    CHECK_OK(ufsecp_silent_payment_scan_batch(ctx, VALID_KEY1, pubkey33, pubkey33, 0, prefix),
+             "NEG-23.44: silent_payment_scan_batch(count=0) -> OK (empty batch)");
+}
+
+// ---------------------------------------------------------------------------
+// NEG-24: ECDSA batch verification with recovery ids
+// ---------------------------------------------------------------------------
+
+static void run_neg24_ecdsa_batch_recoverable(ufsecp_ctx* ctx, const uint8_t* pubkey33) {
+    constexpr size_t kOverMax = (size_t{1} << 20) + 1;  // kMaxBatchN + 1
+
+    // entry: [32 msg | 33 pubkey | 64 sig | 1 recid]
+    uint8_t entry[130] = {};
+    int recid = -1;
+    std::memcpy(entry, MSG32, 32);
+    std::memcpy(entry + 32, pubkey33, 33);
+    CHECK_OK(ufsecp_ecdsa_sign_recoverable(ctx, MSG32, VALID_KEY1, entry + 65, &recid),
+             "NEG-24.0: sign_recoverable for fixture");
+    entry[129] = static_cast<uint8_t>(recid);
+    CHECK_OK(ufsecp_ecdsa_batch_verify_recoverable(ctx, entry, 1),
+             "NEG-24.1: batch_verify_recoverable valid entry -> OK");
+
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(nullptr, entry, 1), UFSECP_ERR_NULL_ARG,
+               "NEG-24.2: batch_verify_recoverable(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, nullptr, 1), UFSECP_ERR_NULL_ARG,
+               "NEG-24.3: batch_verify_recoverable(null entries, n=1) -> NULL_ARG");
+    CHECK_OK(ufsecp_ecdsa_batch_verify_recoverable(ctx, nullptr, 0),
+             "NEG-24.4: batch_verify_recoverable(null entries, count=0) -> OK (empty batch)");
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, entry, kOverMax), UFSECP_ERR_BAD_INPUT,
+               "NEG-24.5: batch_verify_recoverable(count > kMaxBatchN) -> BAD_INPUT");
+
+    uint8_t bad[130];
+    std::memcpy(bad, entry, sizeof(bad));
+    bad[129] = 4;
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, bad, 1), UFSECP_ERR_BAD_SIG,
+               "NEG-24.6: batch_verify_recoverable(bad recid=4) -> BAD_SIG");
+    bad[129] = 0xFF;
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, bad, 1), UFSECP_ERR_BAD_SIG,
+               "NEG-24.7: batch_verify_recoverable(bad recid=255) -> BAD_SIG");
+    bad[129] = static_cast<uint8_t>(entry[129] ^ 1);
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, bad, 1), UFSECP_ERR_VERIFY_FAIL,
+               "NEG-24.8: batch_verify_recoverable(wrong recid) -> VERIFY_FAIL");
+
+    std::memcpy(bad, entry, sizeof(bad));
+    std::memcpy(bad + 65, ZERO_SIG64, 64);
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, bad, 1), UFSECP_ERR_BAD_SIG,
+               "NEG-24.9: batch_verify_recoverable(zero sig) -> BAD_SIG");
+    std::memcpy(bad, entry, sizeof(bad));
+    std::memcpy(bad + 32, ZERO_PUBKEY33, 33);
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, bad, 1), UFSECP_ERR_BAD_PUBKEY,
+               "NEG-24.10: batch_verify_recoverable(invalid pubkey) -> BAD_PUBKEY");
+    std::memcpy(bad, entry, sizeof(bad));
+    bad[0] ^= 0x01;
+    CHECK_CODE(ufsecp_ecdsa_batch_verify_recoverable(ctx, bad, 1), UFSECP_ERR_VERIFY_FAIL,
+               "NEG-24.11: batch_verify_recoverable(tampered msg) -> VERIFY_FAIL");
+}
+
+// ---------------------------------------------------------------------------
+// NEG-25: BIP-324 caller-buffer packet API
+// ---------------------------------------------------------------------------
+
+#ifdef SECP256K1_BIP324
+static void run_neg25_bip324_packets(ufsecp_ctx* ctx) {
+    ufsecp_bip324_session* ini = nullptr;
+    ufsecp_bip324_session* res = nullptr;
+    ufsecp_bip324_session* idle = nullptr;
+    uint8_t ell_i[64], ell_r[64], ell_idle[64];
+    bool const up =
+        ufsecp_bip324_create(ctx, 1, &ini, ell_i) == UFSECP_OK &&
+        ufsecp_bip324_create(ctx, 0, &res, ell_r) == UFSECP_OK &&
+        ufsecp_bip324_create(ctx, 1, &idle, ell_idle) == UFSECP_OK &&
+        ufsecp_bip324_handshake(ini, ell_r, nullptr) == UFSECP_OK &&
+        ufsecp_bip324_handshake(res, ell_i, nullptr) == UFSECP_OK;
+    CHECK(up, "NEG-25.0: BIP-324 session pair for fixture");
+    if (!up) {
+        ufsecp_bip324_destroy(ini);
+        ufsecp_bip324_destroy(res);
+        ufsecp_bip324_destroy(idle);
+        return;
+    }
+
+    static const uint8_t head[4] = { 'p', 'i', 'n', 'g' };
+    static const uint8_t body[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const ufsecp_bip324_segment parts[2] = { { head, sizeof(head) }, { body, sizeof(body) } };
+    uint8_t pkt[64];
+    size_t pkt_len = sizeof(pkt);
+
+    // ufsecp_bip324_encrypt_v
+    CHECK_CODE(ufsecp_bip324_encrypt_v(nullptr, parts, 2, pkt, &pkt_len), UFSECP_ERR_NULL_ARG,
+               "NEG-25.1: encrypt_v(null session) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_encrypt_v(ini, nullptr, 2, pkt, &pkt_len), UFSECP_ERR_NULL_ARG,
+               "NEG-25.2: encrypt_v(null parts, part_count=2) -> NULL_ARG");
+    const ufsecp_bip324_segment null_part[1] = { { nullptr, 4 } };
+    CHECK_CODE(ufsecp_bip324_encrypt_v(ini, null_part, 1, pkt, &pkt_len), UFSECP_ERR_NULL_ARG,
+               "NEG-25.3: encrypt_v(null part data, len=4) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_encrypt_v(ini, parts, 2, nullptr, &pkt_len), UFSECP_ERR_NULL_ARG,
+               "NEG-25.4: encrypt_v(null out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_encrypt_v(ini, parts, 2, pkt, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-25.5: encrypt_v(null out_len) -> NULL_ARG");
+    size_t small_len = sizeof(head) + sizeof(body) + 18;  // one byte undersized
+    CHECK_CODE(ufsecp_bip324_encrypt_v(ini, parts, 2, pkt, &small_len), UFSECP_ERR_BUF_TOO_SMALL,
+               "NEG-25.6: encrypt_v(undersized out) -> BUF_TOO_SMALL");
+    const ufsecp_bip324_segment huge[2] = { { body, 0xFFFFFF }, { body, 1 } };
+    CHECK_CODE(ufsecp_bip324_encrypt_v(ini, huge, 2, pkt, &pkt_len), UFSECP_ERR_BAD_INPUT,
+               "NEG-25.7: encrypt_v(payload > 0xFFFFFF) -> BAD_INPUT");
+    pkt_len = sizeof(pkt);
+    CHECK_ERR(ufsecp_bip324_encrypt_v(idle, parts, 2, pkt, &pkt_len),
+              "NEG-25.8: encrypt_v(session without handshake) -> error");
+
+    // Valid empty packet (zero parts), then a two-part packet.
+    pkt_len = sizeof(pkt);
+    CHECK_OK(ufsecp_bip324_encrypt_v(ini, nullptr, 0, pkt, &pkt_len),
+             "NEG-25.9: encrypt_v(zero parts) -> empty packet");
+    size_t payload_len = 99;
+    CHECK(pkt_len == 19 && ufsecp_bip324_decrypt_in_place(res, pkt, pkt_len, &payload_len) == UFSECP_OK &&
+          payload_len == 0, "NEG-25.10: empty packet round-trips through decrypt_in_place");
+    pkt_len = sizeof(pkt);
+    // More parts than the on-stack segment array holds.
+    ufsecp_bip324_segment many[20];
+    for (size_t i = 0; i < 20; ++i) many[i] = { body + (i % 8), 1 };
+    pkt_len = sizeof(pkt);
+    CHECK(ufsecp_bip324_encrypt_v(ini, many, 20, pkt, &pkt_len) == UFSECP_OK &&
+          ufsecp_bip324_decrypt_in_place(res, pkt, pkt_len, &payload_len) == UFSECP_OK &&
+          payload_len == 20 && pkt[3] == body[0] && pkt[3 + 19] == body[19 % 8],
+          "NEG-25.11: encrypt_v(20 parts) round-trips");
+    pkt_len = sizeof(pkt);
+    CHECK_OK(ufsecp_bip324_encrypt_v(ini, parts, 2, pkt, &pkt_len), "NEG-25.11b: encrypt_v valid");
+
+    // ufsecp_bip324_decrypt_in_place
+    CHECK_CODE(ufsecp_bip324_decrypt_in_place(nullptr, pkt, pkt_len, &payload_len), UFSECP_ERR_NULL_ARG,
+               "NEG-25.12: decrypt_in_place(null session) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_decrypt_in_place(res, nullptr, pkt_len, &payload_len), UFSECP_ERR_NULL_ARG,
+               "NEG-25.13: decrypt_in_place(null packet) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_decrypt_in_place(res, pkt, pkt_len, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-25.14: decrypt_in_place(null payload_len) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_decrypt_in_place(res, pkt, 18, &payload_len), UFSECP_ERR_BUF_TOO_SMALL,
+               "NEG-25.15: decrypt_in_place(buffer shorter than header + tag) -> BUF_TOO_SMALL");
+    CHECK_CODE(ufsecp_bip324_decrypt_in_place(res, pkt, 0, &payload_len), UFSECP_ERR_BUF_TOO_SMALL,
+               "NEG-25.16: decrypt_in_place(zero-length packet) -> BUF_TOO_SMALL");
+    CHECK(payload_len == 0, "NEG-25.17: decrypt_in_place error zeroes *payload_len_out");
+    uint8_t tampered[64];
+    std::memcpy(tampered, pkt, pkt_len);
+    tampered[pkt_len - 1] ^= 0x01;
+    CHECK_CODE(ufsecp_bip324_decrypt_in_place(res, tampered, pkt_len, &payload_len), UFSECP_ERR_VERIFY_FAIL,
+               "NEG-25.18: decrypt_in_place(tampered tag) -> VERIFY_FAIL");
+    CHECK_ERR(ufsecp_bip324_decrypt_in_place(idle, pkt, pkt_len, &payload_len),
+              "NEG-25.19: decrypt_in_place(session without handshake) -> error");
+
+    ufsecp_bip324_destroy(ini);
+    ufsecp_bip324_destroy(res);
+    ufsecp_bip324_destroy(idle);
+}
+#endif // SECP256K1_BIP324
+
+// ---------------------------------------------------------------------------
+// NEG-26: Batched BIP-324 handshakes
+// ---------------------------------------------------------------------------
+
+#ifdef SECP256K1_BIP324
+static void run_neg26_bip324_handshake_batch(ufsecp_ctx* ctx) {
+    constexpr size_t kOverMax = (size_t{1} << 20) + 1;  // kMaxBatchN + 1
+    ufsecp_bip324_session* peer[2] = {};
+    ufsecp_bip324_session* ours[2] = {};
+    uint8_t peer_ell[2 * 64], ours_ell[2 * 64];
+    bool up = true;
+    for (int i = 0; i < 2; ++i) {
+        up = up && ufsecp_bip324_create(ctx, 1, &peer[i], peer_ell + 64 * i) == UFSECP_OK;
+        up = up && ufsecp_bip324_create(ctx, 0, &ours[i], ours_ell + 64 * i) == UFSECP_OK;
+    }
+    CHECK(up, "NEG-26.0: BIP-324 sessions for fixture");
+    if (!up) {
+        for (int i = 0; i < 2; ++i) {
+            ufsecp_bip324_destroy(peer[i]);
+            ufsecp_bip324_destroy(ours[i]);
+        }
+        return;
+    }
+
+    uint8_t ids[2 * 32];
+    uint8_t ok[2] = { 9, 9 };
+    CHECK_CODE(ufsecp_bip324_handshake_batch(nullptr, ours, peer_ell, 2, ids, ok), UFSECP_ERR_NULL_ARG,
+               "NEG-26.1: handshake_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_handshake_batch(ctx, nullptr, peer_ell, 2, ids, ok), UFSECP_ERR_NULL_ARG,
+               "NEG-26.2: handshake_batch(null sessions) -> NULL_ARG");
+    CHECK_CODE(ufsecp_bip324_handshake_batch(ctx, ours, nullptr, 2, ids, ok), UFSECP_ERR_NULL_ARG,
+               "NEG-26.3: handshake_batch(null encodings) -> NULL_ARG");
+    ufsecp_bip324_session* with_null[2] = { ours[0], nullptr };
+    CHECK_CODE(ufsecp_bip324_handshake_batch(ctx, with_null, peer_ell, 2, ids, ok), UFSECP_ERR_NULL_ARG,
+               "NEG-26.4: handshake_batch(null session entry) -> NULL_ARG");
+    CHECK_OK(ufsecp_bip324_handshake_batch(ctx, nullptr, nullptr, 0, nullptr, nullptr),
+             "NEG-26.5: handshake_batch(count=0) -> OK (empty batch)");
+    CHECK_CODE(ufsecp_bip324_handshake_batch(ctx, ours, peer_ell, kOverMax, ids, ok), UFSECP_ERR_BAD_INPUT,
+               "NEG-26.6: handshake_batch(count > kMaxBatchN) -> BAD_INPUT");
+
+    // Valid batch (smoke): both sessions established.
+    CHECK(ufsecp_bip324_handshake_batch(ctx, ours, peer_ell, 2, ids, ok) == UFSECP_OK &&
+          ok[0] == 1 && ok[1] == 1, "NEG-26.7: handshake_batch valid -> OK");
+
+    // Already-established sessions are rejected; failed rows are zeroed.
+    ok[0] = ok[1] = 9;
+    CHECK_CODE(ufsecp_bip324_handshake_batch(ctx, ours, peer_ell, 2, ids, ok), UFSECP_ERR_INTERNAL,
+               "NEG-26.8: handshake_batch(reused sessions) -> INTERNAL");
+    bool zero_ids = true;
+    for (uint8_t b : ids) zero_ids = zero_ids && b == 0;
+    CHECK(ok[0] == 0 && ok[1] == 0 && zero_ids,
+          "NEG-26.9: failed handshakes report ok=0 and zero session ids");
+
+    // Hostile all-0xFF peer encoding: handled exactly like the single call.
+    ufsecp_bip324_session* a = nullptr;
+    ufsecp_bip324_session* b = nullptr;
+    uint8_t ell_a[64], ell_b[64], bad_ell[64];
+    std::memset(bad_ell, 0xFF, sizeof(bad_ell));
+    if (ufsecp_bip324_create(ctx, 0, &a, ell_a) == UFSECP_OK &&
+        ufsecp_bip324_create(ctx, 0, &b, ell_b) == UFSECP_OK) {
+        ufsecp_error_t const single = ufsecp_bip324_handshake(a, bad_ell, nullptr);
+        ok[0] = 9;
+        ufsecp_error_t const batched = ufsecp_bip324_handshake_batch(ctx, &b, bad_ell, 1, nullptr, ok);
+        CHECK(single == batched && ok[0] == (batched == UFSECP_OK ? 1 : 0),
+              "NEG-26.10: handshake_batch(invalid 0xFF peer encoding) matches handshake()");
+    } else {
+        CHECK(false, "NEG-26.10: BIP-324 sessions for hostile-encoding case");
+    }
+    ufsecp_bip324_destroy(a);
+    ufsecp_bip324_destroy(b);
+
+    for (int i = 0; i < 2; ++i) {
+        ufsecp_bip324_destroy(peer[i]);
+        ufsecp_bip324_destroy(ours[i]);
+    }
+}
+#endif // SECP256K1_BIP324
+
+// ---------------------------------------------------------------------------
+// NEG-27: Batched GCS match (one query set, many filters)
+// ---------------------------------------------------------------------------
+
+static void run_neg27_gcs_match_any_batch(ufsecp_ctx* ctx) {
+    uint8_t keys[2 * 16] = {};
+    keys[16] = 0x01;
+    uint8_t item1[] = { 0x01, 0x02 };
+    uint8_t item2[] = { 0x03, 0x04, 0x05 };
+    const uint8_t* items[] = { item1 };
+    size_t sizes[] = { sizeof(item1) };
+    uint8_t filter0[64], filter1[64];
+    size_t flen[2] = { sizeof(filter0), sizeof(filter1) };
+    bool const built = ufsecp_gcs_build(keys, items, sizes, 1, filter0, &flen[0]) == UFSECP_OK &&
+                       ufsecp_gcs_build(keys + 16, items, sizes, 1, filter1, &flen[1]) == UFSECP_OK;
+    CHECK(built, "NEG-27.0: gcs_build for fixture");
+    if (!built) return;
+
+    const uint8_t* filters[] = { filter0, filter1 };
+    size_t n_items[] = { 1, 1 };
+    const uint8_t* query[] = { item2, item1 };
+    size_t query_sizes[] = { sizeof(item2), sizeof(item1) };
+    uint8_t matches[2] = { 9, 9 };
+
+    CHECK_CODE(ufsecp_gcs_match_any_batch(nullptr, keys, filters, flen, n_items, 2,
+                                          query, query_sizes, 2, matches), UFSECP_ERR_NULL_ARG,
+               "NEG-27.1: gcs_match_any_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_match_any_batch(ctx, nullptr, filters, flen, n_items, 2,
+                                          query, query_sizes, 2, matches), UFSECP_ERR_NULL_ARG,
+               "NEG-27.2: gcs_match_any_batch(null keys) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_match_any_batch(ctx, keys, nullptr, flen, n_items, 2,
+                                          query, query_sizes, 2, matches), UFSECP_ERR_NULL_ARG,
+               "NEG-27.3: gcs_match_any_batch(null filters) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_match_any_batch(ctx, keys, filters, flen, n_items, 2,
+                                          query, query_sizes, 2, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-27.4: gcs_match_any_batch(null matches_out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_match_any_batch(ctx, keys, filters, flen, n_items, 2,
+                                          nullptr, query_sizes, 2, matches), UFSECP_ERR_NULL_ARG,
+               "NEG-27.5: gcs_match_any_batch(null query, query_count=2) -> NULL_ARG");
+    const uint8_t* with_null[] = { filter0, nullptr };
+    CHECK_CODE(ufsecp_gcs_match_any_batch(ctx, keys, with_null, flen, n_items, 2,
+                                          query, query_sizes, 2, matches), UFSECP_ERR_NULL_ARG,
+               "NEG-27.6: gcs_match_any_batch(null filter entry) -> NULL_ARG");
+    CHECK_OK(ufsecp_gcs_match_any_batch(ctx, nullptr, nullptr, nullptr, nullptr, 0,
+                                        nullptr, nullptr, 0, nullptr),
+             "NEG-27.7: gcs_match_any_batch(zero filter_count) -> OK (empty batch)");
+
+    // Valid batch (smoke): item1 is in both filters, an empty query in none.
+    CHECK(ufsecp_gcs_match_any_batch(ctx, keys, filters, flen, n_items, 2,
+                                     query, query_sizes, 2, matches) == UFSECP_OK &&
+          matches[0] == 1 && matches[1] == 1, "NEG-27.8: gcs_match_any_batch valid -> both match");
+    matches[0] = matches[1] = 9;
+    CHECK(ufsecp_gcs_match_any_batch(ctx, keys, filters, flen, n_items, 2,
+                                     nullptr, nullptr, 0, matches) == UFSECP_OK &&
+          matches[0] == 0 && matches[1] == 0, "NEG-27.9: gcs_match_any_batch(zero query_count) -> no match");
+
+    // Truncated filter: reported as BAD_INPUT with its matches_out entry 0.
+    size_t short_len[2] = { flen[0], 0 };
+    size_t many[2] = { 1, 1000 };
+    matches[0] = matches[1] = 9;
+    CHECK_CODE(ufsecp_gcs_match_any_batch(ctx, keys, filters, short_len, many, 2,
+                                          query, query_sizes, 2, matches), UFSECP_ERR_BAD_INPUT,
+               "NEG-27.10: gcs_match_any_batch(truncated filter) -> BAD_INPUT");
+    CHECK(matches[0] == 1 && matches[1] == 0,
+          "NEG-27.11: truncated filter reports no match, the others are still answered");
+}
+
+// ---------------------------------------------------------------------------
+// NEG-28: Batched GCS filter construction
+// ---------------------------------------------------------------------------
+
+static void run_neg28_gcs_build_batch(ufsecp_ctx* ctx) {
+    uint8_t keys[2 * 16] = {};
+    keys[16] = 0x01;
+    uint8_t item1[] = { 0x01, 0x02 };
+    uint8_t item2[] = { 0x03, 0x04, 0x05 };
+    uint8_t item3[] = { 0x06 };
+    const uint8_t* items[] = { item1, item2, item3 };
+    size_t sizes[] = { sizeof(item1), sizeof(item2), sizeof(item3) };
+    size_t counts[] = { 1, 2 };
+    constexpr size_t kStride = 64;
+    uint8_t filters[2 * kStride];
+    size_t lens[2] = {};
+
+    CHECK_CODE(ufsecp_gcs_build_batch(nullptr, keys, items, sizes, counts, 2,
+                                      filters, kStride, lens), UFSECP_ERR_NULL_ARG,
+               "NEG-28.1: gcs_build_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, nullptr, items, sizes, counts, 2,
+                                      filters, kStride, lens), UFSECP_ERR_NULL_ARG,
+               "NEG-28.2: gcs_build_batch(null keys) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, keys, nullptr, sizes, counts, 2,
+                                      filters, kStride, lens), UFSECP_ERR_NULL_ARG,
+               "NEG-28.3: gcs_build_batch(null items, n=3) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, keys, items, nullptr, counts, 2,
+                                      filters, kStride, lens), UFSECP_ERR_NULL_ARG,
+               "NEG-28.4: gcs_build_batch(null item sizes, n=3) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, keys, items, sizes, nullptr, 2,
+                                      filters, kStride, lens), UFSECP_ERR_NULL_ARG,
+               "NEG-28.5: gcs_build_batch(null item_counts) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, keys, items, sizes, counts, 2,
+                                      nullptr, kStride, lens), UFSECP_ERR_NULL_ARG,
+               "NEG-28.6: gcs_build_batch(null filters_out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, keys, items, sizes, counts, 2,
+                                      filters, kStride, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-28.7: gcs_build_batch(null filter_lens_out) -> NULL_ARG");
+    CHECK_OK(ufsecp_gcs_build_batch(ctx, nullptr, nullptr, nullptr, nullptr, 0,
+                                    nullptr, 0, nullptr),
+             "NEG-28.8: gcs_build_batch(zero filter_count) -> OK (empty batch)");
+    size_t empty[] = { 0, 0 };
+    uint8_t empty_filter[kStride];
+    size_t empty_len = sizeof(empty_filter);
+    CHECK(ufsecp_gcs_build(keys, nullptr, nullptr, 0, empty_filter, &empty_len) == UFSECP_OK &&
+          ufsecp_gcs_build_batch(ctx, keys, nullptr, nullptr, empty, 2,
+                                 filters, kStride, lens) == UFSECP_OK &&
+          lens[0] == empty_len && lens[1] == empty_len,
+          "NEG-28.9: gcs_build_batch(null items, zero item counts) -> OK, empty filters");
+    size_t overflow[] = { 1, SIZE_MAX };
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, keys, items, sizes, overflow, 2,
+                                      filters, kStride, lens), UFSECP_ERR_BAD_INPUT,
+               "NEG-28.10: gcs_build_batch(item count overflow) -> BAD_INPUT");
+
+    // Valid batch (smoke): byte-identical to per-filter ufsecp_gcs_build().
+    uint8_t one[kStride];
+    size_t one_len = sizeof(one);
+    bool same = ufsecp_gcs_build_batch(ctx, keys, items, sizes, counts, 2,
+                                       filters, kStride, lens) == UFSECP_OK;
+    same = same && ufsecp_gcs_build(keys + 16, items + 1, sizes + 1, 2, one, &one_len) == UFSECP_OK;
+    same = same && lens[1] == one_len && std::memcmp(filters + kStride, one, one_len) == 0;
+    CHECK(same, "NEG-28.11: gcs_build_batch valid -> matches gcs_build");
+
+    // Stride too small: BUF_TOO_SMALL, with the needed size still reported.
+    CHECK_CODE(ufsecp_gcs_build_batch(ctx, keys, items, sizes, counts, 2,
+                                      filters, 1, lens), UFSECP_ERR_BUF_TOO_SMALL,
+               "NEG-28.12: gcs_build_batch(filter_stride too small) -> BUF_TOO_SMALL");
+    CHECK(lens[1] == one_len, "NEG-28.13: BUF_TOO_SMALL still reports the encoded size");
+}
+
+// ---------------------------------------------------------------------------
+// NEG-29: Batched compressed public key parsing
+// ---------------------------------------------------------------------------
+
+static void run_neg29_pubkey_parse_batch(ufsecp_ctx* ctx, const uint8_t* pubkey33) {
+    constexpr size_t kOverMax = (size_t{1} << 20) + 1;  // kMaxBatchN + 1
+    uint8_t keys[3 * 33];
+    std::memcpy(keys, pubkey33, 33);
+    std::memcpy(keys + 33, ZERO_PUBKEY33, 33);
+    std::memcpy(keys + 66, pubkey33, 33);
+    keys[66] = 0x04;  // bad prefix for a 33-byte key
+    uint8_t valid[3] = { 9, 9, 9 };
+    uint8_t xs[3 * 32], ys[3 * 32];
+
+    CHECK_CODE(ufsecp_pubkey_parse_batch(nullptr, keys, 3, valid, xs, ys), UFSECP_ERR_NULL_ARG,
+               "NEG-29.1: pubkey_parse_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_pubkey_parse_batch(ctx, nullptr, 3, valid, xs, ys), UFSECP_ERR_NULL_ARG,
+               "NEG-29.2: pubkey_parse_batch(null keys, n=3) -> NULL_ARG");
+    CHECK_CODE(ufsecp_pubkey_parse_batch(ctx, keys, 3, nullptr, xs, ys), UFSECP_ERR_NULL_ARG,
+               "NEG-29.3: pubkey_parse_batch(null valid_out) -> NULL_ARG");
+    CHECK_OK(ufsecp_pubkey_parse_batch(ctx, nullptr, 0, nullptr, nullptr, nullptr),
+             "NEG-29.4: pubkey_parse_batch(zero count) -> OK (empty batch)");
+    CHECK_CODE(ufsecp_pubkey_parse_batch(ctx, keys, kOverMax, valid, xs, ys), UFSECP_ERR_BAD_INPUT,
+               "NEG-29.5: pubkey_parse_batch(count > kMaxBatchN) -> BAD_INPUT");
+
+    // Valid batch (smoke): per-key verdicts, zero coordinates for bad keys.
+    uint8_t x_ref[32];
+    bool ok = ufsecp_pubkey_parse_batch(ctx, keys, 3, valid, xs, ys) == UFSECP_OK;
+    CHECK(ok && valid[0] == 1 && valid[1] == 0 && valid[2] == 0,
+          "NEG-29.6: pubkey_parse_batch -> valid key 1, zero key and bad prefix 0");
+    std::memcpy(x_ref, pubkey33 + 1, 32);
+    bool zero_bad = true;
+    for (size_t i = 32; i < 3 * 32; ++i) zero_bad = zero_bad && xs[i] == 0 && ys[i] == 0;
+    CHECK(ok && std::memcmp(xs, x_ref, 32) == 0 && zero_bad,
+          "NEG-29.7: pubkey_parse_batch coordinates for valid key, zeros for invalid keys");
+    CHECK_OK(ufsecp_pubkey_parse_batch(ctx, keys, 3, valid, nullptr, nullptr),
+             "NEG-29.8: pubkey_parse_batch(null coordinate outputs) -> OK");
+}
+
+// ---------------------------------------------------------------------------
+// NEG-30: Batched Ethereum ecrecover
+// ---------------------------------------------------------------------------
+
+#ifdef SECP256K1_BUILD_ETHEREUM
+static void run_neg30_eth_ecrecover_batch(ufsecp_ctx* ctx) {
+    constexpr size_t kOverMax = (size_t{1} << 20) + 1;  // kMaxBatchN + 1
+    uint8_t msgs[2 * 32], rs[2 * 32], ss[2 * 32], addrs[2 * 20], addr_ref[20];
+    uint64_t vs[2] = {};
+    uint8_t valid[2] = { 9, 9 };
+    bool const signed_ok =
+        ufsecp_eth_sign(ctx, MSG32, VALID_KEY1, rs, ss, &vs[0], 1) == UFSECP_OK &&
+        ufsecp_eth_ecrecover(ctx, MSG32, rs, ss, vs[0], addr_ref) == UFSECP_OK;
+    CHECK(signed_ok, "NEG-30.0: eth_sign + eth_ecrecover for fixture");
+    if (!signed_ok) return;
+    std::memcpy(msgs, MSG32, 32);
+    std::memcpy(msgs + 32, MSG32, 32);
+    std::memcpy(rs + 32, rs, 32);
+    std::memcpy(ss + 32, ss, 32);
+    vs[1] = vs[0];
+
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(nullptr, msgs, rs, ss, vs, 2, addrs, valid), UFSECP_ERR_NULL_ARG,
+               "NEG-30.1: eth_ecrecover_batch(null_ctx) -> NULL_ARG");
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(ctx, nullptr, rs, ss, vs, 2, addrs, valid), UFSECP_ERR_NULL_ARG,
+               "NEG-30.2: eth_ecrecover_batch(null msgs) -> NULL_ARG");
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(ctx, msgs, nullptr, ss, vs, 2, addrs, valid), UFSECP_ERR_NULL_ARG,
+               "NEG-30.3: eth_ecrecover_batch(null r) -> NULL_ARG");
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(ctx, msgs, rs, nullptr, vs, 2, addrs, valid), UFSECP_ERR_NULL_ARG,
+               "NEG-30.4: eth_ecrecover_batch(null s) -> NULL_ARG");
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(ctx, msgs, rs, ss, nullptr, 2, addrs, valid), UFSECP_ERR_NULL_ARG,
+               "NEG-30.5: eth_ecrecover_batch(null v) -> NULL_ARG");
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(ctx, msgs, rs, ss, vs, 2, nullptr, valid), UFSECP_ERR_NULL_ARG,
+               "NEG-30.6: eth_ecrecover_batch(null addrs_out) -> NULL_ARG");
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(ctx, msgs, rs, ss, vs, 2, addrs, nullptr), UFSECP_ERR_NULL_ARG,
+               "NEG-30.7: eth_ecrecover_batch(null valid_out) -> NULL_ARG");
+    CHECK_OK(ufsecp_eth_ecrecover_batch(ctx, nullptr, nullptr, nullptr, nullptr, 0, nullptr, nullptr),
+             "NEG-30.8: eth_ecrecover_batch(zero count) -> OK (empty batch)");
+    CHECK_CODE(ufsecp_eth_ecrecover_batch(ctx, msgs, rs, ss, vs, kOverMax, addrs, valid),
+               UFSECP_ERR_BAD_INPUT, "NEG-30.9: eth_ecrecover_batch(count > kMaxBatchN) -> BAD_INPUT");
+
+    // Valid batch (smoke), then invalid rows: zero r, bad v.
+    CHECK(ufsecp_eth_ecrecover_batch(ctx, msgs, rs, ss, vs, 2, addrs, valid) == UFSECP_OK &&
+          valid[0] == 1 && valid[1] == 1 && std::memcmp(addrs, addr_ref, 20) == 0 &&
+          std::memcmp(addrs + 20, addr_ref, 20) == 0, "NEG-30.10: eth_ecrecover_batch valid -> OK");
+    std::memcpy(rs + 32, ZERO32, 32);
+    vs[0] = 5;
+    CHECK(ufsecp_eth_ecrecover_batch(ctx, msgs, rs, ss, vs, 2, addrs, valid) == UFSECP_OK &&
+          valid[0] == 0 && valid[1] == 0, "NEG-30.11: eth_ecrecover_batch(bad v, zero r) -> rows invalid");
+    bool zero_addrs = true;
+    for (uint8_t b : addrs) zero_addrs = zero_addrs && b == 0;
+    CHECK(zero_addrs, "NEG-30.12: invalid rows get zero addresses");
+}
+#endif // SECP256K1_BUILD_ETHEREUM
+
 // ---------------------------------------------------------------------------
 // Entry point
 // ---------------------------------------------------------------------------
@@ -1460,6 +2037,18 @@ int test_c_abi_negative_run() {
     run_neg20_zk_snark(f.ctx, f.pubkey33, f.xonly32);
     run_neg21_gpu();
     run_neg22_abi_version();
+    run_neg23_thread_pool(f.ctx, f.pubkey33);
+    run_neg24_ecdsa_batch_recoverable(f.ctx, f.pubkey33);
+#ifdef SECP256K1_BIP324
+    run_neg25_bip324_packets(f.ctx);
+    run_neg26_bip324_handshake_batch(f.ctx);
+#endif
+    run_neg27_gcs_match_any_batch(f.ctx);
+    run_neg28_gcs_build_batch(f.ctx);
+    run_neg29_pubkey_parse_batch(f.ctx, f.pubkey33);
+#ifdef SECP256K1_BUILD_ETHEREUM
+    run_neg30_eth_ecrecover_batch(f.ctx);
+#endif
 
     printf("[test_c_abi_negative] %d/%d checks passed\n",
            g_pass, g_pass + g_fail);
@@ -7,8 +7,12 @@
 //
 // API:
 //   ufsecp_gcs_build(key16, data**, data_sizes*, count, filter_out, filter_len)
+//   ufsecp_gcs_build_batch(ctx, keys16, data**, data_sizes*, item_counts*, filter_count,
+//                          filters_out, filter_stride, filter_lens_out)
 //   ufsecp_gcs_match(key16, filter, filter_len, n_items, item, item_len)
 //   ufsecp_gcs_match_any(key16, filter, filter_len, n_items, query**, query_sizes*, count)
+//   ufsecp_gcs_match_any_batch(ctx, keys16, filters**, filter_lens*, n_items*, filter_count,
+//                              query**, query_sizes*, count, matches_out)
 //
 // TESTS:
 //
@@ -26,10 +30,19 @@
 //
 // 7. NULL argument handling returns appropriate error codes.
 //
+// 8. The streaming decoder finds every member of a 3000-element filter,
+//    agrees between match and match_any, and reports truncation only when
+//    the answer lies past the end of the stream.
+//
+// 9. ufsecp_gcs_match_any_batch agrees with per-filter match_any.
+//
+// 10. ufsecp_gcs_build_batch output is byte-identical to ufsecp_gcs_build.
+//
 // ============================================================================
 
 #include <cstdio>
 #include <cstdint>
+#include <algorithm>
 #include <cstring>
 #include <vector>
 #include <string>
@@ -308,6 +321,242 @@ static void test_null_handling() {
     check(rc == UFSECP_ERR_NULL_ARG, "match: NULL filter -> UFSECP_ERR_NULL_ARG");
 }
 
+// ============================================================================
+// Test 8: Streaming matcher on large filters and truncated streams
+// ============================================================================
+static std::vector<std::string> numbered_items(const char* prefix, size_t n) {
+    std::vector<std::string> out;
+    out.reserve(n);
+    for (size_t i = 0; i < n; ++i) out.push_back(std::string(prefix) + std::to_string(i));
+    return out;
+}
+
+static void ptr_view(const std::vector<std::string>& items,
+                     std::vector<const uint8_t*>& ptrs, std::vector<size_t>& sizes) {
+    ptrs.clear();
+    sizes.clear();
+    for (auto& s : items) {
+        ptrs.push_back((const uint8_t*)s.data());
+        sizes.push_back(s.size());
+    }
+}
+
+static void test_streaming_match() {
+    printf("[8] Streaming match on large and truncated filters\n");
+
+    std::vector<std::string> members = numbered_items("script_", 3000);
+    std::vector<uint8_t> filter;
+    check(build_filter(SIPHASH_KEY, members, filter) == UFSECP_OK, "3000-element filter built");
+
+    size_t found = 0;
+    for (auto& s : members) {
+        found += ufsecp_gcs_match(SIPHASH_KEY, filter.data(), filter.size(), members.size(),
+                                  (const uint8_t*)s.data(), s.size()) == UFSECP_OK;
+    }
+    check(found == members.size(), "every member found by the streaming decoder");
+
+    // match_any over singletons must agree with match, hit or miss
+    std::vector<std::string> probes = numbered_items("probe_", 500);
+    probes.push_back(members[0]);
+    probes.push_back(members[1499]);
+    probes.push_back(members[2999]);
+    bool agree = true;
+    for (auto& s : probes) {
+        const uint8_t* p = (const uint8_t*)s.data();
+        size_t len = s.size();
+        ufsecp_error_t one = ufsecp_gcs_match(SIPHASH_KEY, filter.data(), filter.size(),
+                                              members.size(), p, len);
+        ufsecp_error_t any = ufsecp_gcs_match_any(SIPHASH_KEY, filter.data(), filter.size(),
+                                                  members.size(), &p, &len, 1);
+        agree = agree && one == any;
+    }
+    check(agree, "match_any({x}) == match(x) for 503 probes");
+
+    std::vector<const uint8_t*> ptrs;
+    std::vector<size_t> sizes;
+    std::vector<std::string> wallet = numbered_items("wallet_", 10000);
+    ptr_view(wallet, ptrs, sizes);
+    check(ufsecp_gcs_match_any(SIPHASH_KEY, filter.data(), filter.size(), members.size(),
+                               ptrs.data(), sizes.data(), ptrs.size()) == UFSECP_ERR_NOT_FOUND,
+          "10k-item query set with no member -> NOT_FOUND");
+    wallet[7777] = members[2999];
+    ptr_view(wallet, ptrs, sizes);
+    check(ufsecp_gcs_match_any(SIPHASH_KEY, filter.data(), filter.size(), members.size(),
+                               ptrs.data(), sizes.data(), ptrs.size()) == UFSECP_OK,
+          "10k-item query set with one member -> OK");
+
+    // Cut the stream in half: members late in the set can no longer be
+    // resolved, members early in the set still can.
+    size_t const half = filter.size() / 2;
+    size_t ok = 0, bad = 0;
+    for (auto& s : members) {
+        ufsecp_error_t rc = ufsecp_gcs_match(SIPHASH_KEY, filter.data(), half, members.size(),
+                                             (const uint8_t*)s.data(), s.size());
+        ok  += rc == UFSECP_OK;
+        bad += rc == UFSECP_ERR_BAD_INPUT;
+    }
+    check(ok > 0 && bad > 0 && ok + bad == members.size(),
+          "truncated filter: early members found, late members BAD_INPUT");
+    wallet[7777] = "wallet_7777";
+    ptr_view(wallet, ptrs, sizes);
+    check(ufsecp_gcs_match_any(SIPHASH_KEY, filter.data(), half, members.size(),
+                               ptrs.data(), sizes.data(), ptrs.size()) == UFSECP_ERR_BAD_INPUT,
+          "truncated filter with no hit -> BAD_INPUT");
+}
+
+// ============================================================================
+// Test 9: ufsecp_gcs_match_any_batch agrees with ufsecp_gcs_match_any
+// ============================================================================
+static void test_match_any_batch() {
+    printf("[9] ufsecp_gcs_match_any_batch matches per-filter match_any\n");
+
+    ufsecp_ctx* ctx = nullptr;
+    check(ufsecp_ctx_create(&ctx) == UFSECP_OK && ctx != nullptr, "context created");
+    if (!ctx) return;
+
+    std::vector<std::string> wallet = numbered_items("wallet_", 1000);
+    std::vector<const uint8_t*> q_ptrs;
+    std::vector<size_t> q_sizes;
+    ptr_view(wallet, q_ptrs, q_sizes);
+
+    // 40 "blocks"; every 5th contains a wallet script, pairs of blocks share
+    // a key so the hashed query set is reused.
+    constexpr size_t kFilters = 40;
+    std::vector<std::vector<uint8_t>> filters(kFilters);
+    std::vector<uint8_t> keys(16 * kFilters);
+    std::vector<const uint8_t*> f_ptrs(kFilters);
+    std::vector<size_t> f_lens(kFilters), f_items(kFilters);
+    for (size_t i = 0; i < kFilters; ++i) {
+        uint8_t* key = keys.data() + 16 * i;
+        std::memcpy(key, SIPHASH_KEY, 16);
+        key[0] = static_cast<uint8_t>(i / 2);
+        std::vector<std::string> items = numbered_items(("blk" + std::to_string(i) + "_").c_str(),
+                                                        100 + 37 * i);
+        if (i % 5 == 0) items[i % items.size()] = wallet[(i * 131) % wallet.size()];
+        build_filter(key, items, filters[i]);
+        f_ptrs[i]  = filters[i].data();
+        f_lens[i]  = filters[i].size();
+        f_items[i] = items.size();
+    }
+
+    std::vector<uint8_t> matches(kFilters, 0xEE);
+    ufsecp_error_t rc = ufsecp_gcs_match_any_batch(
+        ctx, keys.data(), f_ptrs.data(), f_lens.data(), f_items.data(), kFilters,
+        q_ptrs.data(), q_sizes.data(), q_ptrs.size(), matches.data());
+    check(rc == UFSECP_OK, "batch over 40 filters returns OK");
+
+    bool agree = true, planted = true;
+    for (size_t i = 0; i < kFilters; ++i) {
+        ufsecp_error_t one = ufsecp_gcs_match_any(
+            keys.data() + 16 * i, f_ptrs[i], f_lens[i], f_items[i],
+            q_ptrs.data(), q_sizes.data(), q_ptrs.size());
+        agree = agree && matches[i] == (one == UFSECP_OK ? 1 : 0);
+        if (i % 5 == 0) planted = planted && matches[i] == 1;
+    }
+    check(agree, "batch result == match_any for every filter");
+    check(planted, "every filter holding a wallet script matches");
+
+    // A truncated filter is reported; the others are still answered.
+    f_lens[3] = 1;
+    std::fill(matches.begin(), matches.end(), 0xEE);
+    rc = ufsecp_gcs_match_any_batch(
+        ctx, keys.data(), f_ptrs.data(), f_lens.data(), f_items.data(), kFilters,
+        q_ptrs.data(), q_sizes.data(), q_ptrs.size(), matches.data());
+    check(rc == UFSECP_ERR_BAD_INPUT && matches[3] == 0 && matches[0] == 1 && matches[5] == 1,
+          "truncated filter -> BAD_INPUT, other filters still matched");
+
+    f_ptrs[1] = nullptr;
+    check(ufsecp_gcs_match_any_batch(ctx, keys.data(), f_ptrs.data(), f_lens.data(), f_items.data(),
+                                     kFilters, q_ptrs.data(), q_sizes.data(), q_ptrs.size(),
+                                     matches.data()) == UFSECP_ERR_NULL_ARG,
+          "NULL filter entry -> UFSECP_ERR_NULL_ARG");
+    check(ufsecp_gcs_match_any_batch(nullptr, keys.data(), f_ptrs.data(), f_lens.data(), f_items.data(),
+                                     kFilters, q_ptrs.data(), q_sizes.data(), q_ptrs.size(),
+                                     matches.data()) == UFSECP_ERR_NULL_ARG,
+          "NULL ctx -> UFSECP_ERR_NULL_ARG");
+    check(ufsecp_gcs_match_any_batch(ctx, nullptr, nullptr, nullptr, nullptr, 0,
+                                     nullptr, nullptr, 0, nullptr) == UFSECP_OK,
+          "filter_count 0 -> OK");
+
+    ufsecp_ctx_destroy(ctx);
+}
+
+// ============================================================================
+// Test 10: ufsecp_gcs_build_batch is byte-identical to ufsecp_gcs_build
+// ============================================================================
+static void test_build_batch() {
+    printf("[10] ufsecp_gcs_build_batch matches per-filter ufsecp_gcs_build\n");
+
+    ufsecp_ctx* ctx = nullptr;
+    check(ufsecp_ctx_create(&ctx) == UFSECP_OK && ctx != nullptr, "context created");
+    if (!ctx) return;
+
+    // 24 blocks of 0..~2300 items (empty, std::sort and radix-sort sizes)
+    constexpr size_t kFilters = 24;
+    std::vector<std::string> all;
+    std::vector<size_t> counts(kFilters);
+    std::vector<uint8_t> keys(16 * kFilters);
+    for (size_t i = 0; i < kFilters; ++i) {
+        std::memcpy(keys.data() + 16 * i, SIPHASH_KEY2, 16);
+        keys[16 * i + 15] = static_cast<uint8_t>(i);
+        counts[i] = (i * i * 4) % 2311;
+        std::vector<std::string> items = numbered_items(("b" + std::to_string(i) + "/").c_str(),
+                                                        counts[i]);
+        all.insert(all.end(), items.begin(), items.end());
+    }
+    std::vector<const uint8_t*> ptrs;
+    std::vector<size_t> sizes;
+    ptr_view(all, ptrs, sizes);
+
+    constexpr size_t kStride = 8192;
+    std::vector<uint8_t> out(kFilters * kStride);
+    std::vector<size_t> lens(kFilters);
+    ufsecp_error_t rc = ufsecp_gcs_build_batch(ctx, keys.data(), ptrs.data(), sizes.data(),
+                                               counts.data(), kFilters, out.data(), kStride,
+                                               lens.data());
+    check(rc == UFSECP_OK, "batch build of 24 filters returns OK");
+
+    bool same = true;
+    size_t first = 0, largest = 0;
+    for (size_t i = 0; i < kFilters; ++i) {
+        std::vector<uint8_t> single(kStride);
+        size_t len = single.size();
+        ufsecp_error_t src = ufsecp_gcs_build(keys.data() + 16 * i,
+                                              counts[i] ? ptrs.data() + first : nullptr,
+                                              counts[i] ? sizes.data() + first : nullptr,
+                                              counts[i], single.data(), &len);
+        same = same && src == UFSECP_OK && len == lens[i] &&
+               std::memcmp(single.data(), out.data() + i * kStride, len) == 0;
+        first += counts[i];
+        largest = std::max(largest, lens[i]);
+    }
+    check(same, "every batch filter == ufsecp_gcs_build output");
+
+    // Members of a batch-built filter are found by the streaming matcher.
+    size_t const last = kFilters - 1;
+    first = all.size() - counts[last];
+    size_t found = 0;
+    for (size_t j = first; j < all.size(); ++j) {
+        found += ufsecp_gcs_match(keys.data() + 16 * last, out.data() + last * kStride, lens[last],
+                                  counts[last], ptrs[j], sizes[j]) == UFSECP_OK;
+    }
+    check(found == counts[last], "all members of the last batch filter found");
+
+    std::vector<size_t> need(kFilters);
+    rc = ufsecp_gcs_build_batch(ctx, keys.data(), ptrs.data(), sizes.data(), counts.data(),
+                                kFilters, out.data(), largest - 1, need.data());
+    check(rc == UFSECP_ERR_BUF_TOO_SMALL && need == lens,
+          "stride below the largest filter -> BUF_TOO_SMALL with required sizes");
+    check(ufsecp_gcs_build_batch(nullptr, keys.data(), ptrs.data(), sizes.data(), counts.data(),
+                                 kFilters, out.data(), kStride, lens.data()) == UFSECP_ERR_NULL_ARG,
+          "NULL ctx -> UFSECP_ERR_NULL_ARG");
+    check(ufsecp_gcs_build_batch(ctx, keys.data(), nullptr, nullptr, counts.data(),
+                                 kFilters, out.data(), kStride, lens.data()) == UFSECP_ERR_NULL_ARG,
+          "NULL data with items -> UFSECP_ERR_NULL_ARG");
+
+    ufsecp_ctx_destroy(ctx);
+}
+
 int test_exploit_gcs_false_positive_run() {
     printf("====================================================================\n");
     printf("EXPLOIT PoC: BIP-158 GCS Filter False Positive and Correctness\n");
@@ -326,6 +575,12 @@ int test_exploit_gcs_false_positive_run() {
     test_empty_filter();
     printf("\n");
     test_null_handling();
+    printf("\n");
+    test_streaming_match();
+    printf("\n");
+    test_match_any_batch();
+    printf("\n");
+    test_build_batch();
 
     printf("\n====================================================================\n");
     printf("Result: %d passed, %d failed\n", g_pass, g_fail);
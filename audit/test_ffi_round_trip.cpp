@@ -1488,6 +1488,21 @@ static void test_ethereum_round_trip() {
     CHECK_OK(ufsecp_eth_ecrecover(ctx, msg32, r, s, v, recovered_addr), "eth_ecrecover");
     CHECK(std::memcmp(recovered_addr, eth_addr, 20) == 0, "ecrecover matches eth_address");
 
+    // Batch ecrecover: the signature twice, then with r = 0 in between
+    uint8_t msgs3[96], rs3[96], ss3[96], addrs3[60], valid3[3];
+    uint64_t const vs3[3] = {v, v, v};
+    for (int i = 0; i < 3; ++i) {
+        std::memcpy(msgs3 + i * 32, msg32, 32);
+        std::memcpy(rs3 + i * 32, r, 32);
+        std::memcpy(ss3 + i * 32, s, 32);
+    }
+    std::memset(rs3 + 32, 0, 32);
+    CHECK_OK(ufsecp_eth_ecrecover_batch(ctx, msgs3, rs3, ss3, vs3, 3, addrs3, valid3),
+             "eth_ecrecover_batch");
+    CHECK(valid3[0] == 1 && valid3[1] == 0 && valid3[2] == 1, "ecrecover_batch validity");
+    CHECK(std::memcmp(addrs3, eth_addr, 20) == 0 && std::memcmp(addrs3 + 40, eth_addr, 20) == 0 &&
+          std::memcmp(addrs3 + 20, zero20, 20) == 0, "ecrecover_batch addresses");
+
     ufsecp_ctx_destroy(ctx);
 }
 #endif
@@ -1373,14 +1373,10 @@ void ufsecp_lbtc_tagged_hash_batch(ufsecp_lbtc_ctrl* ctrl, const char* tag,
 
 /* ---------------------------------------------------------------------------
  * Batch full compressed-pubkey validation (prefix 0x02/0x03 + x<p + on-curve).
- * For CHECKSIG bulk pre-validation. PUBLIC data, variable-time, CPU-threaded;
+ * For CHECKSIG bulk pre-validation. PUBLIC data, variable-time; CPU path is
+ * ufsecp_pubkey_parse_batch per kChunk keys (ctx pool, lane-parallel sqrt);
  * GPU per-key kernel when the controller is GPU-bound (ufsecp_gpu_pubkey_validate).
  * ------------------------------------------------------------------------- */
-static inline bool lbtc_validate_pubkey_one(ufsecp_ctx* ctx, const uint8_t* pk33) {
-    uint8_t out[33];
-    return ufsecp_pubkey_parse(ctx, pk33, 33, out) == UFSECP_OK;
-}
-
 void ufsecp_lbtc_validate_pubkeys(ufsecp_lbtc_ctrl* ctrl,
                                   const uint8_t* keys, size_t n,
                                   size_t stride, uint8_t* results) {
@@ -1388,35 +1384,28 @@ void ufsecp_lbtc_validate_pubkeys(ufsecp_lbtc_ctrl* ctrl,
     std::memset(results, 0, n);
     if (!ctrl || !keys || stride < 33) return;
 
+    const uint8_t* contig = keys;
+    std::vector<uint8_t> packed;
+    if (stride != 33) {
+        packed.resize(n * 33);
+        for (size_t i = 0; i < n; ++i) std::memcpy(packed.data() + i*33, keys + i*stride, 33);
+        contig = packed.data();
+    }
+
 #ifdef UFSECP_LBTC_WITH_GPU
     if (ctrl->gpu) {
-        const uint8_t* contig = keys;
-        std::vector<uint8_t> packed;
-        if (stride != 33) {
-            packed.resize(n * 33);
-            for (size_t i = 0; i < n; ++i) std::memcpy(packed.data() + i*33, keys + i*stride, 33);
-            contig = packed.data();
-        }
         if (ufsecp_gpu_pubkey_validate(ctrl->gpu, contig, n, results) == UFSECP_OK) return;
         std::memset(results, 0, n);
     }
 #endif
 
-    unsigned T = std::thread::hardware_concurrency(); if (!T) T = 4;
-    if (n < 512) T = 1;
-    std::vector<std::thread> ths; ths.reserve(T);
-    const size_t per = (n + T - 1) / T;
-    for (unsigned t = 0; t < T; ++t) {
-        ths.emplace_back([&, t]() {
-            ufsecp_ctx* c = nullptr;
-            if (ufsecp_ctx_create(&c) != UFSECP_OK || !c) return;
-            const size_t lo = (size_t)t * per, hi = std::min(n, lo + per);
-            for (size_t i = lo; i < hi; ++i)
-                results[i] = lbtc_validate_pubkey_one(c, keys + i * stride) ? 1u : 0u;
-            ufsecp_ctx_destroy(c);
-        });
+    for (size_t base = 0; base < n; base += kChunk) {
+        const size_t cnt = std::min(kChunk, n - base);
+        if (ufsecp_pubkey_parse_batch(ctrl->cpu, contig + base * 33, cnt,
+                                      results + base, nullptr, nullptr) != UFSECP_OK) {
+            std::memset(results + base, 0, cnt);
+        }
     }
-    for (auto& th : ths) th.join();
 }
 
 /* ---------------------------------------------------------------------------
@@ -138,6 +138,58 @@ UFSECP_API size_t ufsecp_ctx_size(void);
 UFSECP_API ufsecp_error_t ufsecp_context_randomize(ufsecp_ctx*    ctx,
                                                     const uint8_t* seed32);
 
+/* ===========================================================================
+ * Thread pool (CPU batch entry points)
+ * ===========================================================================
+ * Batch APIs (sign_batch, batch_verify, batch_identify_invalid,
+ * pubkey_create_batch, hash160_pubkey_batch, silent_payment_scan_batch) run
+ * on a persistent work-stealing pool. Without configuration a process-wide
+ * pool of hardware_concurrency() threads is used. A pool can be shared by
+ * any number of contexts; at most one batch job runs on it at a time and a
+ * concurrent caller simply runs its batch on its own thread.
+ *
+ * Attaching/replacing a pool mutates ctx: do it before sharing ctx between
+ * threads. The calling thread always participates in the batch, so a pool
+ * of N threads starts N-1 background workers (N = 1 runs serially).
+ */
+
+/** Opaque thread pool handle. */
+typedef struct ufsecp_thread_pool ufsecp_thread_pool;
+
+/** Create a thread pool.
+ *  @param n_threads  total participants incl. the caller (0 = hardware
+ *                    concurrency; capped at 256).
+ *  @param cpu_ids    optional CPU ids; background worker i is pinned to
+ *                    cpu_ids[i % n_cpu_ids] (Linux only, ignored elsewhere).
+ *  @param n_cpu_ids  number of entries in cpu_ids (0 = no pinning).
+ *  @param pool_out   receives the new pool. */
+UFSECP_API ufsecp_error_t ufsecp_thread_pool_create(unsigned n_threads,
+                                                    const int* cpu_ids,
+                                                    size_t n_cpu_ids,
+                                                    ufsecp_thread_pool** pool_out);
+
+/** Release the handle. Contexts the pool is attached to keep it alive;
+ *  the workers exit when the last reference goes away. NULL is safe. */
+UFSECP_API void ufsecp_thread_pool_destroy(ufsecp_thread_pool* pool);
+
+/** Number of participants in the pool (0 for NULL). */
+UFSECP_API unsigned ufsecp_thread_pool_size(const ufsecp_thread_pool* pool);
+
+/** Attach pool to ctx (and to later clones of ctx).
+ *  NULL detaches and reverts to the process-wide pool. */
+UFSECP_API ufsecp_error_t ufsecp_ctx_set_thread_pool(ufsecp_ctx* ctx,
+                                                     const ufsecp_thread_pool* pool);
+
+/** Give ctx its own pool of n_threads (same parameters as
+ *  ufsecp_thread_pool_create). n_threads = 1 makes batch calls serial. */
+UFSECP_API ufsecp_error_t ufsecp_ctx_set_threads(ufsecp_ctx* ctx,
+                                                 unsigned n_threads,
+                                                 const int* cpu_ids,
+                                                 size_t n_cpu_ids);
+
+/** Number of threads batch calls on ctx will use (0 for NULL). */
+UFSECP_API unsigned ufsecp_ctx_threads(const ufsecp_ctx* ctx);
+
 /* ===========================================================================
  * Private key utilities
  * =========================================================================== */
@@ -188,6 +240,35 @@ UFSECP_API ufsecp_error_t ufsecp_pubkey_xonly(ufsecp_ctx* ctx,
                                               const uint8_t privkey[32],
                                               uint8_t xonly32_out[32]);
 
+/** Derive compressed public keys for a batch of private keys (CT path),
+ *  in parallel on the ctx thread pool.
+ *  Fail-closed: on any invalid key every output entry is zeroed.
+ *  @param count          number of keys (0 .. 2^20).
+ *  @param privkeys32     count * 32 bytes.
+ *  @param pubkeys33_out  count * 33 bytes. */
+UFSECP_API ufsecp_error_t ufsecp_pubkey_create_batch(ufsecp_ctx* ctx,
+                                                     size_t count,
+                                                     const uint8_t* privkeys32,
+                                                     uint8_t* pubkeys33_out);
+
+/** Parse and validate a batch of compressed public keys (0x02/0x03 prefix,
+ *  x < p, on the curve), in parallel on the ctx thread pool. The square
+ *  roots run through the multi-lane field kernel. Per-key result, not
+ *  fail-closed: valid_out[i] = 1 or 0, and for valid keys the affine
+ *  coordinates go to x32s_out / y32s_out (32-byte big-endian, zeros for
+ *  invalid keys). Either coordinate output may be NULL.
+ *  @param pubkeys33  count * 33 bytes.
+ *  @param count      number of keys (0 .. 2^20).
+ *  @param valid_out  count bytes.
+ *  @param x32s_out   count * 32 bytes or NULL.
+ *  @param y32s_out   count * 32 bytes or NULL. */
+UFSECP_API ufsecp_error_t ufsecp_pubkey_parse_batch(ufsecp_ctx* ctx,
+                                                    const uint8_t* pubkeys33,
+                                                    size_t count,
+                                                    uint8_t* valid_out,
+                                                    uint8_t* x32s_out,
+                                                    uint8_t* y32s_out);
+
 /* ===========================================================================
  * ECDSA (secp256k1, RFC 6979 deterministic nonce)
  * =========================================================================== */
@@ -404,6 +485,16 @@ UFSECP_API ufsecp_error_t ufsecp_sha256(const uint8_t* data, size_t len,
 UFSECP_API ufsecp_error_t ufsecp_hash160(const uint8_t* data, size_t len,
                                          uint8_t digest20_out[20]);
 
+/** Hash160 of count packed 33-byte compressed pubkeys (multi-lane SHA-256 /
+ *  RIPEMD-160, parallel on the ctx thread pool). Inputs are hashed as bytes;
+ *  they are not validated as curve points.
+ *  @param pubkeys33      count * 33 bytes.
+ *  @param digests20_out  count * 20 bytes. */
+UFSECP_API ufsecp_error_t ufsecp_hash160_pubkey_batch(ufsecp_ctx* ctx,
+                                                      const uint8_t* pubkeys33,
+                                                      size_t count,
+                                                      uint8_t* digests20_out);
+
 /** BIP-340 tagged hash. */
 UFSECP_API ufsecp_error_t ufsecp_tagged_hash(const char* tag,
                                              const uint8_t* data, size_t len,
@@ -764,6 +855,10 @@ UFSECP_API ufsecp_error_t ufsecp_bip39_to_entropy(ufsecp_ctx* ctx,
 
 /** Schnorr batch verify: verify N signatures in one call.
  *  Each entry: [32-byte xonly pubkey | 32-byte msg | 64-byte sig] = 128 bytes.
+ *  Checks one randomly weighted equation over all N signatures. Preprocessing
+ *  and the 2N-point multi-scalar multiplication are split across the ctx
+ *  thread pool (see ufsecp_ctx_set_threads); batches below a few thousand
+ *  signatures stay on the calling thread.
  *  Returns UFSECP_OK if ALL valid. */
 UFSECP_API ufsecp_error_t ufsecp_schnorr_batch_verify(
     ufsecp_ctx* ctx,
@@ -776,6 +871,17 @@ UFSECP_API ufsecp_error_t ufsecp_ecdsa_batch_verify(
     ufsecp_ctx* ctx,
     const uint8_t* entries, size_t n);
 
+/** ECDSA batch verify with recovery ids: one randomized multi-scalar
+ *  multiplication over the whole batch (Schnorr-like throughput).
+ *  Each entry: [32-byte msg | 33-byte pubkey | 64-byte sig | 1-byte recid]
+ *  = 130 bytes; recid is 0..3 as returned by ufsecp_ecdsa_sign_recoverable.
+ *  An entry is valid iff recovering (msg, sig, recid) yields pubkey, so a
+ *  correct signature carrying the wrong recid fails. Runs on the ctx pool.
+ *  Returns UFSECP_OK if ALL valid, UFSECP_ERR_BAD_SIG for recid > 3. */
+UFSECP_API ufsecp_error_t ufsecp_ecdsa_batch_verify_recoverable(
+    ufsecp_ctx* ctx,
+    const uint8_t* entries, size_t n);
+
 /** Schnorr batch identify invalid: returns indices of invalid sigs.
  *  invalid_out: caller-owned array of size_t.
  *  invalid_count: in = invalid_out capacity, out = total number of invalid entries. */
@@ -1463,6 +1569,25 @@ UFSECP_API ufsecp_error_t ufsecp_silent_payment_scan(
     uint8_t* found_privkeys_out,
     size_t* n_found);
 
+/** Scan a batch of BIP-352 tweak keys (index-server model) on the CPU.
+ *  Same computation and output as ufsecp_gpu_bip352_scan_batch:
+ *    shared   = scan_privkey x tweak_i
+ *    t_i      = tagged_hash("BIP0352/SharedSecret", compress(shared) || 0u32)
+ *    prefix_i = upper 64 bits (big-endian) of x(t_i*G + B_spend)
+ *  Compare prefix_i against the first 8 bytes of each output's x-only key.
+ *  Runs in parallel on the ctx thread pool. Not constant-time with respect
+ *  to scan_privkey (wallet scanning on a trusted host).
+ *  scan_privkey:    32-byte scan private key.
+ *  spend_pubkey33:  33-byte compressed spend public key (B_spend).
+ *  tweak_pubkeys33: n_tweaks x 33 bytes (input_hash * A_sum per tx).
+ *  prefix64_out:    n_tweaks x uint64_t; zeroed on any error. */
+UFSECP_API ufsecp_error_t ufsecp_silent_payment_scan_batch(
+    ufsecp_ctx* ctx,
+    const uint8_t scan_privkey[32],
+    const uint8_t spend_pubkey33[33],
+    const uint8_t* tweak_pubkeys33, size_t n_tweaks,
+    uint64_t* prefix64_out);
+
 /* ===========================================================================
  * ECIES (Elliptic Curve Integrated Encryption Scheme)
  * =========================================================================== */
@@ -1518,20 +1643,57 @@ UFSECP_API ufsecp_error_t ufsecp_bip324_handshake(
     const uint8_t peer_ellswift64[64],
     uint8_t session_id32_out[32]);
 
+/** Complete many BIP-324 handshakes at once (e.g. peers reconnecting after a
+ *  restart). sessions[i] takes the 64 bytes at peer_ellswift64s + 64*i. The
+ *  ECDH final inversions are shared across sessions and the work is spread
+ *  over the context's thread pool; results match ufsecp_bip324_handshake().
+ *  session_ids32_out: if non-NULL, count * 32 bytes; row i is the session ID
+ *                     of session i, or zeros if it failed.
+ *  ok_out:            if non-NULL, count bytes; 1 = established, 0 = failed.
+ *  count:             0 .. 2^20 (larger counts return UFSECP_ERR_BAD_INPUT).
+ *  Returns UFSECP_OK if every session was established, UFSECP_ERR_INTERNAL
+ *  if any failed (see ok_out), UFSECP_ERR_NULL_ARG for a NULL entry. */
+UFSECP_API ufsecp_error_t ufsecp_bip324_handshake_batch(
+    ufsecp_ctx* ctx,
+    ufsecp_bip324_session* const* sessions,
+    const uint8_t* peer_ellswift64s,
+    size_t count,
+    uint8_t* session_ids32_out,
+    uint8_t* ok_out);
+
 /** Encrypt a BIP-324 packet.
  *  plaintext: the message payload.
  *  out: buffer for encrypted output ([3B enc length][encrypted payload][16B tag]).
- *  out_len: in = buffer size, out = bytes written. Must be >= plaintext_len + 19. */
+ *  out_len: in = buffer size, out = bytes written. Must be >= plaintext_len + 19.
+ *  plaintext may be out + 3 (encrypt in place). */
 UFSECP_API ufsecp_error_t ufsecp_bip324_encrypt(
     ufsecp_bip324_session* session,
     const uint8_t* plaintext, size_t plaintext_len,
     uint8_t* out, size_t* out_len);
 
+/** One input segment for ufsecp_bip324_encrypt_v(). */
+typedef struct {
+    const uint8_t* data;
+    size_t len;
+} ufsecp_bip324_segment;
+
+/** Encrypt a BIP-324 packet whose payload is the concatenation of `parts`
+ *  (e.g. a message header and body), without concatenating them first.
+ *  A part may already sit at its final place in `out` (out + 3 + offset of
+ *  the part in the payload); it is then encrypted in place.
+ *  out_len: in = buffer size, out = bytes written. Must be >= payload + 19.
+ *  Returns UFSECP_ERR_BAD_INPUT if the payload exceeds 0xFFFFFF bytes. */
+UFSECP_API ufsecp_error_t ufsecp_bip324_encrypt_v(
+    ufsecp_bip324_session* session,
+    const ufsecp_bip324_segment* parts, size_t part_count,
+    uint8_t* out, size_t* out_len);
+
 /** Decrypt a BIP-324 packet.
  *  encrypted: the full encrypted packet ([3B header][payload][16B tag]).
  *  encrypted_len: total length of encrypted data.
  *  plaintext_out: buffer for decrypted payload.
- *  plaintext_len: in = buffer size, out = payload bytes written.
+ *  plaintext_len: in = buffer size (>= encrypted_len - 19), out = payload bytes written.
+ *  plaintext_out may be encrypted + 3 (decrypt in place).
  *  Returns UFSECP_OK on success, including valid zero-length payloads.
  *  Returns UFSECP_ERR_VERIFY_FAIL on authentication or integrity failure. */
 UFSECP_API ufsecp_error_t ufsecp_bip324_decrypt(
@@ -1539,6 +1701,15 @@ UFSECP_API ufsecp_error_t ufsecp_bip324_decrypt(
     const uint8_t* encrypted, size_t encrypted_len,
     uint8_t* plaintext_out, size_t* plaintext_len);
 
+/** Decrypt a BIP-324 packet in the caller's buffer, without copying.
+ *  packet: the full encrypted packet ([3B header][payload][16B tag]).
+ *  On success the payload is at packet + 3 and *payload_len_out holds its size.
+ *  Returns UFSECP_ERR_VERIFY_FAIL on authentication or integrity failure. */
+UFSECP_API ufsecp_error_t ufsecp_bip324_decrypt_in_place(
+    ufsecp_bip324_session* session,
+    uint8_t* packet, size_t packet_len,
+    size_t* payload_len_out);
+
 /** Destroy a BIP-324 session and securely erase key material. */
 UFSECP_API void ufsecp_bip324_destroy(ufsecp_bip324_session* session);
 
@@ -1641,6 +1812,25 @@ UFSECP_API ufsecp_error_t ufsecp_eth_ecrecover(ufsecp_ctx* ctx,
                                                uint64_t v,
                                                uint8_t addr20_out[20]);
 
+/** Batch ecrecover on the ctx thread pool (shared scalar and field inversions,
+ *  batched square roots, 4-way Keccak-256). Per-entry result, not fail-closed:
+ *  valid_out[i] = 1 and addrs20_out + 20*i = the address, or 0 and zeros.
+ *  Each entry gives the same result as ufsecp_eth_ecrecover.
+ *  @param msgs32       count * 32 bytes.
+ *  @param rs32, ss32   count * 32 bytes each.
+ *  @param vs           count v values (27/28 or EIP-155).
+ *  @param count        number of signatures (0 .. 2^20).
+ *  @param addrs20_out  count * 20 bytes.
+ *  @param valid_out    count bytes. */
+UFSECP_API ufsecp_error_t ufsecp_eth_ecrecover_batch(ufsecp_ctx* ctx,
+                                                     const uint8_t* msgs32,
+                                                     const uint8_t* rs32,
+                                                     const uint8_t* ss32,
+                                                     const uint64_t* vs,
+                                                     size_t count,
+                                                     uint8_t* addrs20_out,
+                                                     uint8_t* valid_out);
+
 #endif /* SECP256K1_BUILD_ETHEREUM */
 
 /* ===========================================================================
@@ -1741,8 +1931,29 @@ UFSECP_API ufsecp_error_t ufsecp_gcs_build(
     const uint8_t** data, const size_t* data_sizes, size_t count,
     uint8_t* filter_out, size_t* filter_len);
 
+/** Build many BIP-158 filters at once (e.g. an indexer walking the chain).
+ *  Filter i is keyed by the 16 bytes at keys16 + 16*i and encodes the next
+ *  item_counts[i] entries of data / data_sizes (items of all filters laid
+ *  out back to back, filter 0 first). Filters are built concurrently on the
+ *  context's thread pool; each is byte-identical to ufsecp_gcs_build().
+ *  filters_out:     filter_count * filter_stride bytes; filter i is written
+ *                   at filters_out + i * filter_stride.
+ *  filter_lens_out: filter_count sizes; entry i is the encoded size of
+ *                   filter i, also when it did not fit.
+ *  Returns UFSECP_OK, or UFSECP_ERR_BUF_TOO_SMALL if any filter exceeds
+ *  filter_stride (that filter's slot is left unwritten). */
+UFSECP_API ufsecp_error_t ufsecp_gcs_build_batch(
+    ufsecp_ctx* ctx,
+    const uint8_t* keys16,
+    const uint8_t** data, const size_t* data_sizes,
+    const size_t* item_counts, size_t filter_count,
+    uint8_t* filters_out, size_t filter_stride,
+    size_t* filter_lens_out);
+
 /** Test if a single item is in the filter.
- *  Returns UFSECP_OK if item is in filter, UFSECP_ERR_NOT_FOUND if not. */
+ *  The filter is decoded only up to the item's position.
+ *  Returns UFSECP_OK if item is in filter, UFSECP_ERR_NOT_FOUND if not,
+ *  UFSECP_ERR_BAD_INPUT if the filter ends before that position. */
 UFSECP_API ufsecp_error_t ufsecp_gcs_match(
     const uint8_t key[16],
     const uint8_t* filter, size_t filter_len,
@@ -1750,6 +1961,8 @@ UFSECP_API ufsecp_error_t ufsecp_gcs_match(
     const uint8_t* item, size_t item_len);
 
 /** Test if any of the query items is in the filter (OR match).
+ *  The query hashes are sorted and merge-joined against the lazily decoded
+ *  filter, stopping at the first hit.
  *  Returns UFSECP_OK if any item matches. */
 UFSECP_API ufsecp_error_t ufsecp_gcs_match_any(
     const uint8_t key[16],
@@ -1757,6 +1970,23 @@ UFSECP_API ufsecp_error_t ufsecp_gcs_match_any(
     size_t n_items,
     const uint8_t** query, const size_t* query_sizes, size_t query_count);
 
+/** Match one query set against many filters (light-client rescan).
+ *  Filter i is filters[i] (filter_lens[i] bytes, n_items[i] elements) under
+ *  the 16-byte key at keys16 + 16*i. Filters are decoded lazily and
+ *  merge-joined against the query set, hashed and sorted once per distinct
+ *  run of keys, and spread over the context's thread pool. Each filter stops
+ *  at its first hit.
+ *  matches_out: filter_count bytes; 1 = some query item matches filter i.
+ *  Returns UFSECP_OK, or UFSECP_ERR_BAD_INPUT if any filter ended before its
+ *  answer was known (its matches_out entry is 0). */
+UFSECP_API ufsecp_error_t ufsecp_gcs_match_any_batch(
+    ufsecp_ctx* ctx,
+    const uint8_t* keys16,
+    const uint8_t* const* filters, const size_t* filter_lens,
+    const size_t* n_items, size_t filter_count,
+    const uint8_t** query, const size_t* query_sizes, size_t query_count,
+    uint8_t* matches_out);
+
 /* ===========================================================================
  * BIP-174/370 — PSBT Signing Helpers
  * =========================================================================== */
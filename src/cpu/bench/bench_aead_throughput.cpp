@@ -0,0 +1,110 @@
+// ============================================================================
+// bench_aead_throughput.cpp -- ChaCha20-Poly1305 bulk throughput (GB/s)
+// ============================================================================
+// Payload sizes from a BIP-324 control message (64 B) up to 1 MiB, for:
+//
+//   chacha   chacha20_crypt() (multi-block keystream kernels)
+//   poly     poly1305_mac()
+//   aead     aead_chacha20_poly1305_encrypt()
+//   bip324   Bip324Session::encrypt_into() (AEAD + 3-byte length)
+//
+// The kernels picked at runtime are printed first.
+//
+//   bench_aead_throughput            64 B .. 1 MiB
+//   bench_aead_throughput --quick    64 B .. 64 KiB
+// ============================================================================
+
+#include "secp256k1/benchmark_harness.hpp"
+#include "secp256k1/bip324.hpp"
+#include "secp256k1/chacha20_poly1305.hpp"
+#include "secp256k1/hash_accel.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace secp256k1;
+
+namespace {
+
+const std::uint8_t KEY[32] = {
+    0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+    0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
+    0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,
+    0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f
+};
+const std::uint8_t NONCE[12] = {0, 0, 0, 9, 0, 0, 0, 0x4a, 0, 0, 0, 0};
+
+// Best-of-passes GB/s for `bytes` per call; ~20 MB of work per pass.
+template <typename Func>
+double gbps(std::size_t bytes, Func&& func) {
+    std::size_t const iters = std::max<std::size_t>(1, (std::size_t{20} << 20) / bytes);
+    double best_ns = 0.0;
+    for (int pass = 0; pass < 5; ++pass) {
+        std::uint64_t const t0 = bench::Timer::now();
+        for (std::size_t i = 0; i < iters; ++i) func();
+        bench::ClobberMemory();
+        double const ns = bench::Timer::ticks_to_ns(bench::Timer::now() - t0);
+        if (pass == 0 || ns < best_ns) best_ns = ns;
+    }
+    return static_cast<double>(bytes * iters) / best_ns;
+}
+
+const char* chacha_kernel() {
+    if (hash::avx512_available()) return "16-block AVX-512";
+    if (hash::avx2_available())   return "8-block AVX2";
+#if defined(__x86_64__) || defined(_M_X64)
+    return "4-block SSE2";
+#else
+    return "1-block";
+#endif
+}
+
+const char* poly_kernel() {
+    return hash::avx2_available() ? "4-way AVX2 (2^26 radix)" : "scalar";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool const quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+    bench::pin_thread_and_elevate();
+
+    std::printf("ChaCha20-Poly1305 throughput (single thread, GB/s)\n");
+    std::printf("  Timer:    %s\n", bench::Timer::timer_name());
+    std::printf("  ChaCha20: %s\n", chacha_kernel());
+    std::printf("  Poly1305: %s\n\n", poly_kernel());
+    std::printf("  %8s  %7s  %7s  %7s  %7s\n",
+                "bytes", "chacha", "poly", "aead", "bip324");
+
+    Bip324Session a(true), b(false);
+    b.complete_handshake(a.our_ellswift_encoding().data());
+    a.complete_handshake(b.our_ellswift_encoding().data());
+
+    std::size_t const max_len = quick ? (std::size_t{1} << 16) : (std::size_t{1} << 20);
+    std::vector<std::uint8_t> buf(max_len), out(max_len + Bip324Cipher::kPacketOverhead);
+    for (std::size_t i = 0; i < buf.size(); ++i) buf[i] = static_cast<std::uint8_t>(i * 7);
+
+    for (std::size_t len = 64; len <= max_len; len *= 4) {
+        double const chacha = gbps(len, [&] {
+            chacha20_crypt(KEY, NONCE, 1, buf.data(), len);
+        });
+        double const poly = gbps(len, [&] {
+            auto tag = poly1305_mac(KEY, buf.data(), len);
+            bench::DoNotOptimize(tag);
+        });
+        double const aead = gbps(len, [&] {
+            std::uint8_t tag[16];
+            aead_chacha20_poly1305_encrypt(KEY, NONCE, nullptr, 0, buf.data(), len, out.data(), tag);
+            bench::DoNotOptimize(tag);
+        });
+        double const bip324 = gbps(len, [&] {
+            std::size_t const n = a.encrypt_into(buf.data(), len, out.data(), out.size());
+            bench::DoNotOptimize(n);
+        });
+        std::printf("  %8zu  %7.2f  %7.2f  %7.2f  %7.2f\n",
+                    len, chacha, poly, aead, bip324);
+    }
+    return 0;
+}
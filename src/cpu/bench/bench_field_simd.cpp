@@ -0,0 +1,137 @@
+// ============================================================================
+// bench_field_simd.cpp -- lane-parallel field / point kernels, ops/s per core
+// ============================================================================
+// Runs every available FieldSimdTier over the same N-element batch on one
+// pinned thread and reports millions of operations per second:
+//   mul, sqr:  field_mul_batch / field_sqr_batch (includes the lane transpose)
+//   dbl:       point_double_batch        (3M + 4S)
+//   madd:      point_add_mixed_batch     (8M + 3S)
+//   sqrt:      field_sqrt_batch          (253S + 13M, 1/20 of the passes)
+// plus the per-element FieldElement::sqrt and Point::dbl_inplace /
+// add_mixed_inplace loops for reference.
+//
+//   bench_field_simd                 N = 4096, 200 passes
+//   bench_field_simd --quick         N = 1024, 20 passes
+//   bench_field_simd --count N       batch size N
+// ============================================================================
+
+#include "secp256k1/benchmark_harness.hpp"
+#include "secp256k1/field_simd.hpp"
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace secp256k1::fast;
+
+namespace {
+
+struct CliOptions {
+    bool        quick = false;
+    std::size_t count = 0;
+};
+
+CliOptions parse_cli(int argc, char** argv) {
+    CliOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            opts.quick = true;
+        } else if (std::strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+            opts.count = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+        }
+    }
+    return opts;
+}
+
+// Millions of element operations per second for `passes` runs of fn().
+template <typename Fn>
+double mops(std::size_t n, int passes, Fn&& fn) {
+    fn();   // warm-up
+    std::uint64_t const t0 = bench::Timer::now();
+    for (int p = 0; p < passes; ++p) {
+        fn();
+        bench::ClobberMemory();
+    }
+    double const ns = bench::Timer::ticks_to_ns(bench::Timer::now() - t0);
+    return static_cast<double>(n) * passes / ns * 1e3;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CliOptions const opts = parse_cli(argc, argv);
+    bench::pin_thread_and_elevate();
+
+    std::size_t const n = opts.count != 0 ? opts.count : (opts.quick ? 1024 : 4096);
+    int const passes = opts.quick ? 20 : 200;
+
+    // Jacobian points 2^i * Q (non-trivial Z) and affine offsets.
+    std::vector<Point> pts(n);
+    std::vector<FieldElement> X(n), Y(n), Z(n), x2(n), y2(n), X3(n), Y3(n), Z3(n);
+    Point p = Point::generator().scalar_mul(Scalar::from_uint64(0x5eed));
+    Point q = Point::generator().scalar_mul(Scalar::from_uint64(0xaffe));
+    for (std::size_t i = 0; i < n; ++i) {
+        pts[i] = p;
+        X[i] = p.X();
+        Y[i] = p.Y();
+        Z[i] = p.z();
+        x2[i] = q.x();
+        y2[i] = q.y();
+        p.dbl_inplace();
+        q.next_inplace();
+    }
+
+    std::printf("Lane-parallel field arithmetic (N = %zu, single thread)\n", n);
+    std::printf("  Timer:   %s\n", bench::Timer::timer_name());
+    std::printf("  Default: %s\n\n", field_simd_tier_name(field_simd_tier()));
+    std::printf("  %-8s  %9s  %9s  %9s  %9s  %9s   (M ops/s)\n",
+                "tier", "mul", "sqr", "dbl", "madd", "sqrt");
+    int const sqrt_passes = std::max(1, passes / 20);
+    std::vector<std::uint8_t> ok(n);
+
+    for (FieldSimdTier tier : {FieldSimdTier::Scalar, FieldSimdTier::AVX2, FieldSimdTier::IFMA}) {
+        if (!field_simd_available(tier)) {
+            std::printf("  %-8s  (not available)\n", field_simd_tier_name(tier));
+            continue;
+        }
+        double const m_mul = mops(n, passes, [&] {
+            field_mul_batch(X.data(), Y.data(), X3.data(), n, tier);
+        });
+        double const m_sqr = mops(n, passes, [&] {
+            field_sqr_batch(X.data(), X3.data(), n, tier);
+        });
+        double const m_dbl = mops(n, passes, [&] {
+            point_double_batch(X.data(), Y.data(), Z.data(), X3.data(), Y3.data(), Z3.data(), n, tier);
+        });
+        double const m_add = mops(n, passes, [&] {
+            point_add_mixed_batch(X.data(), Y.data(), Z.data(), x2.data(), y2.data(),
+                                  X3.data(), Y3.data(), Z3.data(), n, tier);
+        });
+        double const m_sqrt = mops(n, sqrt_passes, [&] {
+            field_sqrt_batch(X.data(), X3.data(), ok.data(), n, tier);
+        });
+        std::printf("  %-8s  %9.2f  %9.2f  %9.2f  %9.2f  %9.3f\n", field_simd_tier_name(tier),
+                    m_mul, m_sqr, m_dbl, m_add, m_sqrt);
+    }
+
+    // Applied repeatedly in place; the cost does not depend on the values.
+    std::vector<Point> work(pts);
+    double const m_dbl = mops(n, passes, [&] {
+        for (auto& w : work) w.dbl_inplace();
+    });
+    work = pts;
+    double const m_add = mops(n, passes, [&] {
+        for (std::size_t i = 0; i < n; ++i) work[i].add_mixed_inplace(x2[i], y2[i]);
+    });
+    double const m_sqrt = mops(n, sqrt_passes, [&] {
+        for (std::size_t i = 0; i < n; ++i) X3[i] = X[i].sqrt();
+    });
+    std::printf("  %-8s  %9s  %9s  %9.2f  %9.2f  %9.3f\n", "Point", "-", "-", m_dbl, m_add, m_sqrt);
+    bench::DoNotOptimize(work);
+    return 0;
+}
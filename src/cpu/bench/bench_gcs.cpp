@@ -0,0 +1,160 @@
+// ============================================================================
+// bench_gcs.cpp -- BIP-158 compact filter build and rescan match (filters/s)
+// ============================================================================
+// Synthetic chain of blocks with ~2000 output scripts each (22-34 bytes, the
+// P2WPKH..P2TR range). Reports:
+//   build:  ufsecp_gcs_build per block vs one ufsecp_gcs_build_batch call
+//   rescan: ufsecp_gcs_match_any per block vs ufsecp_gcs_match_any_batch
+//           for a wallet of W scripts (none of which is in the chain, so
+//           every filter is walked to the end -- the worst case)
+//
+//   bench_gcs                 512 blocks, W = 10000
+//   bench_gcs --quick         64 blocks,  W = 1000
+//   bench_gcs --threads N     pool size for the batch calls (default: all cores)
+// ============================================================================
+
+#include "secp256k1/benchmark_harness.hpp"
+#include "ufsecp/ufsecp.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct CliOptions {
+    bool     quick   = false;
+    unsigned threads = 0;
+};
+
+CliOptions parse_cli(int argc, char** argv) {
+    CliOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            opts.quick = true;
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            opts.threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        }
+    }
+    return opts;
+}
+
+struct Items {
+    std::vector<std::uint8_t>       bytes;
+    std::vector<const std::uint8_t*> ptrs;
+    std::vector<std::size_t>        sizes;
+};
+
+Items make_items(std::size_t n, std::uint64_t seed) {
+    Items it;
+    std::uint64_t s = seed * 0x9e3779b97f4a7c15ULL + 1;
+    auto next = [&s]() {
+        s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+        return s;
+    };
+    std::vector<std::size_t> offs(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t const len = 22 + next() % 13;
+        offs[i] = it.bytes.size();
+        it.sizes.push_back(len);
+        for (std::size_t j = 0; j < len; ++j) it.bytes.push_back(static_cast<std::uint8_t>(next()));
+    }
+    for (std::size_t i = 0; i < n; ++i) it.ptrs.push_back(it.bytes.data() + offs[i]);
+    return it;
+}
+
+double seconds_since(std::uint64_t t0) {
+    return bench::Timer::ticks_to_ns(bench::Timer::now() - t0) / 1e9;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CliOptions const opts = parse_cli(argc, argv);
+    unsigned const threads = opts.threads != 0
+        ? opts.threads : std::max(1U, std::thread::hardware_concurrency());
+    std::size_t const blocks = opts.quick ? 64 : 512;
+    std::size_t const wallet_n = opts.quick ? 1000 : 10000;
+    constexpr std::size_t kStride = 16384;
+
+    ufsecp_ctx* ctx = nullptr;
+    if (ufsecp_ctx_create(&ctx) != UFSECP_OK ||
+        ufsecp_ctx_set_threads(ctx, threads, nullptr, 0) != UFSECP_OK) {
+        std::fprintf(stderr, "context setup failed\n");
+        return 1;
+    }
+
+    std::vector<std::size_t> counts(blocks);
+    std::vector<std::uint8_t> keys(16 * blocks);
+    for (std::size_t b = 0; b < blocks; ++b) {
+        counts[b] = 1500 + (b * 7919) % 1000;
+        for (std::size_t j = 0; j < 16; ++j) keys[16 * b + j] = static_cast<std::uint8_t>(b * 31 + j);
+    }
+    std::size_t total = 0;
+    for (std::size_t c : counts) total += c;
+    Items const chain = make_items(total, 1);
+    Items const wallet = make_items(wallet_n, 2);
+
+    double const n_blocks = static_cast<double>(blocks);
+
+    std::printf("BIP-158 GCS filters (%zu blocks, %zu scripts)\n", blocks, total);
+    std::printf("  Timer:   %s\n", bench::Timer::timer_name());
+    std::printf("  Threads: %u (batch calls)\n\n", threads);
+
+    // -- build --------------------------------------------------------------
+    std::vector<std::uint8_t> serial(blocks * kStride), batched(blocks * kStride);
+    std::vector<std::size_t> serial_lens(blocks), batched_lens(blocks);
+
+    std::uint64_t t0 = bench::Timer::now();
+    for (std::size_t b = 0, first = 0; b < blocks; first += counts[b], ++b) {
+        serial_lens[b] = kStride;
+        ufsecp_gcs_build(keys.data() + 16 * b, const_cast<const std::uint8_t**>(chain.ptrs.data()) + first,
+                         chain.sizes.data() + first, counts[b], serial.data() + b * kStride,
+                         &serial_lens[b]);
+    }
+    double const t_build = seconds_since(t0);
+
+    t0 = bench::Timer::now();
+    ufsecp_error_t const rc = ufsecp_gcs_build_batch(
+        ctx, keys.data(), const_cast<const std::uint8_t**>(chain.ptrs.data()), chain.sizes.data(),
+        counts.data(), blocks, batched.data(), kStride, batched_lens.data());
+    double const t_build_batch = seconds_since(t0);
+    bench::ClobberMemory();
+
+    bool const same = rc == UFSECP_OK && serial_lens == batched_lens && serial == batched;
+    std::printf("  %-8s  %14s  %14s  %7s\n", "", "per-call f/s", "batch f/s", "speedup");
+    std::printf("  %-8s  %14.0f  %14.0f  %6.2fx%s\n", "build",
+                n_blocks / t_build, n_blocks / t_build_batch, t_build / t_build_batch,
+                same ? "" : "  MISMATCH");
+
+    // -- rescan -------------------------------------------------------------
+    std::vector<const std::uint8_t*> filters(blocks);
+    for (std::size_t b = 0; b < blocks; ++b) filters[b] = batched.data() + b * kStride;
+    const std::uint8_t** q = const_cast<const std::uint8_t**>(wallet.ptrs.data());
+
+    t0 = bench::Timer::now();
+    std::size_t hits = 0;
+    for (std::size_t b = 0; b < blocks; ++b) {
+        hits += ufsecp_gcs_match_any(keys.data() + 16 * b, filters[b], batched_lens[b], counts[b],
+                                     q, wallet.sizes.data(), wallet_n) == UFSECP_OK;
+    }
+    double const t_match = seconds_since(t0);
+
+    std::vector<std::uint8_t> matches(blocks);
+    t0 = bench::Timer::now();
+    ufsecp_gcs_match_any_batch(ctx, keys.data(), filters.data(), batched_lens.data(), counts.data(),
+                               blocks, q, wallet.sizes.data(), wallet_n, matches.data());
+    double const t_match_batch = seconds_since(t0);
+    bench::DoNotOptimize(hits);
+    bench::ClobberMemory();
+
+    std::printf("  %-8s  %14.0f  %14.0f  %6.2fx   (W = %zu)\n", "rescan",
+                n_blocks / t_match, n_blocks / t_match_batch, t_match / t_match_batch, wallet_n);
+
+    ufsecp_ctx_destroy(ctx);
+    return same ? 0 : 1;
+}
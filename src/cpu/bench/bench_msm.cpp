@@ -0,0 +1,140 @@
+// ============================================================================
+// bench_msm.cpp -- MSM engines across n = 1k .. 1M
+// ============================================================================
+// Compares the Jacobian-bucket (pippenger_msm) and affine-bucket
+// (pippenger_msm_affine) Pippenger engines on the same random affine points
+// and scalars, plus the engine msm() picks for each n. Every run checks that
+// both engines agree.
+//
+//   bench_msm            n = 1k, 2k, 4k, ..., 1M (3 passes, 1 above 64k)
+//   bench_msm --quick    n = 1k .. 64k
+//   bench_msm --passes N
+// ============================================================================
+
+#include "secp256k1/benchmark_harness.hpp"
+#include "secp256k1/field.hpp"
+#include "secp256k1/pippenger.hpp"
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace secp256k1;
+using namespace secp256k1::fast;
+
+namespace {
+
+struct CliOptions {
+    int passes = 3;
+    bool quick = false;
+};
+
+CliOptions parse_cli(int argc, char** argv) {
+    CliOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            opts.quick = true;
+        } else if (std::strcmp(argv[i], "--passes") == 0 && i + 1 < argc) {
+            opts.passes = std::max(1, std::atoi(argv[++i]));
+        }
+    }
+    return opts;
+}
+
+Scalar make_scalar(std::uint64_t seed) {
+    std::array<std::uint8_t, 32> bytes{};
+    for (std::size_t i = 0; i < 4; ++i) {
+        std::uint64_t word = (seed + 1) * 0x9e3779b97f4a7c15ULL ^ (0xd1b54a32d192ed03ULL * (i + 1));
+        word ^= word >> 29;
+        std::memcpy(bytes.data() + i * 8, &word, sizeof(word));
+    }
+    return Scalar::from_bytes(bytes);
+}
+
+// P_i = P_0 + i*Q in affine form (one batched inversion).
+std::vector<Point> make_points(std::size_t n) {
+    std::vector<Point> jac(n);
+    Point p = Point::generator().scalar_mul(make_scalar(0xA11CE));
+    Point const q = Point::generator().scalar_mul(make_scalar(0xB0B));
+    for (std::size_t i = 0; i < n; ++i) {
+        jac[i] = p;
+        p.add_inplace(q);
+    }
+    std::vector<FieldElement> x(n), y(n);
+    Point::batch_normalize(jac.data(), n, x.data(), y.data());
+    std::vector<Point> out(n);
+    for (std::size_t i = 0; i < n; ++i) out[i] = Point::from_affine(x[i], y[i]);
+    return out;
+}
+
+// Best of `passes` single calls, in ms.
+template <typename Func>
+double best_ms(int passes, Func&& func) {
+    double best = 0.0;
+    for (int p = 0; p < passes; ++p) {
+        std::uint64_t const t0 = bench::Timer::now();
+        func();
+        bench::ClobberMemory();
+        double const ms = bench::Timer::ticks_to_ns(bench::Timer::now() - t0) / 1e6;
+        if (p == 0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+const char* engine_name(MsmEngine e) {
+    switch (e) {
+    case MsmEngine::Strauss:         return "strauss";
+    case MsmEngine::Pippenger:       return "jacobian";
+    case MsmEngine::PippengerAffine: return "affine";
+    case MsmEngine::Auto:            break;
+    }
+    return "auto";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CliOptions const opts = parse_cli(argc, argv);
+    bench::pin_thread_and_elevate();
+
+    std::size_t const max_n = opts.quick ? (std::size_t{1} << 16) : (std::size_t{1} << 20);
+    std::vector<Point> const points = make_points(max_n);
+    std::vector<Scalar> scalars(max_n);
+    for (std::size_t i = 0; i < max_n; ++i) scalars[i] = make_scalar(i);
+
+    std::printf("MSM engines (single thread)\n");
+    std::printf("  Timer:  %s\n\n", bench::Timer::timer_name());
+    std::printf("  %8s  %3s  %12s  %12s  %7s  %8s  %10s\n",
+                "n", "c", "jacobian ms", "affine ms", "speedup", "msm()", "ns/point");
+
+    bool all_equal = true;
+    for (std::size_t n = 1024; n <= max_n; n *= 2) {
+        int const passes = (n > (std::size_t{1} << 16)) ? 1 : opts.passes;
+        Point jac, aff;
+        double const jac_ms = best_ms(passes, [&] {
+            jac = pippenger_msm(scalars.data(), points.data(), n);
+        });
+        double const aff_ms = best_ms(passes, [&] {
+            aff = pippenger_msm_affine(scalars.data(), points.data(), n);
+        });
+        bool const equal = jac.to_compressed() == aff.to_compressed();
+        all_equal = all_equal && equal;
+        MsmEngine const picked = msm_select_engine(n);
+        double const picked_ms = (picked == MsmEngine::PippengerAffine) ? aff_ms : jac_ms;
+        std::printf("  %8zu  %3u  %12.2f  %12.2f  %6.2fx  %8s  %10.1f%s\n",
+                    n, pippenger_optimal_window(n), jac_ms, aff_ms, jac_ms / aff_ms,
+                    engine_name(picked), picked_ms * 1e6 / static_cast<double>(n),
+                    equal ? "" : "  MISMATCH");
+    }
+
+    if (!all_equal) {
+        std::fprintf(stderr, "engine results differ\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+// ============================================================================
+// bench_range_proof.cpp -- Bulletproof range-proof verification, proofs/s
+// ============================================================================
+// Verifies a batch of N 64-bit range proofs two ways and reports proofs per
+// second:
+//   loop:  range_verify per proof (one 130-base MSM + one small MSM each)
+//   batch: batch_range_verify (one weighted MSM for the whole batch)
+// 32 distinct proofs are generated and repeated to fill the batch; the
+// weights are random per entry, so repeats cost the same as fresh proofs.
+//
+//   bench_range_proof                 N = 1 .. 1000
+//   bench_range_proof --quick         N = 1 .. 100
+//   bench_range_proof --count N       one row with N proofs
+// ============================================================================
+
+#include "secp256k1/benchmark_harness.hpp"
+#include "secp256k1/pedersen.hpp"
+#include "secp256k1/scalar.hpp"
+#include "secp256k1/zk.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace secp256k1;
+using fast::Scalar;
+
+namespace {
+
+struct CliOptions {
+    bool        quick = false;
+    std::size_t count = 0;
+};
+
+CliOptions parse_cli(int argc, char** argv) {
+    CliOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            opts.quick = true;
+        } else if (std::strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+            opts.count = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+        }
+    }
+    return opts;
+}
+
+double seconds_since(std::uint64_t t0) {
+    return bench::Timer::ticks_to_ns(bench::Timer::now() - t0) / 1e9;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CliOptions const opts = parse_cli(argc, argv);
+    bench::pin_thread_and_elevate();
+
+    constexpr std::size_t kDistinct = 32;
+    std::vector<PedersenCommitment> base_c(kDistinct);
+    std::vector<zk::RangeProof> base_p(kDistinct);
+    for (std::size_t i = 0; i < kDistinct; ++i) {
+        std::uint64_t const value = (i + 1) * 0x9e3779b97f4a7c15ULL;
+        Scalar const blinding = Scalar::from_uint64(0xb11d + i);
+        std::array<std::uint8_t, 32> aux{};
+        aux[0] = static_cast<std::uint8_t>(i);
+        base_c[i] = pedersen_commit(Scalar::from_uint64(value), blinding);
+        base_p[i] = zk::range_prove(value, blinding, base_c[i], aux);
+    }
+
+    std::vector<std::size_t> counts;
+    if (opts.count != 0) {
+        counts.push_back(opts.count);
+    } else {
+        for (std::size_t n = 1; n <= (opts.quick ? 100U : 1000U); n *= 10) counts.push_back(n);
+    }
+
+    std::printf("Bulletproof range-proof verification (64-bit)\n");
+    std::printf("  Timer: %s\n\n", bench::Timer::timer_name());
+    std::printf("  %6s  %14s  %14s  %7s\n", "proofs", "loop proofs/s", "batch proofs/s", "speedup");
+
+    bool all_ok = true;
+    for (std::size_t n : counts) {
+        std::vector<PedersenCommitment> c(n);
+        std::vector<zk::RangeProof> p(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            c[i] = base_c[i % kDistinct];
+            p[i] = base_p[i % kDistinct];
+        }
+        // Warm the prepared tables before timing.
+        all_ok &= zk::batch_range_verify(c.data(), p.data(), std::min<std::size_t>(n, 2));
+
+        std::uint64_t t0 = bench::Timer::now();
+        bool loop_ok = true;
+        for (std::size_t i = 0; i < n; ++i) loop_ok &= zk::range_verify(c[i], p[i]);
+        double const t_loop = seconds_since(t0);
+
+        t0 = bench::Timer::now();
+        bool const batch_ok = zk::batch_range_verify(c.data(), p.data(), n);
+        double const t_batch = seconds_since(t0);
+        bench::DoNotOptimize(loop_ok);
+
+        all_ok &= loop_ok && batch_ok;
+        double const proofs = static_cast<double>(n);
+        std::printf("  %6zu  %14.0f  %14.0f  %6.2fx%s\n", n, proofs / t_loop, proofs / t_batch,
+                    t_loop / t_batch, loop_ok && batch_ok ? "" : "  FAILED");
+    }
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+// ============================================================================
+// bench_sp_multi_scan.cpp -- BIP-352 multi-recipient scan, M keys x N tweaks
+// ============================================================================
+// Scans one synthetic block (N tweaks, N outputs) for M recipients with
+// SpMultiScanner, once with the shared per-tweak tables and once with the
+// per-key fixed-k ladder, and reports (key, tweak) pairs per second.
+//
+//   bench_sp_multi_scan                 N = 1024, M = 1 .. 256
+//   bench_sp_multi_scan --quick         N = 256,  M = 1 .. 64
+//   bench_sp_multi_scan --keys M        one row with M keys (e.g. 10000)
+//   bench_sp_multi_scan --threads N     ThreadPool size (default: 1 = serial)
+// ============================================================================
+
+#include "secp256k1/benchmark_harness.hpp"
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+#include "secp256k1/sp_multi_scan.hpp"
+#include "secp256k1/thread_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace secp256k1;
+using namespace secp256k1::fast;
+
+namespace {
+
+struct CliOptions {
+    bool        quick   = false;
+    std::size_t keys    = 0;
+    unsigned    threads = 1;
+};
+
+CliOptions parse_cli(int argc, char** argv) {
+    CliOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            opts.quick = true;
+        } else if (std::strcmp(argv[i], "--keys") == 0 && i + 1 < argc) {
+            opts.keys = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            opts.threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        }
+    }
+    return opts;
+}
+
+Scalar make_scalar(std::uint64_t seed) {
+    std::array<std::uint8_t, 32> bytes{};
+    for (std::size_t i = 0; i < 4; ++i) {
+        std::uint64_t word = (seed + 1) * 0x9e3779b97f4a7c15ULL ^ (0xd1b54a32d192ed03ULL * (i + 1));
+        word ^= word >> 29;
+        std::memcpy(bytes.data() + i * 8, &word, sizeof(word));
+    }
+    return Scalar::from_bytes(bytes);
+}
+
+// T_i = T_0 + i*Q, compressed.
+std::vector<std::uint8_t> make_tweaks(std::size_t n) {
+    std::vector<Point> jac(n);
+    Point p = Point::generator().scalar_mul(make_scalar(0x7ee4));
+    Point const q = Point::generator().scalar_mul(make_scalar(0x51de));
+    for (std::size_t i = 0; i < n; ++i) {
+        jac[i] = p;
+        p.add_inplace(q);
+    }
+    std::vector<std::array<std::uint8_t, 33>> comp(n);
+    Point::batch_to_compressed(jac.data(), n, comp.data());
+    std::vector<std::uint8_t> out(n * 33);
+    for (std::size_t i = 0; i < n; ++i) std::memcpy(out.data() + i * 33, comp[i].data(), 33);
+    return out;
+}
+
+std::vector<SpRecipient> make_recipients(std::size_t m) {
+    std::vector<SpRecipient> r(m);
+    Point const spend = Point::generator().scalar_mul(make_scalar(0x5be4d));
+    for (std::size_t i = 0; i < m; ++i) r[i] = {make_scalar(1000 + i), spend};
+    return r;
+}
+
+double scan_seconds(const SpMultiScanner& sc, const std::vector<std::uint8_t>& tweaks,
+                    const std::vector<std::array<std::uint8_t, 32>>& outputs, ThreadPool* pool) {
+    std::uint64_t const t0 = bench::Timer::now();
+    auto matches = sc.scan(tweaks.data(), tweaks.size() / 33, outputs.data(), outputs.size(), pool);
+    bench::DoNotOptimize(matches);
+    return bench::Timer::ticks_to_ns(bench::Timer::now() - t0) / 1e9;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CliOptions const opts = parse_cli(argc, argv);
+    bench::pin_thread_and_elevate();
+
+    std::size_t const n = opts.quick ? 256 : 1024;
+    std::vector<std::uint8_t> const tweaks = make_tweaks(n);
+    std::vector<std::array<std::uint8_t, 32>> outputs(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const x = make_scalar(0xf00d + i).to_bytes();
+        std::memcpy(outputs[i].data(), x.data(), 32);
+    }
+
+    ThreadPool pool(opts.threads);
+    ThreadPool* const p = opts.threads > 1 ? &pool : nullptr;
+
+    std::printf("BIP-352 multi-recipient scan (N = %zu tweaks)\n", n);
+    std::printf("  Timer:   %s\n", bench::Timer::timer_name());
+    std::printf("  Threads: %u\n\n", opts.threads);
+    std::printf("  %6s  %14s  %14s  %7s\n", "keys", "tables pairs/s", "fixed-k pairs/s", "speedup");
+
+    std::vector<std::size_t> key_counts;
+    if (opts.keys != 0) {
+        key_counts.push_back(opts.keys);
+    } else {
+        for (std::size_t m = 1; m <= (opts.quick ? 64U : 256U); m *= 4) key_counts.push_back(m);
+    }
+
+    for (std::size_t m : key_counts) {
+        std::vector<SpRecipient> const r = make_recipients(m);
+        SpMultiScanner const tables(r, 0);
+        SpMultiScanner const fixed_k(r, SIZE_MAX);
+        double const pairs = static_cast<double>(m * n);
+        double const t_tables = scan_seconds(tables, tweaks, outputs, p);
+        double const t_fixed  = scan_seconds(fixed_k, tweaks, outputs, p);
+        std::printf("  %6zu  %14.0f  %14.0f  %6.2fx\n",
+                    m, pairs / t_tables, pairs / t_fixed, t_fixed / t_tables);
+    }
+    return 0;
+}
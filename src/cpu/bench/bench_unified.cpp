@@ -86,6 +86,7 @@
 #include "secp256k1/benchmark_harness.hpp"
 #include "secp256k1/glv.hpp"
 #include "secp256k1/batch_verify.hpp"
+#include "secp256k1/thread_pool.hpp"
 #ifdef SECP256K1_BUILD_ETHEREUM
 #include "secp256k1/recovery.hpp"
 #include "secp256k1/coins/keccak256.hpp"
@@ -1560,9 +1561,108 @@ int main(int argc, char** argv) {
                      cached_speedup);
         }
 
+        // -- Schnorr Batch Verify: multi-threaded (block-validation sizes) --
+        // Same batch on 1 thread and on every pool participant; the ratio is
+        // the parallel scaling of preprocessing + msm_parallel().
+        {
+            ThreadPool& mt_pool = ThreadPool::global();
+            // Light warmup: one call is a whole block-sized batch.
+            bench::Harness mt_H(2, static_cast<std::size_t>(effective_passes));
+            constexpr int MT_SIZES[] = {4096, 16384};
+            for (const int batch_n : MT_SIZES) {
+                std::vector<SchnorrBatchEntry> mt_batch(static_cast<std::size_t>(batch_n));
+                for (int j = 0; j < batch_n; ++j) {
+                    mt_batch[static_cast<std::size_t>(j)].pubkey_x  = schnorr_pubkeys_x[j % POOL];
+                    mt_batch[static_cast<std::size_t>(j)].message   = msghashes[j % POOL];
+                    mt_batch[static_cast<std::size_t>(j)].signature = schnorr_sigs[j % POOL];
+                }
+                const auto n_sz = static_cast<std::size_t>(batch_n);
+                if (!schnorr_batch_verify(mt_batch.data(), n_sz, mt_pool)) {
+                    printf("[!] schnorr_batch_verify(pool,%d) FAILED correctness check\n",
+                           batch_n);
+                }
+
+                const double st_ns = mt_H.run(1, [&]() {
+                    bool ok = schnorr_batch_verify(mt_batch.data(), n_sz, mt_pool, 1);
+                    bench::DoNotOptimize(ok);
+                });
+                const double mt_ns = mt_H.run(1, [&]() {
+                    bool ok = schnorr_batch_verify(mt_batch.data(), n_sz, mt_pool);
+                    bench::DoNotOptimize(ok);
+                });
+
+                char label[64];
+                snprintf(label, sizeof(label), "schnorr_batch_verify(N=%d, 1 thr)", batch_n);
+                print_row(label, st_ns);
+                snprintf(label, sizeof(label), "schnorr_batch_verify(N=%d, %u thr)",
+                         batch_n, mt_pool.size());
+                print_row(label, mt_ns);
+                printf("| %-44s | %8.2fx  |\n", "  -> thread scaling", st_ns / mt_ns);
+            }
+        }
+
+        // -- Schnorr identify_invalid: Individual vs Bisect --
+        // A failed block batch must name its bad signatures. Bisection wins
+        // while the bad set is tiny; the 1% row shows where it stops paying.
+        {
+            bench::Harness id_H(1, static_cast<std::size_t>(effective_passes));
+            constexpr int ID_N = 4096;
+            constexpr int ID_BAD[] = {0, 1, 10, ID_N / 100};
+            for (const int n_bad : ID_BAD) {
+                std::vector<SchnorrBatchEntry> id_batch(static_cast<std::size_t>(ID_N));
+                for (int j = 0; j < ID_N; ++j) {
+                    id_batch[static_cast<std::size_t>(j)].pubkey_x  = schnorr_pubkeys_x[j % POOL];
+                    id_batch[static_cast<std::size_t>(j)].message   = msghashes[j % POOL];
+                    id_batch[static_cast<std::size_t>(j)].signature = schnorr_sigs[j % POOL];
+                }
+                // Spread the bad entries over the whole batch.
+                for (int b = 0; b < n_bad; ++b) {
+                    auto& sig = id_batch[static_cast<std::size_t>(
+                        (b * 2654435761u + 17u) % static_cast<unsigned>(ID_N))].signature;
+                    sig.s = sig.s + Scalar::one();
+                }
+
+                std::vector<std::size_t> lin, bis;
+                schnorr_batch_identify_invalid(id_batch.data(), id_batch.size(), lin,
+                                               BatchIdentifyMode::Individual);
+                schnorr_batch_identify_invalid(id_batch.data(), id_batch.size(), bis,
+                                               BatchIdentifyMode::Bisect);
+                if (lin != bis || lin.size() != static_cast<std::size_t>(n_bad)) {
+                    printf("[!] schnorr_batch_identify_invalid(%d bad) FAILED correctness check\n",
+                           n_bad);
+                }
+
+                const double lin_ns = id_H.run(1, [&]() {
+                    schnorr_batch_identify_invalid(id_batch.data(), id_batch.size(), lin,
+                                                   BatchIdentifyMode::Individual);
+                    bench::DoNotOptimize(lin);
+                });
+                const double bis_ns = id_H.run(1, [&]() {
+                    schnorr_batch_identify_invalid(id_batch.data(), id_batch.size(), bis,
+                                                   BatchIdentifyMode::Bisect);
+                    bench::DoNotOptimize(bis);
+                });
+
+                char label[64];
+                snprintf(label, sizeof(label), "identify_invalid(N=%d, %d bad, indiv)",
+                         ID_N, n_bad);
+                print_row(label, lin_ns);
+                snprintf(label, sizeof(label), "identify_invalid(N=%d, %d bad, bisect)",
+                         ID_N, n_bad);
+                print_row(label, bis_ns);
+                printf("| %-44s | %8.2fx  |\n", "  -> bisect speedup", lin_ns / bis_ns);
+            }
+        }
+
         printf("|                                              |            |\n");
 
         // -- ECDSA Batch Verify --
+        // Recoverable variant needs recids; sign the pool once more.
+        std::vector<RecoverableSignature> ecdsa_rsigs(POOL);
+        for (int j = 0; j < POOL; ++j) {
+            ecdsa_rsigs[static_cast<std::size_t>(j)] =
+                ecdsa_sign_recoverable(msghashes[j], privkeys[j]);
+        }
         for (int bi = 0; bi < N_BATCH_SIZES; ++bi) {
             const int batch_n = BATCH_SIZES[bi];
 
@@ -1598,6 +1698,32 @@ int main(int argc, char** argv) {
 
             printf("| %-44s | %8.2fx  |\n",
                    "  -> speedup vs individual", speedup);
+
+            // Recoverable: recid pins R, whole batch is one MSM.
+            std::vector<ECDSARecoverableBatchEntry> rec_batch(static_cast<std::size_t>(batch_n));
+            for (int j = 0; j < batch_n; ++j) {
+                auto& e = rec_batch[static_cast<std::size_t>(j)];
+                e.msg_hash   = msghashes[j % POOL];
+                e.public_key = pubkeys[j % POOL];
+                e.signature  = ecdsa_rsigs[static_cast<std::size_t>(j % POOL)].sig;
+                e.recid      = ecdsa_rsigs[static_cast<std::size_t>(j % POOL)].recid;
+            }
+            if (!ecdsa_batch_verify(rec_batch)) {
+                printf("[!] ecdsa_batch_verify(recoverable,%d) FAILED correctness check\n",
+                       batch_n);
+            }
+            const double rec_ns = bench_ns([&]() {
+                bool ok = ecdsa_batch_verify(rec_batch);
+                bench::DoNotOptimize(ok);
+            }, iters);
+            const double rec_per_sig = rec_ns / static_cast<double>(batch_n);
+
+            snprintf(label, sizeof(label), "ecdsa_batch_verify(recid,N=%d)", batch_n);
+            print_row(label, rec_ns);
+            snprintf(label, sizeof(label), "  -> per-sig recid (N=%d)", batch_n);
+            print_row(label, rec_per_sig);
+            printf("| %-44s | %8.2fx  |\n",
+                   "  -> recid speedup vs individual", u_ecdsa_verify / rec_per_sig);
         }
     }
 
@@ -1935,6 +2061,24 @@ int main(int argc, char** argv) {
         }, N_SIGN);
         print_row("bip32_coin_derive_key (BTC m/84'/0'/0'/0/0)", u_bip32_child);
 
+        {
+            DerivationCache hd_cache(master_hd);
+            std::uint32_t leaf = 0;
+            double const u_cache = bench_ns([&]() {
+                auto child = hd_cache.derive(std::vector<std::uint32_t>{
+                    84u | 0x80000000u, 0x80000000u, 0x80000000u, 0u, leaf++ & 1023u});
+                bench::DoNotOptimize(child);
+            }, N_SIGN);
+            print_row("DerivationCache derive (m/84'/0'/0'/0/i)", u_cache);
+
+            auto hd_xpub = bip32_derive_path(master_hd, "m/84'/0'/0'/0").first.to_public();
+            double const u_range = bench_ns([&]() {
+                auto children = derive_children_range(hd_xpub, 0, 256);
+                bench::DoNotOptimize(children.data());
+            }, std::max(1, N_SIGN / 256)) / 256.0;
+            print_row("derive_children_range (xpub x256, per child)", u_range);
+        }
+
         u_coin_addr_btc = bench_ns([&]() {
             auto addr = secp256k1::coins::coin_address_from_seed(
                 hd_seed.data(), hd_seed.size(), secp256k1::coins::Bitcoin, 0, 0);
@@ -3071,6 +3215,7 @@ int main(int argc, char** argv) {
     // =====================================================================
 
     double u_bip39_gen12 = 0, u_bip39_gen24 = 0, u_bip39_validate = 0, u_bip39_to_seed = 0;
+    double u_bip39_to_seed_batch = 0;
     {
         using namespace secp256k1;
 
@@ -3099,11 +3244,21 @@ int main(int argc, char** argv) {
             bench::DoNotOptimize(seed.data());
         }, std::max(1, N_SIGN / 4));  // PBKDF2 is expensive
 
+        // 8 mnemonics in lockstep (one AVX-512 pass / two AVX2 passes), per seed
+        std::string const batch_mn[8] = {mnemonic12, mnemonic12, mnemonic12, mnemonic12,
+                                         mnemonic12, mnemonic12, mnemonic12, mnemonic12};
+        std::array<std::uint8_t, 64> batch_seeds[8];
+        u_bip39_to_seed_batch = bench_ns([&]{
+            bip39_mnemonic_to_seed_batch(batch_mn, nullptr, 8, batch_seeds);
+            bench::DoNotOptimize(batch_seeds[0].data());
+        }, std::max(1, N_SIGN / 32)) / 8.0;
+
         print_header("BIP-39 MNEMONIC");
         print_row("bip39_generate (12 words)",         u_bip39_gen12);
         print_row("bip39_generate (24 words)",         u_bip39_gen24);
         print_row("bip39_validate (12 words)",         u_bip39_validate);
         print_row("bip39_to_seed (PBKDF2, 12 words)",  u_bip39_to_seed);
+        print_row("bip39_to_seed_batch (x8, per seed)", u_bip39_to_seed_batch);
         print_sep();
         printf("\n");
     }
@@ -3499,6 +3654,7 @@ int main(int argc, char** argv) {
     tput("bip39_generate (24w)",      u_bip39_gen24);
     tput("bip39_validate (12w)",      u_bip39_validate);
     tput("bip39_to_seed (PBKDF2)",    u_bip39_to_seed);
+    tput("bip39_to_seed_batch (x8)",  u_bip39_to_seed_batch);
     printf("\n");
 
     printf("  --- BIP-141/143/144/342 SegWit ---\n");
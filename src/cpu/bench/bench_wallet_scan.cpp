@@ -0,0 +1,187 @@
+// ============================================================================
+// bench_wallet_scan.cpp -- gap-limit wallet scan (children/s)
+// ============================================================================
+// A synthetic set of account xpubs, each with used receive addresses every
+// 10th child (P2PKH / P2WPKH / P2TR in turn) and a few used change
+// addresses. Scans them with:
+//
+//   per-index   derive_child + three address strings per child, looked up
+//               in a hash set of address strings (the coin_derive_key /
+//               wallet::get_address pattern)
+//   scanner     WalletScanner on the calling thread and on a ThreadPool
+//
+// and reports children checked per second. Every run checks that all three
+// find the same hits.
+//
+//   bench_wallet_scan                  16 accounts
+//   bench_wallet_scan --quick          2 accounts
+//   bench_wallet_scan --threads N      pool size (default: all cores)
+// ============================================================================
+
+#include "secp256k1/address.hpp"
+#include "secp256k1/benchmark_harness.hpp"
+#include "secp256k1/bip32.hpp"
+#include "secp256k1/taproot.hpp"
+#include "secp256k1/thread_pool.hpp"
+#include "secp256k1/wallet_scan.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace secp256k1;
+
+namespace {
+
+constexpr std::uint32_t kUsedReceive = 20;   // used receive children: 0, 10, ..., 190
+constexpr std::uint32_t kUsedChange  = 4;    // used change children:  0, 10, 20, 30
+constexpr std::uint32_t kGap         = 20;
+
+struct CliOptions {
+    bool     quick   = false;
+    unsigned threads = 0;
+};
+
+CliOptions parse_cli(int argc, char** argv) {
+    CliOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            opts.quick = true;
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            opts.threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        }
+    }
+    return opts;
+}
+
+std::array<std::uint8_t, 32> p2tr_output(const fast::Point& pk) {
+    return taproot_output_key(pk.x().to_bytes()).first;
+}
+
+std::vector<std::uint8_t> script_for(const fast::Point& pk, std::uint32_t kind) {
+    std::vector<std::uint8_t> s;
+    if (kind == 2) {
+        auto const q = p2tr_output(pk);
+        s = {0x51, 0x20};
+        s.insert(s.end(), q.begin(), q.end());
+        return s;
+    }
+    auto const comp = pk.to_compressed();
+    auto const h = hash160(comp.data(), 33);
+    if (kind == 0) {
+        s = {0x76, 0xa9, 0x14};
+        s.insert(s.end(), h.begin(), h.end());
+        s.push_back(0x88);
+        s.push_back(0xac);
+    } else {
+        s = {0x00, 0x14};
+        s.insert(s.end(), h.begin(), h.end());
+    }
+    return s;
+}
+
+// Per-index reference: every child gets all three address strings.
+std::size_t scan_per_index(const std::vector<ExtendedKey>& xpubs,
+                           const std::unordered_set<std::string>& addresses,
+                           std::uint64_t& derived) {
+    std::size_t hits = 0;
+    derived = 0;
+    for (const ExtendedKey& xpub : xpubs) {
+        for (std::uint32_t branch : {0u, 1u}) {
+            auto const chain = xpub.derive_child(branch).first;
+            std::uint64_t window_end = kGap;
+            for (std::uint32_t i = 0; i < window_end; ++i) {
+                auto const pk = chain.derive_child(i).first.public_key();
+                ++derived;
+                std::string const a[3] = {address_p2pkh(pk), address_p2wpkh(pk),
+                                          address_p2tr_raw(p2tr_output(pk))};
+                for (const std::string& s : a) {
+                    if (addresses.count(s) != 0) {
+                        ++hits;
+                        window_end = std::max<std::uint64_t>(window_end, std::uint64_t{i} + 1 + kGap);
+                    }
+                }
+            }
+        }
+    }
+    return hits;
+}
+
+double seconds_since(std::uint64_t t0) {
+    return bench::Timer::ticks_to_ns(bench::Timer::now() - t0) / 1e9;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CliOptions const opts = parse_cli(argc, argv);
+    unsigned const threads = opts.threads != 0
+        ? opts.threads : std::max(1U, std::thread::hardware_concurrency());
+    bench::pin_thread_and_elevate();
+
+    std::size_t const n_accounts = opts.quick ? 2 : 16;
+    std::uint8_t seed[32];
+    for (std::uint8_t i = 0; i < 32; ++i) seed[i] = static_cast<std::uint8_t>(0xA5 ^ i);
+    auto const master = bip32_master_key(seed, sizeof(seed)).first;
+
+    std::vector<ExtendedKey> xpubs;
+    std::vector<std::vector<std::uint8_t>> scripts;
+    std::unordered_set<std::string> addresses;
+    for (std::uint32_t a = 0; a < n_accounts; ++a) {
+        auto const account = master.derive_hardened(a).first.to_public();
+        xpubs.push_back(account);
+        for (std::uint32_t branch : {0u, 1u}) {
+            auto const chain = account.derive_child(branch).first;
+            std::uint32_t const used = branch == 0 ? kUsedReceive : kUsedChange;
+            for (std::uint32_t k = 0; k < used; ++k) {
+                auto const pk = chain.derive_child(k * 10).first.public_key();
+                std::uint32_t const kind = k % 3;
+                scripts.push_back(script_for(pk, kind));
+                addresses.insert(kind == 0 ? address_p2pkh(pk)
+                               : kind == 1 ? address_p2wpkh(pk)
+                                           : address_p2tr_raw(p2tr_output(pk)));
+            }
+        }
+    }
+    ScriptPubKeySet const set(scripts);
+    ThreadPool pool(threads);
+
+    std::printf("Gap-limit wallet scan (gap %u, P2PKH + P2WPKH + P2TR)\n", kGap);
+    std::printf("  Accounts: %zu   scripts: %zu   threads: %u\n\n",
+                n_accounts, scripts.size(), threads);
+    std::printf("  %-22s  %10s  %8s  %14s\n", "method", "children", "hits", "children/s");
+
+    auto report = [](const char* name, std::uint64_t children, std::size_t hits, double sec) {
+        std::printf("  %-22s  %10llu  %8zu  %14.0f\n", name,
+                    static_cast<unsigned long long>(children), hits,
+                    sec > 0 ? static_cast<double>(children) / sec : 0.0);
+    };
+
+    // Warm-up: builds the generator tables before anything is timed.
+    (void)WalletScanner().scan(xpubs.data(), 1, set);
+
+    std::uint64_t ref_derived = 0;
+    std::uint64_t t0 = bench::Timer::now();
+    std::size_t const ref_hits = scan_per_index(xpubs, addresses, ref_derived);
+    report("per-index strings", ref_derived, ref_hits, seconds_since(t0));
+
+    WalletScanner const scanner;
+    WalletScanStats stats;
+    t0 = bench::Timer::now();
+    auto const serial = scanner.scan(xpubs.data(), xpubs.size(), set, nullptr, &stats);
+    report("WalletScanner serial", stats.derived, serial.size(), seconds_since(t0));
+
+    t0 = bench::Timer::now();
+    auto const pooled = scanner.scan(xpubs.data(), xpubs.size(), set, &pool, &stats);
+    report("WalletScanner pooled", stats.derived, pooled.size(), seconds_since(t0));
+
+    bool const equal = serial.size() == ref_hits && pooled.size() == ref_hits &&
+                       stats.derived == ref_derived;
+    std::printf("\n  Results %s\n", equal ? "match" : "MISMATCH");
+    return equal ? 0 : 1;
+}
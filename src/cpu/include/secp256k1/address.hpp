@@ -31,6 +31,8 @@
 
 namespace secp256k1 {
 
+class ThreadPool;  // secp256k1/thread_pool.hpp
+
 // -- Network ------------------------------------------------------------------
 
 enum class Network : std::uint8_t {
@@ -274,6 +276,37 @@ fast_scan_batch(const fast::Scalar& scan_privkey,
                 const fast::Scalar& spend_privkey,
                 const std::vector<ScanTx>& txs);
 
+// Same as above, with txs split into contiguous chunks (>= 512 txs each) that
+// run the single-thread pipeline on `pool`. Matches come back in tx order.
+std::vector<ScanMatch>
+fast_scan_batch(const fast::Scalar& scan_privkey,
+                const fast::Scalar& spend_privkey,
+                const std::vector<ScanTx>& txs,
+                ThreadPool& pool);
+
+// Index-server scan (CPU twin of ufsecp_gpu_bip352_scan_batch). For each
+// tweak T_i = input_hash × A_sum published by an index:
+//   t_i      = tagged_hash("BIP0352/SharedSecret", ser(scan × T_i) || 0u32)
+//   prefix_i = upper 64 bits (big-endian) of x(t_i × G + B_spend)
+// The caller compares prefix_i against the first 8 bytes of each output's
+// x-only key. Infinity tweaks yield prefix 0. pool = nullptr runs serially.
+void fast_scan_prefix_batch(const fast::Scalar& scan_privkey,
+                            const fast::Point& spend_pubkey,
+                            const fast::Point* tweaks, std::size_t n,
+                            std::uint64_t* prefix64_out,
+                            ThreadPool* pool = nullptr);
+
+// Same pipeline, keeping the whole k = 0 candidate: xonly_out[i] is
+// x(t_i x G + B_spend) and valid_out[i] is 1, or valid_out[i] is 0 where
+// fast_scan_prefix_batch would report prefix 0. Used by SpChainScanner
+// (secp256k1/sp_chain_scan.hpp).
+void fast_scan_tweak_outputs(const fast::Scalar& scan_privkey,
+                             const fast::Point& spend_pubkey,
+                             const fast::Point* tweaks, std::size_t n,
+                             std::array<std::uint8_t, 32>* xonly_out,
+                             std::uint8_t* valid_out,
+                             ThreadPool* pool = nullptr);
+
 } // namespace secp256k1
 
 #endif // SECP256K1_ADDRESS_HPP
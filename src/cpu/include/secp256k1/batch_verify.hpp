@@ -32,6 +32,8 @@
 
 namespace secp256k1 {
 
+class ThreadPool;  // secp256k1/thread_pool.hpp
+
 // -- Schnorr Batch Verification -----------------------------------------------
 
 struct SchnorrBatchEntry {
@@ -56,6 +58,17 @@ bool schnorr_batch_verify(const std::vector<SchnorrBatchEntry>& entries);
 bool schnorr_batch_verify(const SchnorrBatchCachedEntry* entries, std::size_t n);
 bool schnorr_batch_verify(const std::vector<SchnorrBatchCachedEntry>& entries);
 
+// Multi-threaded variant for large batches (block validation, 5k+ sigs).
+// Per-entry preprocessing (weights, lift_x, challenge hashes) runs in slices
+// on `pool`, and the 2n-point MSM runs through msm_parallel() (point-set
+// partition, partial sums added at the end). Same random-weight soundness as
+// the single-thread path: one weight vector, one final equation.
+// max_threads caps the participants used (0 = pool.size()).
+bool schnorr_batch_verify(const SchnorrBatchEntry* entries, std::size_t n,
+                          ThreadPool& pool, unsigned max_threads = 0);
+bool schnorr_batch_verify(const SchnorrBatchCachedEntry* entries, std::size_t n,
+                          ThreadPool& pool, unsigned max_threads = 0);
+
 // -- ECDSA Batch Verification -------------------------------------------------
 
 struct ECDSABatchEntry {
@@ -72,10 +85,70 @@ struct ECDSABatchEntry {
 bool ecdsa_batch_verify(const ECDSABatchEntry* entries, std::size_t n);
 bool ecdsa_batch_verify(const std::vector<ECDSABatchEntry>& entries);
 
+// -- ECDSA Batch Verification with recovery id --------------------------------
+// Plain ECDSA only commits to x(R) mod n, so a batch cannot be folded into one
+// equation. With the recovery id (as carried by Ethereum and compact
+// recoverable signatures) R is fully determined and the batch becomes a true
+// randomized check, like Schnorr:
+//   sum a_i * (s_i * R_i - z_i * G - r_i * Q_i) == O
+// one 2n-point MSM plus one generator multiplication, no s^{-1} at all.
+//
+// An entry passes iff ecdsa_recover(msg_hash, signature, recid) == public_key.
+// That implies ecdsa_verify(); a signature that is valid but carries the
+// wrong recid is rejected. Low-S is enforced as in ecdsa_batch_verify.
+struct ECDSARecoverableBatchEntry {
+    std::array<std::uint8_t, 32> msg_hash;  // 32-byte message hash
+    fast::Point public_key;                  // Full public key point
+    ECDSASignature signature;                // (r, s)
+    int recid;                               // 0-3 (ecdsa_sign_recoverable)
+};
+
+bool ecdsa_batch_verify(const ECDSARecoverableBatchEntry* entries, std::size_t n);
+bool ecdsa_batch_verify(const std::vector<ECDSARecoverableBatchEntry>& entries);
+
+// Multi-threaded variant: R lifting and weights run in slices on `pool`, the
+// MSM runs through msm_parallel(). max_threads caps participants (0 = all).
+bool ecdsa_batch_verify(const ECDSARecoverableBatchEntry* entries, std::size_t n,
+                        ThreadPool& pool, unsigned max_threads = 0);
+
+// -- Batch Public Key Parsing -------------------------------------------------
+// Parse n compressed public keys (0x02/0x03 || x) stored at keys + i*stride,
+// stride >= 33. The prefix and x < p are checked per key; the n square roots
+// y = sqrt(x^3 + 7) run through the lane-parallel field_sqrt_batch, which
+// also decides on-curve status. Same acceptance as parsing one key at a time.
+//
+// SoA form: x_out[i], y_out[i] get the affine coordinates (y with the
+// prefix parity) and valid_out[i] = 1, or zeros and valid_out[i] = 0.
+// Point::from_affine(x_out[i], y_out[i]) is the ECDSABatchEntry public key.
+// Returns the number of valid keys.
+std::size_t pubkey_parse_batch(const std::uint8_t* keys, std::size_t n, std::size_t stride,
+                               fast::FieldElement* x_out, fast::FieldElement* y_out,
+                               std::uint8_t* valid_out);
+
+// Point form: out[i] is the affine point, or infinity for an invalid key.
+// valid_out may be nullptr.
+std::size_t pubkey_parse_batch(const std::uint8_t* keys, std::size_t n, std::size_t stride,
+                               fast::Point* out, std::uint8_t* valid_out = nullptr);
+
 // -- Identify Invalid Signatures ----------------------------------------------
 
 // After a batch fails, identify which signature(s) are invalid.
-// Returns indices of invalid entries.
+// Returns indices of invalid entries (ascending).
+//
+// Individual: verify every entry (~n single verifies).
+// Bisect:     prepare every entry's weighted batch terms once, then halve
+//             failing index ranges, one MSM per left half (right half =
+//             parent - left). O(k log(n/k)) shrinking MSMs for k bad entries:
+//             one bad signature in a 10k block costs ~2-3 batch verifies
+//             instead of 10k single verifies. Individual wins again once
+//             ~1% of the batch is invalid (bench_unified "identify" rows).
+//             Plain ECDSA has no exact per-entry group equation to bisect and
+//             always scans individually.
+enum class BatchIdentifyMode {
+    Individual,
+    Bisect,
+};
+
 void schnorr_batch_identify_invalid(
     const SchnorrBatchEntry* entries, std::size_t n,
     std::vector<std::size_t>& invalid_out);
@@ -83,6 +156,10 @@ void schnorr_batch_identify_invalid(
 std::vector<std::size_t> schnorr_batch_identify_invalid(
     const SchnorrBatchEntry* entries, std::size_t n);
 
+void schnorr_batch_identify_invalid(
+    const SchnorrBatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode mode);
+
 void schnorr_batch_identify_invalid(
     const SchnorrBatchCachedEntry* entries, std::size_t n,
     std::vector<std::size_t>& invalid_out);
@@ -90,6 +167,10 @@ void schnorr_batch_identify_invalid(
 std::vector<std::size_t> schnorr_batch_identify_invalid(
     const SchnorrBatchCachedEntry* entries, std::size_t n);
 
+void schnorr_batch_identify_invalid(
+    const SchnorrBatchCachedEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode mode);
+
 void ecdsa_batch_identify_invalid(
     const ECDSABatchEntry* entries, std::size_t n,
     std::vector<std::size_t>& invalid_out);
@@ -97,6 +178,21 @@ void ecdsa_batch_identify_invalid(
 std::vector<std::size_t> ecdsa_batch_identify_invalid(
     const ECDSABatchEntry* entries, std::size_t n);
 
+void ecdsa_batch_identify_invalid(
+    const ECDSABatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode mode);
+
+void ecdsa_batch_identify_invalid(
+    const ECDSARecoverableBatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out);
+
+std::vector<std::size_t> ecdsa_batch_identify_invalid(
+    const ECDSARecoverableBatchEntry* entries, std::size_t n);
+
+void ecdsa_batch_identify_invalid(
+    const ECDSARecoverableBatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode mode);
+
 } // namespace secp256k1
 
 #endif // SECP256K1_BATCH_VERIFY_HPP
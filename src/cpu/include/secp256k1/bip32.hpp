@@ -10,12 +10,15 @@
 //   - Normal child derivation (public derivable)
 //   - Hardened child derivation (private only)
 //   - Path parsing ("m/44'/0'/0'/0/0")
+//   - Batched child ranges and a path-prefix derivation cache
 //
 // Reference: https://github.com/bitcoin/bips/blob/master/bip-0032.mediawiki
 // ============================================================================
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <string>
 #include <vector>
 #include "secp256k1/scalar.hpp"
@@ -82,6 +85,81 @@ std::pair<ExtendedKey, bool> bip32_master_key(const std::uint8_t* seed,
 std::pair<ExtendedKey, bool> bip32_derive_path(const ExtendedKey& master,
                                                 const std::string& path);
 
+// Parse "m/44'/0'/0'/0/0" into child indices (hardened bit set for ', h, H).
+// "m" yields an empty list. Returns false on malformed input.
+bool bip32_parse_path(const std::string& path, std::vector<std::uint32_t>& indices);
+
+// -- Batched Child Derivation -------------------------------------------------
+
+// Derive children first .. first+count-1 of parent in one pass.
+// Element i is {child at index first+i, success}, identical to
+// parent.derive_child(first + i). The parent public key, its fingerprint
+// and the HMAC key pads (chain code) are computed once for the range.
+// Public parents batch the I_L*G multiplications
+// (batch_scalar_mul_generator), add the parent point on the lane-parallel
+// mixed-add kernel and serialize all children with one field inversion.
+//
+// Returns an empty vector if the range is empty, wraps past 2^32 or
+// crosses the hardened boundary 0x80000000.
+// Public derivation uses variable-time arithmetic: everything it touches
+// is computable from the xpub. Private parents stay on the CT path.
+std::vector<std::pair<ExtendedKey, bool>>
+derive_children_range(const ExtendedKey& parent, std::uint32_t first, std::uint32_t count);
+
+// Public keys only, for pipelines that hash or tweak the children directly:
+// out_x / out_y receive the affine points of children first .. first+count-1
+// and ok[i] is true where derive_child would succeed. Normal indices only
+// (the parent may be an xprv; its private key is not used). Returns false,
+// writing nothing, for an invalid or hardened range.
+bool derive_children_pubkeys(const ExtendedKey& parent, std::uint32_t first, std::uint32_t count,
+                             fast::FieldElement* out_x, fast::FieldElement* out_y,
+                             bool* ok);
+
+// -- Derivation Cache ---------------------------------------------------------
+
+// Memoizes intermediate extended keys by path prefix. Deriving
+// m/84'/0'/0'/0/i for many i costs one derive_child per call once
+// m/84'/0'/0'/0 is cached, instead of five.
+//
+// Only proper prefixes (the parents) are cached, never the requested
+// leaf, so gap-limit walks do not fill the cache with one-off keys.
+// Inserts stop once max_entries is reached. Cached private keys are
+// erased by clear() and by the destructor. Not thread-safe.
+class DerivationCache {
+public:
+    explicit DerivationCache(const ExtendedKey& master, std::size_t max_entries = 1024);
+    ~DerivationCache();
+
+    DerivationCache(const DerivationCache&) = delete;
+    DerivationCache& operator=(const DerivationCache&) = delete;
+
+    // Same result as bip32_derive_path(master, path).
+    std::pair<ExtendedKey, bool> derive(const std::string& path);
+    std::pair<ExtendedKey, bool> derive(const std::vector<std::uint32_t>& indices);
+
+    // derive_children_range on the key at `parent_path`.
+    std::vector<std::pair<ExtendedKey, bool>>
+    derive_children_range(const std::string& parent_path, std::uint32_t first,
+                          std::uint32_t count);
+
+    const ExtendedKey& master() const noexcept { return master_; }
+    std::size_t size() const noexcept { return entries_.size(); }
+    std::size_t hits() const noexcept { return hits_; }     // levels served from the cache
+    std::size_t misses() const noexcept { return misses_; } // levels derived
+    void clear() noexcept;
+
+private:
+    // Key at indices[0..len); caches every prefix it derives.
+    std::pair<ExtendedKey, bool> derive_prefix(const std::vector<std::uint32_t>& indices,
+                                               std::size_t len);
+
+    ExtendedKey master_;
+    std::size_t max_entries_;
+    std::map<std::vector<std::uint32_t>, ExtendedKey> entries_;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+};
+
 // -- HMAC-SHA512 (needed for BIP-32) ------------------------------------------
 // Exposed for testing. Computes HMAC-SHA512(key, data).
 
@@ -28,10 +28,13 @@
 #include <cstring>
 #include <vector>
 #include "secp256k1/scalar.hpp"
+#include "secp256k1/chacha20_poly1305.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
 
 namespace secp256k1 {
 
+class ThreadPool;  // secp256k1/thread_pool.hpp
+
 // -- BIP-324 Cipher Suite (per-direction) -------------------------------------
 
 class Bip324Cipher {
@@ -62,6 +65,44 @@ public:
         const std::uint8_t* contents, std::size_t contents_len,
         std::vector<std::uint8_t>& plaintext_out) noexcept;
 
+    // -- Allocation-free variants -------------------------------------------
+    // A packet is kPacketOverhead bytes longer than its payload. These write
+    // into caller buffers and never allocate; on any failure the packet
+    // counter does not advance.
+    static constexpr std::size_t kPacketOverhead = 3 + 16;
+    static constexpr std::size_t kMaxPayload     = 0xFFFFFF;
+
+    // Seal the concatenation of parts[0..part_count) (e.g. message header +
+    // body) as one packet into out. A part may point into out + 3 at its own
+    // payload offset, so a payload already staged there is sealed in place.
+    // Returns the packet size, or 0 if the payload exceeds kMaxPayload or
+    // out_cap is too small.
+    std::size_t encrypt_into(
+        const std::uint8_t* aad, std::size_t aad_len,
+        const AeadSegment* parts, std::size_t part_count,
+        std::uint8_t* out, std::size_t out_cap) noexcept;
+
+    std::size_t encrypt_into(
+        const std::uint8_t* aad, std::size_t aad_len,
+        const std::uint8_t* plaintext, std::size_t plaintext_len,
+        std::uint8_t* out, std::size_t out_cap) noexcept;
+
+    // decrypt() into a caller buffer of at least contents_len - 16 bytes (out
+    // may equal contents). payload_len receives the decrypted length.
+    bool decrypt_into(
+        const std::uint8_t* aad, std::size_t aad_len,
+        const std::uint8_t* header_enc,
+        const std::uint8_t* contents, std::size_t contents_len,
+        std::uint8_t* out, std::size_t out_cap,
+        std::size_t& payload_len) noexcept;
+
+    // Decrypt a whole packet [header][payload][tag] in place; on success the
+    // payload is at packet + 3.
+    bool decrypt_in_place(
+        const std::uint8_t* aad, std::size_t aad_len,
+        std::uint8_t* packet, std::size_t packet_len,
+        std::size_t& payload_len) noexcept;
+
     // Get the current packet counter (nonce)
     std::uint64_t packet_counter() const noexcept { return packet_counter_; }
 
@@ -98,6 +139,27 @@ public:
     // Returns true on success.
     bool complete_handshake(const std::uint8_t* peer_encoding) noexcept;
 
+    // Batched complete_handshake() for many sessions at once (e.g. peers
+    // reconnecting after a restart): sessions[i] takes the 64 bytes at
+    // peer_encodings + 64 * i. Per chunk of kHandshakeBatch sessions the
+    // peer encodings are decoded without inversions, the constant-time
+    // x-only multiplies share one final field inversion, and each session's
+    // HKDF runs from cached key schedules. Results match complete_handshake().
+    //
+    // ok_out (optional, count bytes) receives 1 for every session that became
+    // established, 0 otherwise (null entry, already established, failed ECDH).
+    // Returns the number of sessions established.
+    static constexpr std::size_t kHandshakeBatch = 32;
+
+    static std::size_t complete_handshakes(
+        Bip324Session* const* sessions, const std::uint8_t* peer_encodings,
+        std::size_t count, std::uint8_t* ok_out = nullptr) noexcept;
+
+    // Same, with chunks spread over `pool`.
+    static std::size_t complete_handshakes(
+        Bip324Session* const* sessions, const std::uint8_t* peer_encodings,
+        std::size_t count, ThreadPool& pool, std::uint8_t* ok_out = nullptr) noexcept;
+
     // Encrypt a message for sending to the peer.
     // Returns: [3-byte encrypted length][payload][16-byte tag]
     std::vector<std::uint8_t> encrypt(
@@ -113,6 +175,26 @@ public:
         const std::uint8_t* payload_and_tag, std::size_t len,
         std::vector<std::uint8_t>& plaintext_out) noexcept;
 
+    // Allocation-free variants (see Bip324Cipher). All fail before the
+    // handshake is complete.
+    std::size_t encrypt_into(
+        const AeadSegment* parts, std::size_t part_count,
+        std::uint8_t* out, std::size_t out_cap) noexcept;
+
+    std::size_t encrypt_into(
+        const std::uint8_t* plaintext, std::size_t plaintext_len,
+        std::uint8_t* out, std::size_t out_cap) noexcept;
+
+    bool decrypt_into(
+        const std::uint8_t* header,
+        const std::uint8_t* payload_and_tag, std::size_t len,
+        std::uint8_t* out, std::size_t out_cap,
+        std::size_t& payload_len) noexcept;
+
+    bool decrypt_in_place(
+        std::uint8_t* packet, std::size_t packet_len,
+        std::size_t& payload_len) noexcept;
+
     // Check if handshake is complete
     bool is_established() const noexcept { return established_; }
 
@@ -122,6 +204,16 @@ public:
     }
 
 private:
+    // Move the private key out for an ECDH with peer_encoding; false if the
+    // session is established or has no key.
+    bool take_private_key(const std::uint8_t* peer_encoding, fast::Scalar& sk) noexcept;
+    // Derive keys from the ECDH secret (erased) and mark the session established.
+    bool finish_handshake(std::array<std::uint8_t, 32>& shared_secret) noexcept;
+
+    static std::size_t complete_handshake_chunk(
+        Bip324Session* const* sessions, const std::uint8_t* peer_encodings,
+        std::size_t count, std::uint8_t* ok_out) noexcept;
+
     bool initiator_;
     bool established_ = false;
     bool privkey_valid_ = false;
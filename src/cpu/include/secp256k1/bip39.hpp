@@ -52,6 +52,19 @@ std::pair<std::array<std::uint8_t, 64>, bool>
 bip39_mnemonic_to_seed(const std::string& mnemonic,
                        const std::string& passphrase = "");
 
+// bip39_mnemonic_to_seed for `count` independent mnemonics. The 2048
+// PBKDF2 rounds of 8 (AVX-512) or 4 (AVX2) mnemonics run in lockstep on a
+// multi-buffer SHA-512; seeds are identical to the single call.
+//   passphrases: count entries, or nullptr for "" everywhere
+//   ok_out:      optional; false (and a zero seed) for an empty mnemonic
+// For bulk recovery / audit workloads; one call per mnemonic is fine
+// otherwise.
+void bip39_mnemonic_to_seed_batch(const std::string* mnemonics,
+                                  const std::string* passphrases,
+                                  std::size_t count,
+                                  std::array<std::uint8_t, 64>* seeds_out,
+                                  bool* ok_out = nullptr);
+
 // -- Mnemonic <-> Entropy Roundtrip -------------------------------------------
 
 // Decode mnemonic back to entropy bytes.
@@ -64,6 +64,43 @@ bool aead_chacha20_poly1305_decrypt(
     const std::uint8_t tag[16],
     std::uint8_t* out) noexcept;
 
+// -- Scatter/gather AEAD ------------------------------------------------------
+// Same construction, with the message given as a list of segments (iovec)
+// instead of one buffer. Segments are consecutive in the keystream and in the
+// MAC, so the result equals the contiguous call on their concatenation, with
+// no concatenation or allocation. The input and output lists may split the
+// message at different offsets but must cover the same total length. An
+// output byte may alias only the input byte at the same message offset.
+
+struct AeadSegment {
+    const std::uint8_t* data;
+    std::size_t         len;
+};
+
+struct AeadMutableSegment {
+    std::uint8_t* data;
+    std::size_t   len;
+};
+
+// Returns false (nothing written) if the two lists differ in total length.
+bool aead_chacha20_poly1305_encrypt_v(
+    const std::uint8_t key[32],
+    const std::uint8_t nonce[12],
+    const std::uint8_t* aad, std::size_t aad_len,
+    const AeadSegment* in, std::size_t in_count,
+    const AeadMutableSegment* out, std::size_t out_count,
+    std::uint8_t tag[16]) noexcept;
+
+// Returns false on a length mismatch or a bad tag; on a bad tag every output
+// segment is zeroed.
+bool aead_chacha20_poly1305_decrypt_v(
+    const std::uint8_t key[32],
+    const std::uint8_t nonce[12],
+    const std::uint8_t* aad, std::size_t aad_len,
+    const AeadSegment* in, std::size_t in_count,
+    const AeadMutableSegment* out, std::size_t out_count,
+    const std::uint8_t tag[16]) noexcept;
+
 } // namespace secp256k1
 
 #endif // SECP256K1_CHACHA20_POLY1305_HPP
@@ -99,6 +99,16 @@ std::pair<std::array<std::uint8_t, 20>, bool>
 ecrecover(const std::array<std::uint8_t, 32>& msg_hash,
           const EthSignature& sig);
 
+// Batch ecrecover over n packed signatures: msgs32 / rs32 / ss32 are n * 32
+// bytes, vs is n values. addrs20_out + 20*i gets the address and ok_out[i] = 1,
+// or zeros and 0; same per-entry result as ecrecover(). Keys come from
+// ecdsa_recover_batch (shared inversions and sqrts), addresses from
+// keccak256_batch over the packed x || y. Returns the number recovered.
+std::size_t ecrecover_batch(const std::uint8_t* msgs32, const std::uint8_t* rs32,
+                            const std::uint8_t* ss32, const std::uint64_t* vs,
+                            std::size_t n, std::uint8_t* addrs20_out,
+                            std::uint8_t* ok_out);
+
 // -- Verify: Check that signature was produced by address ---------------------
 
 // Verify that a personal_sign signature was produced by the given address.
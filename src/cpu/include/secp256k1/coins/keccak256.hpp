@@ -48,6 +48,15 @@ struct Keccak256State {
 // Compute Keccak-256 hash of data
 std::array<std::uint8_t, 32> keccak256(const std::uint8_t* data, std::size_t len);
 
+// -- Multi-Buffer API ---------------------------------------------------------
+
+// out32 + 32*i = keccak256(msgs + i*len, len) for i < n (n equal-length
+// messages, packed). With AVX2, four messages at a time share one
+// interleaved Keccak-f[1600] (one 64-bit lane of a 256-bit vector each);
+// the n % 4 tail, and hosts without AVX2, go through keccak256().
+void keccak256_batch(const std::uint8_t* msgs, std::size_t len, std::size_t n,
+                     std::uint8_t* out32);
+
 } // namespace secp256k1::coins
 
 #endif // SECP256K1_COINS_KECCAK256_HPP
@@ -208,6 +208,14 @@ Point scalar_mul(const Point& p, const Scalar& k) noexcept;
 FieldElement ecmult_const_xonly(const FieldElement& xn, const FieldElement& xd,
                                  const Scalar& q) noexcept;
 
+// x_out[i] = ecmult_const_xonly(xn[i], xd[i], q[i]) for i < n, with the final
+// inversions of up to 32 entries merged into one (Montgomery's trick). Each
+// scalar multiply stays constant-time in its own q[i]. On the 4x64 fallback
+// path this is a plain loop.
+void ecmult_const_xonly_batch(const FieldElement* xn, const FieldElement* xd,
+                              const Scalar* q, FieldElement* x_out,
+                              std::size_t n) noexcept;
+
 // Prebuilt GLV tables for a fixed base point P.
 // Build once with build_scalar_mul_tables(); reuse across many scalar_mul calls
 // with the same P. Saves ~1,954 ns per call (table build cost).
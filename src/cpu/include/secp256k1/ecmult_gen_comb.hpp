@@ -43,6 +43,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 #include "secp256k1/scalar.hpp"
@@ -95,6 +96,15 @@ public:
     bool save_cache(const std::string& path) const;
     bool load_cache(const std::string& path);
 
+    // Shared read-only table: save_mapped() writes the versioned, checksummed
+    // mapped format; load_mapped() maps it MAP_SHARED (optionally 2 MiB
+    // aligned + MADV_HUGEPAGE) and looks entries up in place, so processes
+    // loading the same file share one page-cache copy. Entries are checked
+    // on-curve like load_cache().
+    bool save_mapped(const std::string& path) const;
+    bool load_mapped(const std::string& path, bool huge_pages = false);
+    bool mapped() const noexcept { return static_cast<bool>(mapping_); }
+
 private:
     unsigned teeth_ = 0;     // Number of "teeth" (comb width in bits)
     unsigned spacing_ = 0;   // = ceil(256 / teeth_)
@@ -105,6 +115,10 @@ private:
     // positions b, b+spacing, b+2*spacing, ..., b+(teeth-1)*spacing
     std::vector<CombAffinePoint> table_;
 
+    // Lookup base: table_.data(), or the payload of mapping_.
+    const CombAffinePoint* entries_ = nullptr;
+    std::shared_ptr<const void> mapping_;
+
     // Build the comb table from generator G
     void build_table();
 
@@ -0,0 +1,95 @@
+#ifndef SECP256K1_FIELD_SIMD_HPP
+#define SECP256K1_FIELD_SIMD_HPP
+#pragma once
+
+// ============================================================================
+// Lane-parallel field arithmetic -- batch mul/sqr and Jacobian point kernels
+// ============================================================================
+//
+// ## WHY
+// FieldElement / FieldElement52 process one element at a time on the scalar
+// multiplier (MULX). Batch workloads -- many independent point doublings or
+// mixed additions, as in key-range walks and table builds -- leave the
+// vector units idle.
+//
+// ## TIERS (runtime-detected, see field_simd_tier())
+//
+//   Scalar -- FieldElement operators. Always available; the reference.
+//   AVX2   -- 4 lanes of 10x26 limbs in 64-bit lanes, VPMULUDQ products,
+//             libsecp256k1's 10x26 reduction (fe26_mul_inner) per lane.
+//   IFMA   -- 8 lanes of 5x52 limbs, VPMADD52LUQ/HUQ products
+//             (AVX-512F + AVX512-IFMA).
+//
+// Inputs are gathered from FieldElement arrays, converted once, kept in the
+// lane representation for the whole formula, and written back canonical --
+// every tier returns bit-identical results. Tails shorter than a full lane
+// group are zero-padded.
+//
+// field_simd_tier() picks the widest available tier. The gain comes from
+// keeping values in lane form across a whole formula: a lone field_mul_batch
+// pays a transpose per operand and is roughly at parity with the scalar
+// loop on AVX2 (bench_field_simd).
+//
+// Not constant-time with respect to which lanes hit the point-kernel edge
+// cases (see point_add_mixed_batch). Field ops are branch-free.
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+
+#include "secp256k1/field.hpp"
+
+namespace secp256k1::fast {
+
+enum class FieldSimdTier : int {
+    Scalar = 0,
+    AVX2   = 1,   // 4 x 10x26
+    IFMA   = 2,   // 8 x 5x52
+};
+
+/// True if the CPU and OS support the tier (Scalar is always available).
+bool field_simd_available(FieldSimdTier tier) noexcept;
+
+/// Tier used by default: the fastest available (cached after first call).
+FieldSimdTier field_simd_tier() noexcept;
+
+/// "scalar", "avx2" or "ifma".
+const char* field_simd_tier_name(FieldSimdTier tier) noexcept;
+
+// -- Field batches ------------------------------------------------------------
+// out[i] = a[i] * b[i] (resp. a[i]^2). out may alias a or b. A tier that is
+// not available falls back to Scalar.
+
+void field_mul_batch(const FieldElement* a, const FieldElement* b, FieldElement* out,
+                     std::size_t n, FieldSimdTier tier = field_simd_tier()) noexcept;
+
+void field_sqr_batch(const FieldElement* a, FieldElement* out,
+                     std::size_t n, FieldSimdTier tier = field_simd_tier()) noexcept;
+
+/// out[i] = a[i]^((p+1)/4) and ok[i] = 1 iff out[i]^2 == a[i], i.e. out[i]
+/// is a square root of a[i] (the same root as FieldElement::sqrt()). The
+/// whole 253S + 13M addition chain stays in lane form. out may alias a.
+void field_sqrt_batch(const FieldElement* a, FieldElement* out, std::uint8_t* ok,
+                      std::size_t n, FieldSimdTier tier = field_simd_tier()) noexcept;
+
+// -- Point batches (SoA Jacobian coordinates, Z = 0 is infinity) --------------
+// Outputs may alias the matching inputs.
+
+/// (X3, Y3, Z3)[i] = 2 * (X, Y, Z)[i].  3M + 4S per point.
+void point_double_batch(const FieldElement* X, const FieldElement* Y, const FieldElement* Z,
+                        FieldElement* X3, FieldElement* Y3, FieldElement* Z3,
+                        std::size_t n, FieldSimdTier tier = field_simd_tier()) noexcept;
+
+/// (X3, Y3, Z3)[i] = (X1, Y1, Z1)[i] + (x2, y2)[i] with the second point
+/// affine.  8M + 3S per point. The lanes where the generic formula breaks
+/// down (P1 at infinity, P1 == P2) are recomputed on the scalar path after
+/// the vector pass, so the result is exact for every input; P1 == -P2
+/// yields Z3 = 0.
+void point_add_mixed_batch(const FieldElement* X1, const FieldElement* Y1, const FieldElement* Z1,
+                           const FieldElement* x2, const FieldElement* y2,
+                           FieldElement* X3, FieldElement* Y3, FieldElement* Z3,
+                           std::size_t n, FieldSimdTier tier = field_simd_tier()) noexcept;
+
+} // namespace secp256k1::fast
+
+#endif // SECP256K1_FIELD_SIMD_HPP
@@ -11,16 +11,18 @@
 //   Tier 0: SCALAR   -- Portable C++ (baseline, always available)
 //   Tier 1: ARM SHA2 -- ARMv8 SHA-256 instructions (single-message HW accel)
 //   Tier 2: SHA-NI   -- Intel SHA Extensions (single-message HW accel, ~3-5x)
-//   Tier 3: AVX2     -- 4-way multi-buffer SHA-256 (interleaved, ~8-12x)
-//                       + optimized RIPEMD-160 with BMI/BMI2
-//   Tier 4: AVX-512  -- 8-way multi-buffer SHA-256 (if available, ~16x)
+//   Tier 3: AVX2     -- 8-way multi-buffer SHA-256 + RIPEMD-160 (batch only)
+//   Tier 4: AVX-512  -- 16-way multi-buffer SHA-256 + RIPEMD-160 (batch only)
+//
+// Single-message calls use tiers 0-2. The *_batch functions use the widest
+// multi-buffer tier the CPU and OS support (see batch_hash_tier()).
 //
 // ## Hot-path API for search pipeline:
 //
 //   Compressed pubkey (33 bytes) -> SHA-256 -> RIPEMD-160 = Hash160 (20 bytes)
 //
 //   - hash160_single():       single pubkey -> 20 bytes
-//   - hash160_batch():        N pubkeys -> Nx20 bytes (multi-buffer SIMD)
+//   - hash160_33_batch():     N pubkeys -> Nx20 bytes (multi-buffer SIMD)
 //   - sha256_33():            SHA-256 of exactly 33 bytes (pubkey-optimized)
 //   - ripemd160_32():         RIPEMD-160 of exactly 32 bytes (SHA output)
 //
@@ -43,6 +45,11 @@
     #endif
 #endif
 
+// Multi-buffer kernels need GCC/Clang vector extensions + target attributes.
+#if defined(SECP256K1_X86_TARGET) && (defined(__GNUC__) || defined(__clang__))
+    #define SECP256K1_HASH_MULTIBUFFER 1
+#endif
+
 namespace secp256k1::hash {
 
 // -- Feature Detection --------------------------------------------------------
@@ -51,13 +58,18 @@ enum class HashTier : int {
     SCALAR  = 0,
     ARM_SHA2 = 1, // ARMv8 SHA-256 instructions
     SHA_NI  = 2,  // Intel SHA Extensions
-    AVX2    = 3,  // 4-way multi-buffer
-    AVX512  = 4,  // 8-way multi-buffer
+    AVX2    = 3,  // 8-way multi-buffer
+    AVX512  = 4,  // 16-way multi-buffer
 };
 
 /// Detect best available hashing tier at runtime.
 HashTier detect_hash_tier() noexcept;
 
+/// Tier used by the *_batch functions: AVX512 or AVX2 when the multi-buffer
+/// kernels are compiled in and the CPU/OS support them, else the
+/// single-message tier from detect_hash_tier().
+HashTier batch_hash_tier() noexcept;
+
 /// Human-readable tier name.
 const char* hash_tier_name(HashTier tier) noexcept;
 
@@ -102,7 +114,8 @@ void hash160_33(const std::uint8_t* pubkey33, std::uint8_t* out20) noexcept;
 // -- Batch operations (multi-buffer SIMD) -------------------------------------
 //
 // Process multiple independent messages simultaneously using SIMD lanes.
-// AVX2: 4 messages per cycle, AVX-512: 8 messages per cycle.
+// AVX2: 8 messages per pass, AVX-512: 16 messages per pass; the tail that
+// does not fill a pass goes through the single-message path.
 // Falls back to sequential scalar/SHA-NI when SIMD unavailable.
 //
 // All batch functions expect contiguous arrays:
@@ -126,13 +139,31 @@ void ripemd160_32_batch(
     std::size_t count) noexcept;
 
 /// Batch Hash160 of Nx33-byte compressed pubkeys.
-/// Fused pipeline: strides of 4/8 messages through SHA256->RIPEMD160.
+/// Fused pipeline: strides of 8/16 messages through SHA256->RIPEMD160
+/// without leaving SIMD registers between the two hashes.
 /// out20s: caller-allocated, at least countx20 bytes.
 void hash160_33_batch(
     const std::uint8_t* pubkeys,    // count x 33 bytes (packed)
     std::uint8_t* out20s,           // count x 20 bytes output
     std::size_t count) noexcept;
 
+// -- Multi-buffer PBKDF2-HMAC-SHA512 ------------------------------------------
+//
+// The iteration loop of PBKDF2-HMAC-SHA512 for `count` independent
+// passwords in lockstep: 8 lanes per pass on AVX-512, 4 on AVX2, the rest
+// one at a time. Per entry i (all values are big-endian SHA-512 words):
+//   inner[i], outer[i]  state after compressing the HMAC key ^ ipad / opad
+//                       block (SHA512::Midstate::state)
+//   t[i]                in: U_1; out: U_1 ^ U_2 ^ ... ^ U_iterations
+// Every round is exactly two compressions; iterations <= 1 leaves t as is.
+
+void pbkdf2_sha512_iterate_batch(
+    const std::uint64_t (*inner)[8],
+    const std::uint64_t (*outer)[8],
+    std::uint64_t (*t)[8],
+    std::size_t count,
+    std::uint32_t iterations) noexcept;
+
 // -- Implementation selectors (for benchmarking / testing) --------------------
 // These bypass auto-detection to force a specific tier.
 
@@ -154,6 +185,27 @@ namespace shani {
 }
 #endif
 
+#ifdef SECP256K1_HASH_MULTIBUFFER
+// Exactly 8 (AVX2) / 16 (AVX-512) packed messages per call. Callers must
+// check avx2_available() / avx512_available() first.
+namespace avx2 {
+    void sha256_33_x8(const std::uint8_t* pubkeys, std::uint8_t* out32s) noexcept;
+    void ripemd160_32_x8(const std::uint8_t* in32s, std::uint8_t* out20s) noexcept;
+    void hash160_33_x8(const std::uint8_t* pubkeys, std::uint8_t* out20s) noexcept;
+    // 4 PBKDF2-HMAC-SHA512 entries (see pbkdf2_sha512_iterate_batch).
+    void pbkdf2_sha512_x4(const std::uint64_t (*inner)[8], const std::uint64_t (*outer)[8],
+                          std::uint64_t (*t)[8], std::uint32_t iterations) noexcept;
+}
+namespace avx512 {
+    void sha256_33_x16(const std::uint8_t* pubkeys, std::uint8_t* out32s) noexcept;
+    void ripemd160_32_x16(const std::uint8_t* in32s, std::uint8_t* out20s) noexcept;
+    void hash160_33_x16(const std::uint8_t* pubkeys, std::uint8_t* out20s) noexcept;
+    // 8 PBKDF2-HMAC-SHA512 entries (see pbkdf2_sha512_iterate_batch).
+    void pbkdf2_sha512_x8(const std::uint64_t (*inner)[8], const std::uint64_t (*outer)[8],
+                          std::uint64_t (*t)[8], std::uint32_t iterations) noexcept;
+}
+#endif
+
 } // namespace secp256k1::hash
 
 #endif // SECP256K1_HASH_ACCEL_HPP
@@ -0,0 +1,141 @@
+#ifndef SECP256K1_KEY_RANGE_PIPELINE_HPP
+#define SECP256K1_KEY_RANGE_PIPELINE_HPP
+#pragma once
+
+// ============================================================================
+// Streaming key-range pipeline: scalar range -> pubkey -> hash160 -> filter
+// ============================================================================
+//
+// ## WHY
+// batch_add_affine_* and hash::hash160_33_batch are fast on their own, but
+// glued together with whole-range intermediate buffers (all X's, then all
+// pubkeys, then all hashes) the audit loop becomes memory-bound: every stage
+// streams its input back in from DRAM.
+//
+// ## MODEL
+// Keys k_i = start + i * step, i in [0, count), are processed in tiles of
+// `tile` consecutive indices. For each tile, with base B = k_{b-1} * G:
+//
+//   1. batch_add_affine_x_with_parity(B, T)  T[j] = (j + 1) * step * G
+//   2. compress   -> tile x 33 bytes
+//   3. hash160_33_batch (AVX2 / AVX-512 multi-buffer)
+//   4. probe Hash160Filter (Bloom word + exact sorted set)
+//
+// All four stages touch only per-thread scratch sized for one tile, so the
+// working set (tile x ~120 bytes + the shared 64-byte/entry offset table)
+// stays in L2. The next tile's base is one point addition away
+// (B += tile * step * G), so there is no per-tile scalar multiplication.
+//
+// With a ThreadPool, contiguous runs of tiles are spread over the pool;
+// each run computes its own first base with one k*G and allocates its own
+// scratch. Matches are returned sorted by index regardless of scheduling.
+//
+// Only compressed-pubkey hash160 (P2PKH / P2WPKH) is produced.
+// ============================================================================
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "secp256k1/batch_add_affine.hpp"
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+
+namespace secp256k1 {
+class ThreadPool;
+}
+
+namespace secp256k1::fast {
+
+// -- Filter ----------------------------------------------------------------
+
+/// Immutable set of 20-byte hash160 values with a cheap negative answer.
+///
+/// A blocked Bloom prefilter (one 64-bit word per probe, 2 bits, ~16 bits
+/// per entry, ~1.5% false positives) rejects almost every candidate with a
+/// single cache miss; survivors are confirmed by binary search over the
+/// sorted, de-duplicated set. contains() has no false positives.
+class Hash160Filter {
+public:
+    Hash160Filter() = default;
+
+    /// @param hashes  count x 20 bytes, packed. Duplicates are allowed.
+    Hash160Filter(const std::uint8_t* hashes, std::size_t count);
+
+    /// Exact membership test.
+    bool contains(const std::uint8_t* hash20) const noexcept;
+
+    /// Prefilter only (may return true for non-members).
+    bool maybe_contains(const std::uint8_t* hash20) const noexcept;
+
+    /// Distinct hashes in the set.
+    std::size_t size() const noexcept { return sorted_.size(); }
+
+    /// Heap bytes held (prefilter + sorted set).
+    std::size_t memory_bytes() const noexcept;
+
+private:
+    std::vector<std::uint64_t>               bits_;
+    std::uint64_t                            word_mask_ = 0;
+    std::vector<std::array<std::uint8_t, 20>> sorted_;
+};
+
+// -- Pipeline --------------------------------------------------------------
+
+struct KeyRangeMatch {
+    std::uint64_t                 index = 0;   // key = start + index * step
+    Scalar                        key;
+    std::array<std::uint8_t, 33>  pubkey{};    // compressed
+    std::array<std::uint8_t, 20>  hash160{};
+};
+
+struct KeyRangeStats {
+    std::uint64_t keys    = 0;   // keys hashed and probed (k == 0 is skipped)
+    std::uint64_t matches = 0;
+    double        seconds = 0.0;
+
+    double keys_per_second() const noexcept {
+        return seconds > 0.0 ? static_cast<double>(keys) / seconds : 0.0;
+    }
+};
+
+class KeyRangePipeline {
+public:
+    /// 1024 points: ~120 KB of per-thread scratch + 64 KB offset table.
+    static constexpr std::size_t kDefaultTile = 1024;
+
+    /// Precomputes T[j] = (j + 1) * step * G for j < tile.
+    /// @throws std::invalid_argument if step == 0 or tile == 0.
+    explicit KeyRangePipeline(const Scalar& step, std::size_t tile = kDefaultTile);
+
+    const Scalar& step() const noexcept { return step_; }
+    std::size_t   tile() const noexcept { return tile_; }
+
+    /// Scan keys start + i * step for i in [0, count) on the calling thread.
+    /// Matches are appended to `matches` in index order.
+    KeyRangeStats scan(const Scalar& start, std::uint64_t count,
+                       const Hash160Filter& filter,
+                       std::vector<KeyRangeMatch>& matches) const;
+
+    /// Same, with tiles spread across `pool` (per-run scratch buffers).
+    KeyRangeStats scan(const Scalar& start, std::uint64_t count,
+                       const Hash160Filter& filter,
+                       std::vector<KeyRangeMatch>& matches,
+                       ThreadPool& pool) const;
+
+private:
+    KeyRangeStats scan_impl(const Scalar& start, std::uint64_t count,
+                            const Hash160Filter& filter,
+                            std::vector<KeyRangeMatch>& matches,
+                            ThreadPool* pool) const;
+
+    Scalar                          step_;
+    std::size_t                     tile_;
+    std::vector<AffinePointCompact> offsets_;     // (j + 1) * step * G
+    Point                           tile_step_;   // tile * step * G
+};
+
+} // namespace secp256k1::fast
+
+#endif // SECP256K1_KEY_RANGE_PIPELINE_HPP
@@ -24,6 +24,8 @@
 //   - Pre-allocates all buckets in a single flat array (no heap per iteration)
 //   - Uses predecoded digits and bucket reuse on the optimized CPU path
 //   - Falls back to Strauss for small n
+//   - From n >= 1024, fills buckets in affine coordinates with batched
+//     inversions (pippenger_msm_affine)
 //
 // Reference: Bernstein, Doumen, Lange, Oosterwijk (2012),
 //            "Faster batch forgery identification"
@@ -37,6 +39,8 @@
 
 namespace secp256k1 {
 
+class ThreadPool;  // secp256k1/thread_pool.hpp
+
 // -- Pippenger Multi-Scalar Multiplication ------------------------------------
 // Computes: R = sum( scalars[i] * points[i] ) for i in [0, n).
 // Uses bucket method (Pippenger) which is asymptotically optimal.
@@ -59,13 +63,33 @@ fast::Point pippenger_msm(const fast::Scalar* scalars,
 fast::Point pippenger_msm(const std::vector<fast::Scalar>& scalars,
                           const std::vector<fast::Point>& points);
 
+// -- Affine-bucket Pippenger --------------------------------------------------
+// Same windows and signed digits as pippenger_msm(), but buckets are filled in
+// affine coordinates. Each round adds the entries of every bucket in pairs,
+// with one inversion shared by all pairs of the round (Montgomery's trick),
+// until every bucket holds a single point:
+//
+//   affine add:  ~5M + 1S per add + 3M for the shared inversion
+//   mixed add:   ~8M + 3S per add (pippenger_msm scatter)
+//
+// A round costs one inversion whatever its size, so this only pays once the
+// buckets are deep: see msm_select_engine(). Scratch (~200 bytes per point)
+// is allocated per call, not kept in thread_local storage.
+fast::Point pippenger_msm_affine(const fast::Scalar* scalars,
+                                 const fast::Point* points,
+                                 std::size_t n);
+
+fast::Point pippenger_msm_affine(const std::vector<fast::Scalar>& scalars,
+                                 const std::vector<fast::Point>& points);
+
 // -- Optimal Window Width -----------------------------------------------------
 // Returns the optimal bucket window width c for n points.
 // Uses measured CPU bands, not just the textbook floor(log2(n)) heuristic.
 unsigned pippenger_optimal_window(std::size_t n);
 
 // -- Unified MSM (auto-selects best algorithm) --------------------------------
-// Automatically picks Strauss for very small MSMs and Pippenger from n >= 48.
+// Automatically picks Strauss for very small MSMs, Jacobian-bucket Pippenger
+// from n >= 48 and affine-bucket Pippenger from n >= 1024.
 fast::Point msm(const fast::Scalar* scalars,
                 const fast::Point* points,
                 std::size_t n);
@@ -73,6 +97,105 @@ fast::Point msm(const fast::Scalar* scalars,
 fast::Point msm(const std::vector<fast::Scalar>& scalars,
                 const std::vector<fast::Point>& points);
 
+enum class MsmEngine : std::uint8_t {
+    Auto,              // msm_select_engine(n)
+    Strauss,           // multi_scalar_mul()
+    Pippenger,         // pippenger_msm(), Jacobian buckets
+    PippengerAffine,   // pippenger_msm_affine(), batched-inversion buckets
+};
+
+// The engine msm() uses for n points. Both Pippenger engines take their
+// window from pippenger_optimal_window(n).
+MsmEngine msm_select_engine(std::size_t n);
+
+// msm() with an explicit engine (Auto = msm_select_engine(n)).
+fast::Point msm(const fast::Scalar* scalars,
+                const fast::Point* points,
+                std::size_t n,
+                MsmEngine engine);
+
+// -- Parallel MSM -------------------------------------------------------------
+// Splits the point set into contiguous slices (>= 2048 points each), runs
+// msm() on every slice on `pool`, and sums the partial results in slice order.
+// Each slice keeps its own buckets and digit scratch (thread_local), so there
+// is no shared state between participants; the only serial step is adding
+// P partial points at the end.
+//
+// max_threads: cap on slices (0 = pool.size()). Inputs too small to give every
+// slice 2048 points use fewer slices, down to a plain msm() call.
+fast::Point msm_parallel(const fast::Scalar* scalars,
+                         const fast::Point* points,
+                         std::size_t n,
+                         ThreadPool& pool,
+                         unsigned max_threads = 0);
+
+// -- Prepared MSM (fixed point set) -------------------------------------------
+// For MSMs that reuse one point vector with fresh scalars: Bulletproof
+// generator vectors, a fixed committee's pubkeys, FROST verification shares.
+//
+// Preparation stores, for every point P_i and every c-bit window j, the affine
+// multiple 2^(c*j) * P_i (n * (256/c + 1) entries, one batched inversion per
+// chunk). An MSM then scatters every signed window digit of every scalar into
+// ONE set of 2^(c-1) buckets and aggregates once:
+//
+//   prepared:       n * (256/c + 1) mixed adds + ~2^c adds, no doublings
+//   pippenger_msm:  the same scatter + (256/c) * ~2^c adds + 256 doublings
+//
+// With aggregation paid once per call instead of once per window, c can be
+// larger: c=10 for n=256 (~2x faster than pippenger_msm on the range-proof
+// MSM). Memory is 64 bytes (80 with 5x52 limbs) per entry, e.g. 426 KB for
+// 256 points at c=10.
+//
+// msm() is const and keeps its buckets in thread_local scratch, so one
+// PreparedMsm can be shared by many threads.
+class PreparedMsm {
+public:
+    static constexpr unsigned kMaxWindowBits = 16;
+
+    PreparedMsm() = default;
+
+    // window_bits: 0 = prepared_msm_optimal_window(n), otherwise 2..16.
+    // @throws std::invalid_argument for any other window_bits.
+    PreparedMsm(const fast::Point* points, std::size_t n, unsigned window_bits = 0);
+    explicit PreparedMsm(const std::vector<fast::Point>& points, unsigned window_bits = 0);
+
+    std::size_t size() const noexcept { return n_; }
+    unsigned window_bits() const noexcept { return c_; }
+    bool empty() const noexcept { return n_ == 0; }
+
+    // Heap bytes held by the precomputed multiples.
+    std::size_t memory_bytes() const noexcept;
+
+    // sum(scalars[i] * P_i) for i < min(n, size()).
+    fast::Point msm(const fast::Scalar* scalars, std::size_t n) const;
+    fast::Point msm(const std::vector<fast::Scalar>& scalars) const;
+
+    // Same, with the points split into contiguous slices on `pool`; each
+    // slice has its own buckets, partial sums are added in slice order.
+    fast::Point msm(const fast::Scalar* scalars, std::size_t n, ThreadPool& pool) const;
+
+private:
+#if defined(SECP256K1_FAST_52BIT)
+    using Entry = fast::AffinePoint52;
+#else
+    struct Entry {
+        fast::FieldElement x;
+        fast::FieldElement y;
+    };
+#endif
+
+    fast::Point msm_range(const fast::Scalar* scalars, std::size_t begin, std::size_t end) const;
+
+    std::size_t               n_       = 0;
+    unsigned                  c_       = 0;
+    unsigned                  windows_ = 0;
+    std::vector<Entry>        table_;       // table_[i * windows_ + j] = 2^(c*j) * P_i
+    std::vector<std::uint8_t> infinity_;    // P_i is the point at infinity
+};
+
+// Window width for PreparedMsm: minimizes n * (256/c + 1) + 2^c.
+unsigned prepared_msm_optimal_window(std::size_t n);
+
 } // namespace secp256k1
 
 #endif // SECP256K1_PIPPENGER_HPP
@@ -60,6 +60,24 @@ struct FixedBaseConfig {
     bool cache_path_set = false;        // true when cache_path was explicitly set
     std::string cache_dir = "";         // Default cache directory with all precomputed tables
     unsigned max_windows_to_load = 0U;  // Load all windows for optimal performance
+
+    // Shared read-only tables (desktop only). With use_mmap the cache lives in
+    // the versioned, checksummed mapped format next to the legacy file
+    // (cache_w18.bin -> cache_w18.tbl) and is mapped MAP_SHARED, so every
+    // process on the host reads the same page-cache copy instead of holding a
+    // private heap copy. A missing or invalid .tbl is converted from the .bin
+    // (or built) once, published atomically, then mapped.
+    bool use_mmap = false;
+    bool huge_pages = false;            // 2 MiB aligned mapping + MADV_HUGEPAGE (file THP / tmpfs huge=)
+    bool verify_table_checksum = true;  // Hash the mapped payload on load (~0.1 s per GB)
+
+    // Background loading (desktop only). The first generator multiplication
+    // (or ensure_fixed_base_ready) installs a w=8 table in a few milliseconds
+    // and returns; a worker thread then builds / loads / maps the configured
+    // tables and swaps them in atomically. Calls in flight finish on the w=8
+    // table. Watch fixed_base_status() or wait_fixed_base_fast_path().
+    // configure_fixed_base() cancels an unfinished load.
+    bool background_load = false;
     
     // Progress reporting
     ProgressCallback progress_callback = nullptr;  // Optional progress reporting
@@ -90,13 +108,51 @@ void configure_fixed_base(const FixedBaseConfig& config);
 void ensure_fixed_base_ready();
 bool fixed_base_ready();
 
+// Where the live fixed-base tables came from and what they cost to get ready.
+enum class FixedBaseSource : std::uint8_t {
+    None,        // not built yet
+    Built,       // generated in this process
+    CacheFile,   // read from the legacy cache_w{bits}.bin
+    MappedFile,  // mapped from an existing cache_w{bits}.tbl
+    Static,      // compiled-in table (SECP256K1_CORE_BACKEND_MODE)
+    Fallback     // interim w=8 table while background_load runs
+};
+
+struct FixedBaseLoadInfo {
+    FixedBaseSource source = FixedBaseSource::None;
+    double ready_ms = 0.0;          // Wall time of the call that made the tables ready
+    std::size_t table_bytes = 0;    // Bytes of point tables in use
+    bool shared_mapping = false;    // Tables live in a read-only shared file mapping
+    bool huge_pages = false;        // MADV_HUGEPAGE accepted for that mapping
+};
+
+// Snapshot for the current configuration (source None until first use).
+FixedBaseLoadInfo fixed_base_load_info();
+
+// Readiness of the generator tables, cheap enough to poll from a health check.
+struct FixedBaseStatus {
+    bool ready = false;          // generator multiplication answers without building
+    bool fast_path = false;      // the configured tables (not the w=8 fallback) are live
+    bool loading = false;        // background load in flight
+    bool failed = false;         // background load failed; the w=8 table stays live
+    double progress = 0.0;       // fraction of the background load done (1.0 on the fast path)
+    unsigned window_bits = 0;    // window of the tables serving calls now (0 = none)
+};
+
+FixedBaseStatus fixed_base_status();
+
+// Waits until no background load is in flight, or timeout_ms (0 = no limit).
+// Returns true when the configured tables are live.
+bool wait_fixed_base_fast_path(unsigned timeout_ms = 0);
+
 // ----------------------------------------------------------------------------
 // Library-level helpers to reduce per-app boilerplate
 // ----------------------------------------------------------------------------
 // Load FixedBase settings from a simple INI-style file and configure globally.
 // Supported keys (case-insensitive):
 //   cache_dir, cache_path, window_bits, enable_glv, use_jsf, use_cache,
-//   max_windows, thread_count, use_comb, comb_width
+//   max_windows, thread_count, use_comb, comb_width, use_mmap, huge_pages,
+//   verify_table_checksum, background_load
 // Lines starting with '#' or ';' are comments. Empty lines ignored.
 // Example:
 //   cache_dir=F:\\EccTables
@@ -28,6 +28,7 @@
 // ============================================================================
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include "secp256k1/ecdsa.hpp"
@@ -75,6 +76,25 @@ std::pair<Point, bool> ecdsa_recover(
     const ECDSASignature& sig,
     int recid);
 
+// -- Batch Public Key Recovery ------------------------------------------------
+// ecdsa_recover() for n signatures, with the same result per entry:
+//   - the n R lifts share one lane-parallel field_sqrt_batch,
+//   - the n r^-1 share one scalar inversion (Montgomery's trick),
+//   - each Q = u1*G + u2*R is one 4-stream GLV Strauss dual_scalar_mul_gen_point,
+//   - the Q are made affine with one field inversion (Point::batch_normalize).
+// out[i] is the affine recovered key and ok_out[i] = 1, or infinity and 0.
+// Returns the number of keys recovered. Variable-time (public data).
+std::size_t ecdsa_recover_batch(const std::array<std::uint8_t, 32>* msg_hashes,
+                                const ECDSASignature* sigs, const int* recids,
+                                std::size_t n, Point* out, std::uint8_t* ok_out);
+
+// -- Nonce Point Lifting ------------------------------------------------------
+// Reconstructs the signing nonce point R from sig.r and recid (steps 1-2 of
+// ecdsa_recover): R.x = r (+ n if recid bit 1), y parity = recid bit 0.
+// The returned point is affine. Fails if recid is out of range, r is zero,
+// r + n would exceed p, or R.x is not on the curve. Variable-time (public data).
+std::pair<Point, bool> ecdsa_lift_r(const ECDSASignature& sig, int recid);
+
 // -- Compact Recovery Serialization -------------------------------------------
 // 65-byte format: [recid_byte] [r: 32 bytes] [s: 32 bytes]
 // recid_byte = 27 + recid + (compressed ? 4 : 0)
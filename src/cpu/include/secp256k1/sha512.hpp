@@ -116,6 +116,94 @@ public:
         return ctx.finalize();
     }
 
+    // Compact midstate (state + byte count), valid on a block boundary --
+    // e.g. after absorbing a 128-byte HMAC key pad. Same shape as
+    // SHA256::Midstate.
+    struct Midstate {
+        std::uint64_t state[8];
+        std::uint64_t total;
+    };
+
+    Midstate capture_midstate() const noexcept {
+        Midstate m;
+        for (int i = 0; i < 8; ++i) m.state[i] = state_[i];
+        m.total = total_;
+        return m;
+    }
+
+    static SHA512 from_midstate(const Midstate& m) noexcept {
+        SHA512 ctx;
+        for (int i = 0; i < 8; ++i) ctx.state_[i] = m.state[i];
+        ctx.total_ = m.total;
+        return ctx;
+    }
+
+    // One compression on a block given as 16 big-endian message words.
+    // For fixed-shape inner loops (PBKDF2) that keep digests as words.
+    static void compress_words(std::uint64_t state[8], const std::uint64_t block[16]) noexcept {
+        std::uint64_t W[80];
+        for (int i = 0; i < 16; ++i) W[i] = block[i];
+        for (int i = 16; i < 80; ++i) {
+            W[i] = sigma1(W[i - 2]) + W[i - 7] + sigma0(W[i - 15]) + W[i - 16];
+        }
+
+        std::uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+        std::uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (int i = 0; i < 80; ++i) {
+            std::uint64_t const t1 = h + Sigma1(e) + ch64(e, f, g) + K[i] + W[i];
+            std::uint64_t const t2 = Sigma0(a) + maj64(a, b, c);
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
+
+    static constexpr std::uint64_t K[80] = {
+        0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL,
+        0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+        0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+        0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+        0xd807aa98a3030242ULL, 0x12835b0145706fbeULL,
+        0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+        0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL,
+        0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+        0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+        0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+        0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL,
+        0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+        0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL,
+        0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+        0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+        0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+        0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL,
+        0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+        0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL,
+        0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+        0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+        0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+        0xd192e819d6ef5218ULL, 0xd69906245565a910ULL,
+        0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+        0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL,
+        0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+        0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+        0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+        0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL,
+        0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+        0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL,
+        0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+        0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+        0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+        0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL,
+        0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+        0x28db77f523047d84ULL, 0x32caab7b40c72493ULL,
+        0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+        0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+        0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+    };
+
 private:
     static std::uint64_t rotr64(std::uint64_t x, unsigned n) noexcept {
         return (x >> n) | (x << (64u - n));
@@ -140,50 +228,7 @@ private:
     }
 
     void compress(const std::uint8_t* block) noexcept {
-        static constexpr std::uint64_t K[80] = {
-            0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL,
-            0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
-            0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
-            0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
-            0xd807aa98a3030242ULL, 0x12835b0145706fbeULL,
-            0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
-            0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL,
-            0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
-            0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
-            0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
-            0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL,
-            0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
-            0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL,
-            0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
-            0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
-            0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
-            0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL,
-            0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
-            0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL,
-            0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
-            0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
-            0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
-            0xd192e819d6ef5218ULL, 0xd69906245565a910ULL,
-            0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
-            0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL,
-            0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
-            0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
-            0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
-            0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL,
-            0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
-            0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL,
-            0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
-            0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
-            0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
-            0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL,
-            0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
-            0x28db77f523047d84ULL, 0x32caab7b40c72493ULL,
-            0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
-            0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
-            0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
-        };
-
-        std::uint64_t W[80];
+        std::uint64_t W[16];
         for (int i = 0; i < 16; ++i) {
             W[i] = (static_cast<std::uint64_t>(block[i * 8 + 0]) << 56) |
                    (static_cast<std::uint64_t>(block[i * 8 + 1]) << 48) |
@@ -194,22 +239,7 @@ private:
                    (static_cast<std::uint64_t>(block[i * 8 + 6]) << 8) |
                    (static_cast<std::uint64_t>(block[i * 8 + 7]));
         }
-        for (int i = 16; i < 80; ++i) {
-            W[i] = sigma1(W[i - 2]) + W[i - 7] + sigma0(W[i - 15]) + W[i - 16];
-        }
-
-        std::uint64_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
-        std::uint64_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
-
-        for (int i = 0; i < 80; ++i) {
-            std::uint64_t const t1 = h + Sigma1(e) + ch64(e, f, g) + K[i] + W[i];
-            std::uint64_t const t2 = Sigma0(a) + maj64(a, b, c);
-            h = g; g = f; f = e; e = d + t1;
-            d = c; c = b; b = a; a = t1 + t2;
-        }
-
-        state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d;
-        state_[4] += e; state_[5] += f; state_[6] += g; state_[7] += h;
+        compress_words(state_, W);
     }
 
     std::uint64_t state_[8]{};
@@ -0,0 +1,220 @@
+#ifndef SECP256K1_SP_CHAIN_SCAN_HPP
+#define SECP256K1_SP_CHAIN_SCAN_HPP
+#pragma once
+
+// ============================================================================
+// Resumable BIP-352 chain scanner over a per-block tweak index
+// ============================================================================
+//
+// ## WHY
+// fast_scan_batch / SilentPaymentScanner::scan_batch take a vector of
+// transactions held in memory. A wallet catching up over hundreds of
+// thousands of blocks instead reads the tweaks an index server publishes
+// (T = input_hash x A_sum per eligible tx, 33 bytes compressed), wants to
+// stop and resume without rescanning, and wants the EC work spread across
+// cores.
+//
+// ## INDEX FORMAT
+// A flat sequence of block records, all integers little-endian:
+//
+//   u32 height | u32 count | count x 33-byte compressed tweak
+//
+// Records can be read straight from a memory-mapped file (SpTweakIndexFile)
+// or any buffer (SpTweakIndexReader); sp_tweak_index_append() writes one.
+//
+// ## MODEL
+// Blocks are queued until `batch_tweaks` tweaks are pending, then the whole
+// batch is scanned: the tweaks are split into contiguous slices across the
+// pool and every participant runs the full chain on its slice
+//
+//   decompress -> scan x T (KPlan) -> batch_to_compressed -> tagged SHA-256
+//   (shared midstate) -> batch_scalar_mul_generator + B_spend -> x-only
+//
+// so the stages share per-thread scratch and one inversion per stage and
+// slice. Results come back per block in height order: the k = 0 candidate
+// x-only key for every tweak, to be compared against the block's taproot
+// outputs. After each batch the checkpoint (next height, index offset) is
+// updated; handing it to resume() continues from the first unreported block.
+//
+// Not constant-time (same as fast_scan_batch): for wallet-side scanning.
+// ============================================================================
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+
+namespace secp256k1 {
+
+class ThreadPool;  // secp256k1/thread_pool.hpp
+
+// -- Tweak index ------------------------------------------------------------
+
+struct SpTweakBlock {
+    std::uint32_t       height   = 0;
+    std::uint32_t       count    = 0;
+    const std::uint8_t* tweaks33 = nullptr;   // count x 33 bytes, points into the index
+};
+
+/// Appends one block record to `out`.
+void sp_tweak_index_append(std::vector<std::uint8_t>& out, std::uint32_t height,
+                           const std::uint8_t* tweaks33, std::size_t count);
+
+/// Forward cursor over block records in [data, data + size).
+class SpTweakIndexReader {
+public:
+    static constexpr std::size_t kRecordHeaderBytes = 8;
+
+    SpTweakIndexReader(const std::uint8_t* data, std::size_t size,
+                       std::size_t offset = 0) noexcept;
+
+    /// Next record; false at the end of the index or on a truncated record
+    /// (malformed() tells the two apart). The cursor does not move on failure.
+    bool next(SpTweakBlock& block) noexcept;
+
+    /// Byte offset of the next record.
+    std::size_t offset() const noexcept { return offset_; }
+    void seek(std::size_t offset) noexcept;
+
+    bool at_end() const noexcept { return offset_ >= size_; }
+    bool malformed() const noexcept { return malformed_; }
+
+private:
+    const std::uint8_t* data_;
+    std::size_t         size_;
+    std::size_t         offset_;
+    bool                malformed_ = false;
+};
+
+/// Read-only shared mapping of a tweak index file. Closed on destruction.
+class SpTweakIndexFile {
+public:
+    SpTweakIndexFile() = default;
+    ~SpTweakIndexFile();
+    SpTweakIndexFile(const SpTweakIndexFile&) = delete;
+    SpTweakIndexFile& operator=(const SpTweakIndexFile&) = delete;
+
+    /// Maps `path`; false (and closed) if it cannot be opened or is empty.
+    bool open(const std::string& path);
+    void close() noexcept;
+
+    bool is_open() const noexcept { return base_ != nullptr; }
+    const std::uint8_t* data() const noexcept { return static_cast<const std::uint8_t*>(base_); }
+    std::size_t size() const noexcept { return length_; }
+
+private:
+    void*       base_   = nullptr;
+    std::size_t length_ = 0;
+#if defined(_WIN32)
+    void*       mapping_handle_ = nullptr;
+#endif
+};
+
+// -- Checkpoint -------------------------------------------------------------
+
+struct SpScanCheckpoint {
+    static constexpr std::size_t kSerializedBytes = 24;
+
+    std::uint32_t next_height    = 0;   // height after the last reported block
+    std::uint64_t index_offset   = 0;   // index byte offset of the next record
+    std::uint64_t tweaks_scanned = 0;
+
+    /// "SPC1" | u32 next_height | u64 index_offset | u64 tweaks_scanned (LE).
+    std::array<std::uint8_t, kSerializedBytes> serialize() const noexcept;
+
+    /// False on a wrong length or magic.
+    static bool parse(const std::uint8_t* data, std::size_t len,
+                      SpScanCheckpoint& out) noexcept;
+};
+
+// -- Scanner ----------------------------------------------------------------
+
+struct SpChainScanOptions {
+    std::size_t batch_tweaks = 16384;     // tweaks per scan batch (~4 MB scratch)
+    ThreadPool* pool         = nullptr;   // nullptr = calling thread only
+};
+
+struct SpChainScanStats {
+    std::uint64_t blocks  = 0;
+    std::uint64_t tweaks  = 0;
+    double        seconds = 0.0;   // time spent scanning batches
+
+    double tweaks_per_second() const noexcept {
+        return seconds > 0.0 ? static_cast<double>(tweaks) / seconds : 0.0;
+    }
+};
+
+class SpChainScanner {
+public:
+    /// Called once per block, in the order blocks were added. xonly[i] is the
+    /// k = 0 candidate for the block's tweak i, meaningful only if valid[i].
+    /// The arrays are reused after the callback returns.
+    using BlockCallback = std::function<void(std::uint32_t height,
+                                             const std::array<std::uint8_t, 32>* xonly,
+                                             const std::uint8_t* valid,
+                                             std::size_t count)>;
+    using CheckpointCallback = std::function<void(const SpScanCheckpoint&)>;
+
+    /// @throws std::invalid_argument if options.batch_tweaks == 0.
+    SpChainScanner(const fast::Scalar& scan_privkey, const fast::Point& spend_pubkey,
+                   BlockCallback on_block, const SpChainScanOptions& options = {});
+    ~SpChainScanner();
+    SpChainScanner(const SpChainScanner&) = delete;
+    SpChainScanner& operator=(const SpChainScanner&) = delete;
+
+    /// Called after every batch with the updated checkpoint.
+    void set_checkpoint_callback(CheckpointCallback cb) { on_checkpoint_ = std::move(cb); }
+
+    /// Push model: queue one block (tweaks are copied); scans once the batch
+    /// is full. Tweaks that are not valid points get valid = 0.
+    void add_block(std::uint32_t height, const std::uint8_t* tweaks33, std::size_t count);
+
+    /// Scan whatever is queued.
+    void flush();
+
+    /// Pull model: scan every record from checkpoint().index_offset to the
+    /// end of the index, then flush. Returns false if a truncated record was
+    /// found; blocks before it are still reported and the checkpoint points
+    /// at it.
+    bool scan_index(const std::uint8_t* data, std::size_t size);
+    bool scan_index(const SpTweakIndexFile& file) { return scan_index(file.data(), file.size()); }
+
+    /// Drops queued blocks and continues from `cp`.
+    void resume(const SpScanCheckpoint& cp);
+
+    const SpScanCheckpoint& checkpoint() const noexcept { return checkpoint_; }
+    const SpChainScanStats& stats() const noexcept { return stats_; }
+
+private:
+    struct PendingBlock {
+        std::uint32_t height;
+        std::uint32_t count;
+        std::uint64_t end_offset;   // index offset after this record
+    };
+
+    void queue_block(std::uint32_t height, const std::uint8_t* tweaks33,
+                     std::size_t count, std::uint64_t end_offset);
+
+    fast::Scalar              scan_privkey_;
+    fast::Point               spend_pubkey_;
+    BlockCallback             on_block_;
+    CheckpointCallback        on_checkpoint_;
+    SpChainScanOptions        options_;
+    SpScanCheckpoint          checkpoint_;
+    SpChainScanStats          stats_;
+
+    std::vector<PendingBlock>                 pending_;
+    std::vector<std::uint8_t>                 pending_tweaks_;   // 33 bytes each
+    std::vector<fast::Point>                  points_;
+    std::vector<std::array<std::uint8_t, 32>> xonly_;
+    std::vector<std::uint8_t>                 valid_;
+};
+
+} // namespace secp256k1
+
+#endif // SECP256K1_SP_CHAIN_SCAN_HPP
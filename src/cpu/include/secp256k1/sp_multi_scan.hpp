@@ -0,0 +1,102 @@
+#ifndef SECP256K1_SP_MULTI_SCAN_HPP
+#define SECP256K1_SP_MULTI_SCAN_HPP
+#pragma once
+
+// ============================================================================
+// Multi-recipient BIP-352 scanning: M scan keys x N tweaks
+// ============================================================================
+//
+// ## WHY
+// fast_scan_batch / sp_scan_batch_impl scan one scan key against many
+// transactions. A custodial backend scanning the same block for thousands
+// of recipients would repeat, per key, the tweak decompression and the
+// per-point wNAF table build of every scan x T_i.
+//
+// ## MODEL
+// For one block (N tweaks T_i = input_hash x A_sum, N taproot outputs):
+//
+//   1. Decompress every tweak once (one sqrt each).
+//   2. From `cache_min_keys` recipients on, build the GLV tables of each
+//      tweak once (Point::batch_scan_precompute, 4096 tweaks at a time) and
+//      run every scan key over them with batch_scan_run_lockstep. Scan-key
+//      sign flags are folded into the wNAF digits, so one table set serves
+//      every key. Below the threshold each key uses batch_scalar_mul_fixed_k.
+//   3. Per (key, 256 tweaks): batch_to_compressed, tagged SHA-256 from the
+//      shared midstate, batch_scalar_mul_generator + B_spend, batch x-only.
+//   4. Probe each k = 0 candidate in a hash set of the block's outputs; a hit
+//      continues with k = 1, 2, ... for that (key, tweak) until a miss.
+//
+// Work items (one key x 256 tweaks) are spread over a ThreadPool, so both
+// many keys and many tweaks parallelise. Matches are returned sorted by
+// (recipient, tweak_index, k).
+//
+// Labels are not scanned. Not constant-time (same as fast_scan_batch).
+// ============================================================================
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+
+namespace secp256k1 {
+
+class ThreadPool;  // secp256k1/thread_pool.hpp
+
+struct SpRecipient {
+    fast::Scalar scan_privkey;
+    fast::Point  spend_pubkey;
+};
+
+struct SpMultiMatch {
+    std::uint32_t recipient    = 0;   // index into the recipient list
+    std::uint32_t tweak_index  = 0;   // index into the tweaks
+    std::uint32_t output_index = 0;   // index into the outputs
+    std::uint32_t k            = 0;
+    fast::Scalar  tweak;              // t_k: spend privkey = b_spend + t_k
+};
+
+class SpMultiScanner {
+public:
+    /// Tweaks per table build and work-item size (see MODEL).
+    static constexpr std::size_t kTile  = 4096;
+    static constexpr std::size_t kChunk = 256;
+
+    /// KPlans for every scan key are computed once here.
+    /// cache_min_keys: use the shared per-tweak tables from this many
+    /// recipients on (SIZE_MAX = never). The lockstep run over prebuilt
+    /// tables already beats batch_scalar_mul_fixed_k for a single key
+    /// (bench_sp_multi_scan), hence the default of 1.
+    explicit SpMultiScanner(std::vector<SpRecipient> recipients,
+                            std::size_t cache_min_keys = 1);
+    ~SpMultiScanner();
+    SpMultiScanner(const SpMultiScanner&) = delete;
+    SpMultiScanner& operator=(const SpMultiScanner&) = delete;
+
+    std::size_t size() const noexcept { return recipients_.size(); }
+
+    /// Scan N compressed 33-byte tweaks against the block's x-only outputs.
+    /// Tweaks that are not valid points are skipped. pool = nullptr runs on
+    /// the calling thread.
+    std::vector<SpMultiMatch> scan(const std::uint8_t* tweaks33, std::size_t n_tweaks,
+                                   const std::array<std::uint8_t, 32>* outputs,
+                                   std::size_t n_outputs,
+                                   ThreadPool* pool = nullptr) const;
+
+    /// Same, with already-decoded tweaks (infinity entries are skipped).
+    std::vector<SpMultiMatch> scan(const fast::Point* tweaks, std::size_t n_tweaks,
+                                   const std::array<std::uint8_t, 32>* outputs,
+                                   std::size_t n_outputs,
+                                   ThreadPool* pool = nullptr) const;
+
+private:
+    std::vector<SpRecipient> recipients_;
+    std::vector<fast::KPlan> plans_;   // KPlan::from_scalar(scan_privkey), ~2 KB each
+    std::size_t              cache_min_keys_;
+};
+
+} // namespace secp256k1
+
+#endif // SECP256K1_SP_MULTI_SCAN_HPP
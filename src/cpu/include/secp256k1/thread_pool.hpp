@@ -0,0 +1,88 @@
+#ifndef SECP256K1_THREAD_POOL_HPP
+#define SECP256K1_THREAD_POOL_HPP
+#pragma once
+
+// ============================================================================
+// Persistent work-stealing thread pool for batch entry points
+// ============================================================================
+//
+// ## WHY
+// Batch signing used to spawn up to 64 fresh std::thread objects per call and
+// split the input into fixed contiguous chunks. For service workloads (batches
+// of 50-500 items arriving thousands of times a second) thread creation plus
+// the slowest chunk's tail latency ate most of the parallel speedup.
+//
+// ## MODEL
+// Workers are created once and park on a condition variable between jobs.
+// parallel_for(count, grain, fn) splits [0, count) into one contiguous slice
+// per participant. Each participant claims `grain`-sized pieces from the front
+// of its own slice with an atomic fetch_add; when its slice is exhausted it
+// steals pieces from the other slices with the same fetch_add. A piece is
+// therefore handed out exactly once, and a slow participant never stalls the
+// job because idle participants drain its slice.
+//
+// The calling thread always participates, so a pool of size N uses N-1
+// background workers. One job runs at a time: a concurrent or nested
+// parallel_for on a busy pool runs inline on the caller instead of blocking
+// (no deadlock when a batch callback itself calls a batch API).
+//
+// ## AFFINITY
+// Optional CPU ids pin worker i to cpu_ids[i % n_cpu_ids] (Linux only;
+// ignored on other platforms). The calling thread is never re-pinned.
+//
+// Exceptions thrown by fn are captured and rethrown on the calling thread
+// after all participants have stopped touching the job.
+// ============================================================================
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace secp256k1 {
+
+class ThreadPool {
+public:
+    /// @param n_threads  Total participants including the calling thread.
+    ///                   0 = std::thread::hardware_concurrency().
+    /// @param cpu_ids    Optional CPU ids for worker pinning (may be nullptr).
+    /// @param n_cpu_ids  Number of entries in cpu_ids.
+    explicit ThreadPool(unsigned n_threads = 0,
+                        const int* cpu_ids = nullptr,
+                        std::size_t n_cpu_ids = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Number of participants (background workers + calling thread).
+    unsigned size() const noexcept;
+
+    /// Invoke fn(begin, end) over disjoint sub-ranges covering [0, count).
+    /// grain = 0 picks ~8 pieces per participant (good default for uniform
+    /// per-item cost). Blocks until every index has been processed.
+    template <typename Fn>
+    void parallel_for(std::size_t count, std::size_t grain, Fn&& fn) {
+        using FnT = std::remove_reference_t<Fn>;
+        run(count, grain,
+            [](void* state, std::size_t begin, std::size_t end) {
+                (*static_cast<FnT*>(state))(begin, end);
+            },
+            const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+    /// Process-wide default pool (hardware_concurrency participants), created
+    /// on first use. Used by the ufsecp batch entry points when no pool has
+    /// been attached to the context.
+    static ThreadPool& global();
+
+private:
+    using RangeFn = void (*)(void* state, std::size_t begin, std::size_t end);
+    void run(std::size_t count, std::size_t grain, RangeFn fn, void* state);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace secp256k1
+
+#endif // SECP256K1_THREAD_POOL_HPP
@@ -0,0 +1,137 @@
+#ifndef SECP256K1_WALLET_SCAN_HPP
+#define SECP256K1_WALLET_SCAN_HPP
+#pragma once
+
+// ============================================================================
+// Gap-limit wallet scanning: xpubs x child ranges against a scriptPubKey set
+// ============================================================================
+//
+// ## WHY
+// Restoring or auditing an HD wallet means walking every receive / change
+// chain of every account xpub until `gap_limit` consecutive children are
+// unused. Doing that through coin_derive_key / wallet::get_address costs a
+// full child derivation, a point serialization and an address string per
+// index, and then a string comparison against the chain's outputs.
+//
+// ## MODEL
+// Per (xpub, branch) chain, indices are taken in windows ending at
+// last_hit + 1 + gap_limit (at most kChunk at a time):
+//
+//   1. derive_children_pubkeys: one HMAC per index from the shared key
+//      midstate, batch_scalar_mul_generator + lane-parallel mixed additions,
+//      one batch inversion for the whole window.
+//   2. P2PKH / P2WPKH: compressed keys -> hash::hash160_33_batch, each hash
+//      probed in the P2PKH and P2WPKH tables.
+//   3. P2TR (BIP-86 key path): t = H_TapTweak(x) from the cached midstate,
+//      batch_scalar_mul_generator(t) + (x, even y), batch x-only, probe.
+//   4. A hit moves the window end; the chain stops when every index below
+//      it has been checked.
+//
+// Set membership is a binary search in sorted 20 / 32-byte tables built
+// once from the caller's scriptPubKeys. Address strings are formatted only
+// for hits. Chains are spread over a ThreadPool; hits are returned sorted
+// by (xpub, branch, child, type).
+//
+// Public derivation only; never touches private keys. Not constant-time.
+// ============================================================================
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "secp256k1/address.hpp"
+#include "secp256k1/bip32.hpp"
+
+namespace secp256k1 {
+
+class ThreadPool;  // secp256k1/thread_pool.hpp
+
+enum class WalletOutputType : std::uint8_t {
+    P2PKH  = 1,   // OP_DUP OP_HASH160 <20> OP_EQUALVERIFY OP_CHECKSIG
+    P2WPKH = 2,   // OP_0 <20>
+    P2TR   = 4,   // OP_1 <32>, BIP-86 output key (no script tree)
+};
+
+// Sorted lookup tables of the scriptPubKeys a scan should recognise.
+// Scripts of any other shape are ignored.
+class ScriptPubKeySet {
+public:
+    ScriptPubKeySet() = default;
+    explicit ScriptPubKeySet(const std::vector<std::vector<std::uint8_t>>& scripts);
+
+    /// Classify and append one script; returns false if it is not
+    /// P2PKH / P2WPKH / P2TR. `index` is reported back in hits.
+    bool add(const std::uint8_t* script, std::size_t len, std::uint32_t index);
+
+    /// Sort and de-duplicate (first index wins). Call after add(); scan()
+    /// on an unfinalized set works on a finalized copy.
+    void finalize();
+
+    /// Index of the matching script, or -1.
+    std::int64_t find_p2pkh(const std::uint8_t* hash20) const noexcept;
+    std::int64_t find_p2wpkh(const std::uint8_t* hash20) const noexcept;
+    std::int64_t find_p2tr(const std::uint8_t* output_x32) const noexcept;
+
+    std::size_t size() const noexcept { return p2pkh_.size() + p2wpkh_.size() + p2tr_.size(); }
+    bool finalized() const noexcept { return finalized_; }
+
+private:
+    std::vector<std::pair<std::array<std::uint8_t, 20>, std::uint32_t>> p2pkh_;
+    std::vector<std::pair<std::array<std::uint8_t, 20>, std::uint32_t>> p2wpkh_;
+    std::vector<std::pair<std::array<std::uint8_t, 32>, std::uint32_t>> p2tr_;
+    bool finalized_ = true;
+};
+
+struct WalletScanOptions {
+    /// Consecutive unused children that end a chain.
+    std::uint32_t gap_limit = 20;
+    /// Normal child indices of each xpub to walk (receive, change). Empty:
+    /// walk the children of the xpub itself.
+    std::vector<std::uint32_t> branches{0, 1};
+    /// OR of WalletOutputType values.
+    std::uint8_t types = 1 | 2 | 4;
+    Network network = Network::Mainnet;
+};
+
+struct WalletScanHit {
+    static constexpr std::uint32_t kNoBranch = 0xFFFFFFFFu;
+
+    std::uint32_t    xpub_index   = 0;          // index into the xpubs
+    std::uint32_t    branch       = kNoBranch;  // kNoBranch when branches is empty
+    std::uint32_t    child_index  = 0;
+    WalletOutputType type         = WalletOutputType::P2PKH;
+    std::uint32_t    script_index = 0;          // index passed to ScriptPubKeySet::add
+    std::string      address;
+};
+
+struct WalletScanStats {
+    std::uint64_t chains  = 0;   // (xpub, branch) chains walked
+    std::uint64_t derived = 0;   // children checked (the cost of the gap limit)
+};
+
+class WalletScanner {
+public:
+    /// Children derived per batch (see MODEL).
+    static constexpr std::size_t kChunk = 256;
+
+    explicit WalletScanner(WalletScanOptions options = {});
+
+    const WalletScanOptions& options() const noexcept { return options_; }
+
+    /// Scan every (xpub, branch) chain. Only the public halves of the keys
+    /// are used. An xpub whose branch cannot be derived contributes no hits.
+    /// pool = nullptr runs on the calling thread.
+    std::vector<WalletScanHit> scan(const ExtendedKey* xpubs, std::size_t n_xpubs,
+                                    const ScriptPubKeySet& scripts,
+                                    ThreadPool* pool = nullptr,
+                                    WalletScanStats* stats = nullptr) const;
+
+private:
+    WalletScanOptions options_;
+};
+
+} // namespace secp256k1
+
+#endif // SECP256K1_WALLET_SCAN_HPP
@@ -11,6 +11,7 @@
 #include "secp256k1/detail/secure_erase.hpp"
 #include "secp256k1/precompute.hpp"
 #include "secp256k1/multiscalar.hpp"
+#include "secp256k1/thread_pool.hpp"
 #include <algorithm>
 #include <cstring>
 
@@ -941,14 +942,19 @@ static void build_block1(const std::uint8_t s_comp[33],
     blk[62] = 0x03; blk[63] = 0x28; // bit-length = (64+37)*8 = 808 = 0x0328
 }
 
-} // anonymous namespace
-
-std::vector<ScanMatch>
-fast_scan_batch(const fast::Scalar& scan_privkey,
-                const fast::Scalar& spend_privkey,
-                const std::vector<ScanTx>& txs)
+// Below this many transactions per chunk the per-chunk fixed costs (KPlan
+// setup, batch inversions, generator table snapshot) stop amortising.
+constexpr std::size_t kScanMinChunk = 512;
+
+// Single-thread pipeline over txs[0, n). Matches are appended to `results`
+// with tx_index offset by `index_base` (used by the pooled overload).
+void fast_scan_range(const fast::Scalar& scan_privkey,
+                     const fast::Scalar& spend_privkey,
+                     const ScanTx* txs, std::size_t n,
+                     std::uint32_t index_base,
+                     std::vector<ScanMatch>& results)
 {
-    if (txs.empty()) return {};
+    if (n == 0) return;
 
     // Process-wide constant SHA256 midstate.
     const std::array<std::uint32_t, 8>& s_base_state = g_bip352_base_state;
@@ -962,8 +968,6 @@ fast_scan_batch(const fast::Scalar& scan_privkey,
     static thread_local std::vector<fast::Point>              tl_out_jac;
     static thread_local std::vector<std::array<std::uint8_t, 32>> tl_out_x;
 
-    std::size_t const n = txs.size();
-
     // Resize-in-place (realloc only if growing beyond previous high-water mark).
     tl_a_eff.resize(n);
     tl_s1.resize(n);
@@ -972,7 +976,7 @@ fast_scan_batch(const fast::Scalar& scan_privkey,
 
     // Count outputs upfront for Stage-2 buffer sizing.
     std::size_t total_outputs = 0;
-    for (auto const& tx : txs) total_outputs += tx.outputs.size();
+    for (std::size_t i = 0; i < n; ++i) total_outputs += txs[i].outputs.size();
     tl_out_map.resize(total_outputs);
     tl_out_jac.resize(total_outputs);
     tl_out_x.resize(total_outputs);
@@ -990,7 +994,7 @@ fast_scan_batch(const fast::Scalar& scan_privkey,
         build_block1(tl_s1c[i].data(), tl_blk[i].data());
 
     // ── Stage 2: hash all → batch ×G → batch x-only ─────────────────────────
-    if (total_outputs == 0) return {};
+    if (total_outputs == 0) return;
 
     static thread_local std::vector<fast::Scalar> tl_out_scalars;
     tl_out_scalars.resize(total_outputs);
@@ -1031,11 +1035,10 @@ fast_scan_batch(const fast::Scalar& scan_privkey,
 
     // Pass 2b: one mutex lock for all N×M fixed-base multiplications.
     std::size_t const actual_outputs = slot;
-    if (actual_outputs == 0) return {};
+    if (actual_outputs == 0) return;
     fast::batch_scalar_mul_generator(tl_out_scalars.data(), tl_out_jac.data(), actual_outputs);
 
     // ── Compare and collect matches ──────────────────────────────────────────
-    std::vector<ScanMatch> results;
 
     auto recompute_t_k = [&](std::uint32_t ti, std::uint32_t k, Scalar& t_k_out) -> bool {
         std::uint8_t* mblk = tl_blk[ti].data();
@@ -1051,11 +1054,170 @@ fast_scan_batch(const fast::Scalar& scan_privkey,
         if (tl_out_x[j] != txs[ti].outputs[k]) continue;
         Scalar t_k;
         if (!recompute_t_k(ti, k, t_k)) continue;
-        results.push_back({ti, k, spend_privkey + t_k});
+        results.push_back({index_base + ti, k, spend_privkey + t_k});
     }
+}
+
+} // anonymous namespace
 
+std::vector<ScanMatch>
+fast_scan_batch(const fast::Scalar& scan_privkey,
+                const fast::Scalar& spend_privkey,
+                const std::vector<ScanTx>& txs)
+{
+    std::vector<ScanMatch> results;
+    fast_scan_range(scan_privkey, spend_privkey, txs.data(), txs.size(), 0, results);
     return results;
 }
 
+std::vector<ScanMatch>
+fast_scan_batch(const fast::Scalar& scan_privkey,
+                const fast::Scalar& spend_privkey,
+                const std::vector<ScanTx>& txs,
+                ThreadPool& pool)
+{
+    std::size_t const n = txs.size();
+    std::size_t const parts = std::min<std::size_t>(
+        pool.size(), (n + kScanMinChunk - 1) / kScanMinChunk);
+    if (parts <= 1) return fast_scan_batch(scan_privkey, spend_privkey, txs);
+
+    // Contiguous chunks, one result vector each: concatenating in chunk order
+    // keeps matches sorted by tx_index exactly like the serial path.
+    std::size_t const per = (n + parts - 1) / parts;
+    std::vector<std::vector<ScanMatch>> partial(parts);
+    pool.parallel_for(parts, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+            std::size_t const lo = p * per;
+            if (lo >= n) continue;
+            std::size_t const len = std::min(per, n - lo);
+            fast_scan_range(scan_privkey, spend_privkey, txs.data() + lo, len,
+                            static_cast<std::uint32_t>(lo), partial[p]);
+        }
+    });
+
+    std::vector<ScanMatch> results;
+    for (auto& v : partial) results.insert(results.end(), v.begin(), v.end());
+    return results;
+}
+
+namespace {
+
+// k = 0 candidate per tweak: x(tagged_hash(ser(scan x T_i) || 0u32) x G + B_spend).
+// valid_out[i] = 0 for infinity tweaks, a hash outside [1, n) or an infinite
+// candidate; xonly_out[i] is then unspecified.
+void tweak_outputs_range(const fast::KPlan& plan,
+                         const fast::Point& spend_pubkey,
+                         const fast::Point* tweaks, std::size_t m,
+                         std::array<std::uint8_t, 32>* xonly_out,
+                         std::uint8_t* valid_out)
+{
+    static thread_local std::vector<fast::Point>                  tl_pts;
+    static thread_local std::vector<std::array<std::uint8_t, 33>> tl_comp;
+    static thread_local std::vector<fast::Scalar>                 tl_hash;
+    static thread_local std::vector<fast::Point>                  tl_in;
+    tl_pts.resize(m);
+    tl_comp.resize(m);
+    tl_hash.resize(m);
+
+    // The fixed-k ladder expects finite inputs: stand G in for infinity
+    // tweaks (their result is discarded below).
+    const fast::Point* in = tweaks;
+    if (std::any_of(tweaks, tweaks + m, [](const fast::Point& t) { return t.is_infinity(); })) {
+        tl_in.assign(tweaks, tweaks + m);
+        for (auto& t : tl_in) {
+            if (t.is_infinity()) t = fast::Point::generator();
+        }
+        in = tl_in.data();
+    }
+
+    // Stage 1: shared_i = scan x T_i (shared wNAF schedule, one inversion).
+    fast::Point::batch_scalar_mul_fixed_k(plan, in, m, tl_pts.data());
+    fast::Point::batch_to_compressed(tl_pts.data(), m, tl_comp.data());
+
+    // t_i = tagged_hash(ser(shared_i) || 0u32) from the shared midstate.
+    for (std::size_t i = 0; i < m; ++i) {
+        valid_out[i] = 0;
+        tl_hash[i] = Scalar::zero();
+        if (tweaks[i].is_infinity() || tl_pts[i].is_infinity()) continue;
+        std::uint8_t blk[64];
+        build_block1(tl_comp[i].data(), blk);
+        std::uint32_t h[8];
+        std::memcpy(h, g_bip352_base_state.data(), 32);
+        detail::sha256_compress_dispatch(blk, h);
+        std::array<std::uint8_t, 32> t_bytes;
+        for (int b = 0; b < 8; ++b) {
+            t_bytes[b*4+0] = std::uint8_t(h[b] >> 24);
+            t_bytes[b*4+1] = std::uint8_t(h[b] >> 16);
+            t_bytes[b*4+2] = std::uint8_t(h[b] >>  8);
+            t_bytes[b*4+3] = std::uint8_t(h[b]);
+        }
+        if (Scalar::parse_bytes_strict_nonzero(t_bytes.data(), tl_hash[i])) valid_out[i] = 1;
+    }
+
+    // Stage 2: cand_i = t_i x G + B_spend, then one inversion for all x.
+    fast::batch_scalar_mul_generator(tl_hash.data(), tl_pts.data(), m);
+    for (std::size_t i = 0; i < m; ++i) tl_pts[i] = tl_pts[i].add(spend_pubkey);
+    fast::Point::batch_x_only_bytes(tl_pts.data(), m, xonly_out);
+    for (std::size_t i = 0; i < m; ++i) {
+        if (tl_pts[i].is_infinity()) valid_out[i] = 0;
+    }
+}
+
+} // anonymous namespace
+
+void fast_scan_tweak_outputs(const fast::Scalar& scan_privkey,
+                             const fast::Point& spend_pubkey,
+                             const fast::Point* tweaks, std::size_t n,
+                             std::array<std::uint8_t, 32>* xonly_out,
+                             std::uint8_t* valid_out,
+                             ThreadPool* pool)
+{
+    if (n == 0) return;
+    fast::KPlan const plan = fast::KPlan::from_scalar(scan_privkey);
+
+    auto run_range = [&](std::size_t begin, std::size_t end) {
+        tweak_outputs_range(plan, spend_pubkey, tweaks + begin, end - begin,
+                            xonly_out + begin, valid_out + begin);
+    };
+
+    if (pool == nullptr) {
+        run_range(0, n);
+    } else {
+        pool->parallel_for(n, kScanMinChunk, run_range);
+    }
+}
+
+void fast_scan_prefix_batch(const fast::Scalar& scan_privkey,
+                            const fast::Point& spend_pubkey,
+                            const fast::Point* tweaks, std::size_t n,
+                            std::uint64_t* prefix64_out,
+                            ThreadPool* pool)
+{
+    if (n == 0) return;
+    fast::KPlan const plan = fast::KPlan::from_scalar(scan_privkey);
+
+    auto run_range = [&](std::size_t begin, std::size_t end) {
+        static thread_local std::vector<std::array<std::uint8_t, 32>> tl_x;
+        static thread_local std::vector<std::uint8_t>                 tl_ok;
+        std::size_t const m = end - begin;
+        tl_x.resize(m);
+        tl_ok.resize(m);
+        tweak_outputs_range(plan, spend_pubkey, tweaks + begin, m, tl_x.data(), tl_ok.data());
+
+        for (std::size_t i = 0; i < m; ++i) {
+            std::uint64_t prefix = 0;
+            if (tl_ok[i]) {
+                for (int b = 0; b < 8; ++b) prefix = (prefix << 8) | tl_x[i][b];
+            }
+            prefix64_out[begin + i] = prefix;
+        }
+    };
+
+    if (pool == nullptr) {
+        run_range(0, n);
+    } else {
+        pool->parallel_for(n, kScanMinChunk, run_range);
+    }
+}
 
 } // namespace secp256k1
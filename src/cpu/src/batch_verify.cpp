@@ -6,15 +6,20 @@
 // ============================================================================
 
 #include "secp256k1/batch_verify.hpp"
+#include "secp256k1/field_simd.hpp"
 #include "secp256k1/multiscalar.hpp"
 #include "secp256k1/pippenger.hpp"
+#include "secp256k1/recovery.hpp"
 #include "secp256k1/sha256.hpp"
 #include "secp256k1/tagged_hash.hpp"
 #include "secp256k1/detail/csprng.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
+#include "secp256k1/thread_pool.hpp"
 #if defined(__SIZEOF_INT128__) && !defined(SECP256K1_PLATFORM_ESP32) && !defined(SECP256K1_PLATFORM_STM32) && !defined(__EMSCRIPTEN__)
 #include "secp256k1/field_52.hpp"
 #endif
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <unordered_map>
 #include <array>
@@ -117,12 +122,88 @@ std::pair<bool, Point> lift_x(const std::array<uint8_t, 32>& pubkey_x) {
     return {true, std::move(parsed.point)};
 }
 
+// Entries per preprocessing slice on the pooled path (lift_x + challenge
+// hash ~ 3-5 us/entry, so one slice is ~1 ms of work).
+constexpr std::size_t kSchnorrPrepSlice = 256;
+
+// Participants to use for n entries: every participant gets >= one slice.
+std::size_t pool_parts(const ThreadPool* pool, unsigned max_threads,
+                       std::size_t n, std::size_t min_per_part) {
+    if (pool == nullptr) return 1;
+    unsigned const threads = (max_threads == 0) ? pool->size()
+                                                : std::min(max_threads, pool->size());
+    std::size_t const parts = std::min<std::size_t>(threads, n / min_per_part);
+    return parts == 0 ? 1 : parts;
+}
+
+// Runs prepare(begin, end, g_part) over [0, n): inline when parts <= 1,
+// otherwise as `parts` contiguous slices on the pool. Each slice owns its
+// g_part; the parts are summed into g_coeff. False if any slice fails.
+template <typename PrepareFn>
+bool prepare_in_slices(ThreadPool* pool, std::size_t parts, std::size_t n,
+                       PrepareFn&& prepare, Scalar& g_coeff) {
+    if (parts <= 1) return prepare(std::size_t{0}, n, g_coeff);
+
+    std::size_t const per = (n + parts - 1) / parts;
+    std::vector<Scalar> g_parts(parts, Scalar::zero());
+    std::atomic<bool> ok{true};
+    pool->parallel_for(parts, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+            std::size_t const lo = p * per;
+            if (lo >= n || !ok.load(std::memory_order_relaxed)) continue;
+            if (!prepare(lo, std::min(n, lo + per), g_parts[p])) {
+                ok.store(false, std::memory_order_relaxed);
+            }
+        }
+    });
+    if (!ok.load(std::memory_order_relaxed)) return false;
+    for (auto const& g : g_parts) g_coeff += g;
+    return true;
+}
+
+// Weighted terms of one Schnorr entry: g_term = a*s and the MSM slots
+// (-a*e, P), (-a, R). Entry i owns slots 2i and 2i+1, so any index range of
+// the batch is one contiguous MSM (bisection identify relies on this).
+template <typename Entry, typename ResolvePubkeyFn, typename PubkeyBytesFn>
+bool schnorr_entry_terms(const Entry& entry, const Scalar& weight,
+                         ResolvePubkeyFn& resolve_pubkey,
+                         PubkeyBytesFn& pubkey_bytes,
+                         Scalar& g_term, Scalar* scalars, Point* points) {
+    auto [r_ok, R_pt] = lift_x(entry.signature.r);
+    if (!r_ok) return false;
+
+    Point P_pt = Point::infinity();
+    if (!resolve_pubkey(entry, P_pt)) return false;
+
+    auto const* const pubkey_x = pubkey_bytes(entry);
+    if (pubkey_x == nullptr) return false;
+
+    alignas(16) uint8_t challenge_input[96];
+    std::memcpy(challenge_input +  0, entry.signature.r.data(), 32);
+    std::memcpy(challenge_input + 32, pubkey_x->data(), 32);
+    std::memcpy(challenge_input + 64, entry.message.data(), 32);
+    Scalar const challenge = Scalar::from_bytes(
+        detail::cached_tagged_hash(detail::g_challenge_midstate, challenge_input, 96));
+
+    g_term = weight * entry.signature.s;
+    scalars[0] = (weight * challenge).negate();
+    points[0] = std::move(P_pt);
+    scalars[1] = weight.negate();
+    points[1] = std::move(R_pt);
+    return true;
+}
+
+// pool == nullptr: single-thread path. Otherwise per-entry preprocessing runs
+// in slices on the pool and the 2n-point MSM goes through msm_parallel();
+// resolve_pubkey must then be safe to call concurrently.
 template <typename Entry, typename VerifyOneFn, typename ResolvePubkeyFn,
           typename PubkeyBytesFn>
 bool schnorr_batch_verify_impl(const Entry* entries, std::size_t n,
                                VerifyOneFn&& verify_one,
                                ResolvePubkeyFn&& resolve_pubkey,
-                               PubkeyBytesFn&& pubkey_bytes) {
+                               PubkeyBytesFn&& pubkey_bytes,
+                               ThreadPool* pool = nullptr,
+                               unsigned max_threads = 0) {
     if (n == 0) return false;
     if (n == 1) return verify_one(entries[0]);
 
@@ -184,47 +265,37 @@ bool schnorr_batch_verify_impl(const Entry* entries, std::size_t n,
     Scalar* const scalars = scratch.scalars.data();
     Point* const points = scratch.points.data();
 
-    Scalar g_coeff = Scalar::zero();
-
-    for (std::size_t i = 0; i < n; ++i) {
-        Scalar const weight = batch_weight(bw_mid, static_cast<uint32_t>(i));
-
-        auto [r_ok, R_pt] = lift_x(entries[i].signature.r);
-        if (!r_ok) return false;
-
-        Point P_pt = Point::infinity();
-        if (!resolve_pubkey(entries[i], P_pt)) return false;
-
-        auto const* const pubkey_x = pubkey_bytes(entries[i]);
-        if (pubkey_x == nullptr) return false;
-
-        alignas(16) uint8_t challenge_input[96];
-        std::memcpy(challenge_input +  0, entries[i].signature.r.data(), 32);
-        std::memcpy(challenge_input + 32, pubkey_x->data(), 32);
-        std::memcpy(challenge_input + 64, entries[i].message.data(), 32);
-        Scalar const challenge = Scalar::from_bytes(
-            detail::cached_tagged_hash(detail::g_challenge_midstate, challenge_input, 96));
-
-        g_coeff += weight * entries[i].signature.s;
+    // Fills MSM slots for entries [begin, end) and accumulates their share of
+    // the generator coefficient into g_part.
+    auto prepare = [&](std::size_t begin, std::size_t end, Scalar& g_part) -> bool {
+        for (std::size_t i = begin; i < end; ++i) {
+            Scalar const weight = batch_weight(bw_mid, static_cast<uint32_t>(i));
+            Scalar g_term;
+            if (!schnorr_entry_terms(entries[i], weight, resolve_pubkey, pubkey_bytes,
+                                     g_term, scalars + 2 * i, points + 2 * i)) {
+                return false;
+            }
+            g_part += g_term;
+        }
+        return true;
+    };
 
-        scalars[i] = (weight * challenge).negate();
-        points[i] = P_pt;
-        scalars[n + i] = weight.negate();
-        points[n + i] = R_pt;
-    }
+    Scalar g_coeff = Scalar::zero();
+    std::size_t const parts = pool_parts(pool, max_threads, n, kSchnorrPrepSlice);
+    if (!prepare_in_slices(pool, parts, n, prepare, g_coeff)) return false;
 
     // g_coeff = sum(weight_i * sig_i.s) — all public data; VT correct here.
     auto G_term = Point::generator().scalar_mul(g_coeff);
-    auto rest = msm(scalars, points, msm_n);
+    auto rest = (pool != nullptr) ? msm_parallel(scalars, points, msm_n, *pool, max_threads)
+                                  : msm(scalars, points, msm_n);
     auto result = G_term.add(rest);
     return result.is_infinity();
 }
 
 template <typename Entry, typename VerifyOneFn>
-void schnorr_batch_identify_invalid_impl(
-    const Entry* entries, std::size_t n,
-    std::vector<std::size_t>& invalid,
-    VerifyOneFn&& verify_one) {
+void batch_identify_linear(const Entry* entries, std::size_t n,
+                           std::vector<std::size_t>& invalid,
+                           VerifyOneFn&& verify_one) {
     invalid.clear();
     invalid.reserve(n);
     for (std::size_t i = 0; i < n; ++i) {
@@ -234,6 +305,84 @@ void schnorr_batch_identify_invalid_impl(
     }
 }
 
+// -- Bisection identify -------------------------------------------------------
+// Every entry's weighted terms are prepared ONCE (entry i owns MSM slots 2i,
+// 2i+1; g_prefix[hi] - g_prefix[lo] is a range's generator coefficient), so
+// the sum S(lo, hi) of any index range is one G multiplication plus one
+// contiguous MSM. S == O means the range is clean (same soundness as a batch
+// verify). A failing range is halved, and only the left half costs an MSM:
+// S(right) = S(parent) - S(left). A single entry's S is its own verification
+// equation times a nonzero weight, so leaves are decided exactly.
+struct BisectTerms {
+    std::vector<Scalar> g_prefix;  // n + 1 prefix sums of the G coefficients
+    std::vector<Scalar> scalars;   // 2n MSM scalars
+    std::vector<Point>  points;    // 2n MSM points
+};
+
+Point bisect_range_sum(const BisectTerms& t, std::size_t lo, std::size_t hi) {
+    Scalar const g = t.g_prefix[hi] - t.g_prefix[lo];
+    Point const rest = msm(t.scalars.data() + 2 * lo, t.points.data() + 2 * lo,
+                           2 * (hi - lo));
+    return Point::generator().scalar_mul(g).add(rest);
+}
+
+void bisect_search(const BisectTerms& t, std::size_t lo, std::size_t hi,
+                   const Point& sum, std::vector<std::size_t>& invalid) {
+    if (sum.is_infinity()) return;
+    if (hi - lo == 1) {
+        invalid.push_back(lo);
+        return;
+    }
+    std::size_t const mid = lo + (hi - lo) / 2;
+    Point const left = bisect_range_sum(t, lo, mid);
+    Point const right = sum.add(left.negate());
+    bisect_search(t, lo, mid, left, invalid);
+    bisect_search(t, mid, hi, right, invalid);
+}
+
+// terms(i, weight, g_term, scalars2, points2) fills entry i's two MSM slots;
+// false means the entry cannot even be parsed (bad R or pubkey). Such entries
+// are reported directly and contribute nothing to the search.
+template <typename TermsFn>
+void batch_identify_bisect(std::size_t n, TermsFn&& terms,
+                           std::vector<std::size_t>& invalid) {
+    invalid.clear();
+    if (n == 0) return;
+
+    // Weights only need to be unpredictable here: fresh CSPRNG seed per call.
+    std::uint8_t seed[32];
+    secp256k1::detail::csprng_fill(seed, sizeof(seed));
+    SHA256 weight_base;
+    weight_base.update(seed, sizeof(seed));
+    detail::secure_erase(seed, sizeof(seed));
+    SHA256::Midstate const bw_mid = weight_base.capture_midstate();
+
+    BisectTerms t;
+    t.g_prefix.resize(n + 1);
+    t.scalars.resize(2 * n);
+    t.points.resize(2 * n);
+    Scalar acc = Scalar::zero();
+    t.g_prefix[0] = acc;
+    for (std::size_t i = 0; i < n; ++i) {
+        Scalar const weight = batch_weight(bw_mid, static_cast<uint32_t>(i));
+        Scalar g_term = Scalar::zero();
+        if (!terms(i, weight, g_term, &t.scalars[2 * i], &t.points[2 * i])) {
+            invalid.push_back(i);
+            g_term = Scalar::zero();
+            t.scalars[2 * i] = t.scalars[2 * i + 1] = Scalar::zero();
+            t.points[2 * i] = t.points[2 * i + 1] = Point::generator();
+        }
+        acc += g_term;
+        t.g_prefix[i + 1] = acc;
+    }
+
+    std::size_t const n_unparsed = invalid.size();
+    bisect_search(t, 0, n, bisect_range_sum(t, 0, n), invalid);
+    std::inplace_merge(invalid.begin(),
+                       invalid.begin() + static_cast<std::ptrdiff_t>(n_unparsed),
+                       invalid.end());
+}
+
 } // anonymous namespace
 
 // -- Schnorr Batch Verification -----------------------------------------------
@@ -298,6 +447,29 @@ bool schnorr_batch_verify(const std::vector<SchnorrBatchEntry>& entries) {
     return schnorr_batch_verify(entries.data(), entries.size());
 }
 
+bool schnorr_batch_verify(const SchnorrBatchEntry* entries, std::size_t n,
+                          ThreadPool& pool, unsigned max_threads) {
+    // The dedup map of the single-thread path is not shareable between
+    // participants; parse directly instead. Repeated keys still hit the
+    // per-thread lift_x cache inside schnorr_xonly_pubkey_parse.
+    auto verify_one = [](const SchnorrBatchEntry& entry) {
+        return schnorr_verify(entry.pubkey_x, entry.message, entry.signature);
+    };
+    auto resolve_pubkey = [](const SchnorrBatchEntry& entry, Point& out_point) {
+        SchnorrXonlyPubkey parsed;
+        if (!schnorr_xonly_pubkey_parse(parsed, entry.pubkey_x)) return false;
+        out_point = parsed.point;
+        return true;
+    };
+    auto pubkey_bytes = [](const SchnorrBatchEntry& entry)
+        -> const std::array<uint8_t, 32>* {
+        return &entry.pubkey_x;
+    };
+
+    return schnorr_batch_verify_impl(entries, n, verify_one, resolve_pubkey,
+                                     pubkey_bytes, &pool, max_threads);
+}
+
 bool schnorr_batch_verify(const SchnorrBatchCachedEntry* entries, std::size_t n) {
     auto verify_one = [](const SchnorrBatchCachedEntry& entry) {
         return entry.pubkey != nullptr &&
@@ -324,6 +496,27 @@ bool schnorr_batch_verify(const std::vector<SchnorrBatchCachedEntry>& entries) {
     return schnorr_batch_verify(entries.data(), entries.size());
 }
 
+bool schnorr_batch_verify(const SchnorrBatchCachedEntry* entries, std::size_t n,
+                          ThreadPool& pool, unsigned max_threads) {
+    auto verify_one = [](const SchnorrBatchCachedEntry& entry) {
+        return entry.pubkey != nullptr &&
+               schnorr_verify(*entry.pubkey, entry.message, entry.signature);
+    };
+    auto resolve_pubkey = [](const SchnorrBatchCachedEntry& entry,
+                             Point& out_point) {
+        if (entry.pubkey == nullptr) return false;
+        out_point = entry.pubkey->point;
+        return true;
+    };
+    auto pubkey_bytes = [](const SchnorrBatchCachedEntry& entry)
+        -> const std::array<uint8_t, 32>* {
+        return (entry.pubkey == nullptr) ? nullptr : &entry.pubkey->x_bytes;
+    };
+
+    return schnorr_batch_verify_impl(entries, n, verify_one, resolve_pubkey,
+                                     pubkey_bytes, &pool, max_threads);
+}
+
 // -- ECDSA Batch Verification -------------------------------------------------
 // For each sig (r_i, s_i), message z_i, pubkey Q_i:
 //   w_i = s_i^{-1}
@@ -485,18 +678,242 @@ bool ecdsa_batch_verify(const std::vector<ECDSABatchEntry>& entries) {
     return ecdsa_batch_verify(entries.data(), entries.size());
 }
 
+// -- ECDSA Batch Verification with recovery id --------------------------------
+// With R_i lifted from (r_i, recid_i) each signature satisfies
+//   s_i * R_i == z_i * G + r_i * Q_i
+// exactly (not just in x), so the batch folds into one randomized equation:
+//   sum(a_i * s_i * R_i) - sum(a_i * r_i * Q_i) - (sum a_i * z_i) * G == O
+// Multiplying through by s_i instead of using u1 = z/s, u2 = r/s avoids the
+// batch inversion entirely. Cost per entry: one sqrt (R lift) + two MSM points.
+
+namespace {
+
+// Crossover (x86-64 FE52, distinct keys): the MSM path breaks even with
+// per-entry recovery around N = 192 and is ~1.5-1.7x faster by N = 1024.
+constexpr std::size_t kEcdsaRecoverableIndividualCutoff = 160;
+
+// Same policy gate as ecdsa_batch_verify: nonzero r/s, low-S, finite pubkey.
+bool ecdsa_recoverable_precheck(const ECDSARecoverableBatchEntry& e) {
+    if (e.signature.r.is_zero() || e.signature.s.is_zero()) return false;
+    if (!e.signature.is_low_s()) return false;
+    if (e.public_key.is_infinity()) return false;
+    return e.recid >= 0 && e.recid <= 3;
+}
+
+// Single-entry reference check: ecrecover(msg, sig, recid) == public_key.
+bool ecdsa_recoverable_verify_one(const ECDSARecoverableBatchEntry& e) {
+    if (!ecdsa_recoverable_precheck(e)) return false;
+    auto [Q, ok] = ecdsa_recover(e.msg_hash, e.signature, e.recid);
+    if (!ok) return false;
+    return Q.add(e.public_key.negate()).is_infinity();
+}
+
+// Weighted terms of one recoverable entry: g_term = -a*z and the MSM slots
+// (a*s, R), (-a*r, Q). Same two-slot layout as schnorr_entry_terms.
+bool ecdsa_recoverable_entry_terms(const ECDSARecoverableBatchEntry& e,
+                                   const Scalar& weight, Scalar& g_term,
+                                   Scalar* scalars, Point* points) {
+    if (!ecdsa_recoverable_precheck(e)) return false;
+    auto [R_pt, r_ok] = ecdsa_lift_r(e.signature, e.recid);
+    if (!r_ok) return false;
+
+    g_term = (weight * Scalar::from_bytes(e.msg_hash)).negate();
+    scalars[0] = weight * e.signature.s;
+    points[0] = std::move(R_pt);
+    scalars[1] = (weight * e.signature.r).negate();
+    points[1] = e.public_key;
+    return true;
+}
+
+bool ecdsa_recoverable_batch_verify_impl(const ECDSARecoverableBatchEntry* entries,
+                                         std::size_t n, ThreadPool* pool,
+                                         unsigned max_threads) {
+    if (n == 0) return false;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!ecdsa_recoverable_precheck(entries[i])) return false;
+    }
+    // Below the crossover a 2n-point Pippenger loses to n recoveries, which
+    // use the precomputed generator tables (same trade-off as Schnorr).
+    if (n <= kEcdsaRecoverableIndividualCutoff) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!ecdsa_recoverable_verify_one(entries[i])) return false;
+        }
+        return true;
+    }
+
+    // Weights: CSPRNG bytes XOR SHA256(all r, s, recid, msg) -- see
+    // schnorr_batch_verify_impl (P2-SEC-002). Public keys are not serialized
+    // into the seed (that would cost a field inversion per entry); the CSPRNG
+    // half already makes the weights unpredictable.
+    std::uint8_t csprng_rand[32];
+    secp256k1::detail::csprng_fill(csprng_rand, sizeof(csprng_rand));
+
+    SHA256 seed_ctx;
+    std::uint8_t sig_bytes[65];
+    for (std::size_t i = 0; i < n; ++i) {
+        entries[i].signature.r.write_bytes(sig_bytes);
+        entries[i].signature.s.write_bytes(sig_bytes + 32);
+        sig_bytes[64] = static_cast<std::uint8_t>(entries[i].recid);
+        seed_ctx.update(sig_bytes, sizeof(sig_bytes));
+        seed_ctx.update(entries[i].msg_hash.data(), 32);
+    }
+    auto batch_seed = seed_ctx.finalize();
+    for (std::size_t j = 0; j < 32; ++j) {
+        batch_seed[j] ^= csprng_rand[j];
+    }
+    detail::secure_erase(csprng_rand, sizeof(csprng_rand));
+
+    SHA256 batch_weight_base;
+    batch_weight_base.update(batch_seed.data(), batch_seed.size());
+    SHA256::Midstate const bw_mid = batch_weight_base.capture_midstate();
+
+    std::size_t const msm_n = 2 * n;
+    auto& scratch = schnorr_batch_scratch(msm_n);
+    Scalar* const scalars = scratch.scalars.data();
+    Point* const points = scratch.points.data();
+
+    auto prepare = [&](std::size_t begin, std::size_t end, Scalar& g_part) -> bool {
+        for (std::size_t i = begin; i < end; ++i) {
+            Scalar const weight = batch_weight(bw_mid, static_cast<uint32_t>(i));
+            Scalar g_term;
+            if (!ecdsa_recoverable_entry_terms(entries[i], weight, g_term,
+                                               scalars + 2 * i, points + 2 * i)) {
+                return false;
+            }
+            g_part += g_term;
+        }
+        return true;
+    };
+
+    Scalar g_coeff = Scalar::zero();
+    std::size_t const parts = pool_parts(pool, max_threads, n, kSchnorrPrepSlice);
+    if (!prepare_in_slices(pool, parts, n, prepare, g_coeff)) return false;
+
+    auto G_term = Point::generator().scalar_mul(g_coeff);
+    auto rest = (pool != nullptr) ? msm_parallel(scalars, points, msm_n, *pool, max_threads)
+                                  : msm(scalars, points, msm_n);
+    return G_term.add(rest).is_infinity();
+}
+
+} // anonymous namespace
+
+bool ecdsa_batch_verify(const ECDSARecoverableBatchEntry* entries, std::size_t n) {
+    return ecdsa_recoverable_batch_verify_impl(entries, n, nullptr, 0);
+}
+
+bool ecdsa_batch_verify(const std::vector<ECDSARecoverableBatchEntry>& entries) {
+    return ecdsa_batch_verify(entries.data(), entries.size());
+}
+
+bool ecdsa_batch_verify(const ECDSARecoverableBatchEntry* entries, std::size_t n,
+                        ThreadPool& pool, unsigned max_threads) {
+    return ecdsa_recoverable_batch_verify_impl(entries, n, &pool, max_threads);
+}
+
+// -- Batch Public Key Parsing -------------------------------------------------
+
+std::size_t pubkey_parse_batch(const std::uint8_t* keys, std::size_t n, std::size_t stride,
+                               FieldElement* x_out, FieldElement* y_out,
+                               std::uint8_t* valid_out) {
+    if (n == 0) return 0;
+    if (keys == nullptr || stride < 33) {
+        for (std::size_t i = 0; i < n; ++i) {
+            x_out[i] = FieldElement::zero();
+            y_out[i] = FieldElement::zero();
+            valid_out[i] = 0;
+        }
+        return 0;
+    }
+
+    // 256 keys per pass keep the right-hand sides on the stack; the sqrt
+    // kernel only needs full lane groups.
+    constexpr std::size_t kChunk = 256;
+    FieldElement rhs[kChunk];
+    std::uint8_t parsed[kChunk];
+    FieldElement const seven = FieldElement::from_uint64(7);
+    std::size_t n_valid = 0;
+    for (std::size_t lo = 0; lo < n; lo += kChunk) {
+        std::size_t const m = std::min(kChunk, n - lo);
+        for (std::size_t j = 0; j < m; ++j) {
+            const std::uint8_t* k = keys + (lo + j) * stride;
+            FieldElement& x = x_out[lo + j];
+            parsed[j] = (k[0] == 0x02 || k[0] == 0x03) &&
+                        FieldElement::parse_bytes_strict(k + 1, x);
+            if (!parsed[j]) x = FieldElement::zero();
+            rhs[j] = x.square() * x + seven;
+        }
+        fast::field_sqrt_batch(rhs, y_out + lo, valid_out + lo, m);
+        for (std::size_t j = 0; j < m; ++j) {
+            std::size_t const i = lo + j;
+            if (!parsed[j] || !valid_out[i]) {
+                x_out[i] = FieldElement::zero();
+                y_out[i] = FieldElement::zero();
+                valid_out[i] = 0;
+                continue;
+            }
+            std::uint64_t const odd = keys[i * stride] & 1u;
+            if ((y_out[i].limbs()[0] & 1u) != odd) y_out[i] = y_out[i].negate();
+            ++n_valid;
+        }
+    }
+    return n_valid;
+}
+
+std::size_t pubkey_parse_batch(const std::uint8_t* keys, std::size_t n, std::size_t stride,
+                               Point* out, std::uint8_t* valid_out) {
+    constexpr std::size_t kChunk = 256;
+    FieldElement xs[kChunk], ys[kChunk];
+    std::uint8_t ok[kChunk];
+    std::size_t n_valid = 0;
+    for (std::size_t lo = 0; lo < n; lo += kChunk) {
+        std::size_t const m = std::min(kChunk, n - lo);
+        n_valid += pubkey_parse_batch(keys != nullptr ? keys + lo * stride : nullptr, m, stride,
+                                      xs, ys, ok);
+        for (std::size_t j = 0; j < m; ++j) {
+            out[lo + j] = ok[j] ? Point::from_affine(xs[j], ys[j]) : Point::infinity();
+            if (valid_out != nullptr) valid_out[lo + j] = ok[j];
+        }
+    }
+    return n_valid;
+}
+
 // -- Identify Invalid Signatures ----------------------------------------------
 
 void schnorr_batch_identify_invalid(
     const SchnorrBatchEntry* entries, std::size_t n,
-    std::vector<std::size_t>& invalid_out) {
-    schnorr_batch_identify_invalid_impl(
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode mode) {
+    if (mode == BatchIdentifyMode::Bisect) {
+        auto resolve_pubkey = [](const SchnorrBatchEntry& entry, Point& out_point) {
+            SchnorrXonlyPubkey parsed;
+            if (!schnorr_xonly_pubkey_parse(parsed, entry.pubkey_x)) return false;
+            out_point = parsed.point;
+            return true;
+        };
+        auto pubkey_bytes = [](const SchnorrBatchEntry& entry)
+            -> const std::array<uint8_t, 32>* {
+            return &entry.pubkey_x;
+        };
+        batch_identify_bisect(n, [&](std::size_t i, const Scalar& w, Scalar& g,
+                                     Scalar* sc, Point* pt) {
+            return schnorr_entry_terms(entries[i], w, resolve_pubkey, pubkey_bytes,
+                                       g, sc, pt);
+        }, invalid_out);
+        return;
+    }
+    batch_identify_linear(
         entries, n, invalid_out, [](const SchnorrBatchEntry& entry) {
             return schnorr_verify(entry.pubkey_x, entry.message,
                                   entry.signature);
         });
 }
 
+void schnorr_batch_identify_invalid(
+    const SchnorrBatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out) {
+    schnorr_batch_identify_invalid(entries, n, invalid_out,
+                                   BatchIdentifyMode::Individual);
+}
+
 std::vector<std::size_t> schnorr_batch_identify_invalid(
     const SchnorrBatchEntry* entries, std::size_t n) {
     std::vector<std::size_t> invalid;
@@ -506,8 +923,26 @@ std::vector<std::size_t> schnorr_batch_identify_invalid(
 
 void schnorr_batch_identify_invalid(
     const SchnorrBatchCachedEntry* entries, std::size_t n,
-    std::vector<std::size_t>& invalid_out) {
-    schnorr_batch_identify_invalid_impl(
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode mode) {
+    if (mode == BatchIdentifyMode::Bisect) {
+        auto resolve_pubkey = [](const SchnorrBatchCachedEntry& entry,
+                                 Point& out_point) {
+            if (entry.pubkey == nullptr) return false;
+            out_point = entry.pubkey->point;
+            return true;
+        };
+        auto pubkey_bytes = [](const SchnorrBatchCachedEntry& entry)
+            -> const std::array<uint8_t, 32>* {
+            return (entry.pubkey == nullptr) ? nullptr : &entry.pubkey->x_bytes;
+        };
+        batch_identify_bisect(n, [&](std::size_t i, const Scalar& w, Scalar& g,
+                                     Scalar* sc, Point* pt) {
+            return schnorr_entry_terms(entries[i], w, resolve_pubkey, pubkey_bytes,
+                                       g, sc, pt);
+        }, invalid_out);
+        return;
+    }
+    batch_identify_linear(
         entries, n, invalid_out, [](const SchnorrBatchCachedEntry& entry) {
             return entry.pubkey != nullptr &&
                    schnorr_verify(*entry.pubkey, entry.message,
@@ -515,6 +950,13 @@ void schnorr_batch_identify_invalid(
         });
 }
 
+void schnorr_batch_identify_invalid(
+    const SchnorrBatchCachedEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out) {
+    schnorr_batch_identify_invalid(entries, n, invalid_out,
+                                   BatchIdentifyMode::Individual);
+}
+
 std::vector<std::size_t> schnorr_batch_identify_invalid(
     const SchnorrBatchCachedEntry* entries, std::size_t n) {
     std::vector<std::size_t> invalid;
@@ -522,17 +964,23 @@ std::vector<std::size_t> schnorr_batch_identify_invalid(
     return invalid;
 }
 
+void ecdsa_batch_identify_invalid(
+    const ECDSABatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode /*mode*/) {
+    // Plain ECDSA has no exact per-entry group equation (only x(R) mod n is
+    // committed), so there is nothing to bisect: both modes scan.
+    batch_identify_linear(
+        entries, n, invalid_out, [](const ECDSABatchEntry& entry) {
+            return ecdsa_verify(entry.msg_hash, entry.public_key,
+                                entry.signature);
+        });
+}
+
 void ecdsa_batch_identify_invalid(
     const ECDSABatchEntry* entries, std::size_t n,
     std::vector<std::size_t>& invalid_out) {
-    invalid_out.clear();
-    invalid_out.reserve(n);
-    for (std::size_t i = 0; i < n; ++i) {
-        if (!ecdsa_verify(entries[i].msg_hash, entries[i].public_key,
-                          entries[i].signature)) {
-            invalid_out.push_back(i);
-        }
-    }
+    ecdsa_batch_identify_invalid(entries, n, invalid_out,
+                                 BatchIdentifyMode::Individual);
 }
 
 std::vector<std::size_t> ecdsa_batch_identify_invalid(
@@ -542,4 +990,31 @@ std::vector<std::size_t> ecdsa_batch_identify_invalid(
     return invalid;
 }
 
+void ecdsa_batch_identify_invalid(
+    const ECDSARecoverableBatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out, BatchIdentifyMode mode) {
+    if (mode == BatchIdentifyMode::Bisect) {
+        batch_identify_bisect(n, [&](std::size_t i, const Scalar& w, Scalar& g,
+                                     Scalar* sc, Point* pt) {
+            return ecdsa_recoverable_entry_terms(entries[i], w, g, sc, pt);
+        }, invalid_out);
+        return;
+    }
+    batch_identify_linear(entries, n, invalid_out, ecdsa_recoverable_verify_one);
+}
+
+void ecdsa_batch_identify_invalid(
+    const ECDSARecoverableBatchEntry* entries, std::size_t n,
+    std::vector<std::size_t>& invalid_out) {
+    ecdsa_batch_identify_invalid(entries, n, invalid_out,
+                                 BatchIdentifyMode::Individual);
+}
+
+std::vector<std::size_t> ecdsa_batch_identify_invalid(
+    const ECDSARecoverableBatchEntry* entries, std::size_t n) {
+    std::vector<std::size_t> invalid;
+    ecdsa_batch_identify_invalid(entries, n, invalid);
+    return invalid;
+}
+
 } // namespace secp256k1
@@ -8,6 +8,8 @@
 #include "secp256k1/ct/point.hpp"
 #include "secp256k1/ct/scalar.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
+#include "secp256k1/field_simd.hpp"
+#include "secp256k1/precompute.hpp"
 #include <cstring>
 #include <cctype>
 
@@ -17,14 +19,24 @@ using fast::Scalar;
 using fast::Point;
 
 // -- HMAC-SHA512 --------------------------------------------------------------
+// The key pads are absorbed into SHA-512 midstates once; a key reused for
+// many messages (the chain code across a child range) then costs two
+// compressions per message fewer.
 
-std::array<std::uint8_t, 64> hmac_sha512(const uint8_t* key, std::size_t key_len,
-                                          const uint8_t* data, std::size_t data_len) {
+namespace {
+
+struct HmacSha512Key {
+    SHA512::Midstate inner;   // after key ^ ipad
+    SHA512::Midstate outer;   // after key ^ opad
+};
+
+void hmac_sha512_key(const uint8_t* key, std::size_t key_len, HmacSha512Key& out) {
     uint8_t k_buf[128]{};
 
     if (key_len > 128) {
         auto h = SHA512::hash(key, key_len);
         std::memcpy(k_buf, h.data(), 64);
+        detail::secure_erase(h.data(), h.size());
     } else {
         std::memcpy(k_buf, key, key_len);
     }
@@ -35,22 +47,45 @@ std::array<std::uint8_t, 64> hmac_sha512(const uint8_t* key, std::size_t key_len
         opad[i] = k_buf[i] ^ 0x5c;
     }
 
-    // inner = SHA512(ipad || data)
     SHA512 inner;
     inner.update(ipad, 128);
+    out.inner = inner.capture_midstate();
+    SHA512 outer;
+    outer.update(opad, 128);
+    out.outer = outer.capture_midstate();
+
+    detail::secure_erase(k_buf, sizeof(k_buf));
+    detail::secure_erase(ipad, sizeof(ipad));
+    detail::secure_erase(opad, sizeof(opad));
+    detail::secure_erase(&inner, sizeof(inner));
+    detail::secure_erase(&outer, sizeof(outer));
+}
+
+std::array<uint8_t, 64> hmac_sha512_with(const HmacSha512Key& key,
+                                         const uint8_t* data, std::size_t data_len) {
+    // inner = SHA512(ipad || data)
+    SHA512 inner = SHA512::from_midstate(key.inner);
     inner.update(data, data_len);
     auto inner_hash = inner.finalize();
 
     // outer = SHA512(opad || inner_hash)
-    SHA512 outer;
-    outer.update(opad, 128);
+    SHA512 outer = SHA512::from_midstate(key.outer);
     outer.update(inner_hash.data(), 64);
     auto result = outer.finalize();
-    detail::secure_erase(k_buf, sizeof(k_buf));
-    detail::secure_erase(ipad, sizeof(ipad));
-    detail::secure_erase(opad, sizeof(opad));
     // RED-TEAM-010: erase inner_hash — derived from secret key material in BIP-32 hardened paths.
     detail::secure_erase(inner_hash.data(), inner_hash.size());
+    detail::secure_erase(&inner, sizeof(inner));
+    return result;
+}
+
+} // anonymous namespace
+
+std::array<std::uint8_t, 64> hmac_sha512(const uint8_t* key, std::size_t key_len,
+                                          const uint8_t* data, std::size_t data_len) {
+    HmacSha512Key k;
+    hmac_sha512_key(key, key_len, k);
+    auto result = hmac_sha512_with(k, data, data_len);
+    detail::secure_erase(&k, sizeof(k));
     return result;
 }
 
@@ -516,30 +551,27 @@ std::pair<ExtendedKey, bool> bip32_master_key(const uint8_t* seed, std::size_t s
 
 // -- Path Derivation ----------------------------------------------------------
 
-std::pair<ExtendedKey, bool> bip32_derive_path(const ExtendedKey& master,
-                                                const std::string& path) {
+bool bip32_parse_path(const std::string& path, std::vector<uint32_t>& indices) {
     // Format: "m/44'/0'/0'/0/0"
-    if (path.empty() || path[0] != 'm') return {ExtendedKey{}, false};
-    if (path.size() == 1) return {master, true};
+    indices.clear();
+    if (path.empty() || path[0] != 'm') return false;
 
-    ExtendedKey current = master;
     std::size_t pos = 1; // skip 'm'
-
     while (pos < path.size()) {
-        if (path[pos] != '/') return {ExtendedKey{}, false};
+        if (path[pos] != '/') return false;
         ++pos;
-        if (pos >= path.size()) return {ExtendedKey{}, false};
+        if (pos >= path.size()) return false;
 
         // Parse number with overflow detection
         uint64_t index64 = 0;
         bool has_digit = false;
         while (pos < path.size() && std::isdigit(static_cast<unsigned char>(path[pos]))) {
             index64 = index64 * 10 + static_cast<uint64_t>(path[pos] - '0');
-            if (index64 > 0x7FFFFFFFu) return {ExtendedKey{}, false}; // exceeds max BIP-32 index
+            if (index64 > 0x7FFFFFFFu) return false; // exceeds max BIP-32 index
             ++pos;
             has_digit = true;
         }
-        if (!has_digit) return {ExtendedKey{}, false};
+        if (!has_digit) return false;
         const auto index = static_cast<uint32_t>(index64);
 
         // Check for hardened marker
@@ -548,9 +580,20 @@ std::pair<ExtendedKey, bool> bip32_derive_path(const ExtendedKey& master,
             hardened = true;
             ++pos;
         }
-        if (pos < path.size() && path[pos] != '/') return {ExtendedKey{}, false};
+        if (pos < path.size() && path[pos] != '/') return false;
+
+        indices.push_back(hardened ? (index | 0x80000000u) : index);
+    }
+    return true;
+}
+
+std::pair<ExtendedKey, bool> bip32_derive_path(const ExtendedKey& master,
+                                                const std::string& path) {
+    std::vector<uint32_t> indices;
+    if (!bip32_parse_path(path, indices)) return {ExtendedKey{}, false};
 
-        uint32_t const child_index = hardened ? (index | 0x80000000u) : index;
+    ExtendedKey current = master;
+    for (uint32_t const child_index : indices) {
         auto [child, ok] = current.derive_child(child_index);
         if (!ok) {
             // P2-CT-001: scrub the working intermediate's material on failure (secret
@@ -572,4 +615,278 @@ std::pair<ExtendedKey, bool> bip32_derive_path(const ExtendedKey& master,
     return {current, true};
 }
 
+// -- Batched Child Derivation -------------------------------------------------
+
+// child_point = I_L*G + parent_point for a whole range: batched fixed-base
+// multiplications, then lane-parallel mixed additions. Jacobian results,
+// infinity where the sum is (serialize with one batch inversion).
+static std::vector<Point> public_child_points(const std::vector<Scalar>& il_list,
+                                              const Point& parent_pk) {
+    std::size_t const m = il_list.size();
+    std::vector<Point> pts(m);
+    fast::batch_scalar_mul_generator(il_list.data(), pts.data(), m);
+
+    std::vector<fast::FieldElement> X(m), Y(m), Z(m);
+    std::vector<fast::FieldElement> const px(m, parent_pk.x()), py(m, parent_pk.y());
+    for (std::size_t j = 0; j < m; ++j) {
+        X[j] = pts[j].X();
+        Y[j] = pts[j].Y();
+        Z[j] = pts[j].z();
+    }
+    fast::point_add_mixed_batch(X.data(), Y.data(), Z.data(), px.data(), py.data(),
+                                X.data(), Y.data(), Z.data(), m);
+    for (std::size_t j = 0; j < m; ++j) {
+        pts[j] = Point::from_jacobian_coords(X[j], Y[j], Z[j],
+                                             Z[j] == fast::FieldElement::zero());
+    }
+    return pts;
+}
+
+// Validates a child range; sets *hardened. Empty, wrapping and
+// boundary-crossing ranges are invalid.
+static bool child_range_valid(uint32_t first, uint32_t count, bool* hardened) {
+    if (count == 0) return false;
+    uint64_t const last = static_cast<uint64_t>(first) + count - 1;
+    if (last > 0xFFFFFFFFu) return false;
+    *hardened = (first & 0x80000000u) != 0;
+    return *hardened == ((last & 0x80000000u) != 0);
+}
+
+std::vector<std::pair<ExtendedKey, bool>>
+derive_children_range(const ExtendedKey& parent, uint32_t first, uint32_t count) {
+    std::vector<std::pair<ExtendedKey, bool>> out;
+    bool hardened = false;
+    if (!child_range_valid(first, count, &hardened)) return out;
+
+    out.assign(count, {ExtendedKey{}, false});
+    if ((hardened && !parent.is_private) || parent.depth == 0xFFu) return out;
+
+    // Per-range work: parent point, fingerprint, HMAC key pads.
+    auto parent_pk = parent.public_key();
+    if (parent_pk.is_infinity()) return out;
+    auto const parent_comp = parent_pk.to_compressed();
+    auto const parent_fp = fingerprint_from_compressed(parent_comp);
+    HmacSha512Key hkey;
+    hmac_sha512_key(parent.chain_code.data(), 32, hkey);
+
+    Scalar parent_scalar{};
+    if (parent.is_private && !Scalar::parse_bytes_strict_nonzero(parent.key, parent_scalar)) {
+        detail::secure_erase(&hkey, sizeof(hkey));
+        return out;
+    }
+
+    uint8_t data[37];
+    if (hardened) {
+        data[0] = 0x00;
+        std::memcpy(data + 1, parent.key.data(), 32);
+    } else {
+        std::memcpy(data, parent_comp.data(), 33);
+    }
+
+    // Public parents: I_L scalars of the valid children, multiplied below.
+    std::vector<Scalar> il_list;
+    std::vector<uint32_t> slot;
+    if (!parent.is_private) {
+        il_list.reserve(count);
+        slot.reserve(count);
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t const index = first + i;
+        data[33] = static_cast<uint8_t>(index >> 24);
+        data[34] = static_cast<uint8_t>(index >> 16);
+        data[35] = static_cast<uint8_t>(index >> 8);
+        data[36] = static_cast<uint8_t>(index);
+        auto I = hmac_sha512_with(hkey, data, 37);
+
+        std::array<uint8_t, 32> IL{};
+        std::memcpy(IL.data(), I.data(), 32);
+        Scalar il_scalar{};
+        bool const il_ok = Scalar::parse_bytes_strict(IL, il_scalar) && !il_scalar.is_zero_ct();
+
+        ExtendedKey& child = out[i].first;
+        std::memcpy(child.chain_code.data(), I.data() + 32, 32);
+        child.depth = static_cast<uint8_t>(parent.depth + 1);
+        child.child_number = index;
+        child.parent_fingerprint = parent_fp;
+
+        if (il_ok && parent.is_private) {
+            // child_key = (IL + parent_key) mod n — CT: both scalars are secret
+            auto child_scalar = ct::scalar_add(il_scalar, parent_scalar);
+            if (!child_scalar.is_zero_ct()) {
+                child.key = child_scalar.to_bytes();
+                child.is_private = true;
+                out[i].second = true;
+            }
+            detail::secure_erase(&child_scalar, sizeof(child_scalar));
+        } else if (il_ok) {
+            il_list.push_back(il_scalar);
+            slot.push_back(i);
+        }
+
+        detail::secure_erase(I.data(), I.size());
+        detail::secure_erase(IL.data(), IL.size());
+        detail::secure_erase(&il_scalar, sizeof(il_scalar));   // CT-02
+    }
+    detail::secure_erase(data, sizeof(data));
+    detail::secure_erase(&hkey, sizeof(hkey));
+    detail::secure_erase(&parent_scalar, sizeof(parent_scalar));
+    if (!il_list.empty()) {
+        std::size_t const m = il_list.size();
+        auto pts = public_child_points(il_list, parent_pk);
+        std::vector<std::array<uint8_t, 33>> comp(m);
+        Point::batch_to_compressed(pts.data(), m, comp.data());
+        for (std::size_t j = 0; j < m; ++j) {
+            if (pts[j].is_infinity()) continue;
+            ExtendedKey& child = out[slot[j]].first;
+            child.pub_prefix = comp[j][0];
+            std::memcpy(child.key.data(), comp[j].data() + 1, 32);
+            child.is_private = false;
+            out[slot[j]].second = true;
+        }
+    }
+
+    // Failed children carry no partial data, as with derive_child.
+    for (auto& [child, ok] : out) {
+        if (!ok) child = ExtendedKey{};
+    }
+    return out;
+}
+
+bool derive_children_pubkeys(const ExtendedKey& parent, uint32_t first, uint32_t count,
+                             fast::FieldElement* out_x, fast::FieldElement* out_y,
+                             bool* ok) {
+    bool hardened = false;
+    if (!child_range_valid(first, count, &hardened) || hardened) return false;
+    for (uint32_t i = 0; i < count; ++i) ok[i] = false;
+    if (parent.depth == 0xFFu) return true;
+
+    // Normal children only: I_L depends on the public parent alone, so this
+    // path never touches a private key even for an xprv parent.
+    auto parent_pk = parent.public_key();
+    if (parent_pk.is_infinity()) return true;
+    auto const parent_comp = parent_pk.to_compressed();
+    HmacSha512Key hkey;
+    hmac_sha512_key(parent.chain_code.data(), 32, hkey);
+
+    std::vector<Scalar> il_list;
+    std::vector<uint32_t> slot;
+    il_list.reserve(count);
+    slot.reserve(count);
+    uint8_t data[37];
+    std::memcpy(data, parent_comp.data(), 33);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t const index = first + i;
+        data[33] = static_cast<uint8_t>(index >> 24);
+        data[34] = static_cast<uint8_t>(index >> 16);
+        data[35] = static_cast<uint8_t>(index >> 8);
+        data[36] = static_cast<uint8_t>(index);
+        auto I = hmac_sha512_with(hkey, data, 37);
+        std::array<uint8_t, 32> IL{};
+        std::memcpy(IL.data(), I.data(), 32);
+        Scalar il_scalar{};
+        if (Scalar::parse_bytes_strict(IL, il_scalar) && !il_scalar.is_zero()) {
+            il_list.push_back(il_scalar);
+            slot.push_back(i);
+        }
+    }
+    if (il_list.empty()) return true;
+
+    std::size_t const m = il_list.size();
+    auto pts = public_child_points(il_list, parent_pk);
+    std::vector<fast::FieldElement> xs(m), ys(m);
+    Point::batch_normalize(pts.data(), m, xs.data(), ys.data());
+    for (std::size_t j = 0; j < m; ++j) {
+        if (pts[j].is_infinity()) continue;
+        out_x[slot[j]] = xs[j];
+        out_y[slot[j]] = ys[j];
+        ok[slot[j]] = true;
+    }
+    return true;
+}
+
+// -- Derivation Cache ---------------------------------------------------------
+
+DerivationCache::DerivationCache(const ExtendedKey& master, std::size_t max_entries)
+    : master_(master), max_entries_(max_entries) {}
+
+DerivationCache::~DerivationCache() {
+    clear();
+    detail::secure_erase(master_.key.data(), master_.key.size());
+    detail::secure_erase(master_.chain_code.data(), master_.chain_code.size());
+}
+
+void DerivationCache::clear() noexcept {
+    for (auto& entry : entries_) {
+        detail::secure_erase(entry.second.key.data(), entry.second.key.size());
+        detail::secure_erase(entry.second.chain_code.data(), entry.second.chain_code.size());
+    }
+    entries_.clear();
+}
+
+std::pair<ExtendedKey, bool>
+DerivationCache::derive_prefix(const std::vector<uint32_t>& indices, std::size_t len) {
+    // Longest cached prefix of indices[0..len).
+    std::size_t have = len;
+    ExtendedKey current = master_;
+    std::vector<uint32_t> key(indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(len));
+    while (have > 0) {
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            current = it->second;
+            break;
+        }
+        key.pop_back();
+        --have;
+    }
+    hits_ += have;
+
+    for (std::size_t level = have; level < len; ++level) {
+        auto [child, ok] = current.derive_child(indices[level]);
+        ++misses_;
+        if (!ok) {
+            detail::secure_erase(current.key.data(), current.key.size());
+            detail::secure_erase(current.chain_code.data(), current.chain_code.size());
+            return {ExtendedKey{}, false};
+        }
+        current = child;
+        detail::secure_erase(child.key.data(), child.key.size());
+        detail::secure_erase(child.chain_code.data(), child.chain_code.size());
+        key.push_back(indices[level]);
+        if (entries_.size() < max_entries_) entries_.emplace(key, current);
+    }
+    return {current, true};
+}
+
+std::pair<ExtendedKey, bool> DerivationCache::derive(const std::vector<uint32_t>& indices) {
+    if (indices.empty()) return {master_, true};
+    // Parent through the cache, the leaf itself is not cached.
+    auto [parent, ok] = derive_prefix(indices, indices.size() - 1);
+    if (!ok) return {ExtendedKey{}, false};
+    auto result = parent.derive_child(indices.back());
+    ++misses_;
+    detail::secure_erase(parent.key.data(), parent.key.size());
+    detail::secure_erase(parent.chain_code.data(), parent.chain_code.size());
+    return result;
+}
+
+std::pair<ExtendedKey, bool> DerivationCache::derive(const std::string& path) {
+    std::vector<uint32_t> indices;
+    if (!bip32_parse_path(path, indices)) return {ExtendedKey{}, false};
+    return derive(indices);
+}
+
+std::vector<std::pair<ExtendedKey, bool>>
+DerivationCache::derive_children_range(const std::string& parent_path, uint32_t first,
+                                       uint32_t count) {
+    std::vector<uint32_t> indices;
+    if (!bip32_parse_path(parent_path, indices)) return {};
+    auto [parent, ok] = derive_prefix(indices, indices.size());
+    if (!ok) return {};
+    auto out = ::secp256k1::derive_children_range(parent, first, count);
+    detail::secure_erase(parent.key.data(), parent.key.size());
+    detail::secure_erase(parent.chain_code.data(), parent.chain_code.size());
+    return out;
+}
+
 } // namespace secp256k1
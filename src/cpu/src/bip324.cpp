@@ -19,11 +19,13 @@
 
 #include "secp256k1/bip324.hpp"
 #include "secp256k1/chacha20_poly1305.hpp"
-#include "secp256k1/hkdf.hpp"
 #include "secp256k1/ellswift.hpp"
 #include "secp256k1/sha256.hpp"
 #include "secp256k1/ct/point.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
+#include "secp256k1/thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 
 #include "secp256k1/detail/csprng.hpp"
@@ -34,6 +36,87 @@ namespace {
 
 using secp256k1::detail::csprng_fill;
 
+// tagged_hash("bip324_ellswift_xonly_ecdh", ell_a || ell_b || x)
+std::array<std::uint8_t, 32> xdh_hash(
+    const std::uint8_t x32[32],
+    const std::uint8_t ell_a[64],
+    const std::uint8_t ell_b[64]) noexcept
+{
+    static const auto kTag = SHA256::hash(
+        reinterpret_cast<const std::uint8_t*>("bip324_ellswift_xonly_ecdh"), 26);
+    SHA256 h;
+    h.update(kTag.data(), 32); h.update(kTag.data(), 32);
+    h.update(ell_a, 64); h.update(ell_b, 64); h.update(x32, 32);
+    return h.finalize();
+}
+
+// HMAC-SHA256 key schedule: SHA-256 states after the ipad / opad blocks.
+struct HmacKey {
+    SHA256 inner;
+    SHA256 outer;
+};
+
+HmacKey hmac_key(const std::uint8_t* key, std::size_t key_len) noexcept {
+    // key_len <= 64 for every caller (the BIP-324 salt and a 32-byte PRK).
+    std::uint8_t ipad[64], opad[64];
+    std::memset(ipad, 0x36, 64);
+    std::memset(opad, 0x5C, 64);
+    for (std::size_t i = 0; i < key_len; ++i) {
+        ipad[i] ^= key[i];
+        opad[i] ^= key[i];
+    }
+    HmacKey k;
+    k.inner.update(ipad, 64);
+    k.outer.update(opad, 64);
+    detail::secure_erase(ipad, sizeof(ipad));
+    detail::secure_erase(opad, sizeof(opad));
+    return k;
+}
+
+void hmac_finish(const HmacKey& key, const std::uint8_t* a, std::size_t a_len,
+                 const std::uint8_t* b, std::size_t b_len, std::uint8_t out[32]) noexcept {
+    SHA256 inner = key.inner;
+    inner.update(a, a_len);
+    if (b_len > 0) inner.update(b, b_len);
+    auto inner_hash = inner.finalize();
+    SHA256 outer = key.outer;
+    outer.update(inner_hash.data(), 32);
+    auto mac = outer.finalize();
+    std::memcpy(out, mac.data(), 32);
+    detail::secure_erase(inner_hash.data(), inner_hash.size());
+    detail::secure_erase(mac.data(), mac.size());
+    detail::secure_erase(&inner, sizeof(inner));
+}
+
+// PRK = HKDF-Extract("bitcoin_v2_shared_secret", shared_secret), then the
+// three 32-byte HKDF-Expand outputs (T(1) = HMAC(PRK, info || 0x01)) from one
+// PRK key schedule. The salt's key schedule is computed once per process:
+// 10 SHA-256 compressions per handshake instead of 16 through hkdf.hpp.
+void derive_session_keys(const std::uint8_t shared_secret[32],
+                         std::uint8_t initiator_key[32],
+                         std::uint8_t responder_key[32],
+                         std::uint8_t session_id[32]) noexcept {
+    static constexpr char kSalt[] = "bitcoin_v2_shared_secret";
+    static const HmacKey kSaltKey = hmac_key(
+        reinterpret_cast<const std::uint8_t*>(kSalt), sizeof(kSalt) - 1);
+
+    std::uint8_t prk[32];
+    hmac_finish(kSaltKey, shared_secret, 32, nullptr, 0, prk);
+    HmacKey prk_key = hmac_key(prk, sizeof(prk));
+
+    static constexpr std::uint8_t kOne = 0x01;
+    auto expand = [&](const char* info, std::size_t info_len, std::uint8_t* out) {
+        hmac_finish(prk_key, reinterpret_cast<const std::uint8_t*>(info), info_len,
+                    &kOne, 1, out);
+    };
+    expand("initiator_L", 11, initiator_key);
+    expand("responder_L", 11, responder_key);
+    expand("session_id", 10, session_id);
+
+    detail::secure_erase(prk, sizeof(prk));
+    detail::secure_erase(&prk_key, sizeof(prk_key));
+}
+
 } // anonymous namespace
 
 // ============================================================================
@@ -53,85 +136,167 @@ void Bip324Cipher::build_nonce(std::uint8_t* nonce) const noexcept {
     }
 }
 
-std::vector<std::uint8_t> Bip324Cipher::encrypt(
-    const std::uint8_t* aad, std::size_t aad_len,
-    const std::uint8_t* plaintext, std::size_t plaintext_len) noexcept {
+namespace {
 
-    // BIP-324 length field is 3 bytes: reject plaintext > 0xFFFFFF
-    if (plaintext_len > 0xFFFFFF) return {};
+// Gather lists up to this many parts go straight to the scatter/gather AEAD;
+// longer lists are copied into the packet buffer first.
+constexpr std::size_t kMaxGatherParts = 15;
 
-    // Overflow guard: 3 + plaintext_len + 16 must not wrap
-    if (plaintext_len > SIZE_MAX - 19) return {};
+inline void store_length24(std::uint8_t* out, std::size_t len) noexcept {
+    out[0] = static_cast<std::uint8_t>(len & 0xFF);
+    out[1] = static_cast<std::uint8_t>((len >> 8) & 0xFF);
+    out[2] = static_cast<std::uint8_t>((len >> 16) & 0xFF);
+}
 
-    // Output: [3-byte encrypted length] [encrypted payload] [16-byte tag]
-    std::size_t const ct_len = 3 + plaintext_len;
-    std::vector<std::uint8_t> output(ct_len + 16);
-
-    // Build combined plaintext [length(3)][payload(N)] directly in output
-    output[0] = static_cast<std::uint8_t>(plaintext_len & 0xFF);
-    output[1] = static_cast<std::uint8_t>((plaintext_len >> 8) & 0xFF);
-    output[2] = static_cast<std::uint8_t>((plaintext_len >> 16) & 0xFF);
-    if (plaintext_len > 0) {
-        std::memcpy(output.data() + 3, plaintext, plaintext_len);
+inline std::uint32_t load_length24(const std::uint8_t* in) noexcept {
+    return static_cast<std::uint32_t>(in[0])
+         | (static_cast<std::uint32_t>(in[1]) << 8)
+         | (static_cast<std::uint32_t>(in[2]) << 16);
+}
+
+} // anonymous namespace
+
+std::size_t Bip324Cipher::encrypt_into(
+    const std::uint8_t* aad, std::size_t aad_len,
+    const AeadSegment* parts, std::size_t part_count,
+    std::uint8_t* out, std::size_t out_cap) noexcept {
+
+    // BIP-324 length field is 3 bytes: reject payloads > 0xFFFFFF
+    std::size_t payload_len = 0;
+    for (std::size_t i = 0; i < part_count; ++i) {
+        if (parts[i].len > kMaxPayload - payload_len) return 0;
+        payload_len += parts[i].len;
     }
+    std::size_t const ct_len = 3 + payload_len;
+    if (out == nullptr || out_cap < ct_len + 16) return 0;
 
-    // Encrypt in place (AEAD supports aliased in/out)
     std::uint8_t nonce[12];
     build_nonce(nonce);
 
-    aead_chacha20_poly1305_encrypt(
-        key_, nonce,
-        aad, aad_len,
-        output.data(), ct_len,
-        output.data(),
-        output.data() + ct_len);
+    // Message = [length(3)][parts...], encrypted into out[0, ct_len).
+    std::uint8_t length[3];
+    store_length24(length, payload_len);
+    if (part_count <= kMaxGatherParts) {
+        AeadSegment in[kMaxGatherParts + 1];
+        in[0] = AeadSegment{length, 3};
+        for (std::size_t i = 0; i < part_count; ++i) in[i + 1] = parts[i];
+        AeadMutableSegment const dst{out, ct_len};
+        aead_chacha20_poly1305_encrypt_v(key_, nonce, aad, aad_len,
+                                         in, part_count + 1, &dst, 1, out + ct_len);
+    } else {
+        std::size_t off = 3;
+        for (std::size_t i = 0; i < part_count; ++i) {
+            if (parts[i].len > 0 && parts[i].data != out + off) {
+                std::memmove(out + off, parts[i].data, parts[i].len);
+            }
+            off += parts[i].len;
+        }
+        std::memcpy(out, length, 3);
+        aead_chacha20_poly1305_encrypt(key_, nonce, aad, aad_len,
+                                       out, ct_len, out, out + ct_len);
+    }
 
     packet_counter_++;
+    return ct_len + 16;
+}
+
+std::size_t Bip324Cipher::encrypt_into(
+    const std::uint8_t* aad, std::size_t aad_len,
+    const std::uint8_t* plaintext, std::size_t plaintext_len,
+    std::uint8_t* out, std::size_t out_cap) noexcept {
+    AeadSegment const part{plaintext, plaintext_len};
+    return encrypt_into(aad, aad_len, &part, 1, out, out_cap);
+}
+
+std::vector<std::uint8_t> Bip324Cipher::encrypt(
+    const std::uint8_t* aad, std::size_t aad_len,
+    const std::uint8_t* plaintext, std::size_t plaintext_len) noexcept {
+
+    // BIP-324 length field is 3 bytes: reject plaintext > 0xFFFFFF
+    if (plaintext_len > kMaxPayload) return {};
+
+    // Output: [3-byte encrypted length] [encrypted payload] [16-byte tag]
+    std::vector<std::uint8_t> output(plaintext_len + kPacketOverhead);
+    encrypt_into(aad, aad_len, plaintext, plaintext_len, output.data(), output.size());
     return output;
 }
 
-bool Bip324Cipher::decrypt(
+bool Bip324Cipher::decrypt_into(
     const std::uint8_t* aad, std::size_t aad_len,
     const std::uint8_t* header_enc,
     const std::uint8_t* contents, std::size_t contents_len,
-    std::vector<std::uint8_t>& plaintext_out) noexcept {
-
-    plaintext_out.clear();
+    std::uint8_t* out, std::size_t out_cap,
+    std::size_t& payload_len) noexcept {
 
+    payload_len = 0;
     if (contents_len < 16) return false;
+    std::size_t const body_len = contents_len - 16;
+    if (body_len > 0 && (out == nullptr || out_cap < body_len)) return false;
 
-    std::size_t const ct_len = 3 + (contents_len - 16);
+    std::uint8_t nonce[12];
+    build_nonce(nonce);
 
-    // Single allocation: reconstruct ciphertext and decrypt in place
-    std::vector<std::uint8_t> buf(ct_len);
-    std::memcpy(buf.data(), header_enc, 3);
-    if (contents_len > 16) {
-        std::memcpy(buf.data() + 3, contents, contents_len - 16);
+    // Ciphertext = [header(3)][body]; the length bytes decrypt to the stack.
+    std::uint8_t length[3];
+    AeadSegment const in[2] = {{header_enc, 3}, {contents, body_len}};
+    AeadMutableSegment const dst[2] = {{length, 3}, {out, body_len}};
+    if (!aead_chacha20_poly1305_decrypt_v(key_, nonce, aad, aad_len,
+                                          in, 2, dst, 2, contents + body_len)) {
+        return false;
     }
 
-    const std::uint8_t* tag = contents + (contents_len - 16);
+    std::uint32_t const len = load_length24(length);
+    if (len > body_len) return false;
+
+    payload_len = len;
+    packet_counter_++;
+    return true;
+}
+
+bool Bip324Cipher::decrypt_in_place(
+    const std::uint8_t* aad, std::size_t aad_len,
+    std::uint8_t* packet, std::size_t packet_len,
+    std::size_t& payload_len) noexcept {
+
+    payload_len = 0;
+    if (packet == nullptr || packet_len < kPacketOverhead) return false;
+    std::size_t const ct_len = packet_len - 16;
 
     std::uint8_t nonce[12];
     build_nonce(nonce);
 
     // Decrypt in place (AEAD supports aliased in/out)
-    bool ok = aead_chacha20_poly1305_decrypt(
-        key_, nonce,
-        aad, aad_len,
-        buf.data(), ct_len,
-        tag,
-        buf.data());
+    if (!aead_chacha20_poly1305_decrypt(key_, nonce, aad, aad_len,
+                                        packet, ct_len, packet + ct_len, packet)) {
+        return false;
+    }
 
-    if (!ok) return false;
+    std::uint32_t const len = load_length24(packet);
+    if (len > ct_len - 3) return false;
 
-    std::uint32_t const payload_len = static_cast<std::uint32_t>(buf[0])
-                                    | (static_cast<std::uint32_t>(buf[1]) << 8)
-                                    | (static_cast<std::uint32_t>(buf[2]) << 16);
+    payload_len = len;
+    packet_counter_++;
+    return true;
+}
 
-    if (payload_len > ct_len - 3) return false;
+bool Bip324Cipher::decrypt(
+    const std::uint8_t* aad, std::size_t aad_len,
+    const std::uint8_t* header_enc,
+    const std::uint8_t* contents, std::size_t contents_len,
+    std::vector<std::uint8_t>& plaintext_out) noexcept {
 
-    plaintext_out.assign(buf.begin() + 3, buf.begin() + 3 + payload_len);
-    packet_counter_++;
+    plaintext_out.clear();
+
+    if (contents_len < 16) return false;
+
+    plaintext_out.resize(contents_len - 16);
+    std::size_t payload_len = 0;
+    if (!decrypt_into(aad, aad_len, header_enc, contents, contents_len,
+                      plaintext_out.data(), plaintext_out.size(), payload_len)) {
+        plaintext_out.clear();
+        return false;
+    }
+    plaintext_out.resize(payload_len);
     return true;
 }
 
@@ -169,62 +334,34 @@ Bip324Session::Bip324Session(bool initiator, const std::uint8_t* privkey) noexce
     detail::secure_erase(&sk, sizeof(sk));
 }
 
-bool Bip324Session::complete_handshake(const std::uint8_t* peer_encoding) noexcept {
+bool Bip324Session::take_private_key(const std::uint8_t* peer_encoding,
+                                     fast::Scalar& sk) noexcept {
     if (established_) return false;
     if (!privkey_valid_) return false;
 
     std::memcpy(peer_encoding_.data(), peer_encoding, 64);
 
     // SEC-006 fix: use stored Scalar directly — no raw-byte re-parse.
-    fast::Scalar sk = privkey_scalar_;
+    sk = privkey_scalar_;
     detail::secure_erase(&privkey_scalar_, sizeof(privkey_scalar_));
     privkey_valid_ = false;
+    return true;
+}
 
-    // Determine ell_a and ell_b (initiator = a, responder = b)
-    const std::uint8_t* ell_a = initiator_ ? our_encoding_.data() : peer_encoding_.data();
-    const std::uint8_t* ell_b = initiator_ ? peer_encoding_.data() : our_encoding_.data();
-
-    // 1. ECDH via ElligatorSwift
-    auto shared_secret = ellswift_xdh(ell_a, ell_b, sk, initiator_);
-
+bool Bip324Session::finish_handshake(std::array<std::uint8_t, 32>& shared_secret) noexcept {
     // Check for failure (all zeros) — constant-time accumulator, no early exit.
     // An early-exit loop leaks timing about the number of leading zero bytes in
     // the shared secret (P1-009 fix). The probability of all-zero is < 2^-256.
     std::uint8_t acc = 0;
     for (auto b : shared_secret) acc |= b;
-    if (acc == 0) {
-        // BUG-FIX: zeroize sk before early return so the ephemeral private key
-        // scalar does not remain on the stack after an attacker-induced ECDH failure.
-        detail::secure_erase(&sk, sizeof(sk));
-        return false;
-    }
+    if (acc == 0) return false;
 
-    // 2. Derive PRK via HKDF-Extract
-    constexpr char salt[] = "bitcoin_v2_shared_secret";
-    auto prk = hkdf_sha256_extract(
-        reinterpret_cast<const std::uint8_t*>(salt), sizeof(salt) - 1,
-        shared_secret.data(), shared_secret.size());
-
-    // 3. Derive directional keys via HKDF-Expand
+    // HKDF-Extract + the three HKDF-Expand outputs
     std::uint8_t initiator_key[32], responder_key[32];
+    derive_session_keys(shared_secret.data(), initiator_key, responder_key,
+                        session_id_.data());
 
-    constexpr char init_info[] = "initiator_L";
-    constexpr char resp_info[] = "responder_L";
-
-    hkdf_sha256_expand(prk.data(),
-                        reinterpret_cast<const std::uint8_t*>(init_info), sizeof(init_info) - 1,
-                        initiator_key, 32);
-    hkdf_sha256_expand(prk.data(),
-                        reinterpret_cast<const std::uint8_t*>(resp_info), sizeof(resp_info) - 1,
-                        responder_key, 32);
-
-    // 4. Derive session ID
-    constexpr char sid_info[] = "session_id";
-    hkdf_sha256_expand(prk.data(),
-                        reinterpret_cast<const std::uint8_t*>(sid_info), sizeof(sid_info) - 1,
-                        session_id_.data(), 32);
-
-    // 5. Assign send/recv keys based on role
+    // Assign send/recv keys based on role
     if (initiator_) {
         send_cipher_.init(initiator_key);
         recv_cipher_.init(responder_key);
@@ -235,16 +372,100 @@ bool Bip324Session::complete_handshake(const std::uint8_t* peer_encoding) noexce
 
     // Secure erase intermediates
     detail::secure_erase(shared_secret.data(), shared_secret.size());
-    detail::secure_erase(prk.data(), prk.size());
     detail::secure_erase(initiator_key, sizeof(initiator_key));
     detail::secure_erase(responder_key, sizeof(responder_key));
-    detail::secure_erase(&sk, sizeof(sk));
-    // privkey_scalar_ was already erased at function entry (lines above).
 
     established_ = true;
     return true;
 }
 
+bool Bip324Session::complete_handshake(const std::uint8_t* peer_encoding) noexcept {
+    fast::Scalar sk;
+    if (!take_private_key(peer_encoding, sk)) return false;
+
+    // Determine ell_a and ell_b (initiator = a, responder = b)
+    const std::uint8_t* ell_a = initiator_ ? our_encoding_.data() : peer_encoding_.data();
+    const std::uint8_t* ell_b = initiator_ ? peer_encoding_.data() : our_encoding_.data();
+
+    // ECDH via ElligatorSwift. BUG-FIX: sk is erased before any return so the
+    // ephemeral private key does not remain on the stack after an
+    // attacker-induced ECDH failure.
+    auto shared_secret = ellswift_xdh(ell_a, ell_b, sk, initiator_);
+    detail::secure_erase(&sk, sizeof(sk));
+
+    return finish_handshake(shared_secret);
+}
+
+std::size_t Bip324Session::complete_handshakes(
+    Bip324Session* const* sessions, const std::uint8_t* peer_encodings,
+    std::size_t count, std::uint8_t* ok_out) noexcept {
+    std::size_t established = 0;
+    for (std::size_t base = 0; base < count; base += kHandshakeBatch) {
+        std::size_t const m = std::min(kHandshakeBatch, count - base);
+        established += complete_handshake_chunk(sessions + base, peer_encodings + 64 * base,
+                                                m, ok_out ? ok_out + base : nullptr);
+    }
+    return established;
+}
+
+std::size_t Bip324Session::complete_handshakes(
+    Bip324Session* const* sessions, const std::uint8_t* peer_encodings,
+    std::size_t count, ThreadPool& pool, std::uint8_t* ok_out) noexcept {
+    std::atomic<std::size_t> established{0};
+    pool.parallel_for(count, kHandshakeBatch, [&](std::size_t begin, std::size_t end) {
+        established.fetch_add(
+            complete_handshakes(sessions + begin, peer_encodings + 64 * begin, end - begin,
+                                ok_out ? ok_out + begin : nullptr),
+            std::memory_order_relaxed);
+    });
+    return established.load(std::memory_order_relaxed);
+}
+
+// Up to kHandshakeBatch sessions: decode every peer encoding as a fraction,
+// run the CT x-only multiplies with one shared final inversion, then hash and
+// derive keys per session. Sessions that cannot take a handshake are skipped.
+std::size_t Bip324Session::complete_handshake_chunk(
+    Bip324Session* const* sessions, const std::uint8_t* peer_encodings,
+    std::size_t count, std::uint8_t* ok_out) noexcept {
+    fast::FieldElement xn[kHandshakeBatch], xd[kHandshakeBatch], x[kHandshakeBatch];
+    fast::Scalar sk[kHandshakeBatch];
+    std::size_t idx[kHandshakeBatch];
+
+    std::size_t live = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (ok_out) ok_out[i] = 0;
+        Bip324Session* s = sessions[i];
+        if (s == nullptr || !s->take_private_key(peer_encodings + 64 * i, sk[live])) continue;
+        auto [n, d] = ellswift_decode_frac(s->peer_encoding_.data());
+        xn[live] = n;
+        xd[live] = d;
+        idx[live++] = i;
+    }
+
+    ct::ecmult_const_xonly_batch(xn, xd, sk, x, live);
+    detail::secure_erase(sk, sizeof(sk));
+
+    std::size_t established = 0;
+    for (std::size_t j = 0; j < live; ++j) {
+        Bip324Session* s = sessions[idx[j]];
+        const std::uint8_t* ell_a = s->initiator_ ? s->our_encoding_.data() : s->peer_encoding_.data();
+        const std::uint8_t* ell_b = s->initiator_ ? s->peer_encoding_.data() : s->our_encoding_.data();
+
+        std::array<std::uint8_t, 32> shared_secret{};
+        if (!(x[j] == fast::FieldElement::zero())) {
+            auto x32 = x[j].to_bytes();
+            shared_secret = xdh_hash(x32.data(), ell_a, ell_b);
+            detail::secure_erase(x32.data(), x32.size());
+        }
+        if (s->finish_handshake(shared_secret)) {
+            if (ok_out) ok_out[idx[j]] = 1;
+            ++established;
+        }
+    }
+    detail::secure_erase(x, sizeof(x));
+    return established;
+}
+
 std::vector<std::uint8_t> Bip324Session::encrypt(
     const std::uint8_t* plaintext, std::size_t plaintext_len) noexcept {
     if (!established_) return {};
@@ -262,6 +483,39 @@ bool Bip324Session::decrypt(
     return recv_cipher_.decrypt(nullptr, 0, header, payload_and_tag, len, plaintext_out);
 }
 
+std::size_t Bip324Session::encrypt_into(
+    const AeadSegment* parts, std::size_t part_count,
+    std::uint8_t* out, std::size_t out_cap) noexcept {
+    if (!established_) return 0;
+    return send_cipher_.encrypt_into(nullptr, 0, parts, part_count, out, out_cap);
+}
+
+std::size_t Bip324Session::encrypt_into(
+    const std::uint8_t* plaintext, std::size_t plaintext_len,
+    std::uint8_t* out, std::size_t out_cap) noexcept {
+    if (!established_) return 0;
+    return send_cipher_.encrypt_into(nullptr, 0, plaintext, plaintext_len, out, out_cap);
+}
+
+bool Bip324Session::decrypt_into(
+    const std::uint8_t* header,
+    const std::uint8_t* payload_and_tag, std::size_t len,
+    std::uint8_t* out, std::size_t out_cap,
+    std::size_t& payload_len) noexcept {
+    payload_len = 0;
+    if (!established_) return false;
+    return recv_cipher_.decrypt_into(nullptr, 0, header, payload_and_tag, len,
+                                     out, out_cap, payload_len);
+}
+
+bool Bip324Session::decrypt_in_place(
+    std::uint8_t* packet, std::size_t packet_len,
+    std::size_t& payload_len) noexcept {
+    payload_len = 0;
+    if (!established_) return false;
+    return recv_cipher_.decrypt_in_place(nullptr, 0, packet, packet_len, payload_len);
+}
+
 // ============================================================================
 // BIP-324 optimized XDH backend — sqrt-free x-only path
 // ============================================================================
@@ -277,23 +531,6 @@ bool Bip324Session::decrypt(
 
 namespace bip324 {
 
-namespace {
-
-static std::array<std::uint8_t,32> bip324_xdh_hash(
-    const std::uint8_t x32[32],
-    const std::uint8_t ell_a[64],
-    const std::uint8_t ell_b[64]) noexcept
-{
-    static const auto kTag = SHA256::hash(
-        reinterpret_cast<const std::uint8_t*>("bip324_ellswift_xonly_ecdh"), 26);
-    SHA256 h;
-    h.update(kTag.data(), 32); h.update(kTag.data(), 32);
-    h.update(ell_a, 64); h.update(ell_b, 64); h.update(x32, 32);
-    return h.finalize();
-}
-
-} // anonymous
-
 std::array<std::uint8_t,32> xdh(
     const std::uint8_t ell_a64[64],   // initiator's ELL (party 0)
     const std::uint8_t ell_b64[64],   // responder's ELL (party 1)
@@ -318,7 +555,7 @@ std::array<std::uint8_t,32> xdh(
 
     auto x32 = px.to_bytes();
     // Hash: (x, ell_a64, ell_b64) — same order for both parties
-    return bip324_xdh_hash(x32.data(), ell_a64, ell_b64);
+    return xdh_hash(x32.data(), ell_a64, ell_b64);
 }
 
 } // namespace bip324
@@ -4,7 +4,8 @@
 #include "secp256k1/bip39.hpp"
 #include "secp256k1/bip39_wordlist.hpp"
 #include "secp256k1/sha256.hpp"
-#include "secp256k1/bip32.hpp"  // hmac_sha512
+#include "secp256k1/sha512.hpp"
+#include "secp256k1/hash_accel.hpp"  // pbkdf2_sha512_iterate_batch
 #include "secp256k1/detail/secure_erase.hpp"
 #include "secp256k1/detail/csprng.hpp"  // ENTROPY-SOURCE: single-source fail-closed CSPRNG
 #include "secp256k1/unicode_nfkd.hpp"
@@ -12,6 +13,7 @@
 #include <algorithm>
 #include <cstring>
 #include <sstream>
+#include <vector>
 
 #if defined(_WIN32)
 #  include <windows.h>
@@ -62,45 +64,100 @@ static std::vector<std::string> split_words(const std::string& mnemonic) {
 // ---------------------------------------------------------------------------
 // PBKDF2-HMAC-SHA512
 // ---------------------------------------------------------------------------
+// HMAC pads are absorbed once per password: every PRF call then starts from
+// the ipad / opad midstates, and rounds 2..c (fixed 64-byte messages) are
+// two compressions each in hash::pbkdf2_sha512_iterate_batch instead of the
+// four a full hmac_sha512 call costs.
+namespace {
+
+struct Pbkdf2Key {
+    SHA512::Midstate inner;
+    SHA512::Midstate outer;
+};
+
+void pbkdf2_key_setup(const uint8_t* password, size_t password_len, Pbkdf2Key& key) {
+    uint8_t k[128] = {};
+    if (password_len > 128) {
+        auto const hk = SHA512::hash(password, password_len);
+        std::memcpy(k, hk.data(), hk.size());
+    } else if (password_len > 0) {
+        std::memcpy(k, password, password_len);
+    }
+
+    uint8_t pad[128];
+    for (size_t i = 0; i < 128; ++i) pad[i] = static_cast<uint8_t>(k[i] ^ 0x36);
+    SHA512 ctx;
+    ctx.update(pad, 128);
+    key.inner = ctx.capture_midstate();
+
+    for (size_t i = 0; i < 128; ++i) pad[i] = static_cast<uint8_t>(k[i] ^ 0x5c);
+    ctx = SHA512();
+    ctx.update(pad, 128);
+    key.outer = ctx.capture_midstate();
+
+    detail::secure_erase(k, sizeof(k));
+    detail::secure_erase(pad, sizeof(pad));
+    detail::secure_erase(&ctx, sizeof(ctx));
+}
+
+// U_1 = HMAC-SHA512(password, salt || INT_32_BE(block_num)) as SHA-512 words.
+void pbkdf2_first_round(const Pbkdf2Key& key, const uint8_t* salt, size_t salt_len,
+                        uint32_t block_num, uint64_t u1[8]) {
+    uint8_t const ctr[4] = {
+        static_cast<uint8_t>(block_num >> 24), static_cast<uint8_t>(block_num >> 16),
+        static_cast<uint8_t>(block_num >> 8), static_cast<uint8_t>(block_num)};
+    SHA512 ctx = SHA512::from_midstate(key.inner);
+    ctx.update(salt, salt_len);
+    ctx.update(ctr, 4);
+    auto inner_hash = ctx.finalize();
+
+    ctx = SHA512::from_midstate(key.outer);
+    ctx.update(inner_hash.data(), inner_hash.size());
+    auto u = ctx.finalize();
+    for (size_t i = 0; i < 8; ++i) {
+        uint64_t w = 0;
+        for (size_t j = 0; j < 8; ++j) w = (w << 8) | u[i * 8 + j];
+        u1[i] = w;
+    }
+
+    detail::secure_erase(inner_hash.data(), inner_hash.size());
+    detail::secure_erase(u.data(), u.size());
+    detail::secure_erase(&ctx, sizeof(ctx));
+}
+
+void store_words_be(const uint64_t t[8], uint8_t* out, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        out[i] = static_cast<uint8_t>(t[i / 8] >> (56 - 8 * (i % 8)));
+    }
+}
+
+} // anonymous namespace
+
 void pbkdf2_hmac_sha512(const uint8_t* password, size_t password_len,
                          const uint8_t* salt, size_t salt_len,
                          uint32_t iterations,
                          uint8_t* output, size_t output_len) {
     // BIP-39 always uses output_len = 64 (one block), but we implement
     // the general multi-block version for correctness.
+    Pbkdf2Key key;
+    pbkdf2_key_setup(password, password_len, key);
+
     uint32_t block_num = 1;
     size_t offset = 0;
+    uint64_t t[1][8];
 
     while (offset < output_len) {
-        // U_1 = HMAC-SHA512(password, salt || INT_32_BE(block_num))
-        // Build salt || INT_32_BE(block_num)
-        std::vector<uint8_t> salt_block(salt_len + 4);
-        std::memcpy(salt_block.data(), salt, salt_len);
-        salt_block[salt_len + 0] = static_cast<uint8_t>((block_num >> 24) & 0xFF);
-        salt_block[salt_len + 1] = static_cast<uint8_t>((block_num >> 16) & 0xFF);
-        salt_block[salt_len + 2] = static_cast<uint8_t>((block_num >> 8) & 0xFF);
-        salt_block[salt_len + 3] = static_cast<uint8_t>(block_num & 0xFF);
-
-        auto u = hmac_sha512(password, password_len,
-                             salt_block.data(), salt_block.size());
-
-        std::array<uint8_t, 64> result = u;
-
-        for (uint32_t i = 1; i < iterations; ++i) {
-            u = hmac_sha512(password, password_len, u.data(), u.size());
-            for (size_t j = 0; j < 64; ++j) {
-                result[j] ^= u[j];
-            }
-        }
+        pbkdf2_first_round(key, salt, salt_len, block_num, t[0]);
+        hash::pbkdf2_sha512_iterate_batch(&key.inner.state, &key.outer.state, t, 1, iterations);
 
         const size_t to_copy = std::min<size_t>(64, output_len - offset);
-        std::memcpy(output + offset, result.data(), to_copy);
-        detail::secure_erase(salt_block.data(), salt_block.size());
-        detail::secure_erase(result.data(), result.size());
-        detail::secure_erase(u.data(), u.size());
+        store_words_be(t[0], output + offset, to_copy);
         offset += to_copy;
         ++block_num;
     }
+
+    detail::secure_erase(&key, sizeof(key));
+    detail::secure_erase(t, sizeof(t));
 }
 
 // ---------------------------------------------------------------------------
@@ -276,6 +333,56 @@ bip39_mnemonic_to_seed(const std::string& mnemonic,
     return {seed, true};
 }
 
+// ---------------------------------------------------------------------------
+// bip39_mnemonic_to_seed_batch
+// ---------------------------------------------------------------------------
+void bip39_mnemonic_to_seed_batch(const std::string* mnemonics,
+                                  const std::string* passphrases,
+                                  size_t count,
+                                  std::array<uint8_t, 64>* seeds_out,
+                                  bool* ok_out) {
+    // Fixed-size chunks keep the lane state on the stack (12 KiB).
+    constexpr size_t kChunk = 64;
+    uint64_t inner[kChunk][8];
+    uint64_t outer[kChunk][8];
+    uint64_t t[kChunk][8];
+    size_t slot[kChunk];
+
+    for (size_t base = 0; base < count; base += kChunk) {
+        size_t const n = std::min(kChunk, count - base);
+        size_t live = 0;
+        for (size_t i = base; i < base + n; ++i) {
+            seeds_out[i] = {};
+            if (ok_out) ok_out[i] = !mnemonics[i].empty();
+            if (mnemonics[i].empty()) continue;
+
+            std::string norm_mnemonic = nfkd_normalize(mnemonics[i]);
+            std::string salt_str = "mnemonic";
+            if (passphrases) salt_str += nfkd_normalize(passphrases[i]);
+
+            Pbkdf2Key key;
+            pbkdf2_key_setup(reinterpret_cast<const uint8_t*>(norm_mnemonic.data()),
+                             norm_mnemonic.size(), key);
+            pbkdf2_first_round(key, reinterpret_cast<const uint8_t*>(salt_str.data()),
+                               salt_str.size(), 1, t[live]);
+            std::memcpy(inner[live], key.inner.state, sizeof(inner[live]));
+            std::memcpy(outer[live], key.outer.state, sizeof(outer[live]));
+            slot[live++] = i;
+
+            detail::secure_erase(&key, sizeof(key));
+            detail::secure_erase(norm_mnemonic.data(), norm_mnemonic.size());
+            detail::secure_erase(salt_str.data(), salt_str.size());
+        }
+
+        hash::pbkdf2_sha512_iterate_batch(inner, outer, t, live, 2048);
+        for (size_t j = 0; j < live; ++j) store_words_be(t[j], seeds_out[slot[j]].data(), 64);
+    }
+
+    detail::secure_erase(inner, sizeof(inner));
+    detail::secure_erase(outer, sizeof(outer));
+    detail::secure_erase(t, sizeof(t));
+}
+
 // ---------------------------------------------------------------------------
 // bip39_mnemonic_to_entropy
 // ---------------------------------------------------------------------------
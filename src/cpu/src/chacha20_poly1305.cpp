@@ -3,7 +3,9 @@
 // ============================================================================
 // Features:
 //   - SSE2/SSSE3 vectorized ChaCha20 quarter-round (x86-64)
+//   - Multi-block ChaCha20 keystream: 4 blocks (SSE2), 8 (AVX2), 16 (AVX-512)
 //   - 64-bit Poly1305 with __int128 multiply, 3×44-bit limbs (x86-64/aarch64)
+//   - 4-way AVX2 Poly1305 (5×26-bit limbs) for long messages
 //   - 32-bit scalar fallback for embedded/MSVC targets
 //   - Constant-time tag comparison via timing-safe equality check
 //   - Key material is securely erased after use
@@ -11,6 +13,7 @@
 
 #include "secp256k1/chacha20_poly1305.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
+#include "secp256k1/hash_accel.hpp"   // avx2_available(), avx512_available()
 #include <cstring>
 
 #if defined(__x86_64__) || defined(_M_X64)
@@ -20,6 +23,17 @@
 #endif
 #endif
 
+// Multi-block kernels are written over GCC/Clang vector types and compiled
+// per ISA with target() attributes (same scheme as hash_accel.cpp), then
+// picked at runtime from the cached CPUID flags.
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define SECP256K1_CHACHA_MULTIBLOCK 1
+    #include <immintrin.h>   // file scope: see hash_accel.cpp
+    #if !defined(SECP256K1_NO_INT128)
+        #define SECP256K1_POLY1305_AVX2 1
+    #endif
+#endif
+
 namespace secp256k1 {
 
 // ============================================================================
@@ -195,6 +209,161 @@ void chacha20_setup_state(std::uint32_t state[16],
     state[15] = load32_le(nonce + 8);
 }
 
+// ---- Multi-block ChaCha20 keystream ----
+// One block per 32-bit lane: x[i] holds word i of N consecutive blocks
+// (counters state[12] .. state[12] + N - 1), so a quarter-round is 12 vector
+// ops for N blocks with no shuffles. The result is transposed back to block
+// order on the way out. 16 words x 8 lanes fill all 16 YMM registers, so the
+// AVX2 kernel spills a little; AVX-512 has room for all 16 ZMM words.
+
+#ifdef SECP256K1_CHACHA_MULTIBLOCK
+
+#define CC_INLINE inline __attribute__((always_inline))
+
+typedef std::uint32_t cc_u32x4  __attribute__((vector_size(16)));
+typedef std::uint32_t cc_u32x8  __attribute__((vector_size(32)));
+typedef std::uint32_t cc_u32x16 __attribute__((vector_size(64)));
+typedef std::uint8_t  cc_u8x32  __attribute__((vector_size(32)));
+
+// Lane-wise helpers are macros or take references: a function taking a
+// vector by value has a baseline-ISA signature (-Wpsabi), see hash_accel.cpp.
+#define CC_SPLAT(V, x)  (V{} + static_cast<std::uint32_t>(x))
+#define CC_ROTL(x, n)   (((x) << (n)) | ((x) >> (32 - (n))))
+
+// 16- and 8-bit rotations as byte shuffles (vpshufb) on 256-bit vectors;
+// AVX-512 has vprold and SSE2 has no byte shuffle, so those keep shifts.
+// Taken by reference, which keeps vectors out of the function signature.
+template <class V>
+CC_INLINE void cc_rot16(V& x) noexcept {
+    if constexpr (sizeof(V) == 32) {
+        x = (V)__builtin_shuffle((cc_u8x32)x, (cc_u8x32){
+             2, 3, 0, 1,  6, 7, 4, 5, 10,11, 8, 9, 14,15,12,13,
+            18,19,16,17, 22,23,20,21, 26,27,24,25, 30,31,28,29});
+    } else {
+        x = CC_ROTL(x, 16);
+    }
+}
+
+template <class V>
+CC_INLINE void cc_rot8(V& x) noexcept {
+    if constexpr (sizeof(V) == 32) {
+        x = (V)__builtin_shuffle((cc_u8x32)x, (cc_u8x32){
+             3, 0, 1, 2,  7, 4, 5, 6, 11, 8, 9,10, 15,12,13,14,
+            19,16,17,18, 23,20,21,22, 27,24,25,26, 31,28,29,30});
+    } else {
+        x = CC_ROTL(x, 8);
+    }
+}
+
+#define CC_QR(a, b, c, d) do { \
+    a += b; d ^= a; cc_rot16(d);       \
+    c += d; b ^= c; b = CC_ROTL(b, 12); \
+    a += b; d ^= a; cc_rot8(d);        \
+    c += d; b ^= c; b = CC_ROTL(b, 7);  \
+} while (0)
+
+// N keystream blocks from state (counter state[12]) into out[0, 64*N).
+template <class V, int N>
+CC_INLINE void chacha20_blocks_lanes(const std::uint32_t state[16],
+                                     std::uint8_t* out) noexcept {
+    V x[16];
+    for (int i = 0; i < 16; ++i) x[i] = CC_SPLAT(V, state[i]);
+    for (int l = 0; l < N; ++l) x[12][l] += static_cast<std::uint32_t>(l);
+    V const counters = x[12];
+
+    for (int r = 0; r < 10; ++r) {
+        CC_QR(x[0], x[4], x[ 8], x[12]);
+        CC_QR(x[1], x[5], x[ 9], x[13]);
+        CC_QR(x[2], x[6], x[10], x[14]);
+        CC_QR(x[3], x[7], x[11], x[15]);
+        CC_QR(x[0], x[5], x[10], x[15]);
+        CC_QR(x[1], x[6], x[11], x[12]);
+        CC_QR(x[2], x[7], x[ 8], x[13]);
+        CC_QR(x[3], x[4], x[ 9], x[14]);
+    }
+
+    for (int i = 0; i < 16; ++i) x[i] += (i == 12) ? counters : CC_SPLAT(V, state[i]);
+    // Little-endian host: word i of block l goes to out + 64*l + 4*i.
+    for (int l = 0; l < N; ++l) {
+        for (int i = 0; i < 16; ++i) {
+            std::uint32_t const w = x[i][l];
+            std::memcpy(out + 64 * l + 4 * i, &w, 4);
+        }
+    }
+}
+
+#undef CC_QR
+#undef CC_ROTL
+#undef CC_SPLAT
+#undef CC_INLINE
+
+void chacha20_blocks_x4(const std::uint32_t state[16], std::uint8_t out[256]) noexcept {
+    chacha20_blocks_lanes<cc_u32x4, 4>(state, out);
+}
+
+__attribute__((target("avx2")))
+void chacha20_blocks_x8(const std::uint32_t state[16], std::uint8_t out[512]) noexcept {
+    chacha20_blocks_lanes<cc_u32x8, 8>(state, out);
+}
+
+__attribute__((target("avx512f")))
+void chacha20_blocks_x16(const std::uint32_t state[16], std::uint8_t out[1024]) noexcept {
+    chacha20_blocks_lanes<cc_u32x16, 16>(state, out);
+}
+
+#endif // SECP256K1_CHACHA_MULTIBLOCK
+
+// Keystream for nblocks consecutive blocks; advances state[12] by nblocks.
+// Wide kernels take the bulk, narrower ones (down to one block) the tail.
+void chacha20_keystream(std::uint32_t state[16], std::uint8_t* out,
+                        std::size_t nblocks) noexcept {
+#ifdef SECP256K1_CHACHA_MULTIBLOCK
+    if (nblocks >= 16 && hash::avx512_available()) {
+        do {
+            chacha20_blocks_x16(state, out);
+            state[12] += 16;
+            out += 1024;
+            nblocks -= 16;
+        } while (nblocks >= 16);
+    }
+    if (nblocks >= 8 && hash::avx2_available()) {
+        do {
+            chacha20_blocks_x8(state, out);
+            state[12] += 8;
+            out += 512;
+            nblocks -= 8;
+        } while (nblocks >= 8);
+    }
+    while (nblocks >= 4) {
+        chacha20_blocks_x4(state, out);
+        state[12] += 4;
+        out += 256;
+        nblocks -= 4;
+    }
+#endif
+    for (; nblocks > 0; --nblocks) {
+        chacha20_block_internal(state, out);
+        state[12]++;
+        out += 64;
+    }
+}
+
+// Keystream is generated this many bytes at a time (one AVX-512 call).
+constexpr std::size_t kKeystreamChunk = 1024;
+
+inline void xor_into(std::uint8_t* dst, const std::uint8_t* src,
+                     const std::uint8_t* ks, std::size_t len) noexcept {
+    std::size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        std::uint64_t a, b;
+        std::memcpy(&a, src + i, 8);
+        std::memcpy(&b, ks + i, 8);
+        a ^= b;
+        std::memcpy(dst + i, &a, 8);
+    }
+    for (; i < len; ++i) dst[i] = static_cast<std::uint8_t>(src[i] ^ ks[i]);
+}
+
 } // anonymous namespace
 
 void chacha20_block(const std::uint8_t key[32],
@@ -214,22 +383,18 @@ void chacha20_crypt(const std::uint8_t key[32],
     std::uint32_t state[16];
     chacha20_setup_state(state, key, nonce, counter);
 
-    std::uint8_t block[64];
+    alignas(64) std::uint8_t ks[kKeystreamChunk];
     std::size_t offset = 0;
 
     while (offset < len) {
-        chacha20_block_internal(state, block);
-        state[12]++; // increment counter
-
-        std::size_t const use = (len - offset < 64) ? (len - offset) : 64;
-        for (std::size_t i = 0; i < use; ++i) {
-            data[offset + i] ^= block[i];
-        }
+        std::size_t const use = (len - offset < kKeystreamChunk) ? (len - offset) : kKeystreamChunk;
+        chacha20_keystream(state, ks, (use + 63) / 64);
+        xor_into(data + offset, data + offset, ks, use);
         offset += use;
     }
 
     detail::secure_erase(state, sizeof(state));
-    detail::secure_erase(block, sizeof(block));
+    detail::secure_erase(ks, (len < kKeystreamChunk) ? ((len + 63) & ~std::size_t{63}) : sizeof(ks));
 }
 
 // ============================================================================
@@ -237,12 +402,197 @@ void chacha20_crypt(const std::uint8_t key[32],
 // ============================================================================
 // 64-bit path: 3×44-bit limbs with unsigned __int128 multiply (9 muls vs 25).
 // 32-bit fallback: original 5×26-bit limbs with uint64_t multiply.
+// AVX2 path: runs of >= 16 blocks on four interleaved accumulators.
 // ============================================================================
 
 namespace {
 
 #if !defined(SECP256K1_NO_INT128)
 
+constexpr std::uint64_t kMask26 = 0x3FFFFFFULL;
+constexpr std::uint64_t kMask44 = 0xFFFFFFFFFFFULL;
+
+#ifdef SECP256K1_POLY1305_AVX2
+
+// ---- 4-way AVX2 Poly1305 ----
+// Block j of a run goes to accumulator j mod 4. Each step multiplies all four
+// by r^4 (25 vpmuludq on 5×26-bit limbs) and adds the next four blocks:
+//
+//   h = (((h + m0) r^4 + m4) r^4 + ...) r^4 + m_{4k}  (and likewise m1, m2, m3)
+//
+// and a final multiply by [r^4, r^3, r^2, r] lines the accumulators up before
+// they are summed back into the scalar 44-bit state. Limbs stay below 2^27
+// between steps, so the 64-bit lane sums stay below 2^59.
+
+// Limbs of a 44/44/42-bit value (limb 1 carried) in 26-bit radix.
+inline void limbs44_to_26(const std::uint64_t in[3], std::uint64_t out[5]) noexcept {
+    std::uint64_t const l1 = in[1] & kMask44;
+    std::uint64_t const l2 = in[2] + (in[1] >> 44);
+    out[0] =   in[0]                  & kMask26;
+    out[1] = ((in[0] >> 26) | (l1 << 18)) & kMask26;
+    out[2] =  (l1 >> 8)               & kMask26;
+    out[3] = ((l1 >> 34) | (l2 << 10)) & kMask26;
+    out[4] =   l2 >> 16;
+}
+
+// out = a * b mod 2^130 - 5, 26-bit limbs, carried.
+inline void poly26_mul(const std::uint64_t a[5], const std::uint64_t b[5],
+                       std::uint64_t out[5]) noexcept {
+    std::uint64_t const s1 = b[1] * 5, s2 = b[2] * 5, s3 = b[3] * 5, s4 = b[4] * 5;
+    std::uint64_t d0 = a[0] * b[0] + a[1] * s4   + a[2] * s3   + a[3] * s2   + a[4] * s1;
+    std::uint64_t d1 = a[0] * b[1] + a[1] * b[0] + a[2] * s4   + a[3] * s3   + a[4] * s2;
+    std::uint64_t d2 = a[0] * b[2] + a[1] * b[1] + a[2] * b[0] + a[3] * s4   + a[4] * s3;
+    std::uint64_t d3 = a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0] + a[4] * s4;
+    std::uint64_t d4 = a[0] * b[4] + a[1] * b[3] + a[2] * b[2] + a[3] * b[1] + a[4] * b[0];
+    std::uint64_t c;
+    c = d0 >> 26; d0 &= kMask26; d1 += c;
+    c = d1 >> 26; d1 &= kMask26; d2 += c;
+    c = d2 >> 26; d2 &= kMask26; d3 += c;
+    c = d3 >> 26; d3 &= kMask26; d4 += c;
+    c = d4 >> 26; d4 &= kMask26; d0 += c * 5;
+    c = d0 >> 26; d0 &= kMask26; d1 += c;
+    out[0] = d0; out[1] = d1; out[2] = d2; out[3] = d3; out[4] = d4;
+}
+
+#define P4_INLINE static inline __attribute__((target("avx2"), always_inline))
+
+// Four consecutive blocks, one per lane, with the 2^128 pad bit.
+P4_INLINE void poly4_load(const std::uint8_t* m, __m256i l[5]) noexcept {
+    __m256i const mask = _mm256_set1_epi64x(static_cast<long long>(kMask26));
+    __m256i const lo = _mm256_set_epi64x(
+        static_cast<long long>(load64_le(m + 48)), static_cast<long long>(load64_le(m + 32)),
+        static_cast<long long>(load64_le(m + 16)), static_cast<long long>(load64_le(m)));
+    __m256i const hi = _mm256_set_epi64x(
+        static_cast<long long>(load64_le(m + 56)), static_cast<long long>(load64_le(m + 40)),
+        static_cast<long long>(load64_le(m + 24)), static_cast<long long>(load64_le(m + 8)));
+    l[0] = _mm256_and_si256(lo, mask);
+    l[1] = _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask);
+    l[2] = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)), mask);
+    l[3] = _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask);
+    l[4] = _mm256_or_si256(_mm256_srli_epi64(hi, 40), _mm256_set1_epi64x(1LL << 24));
+}
+
+// h *= r lane-wise (s = 5 r), uncarried.
+P4_INLINE void poly4_mul(__m256i h[5], const __m256i r[5], const __m256i s[5]) noexcept {
+    __m256i d0 = _mm256_mul_epu32(h[0], r[0]);
+    __m256i d1 = _mm256_mul_epu32(h[0], r[1]);
+    __m256i d2 = _mm256_mul_epu32(h[0], r[2]);
+    __m256i d3 = _mm256_mul_epu32(h[0], r[3]);
+    __m256i d4 = _mm256_mul_epu32(h[0], r[4]);
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[1], s[4]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[1], r[0]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[1], r[1]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[1], r[2]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[1], r[3]));
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[2], s[3]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[2], s[4]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[2], r[0]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[2], r[1]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[2], r[2]));
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[3], s[2]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[3], s[3]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[3], s[4]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[3], r[0]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[3], r[1]));
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[4], s[1]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[4], s[2]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[4], s[3]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[4], s[4]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[4], r[0]));
+    h[0] = d0; h[1] = d1; h[2] = d2; h[3] = d3; h[4] = d4;
+}
+
+// Partial carry back to ~26-bit limbs (two interleaved chains).
+P4_INLINE void poly4_carry(__m256i h[5]) noexcept {
+    __m256i const mask = _mm256_set1_epi64x(static_cast<long long>(kMask26));
+    __m256i c;
+    c = _mm256_srli_epi64(h[0], 26); h[0] = _mm256_and_si256(h[0], mask); h[1] = _mm256_add_epi64(h[1], c);
+    c = _mm256_srli_epi64(h[3], 26); h[3] = _mm256_and_si256(h[3], mask); h[4] = _mm256_add_epi64(h[4], c);
+    c = _mm256_srli_epi64(h[1], 26); h[1] = _mm256_and_si256(h[1], mask); h[2] = _mm256_add_epi64(h[2], c);
+    c = _mm256_srli_epi64(h[4], 26); h[4] = _mm256_and_si256(h[4], mask);
+    h[0] = _mm256_add_epi64(h[0], _mm256_add_epi64(c, _mm256_slli_epi64(c, 2)));   // 2^130 = 5
+    c = _mm256_srli_epi64(h[2], 26); h[2] = _mm256_and_si256(h[2], mask); h[3] = _mm256_add_epi64(h[3], c);
+    c = _mm256_srli_epi64(h[0], 26); h[0] = _mm256_and_si256(h[0], mask); h[1] = _mm256_add_epi64(h[1], c);
+    c = _mm256_srli_epi64(h[3], 26); h[3] = _mm256_and_si256(h[3], mask); h[4] = _mm256_add_epi64(h[4], c);
+}
+
+// Absorb 4 * ngroups full blocks into the 44-bit accumulator h (clamped key
+// r, both in 44/44/42-bit limbs). ngroups >= 1.
+__attribute__((target("avx2")))
+void poly1305_blocks_avx2(std::uint64_t h[3], const std::uint64_t r[3],
+                          const std::uint8_t* msg, std::size_t ngroups) noexcept {
+    std::uint64_t r1[5], r2[5], r3[5], r4[5];
+    limbs44_to_26(r, r1);
+    poly26_mul(r1, r1, r2);
+    poly26_mul(r2, r1, r3);
+    poly26_mul(r2, r2, r4);
+
+    __m256i R[5], S[5];
+    for (int i = 0; i < 5; ++i) {
+        R[i] = _mm256_set1_epi64x(static_cast<long long>(r4[i]));
+        S[i] = _mm256_set1_epi64x(static_cast<long long>(r4[i] * 5));
+    }
+
+    std::uint64_t h26[5];
+    limbs44_to_26(h, h26);
+    __m256i acc[5];
+    poly4_load(msg, acc);
+    for (int i = 0; i < 5; ++i) {
+        acc[i] = _mm256_add_epi64(acc[i], _mm256_set_epi64x(0, 0, 0, static_cast<long long>(h26[i])));
+    }
+    for (std::size_t g = 1; g < ngroups; ++g) {
+        poly4_mul(acc, R, S);
+        poly4_carry(acc);
+        __m256i m[5];
+        poly4_load(msg + 64 * g, m);
+        for (int i = 0; i < 5; ++i) acc[i] = _mm256_add_epi64(acc[i], m[i]);
+    }
+
+    // Lane j still owes r^(4-j): lane 0 holds the oldest block of each group.
+    for (int i = 0; i < 5; ++i) {
+        R[i] = _mm256_set_epi64x(static_cast<long long>(r1[i]), static_cast<long long>(r2[i]),
+                                 static_cast<long long>(r3[i]), static_cast<long long>(r4[i]));
+        S[i] = _mm256_set_epi64x(static_cast<long long>(r1[i] * 5), static_cast<long long>(r2[i] * 5),
+                                 static_cast<long long>(r3[i] * 5), static_cast<long long>(r4[i] * 5));
+    }
+    poly4_mul(acc, R, S);
+
+    std::uint64_t d[5];
+    for (int i = 0; i < 5; ++i) {
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc[i]);
+        d[i] = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    std::uint64_t c;
+    c = d[0] >> 26; d[0] &= kMask26; d[1] += c;
+    c = d[1] >> 26; d[1] &= kMask26; d[2] += c;
+    c = d[2] >> 26; d[2] &= kMask26; d[3] += c;
+    c = d[3] >> 26; d[3] &= kMask26; d[4] += c;
+    c = d[4] >> 26; d[4] &= kMask26; d[0] += c * 5;
+    c = d[0] >> 26; d[0] &= kMask26; d[1] += c;
+
+    // Back to 44/44/42-bit limbs (limb 2 may exceed 42 bits; finish() carries it).
+    std::uint64_t t = d[0] + (d[1] << 26);
+    h[0] = t & kMask44;
+    t = (t >> 44) + (d[2] << 8) + (d[3] << 34);
+    h[1] = t & kMask44;
+    h[2] = (t >> 44) + (d[4] << 16);
+
+    detail::secure_erase(r1, sizeof(r1));
+    detail::secure_erase(r2, sizeof(r2));
+    detail::secure_erase(r3, sizeof(r3));
+    detail::secure_erase(r4, sizeof(r4));
+    detail::secure_erase(h26, sizeof(h26));
+}
+
+#undef P4_INLINE
+
+// Shorter runs stay on the scalar path: the r^2..r^4 setup costs about as
+// much as a dozen scalar blocks.
+constexpr std::size_t kPoly1305Avx2MinBlocks = 16;
+
+#endif // SECP256K1_POLY1305_AVX2
+
 struct Poly1305State {
     std::uint64_t r[3];    // clamped key r in 44/44/42-bit limbs
     std::uint64_t sr[2];   // precomputed 20*r[1], 20*r[2] for modular reduction
@@ -305,6 +655,19 @@ struct Poly1305State {
         h[1] += c;
     }
 
+    // nblocks full 16-byte blocks.
+    void blocks(const std::uint8_t* msg, std::size_t nblocks) noexcept {
+#ifdef SECP256K1_POLY1305_AVX2
+        if (nblocks >= kPoly1305Avx2MinBlocks && hash::avx2_available()) {
+            std::size_t const groups = nblocks / 4;
+            poly1305_blocks_avx2(h, r, msg, groups);
+            msg     += 64 * groups;
+            nblocks -= 4 * groups;
+        }
+#endif
+        for (; nblocks > 0; --nblocks, msg += 16) block(msg, 16);
+    }
+
     void finish(std::uint8_t tag[16]) noexcept {
         // Final carry propagation
         std::uint64_t c;
@@ -426,6 +789,10 @@ struct Poly1305State {
         h[1] += c;
     }
 
+    void blocks(const std::uint8_t* msg, std::size_t nblocks) noexcept {
+        for (; nblocks > 0; --nblocks, msg += 16) block(msg, 16);
+    }
+
     void finish(std::uint8_t tag[16]) noexcept {
         std::uint32_t c;
         c = h[1] >> 26; h[1] &= 0x3FFFFFF;
@@ -490,11 +857,8 @@ std::array<std::uint8_t, 16> poly1305_mac(
     Poly1305State st;
     st.init(key);
 
-    std::size_t offset = 0;
-    while (offset + 16 <= len) {
-        st.block(data + offset, 16);
-        offset += 16;
-    }
+    std::size_t const offset = len & ~std::size_t{15};
+    st.blocks(data, len / 16);
     if (offset < len) {
         st.block(data + offset, len - offset);
     }
@@ -520,11 +884,8 @@ void aead_poly1305_pad_and_mac(Poly1305State& st,
                                 const std::uint8_t* aad, std::size_t aad_len,
                                 const std::uint8_t* ct, std::size_t ct_len) noexcept {
     // Process AAD in full 16-byte blocks
-    std::size_t off = 0;
-    while (off + 16 <= aad_len) {
-        st.block(aad + off, 16);
-        off += 16;
-    }
+    std::size_t off = aad_len & ~std::size_t{15};
+    st.blocks(aad, aad_len / 16);
     // Pad last partial AAD block to 16 bytes (RFC 8439 pad16).
     // The padding zeros are part of the mac_data stream and must be
     // processed in the same Poly1305 block as the trailing AAD bytes,
@@ -537,11 +898,8 @@ void aead_poly1305_pad_and_mac(Poly1305State& st,
     }
 
     // Process ciphertext in full 16-byte blocks
-    off = 0;
-    while (off + 16 <= ct_len) {
-        st.block(ct + off, 16);
-        off += 16;
-    }
+    off = ct_len & ~std::size_t{15};
+    st.blocks(ct, ct_len / 16);
     // Pad last partial ciphertext block to 16 bytes (RFC 8439 pad16)
     if (off < ct_len) {
         std::uint8_t padded[16]{};
@@ -626,4 +984,200 @@ bool aead_chacha20_poly1305_decrypt(
     return true;
 }
 
+// ============================================================================
+// Scatter/gather AEAD
+// ============================================================================
+// The keystream XOR walks the input and output segment lists with one
+// cursor each; the MAC feeds segments through a 16-byte carry so block
+// boundaries need not line up with segment boundaries.
+// ============================================================================
+
+namespace {
+
+template <class Segment>
+class SegmentCursor {
+public:
+    SegmentCursor(const Segment* segs, std::size_t count) noexcept
+        : segs_(segs), count_(count) { skip_empty(); }
+
+    // Contiguous bytes left in the current segment.
+    std::size_t avail() const noexcept { return idx_ < count_ ? segs_[idx_].len - off_ : 0; }
+    auto ptr() const noexcept { return segs_[idx_].data + off_; }
+    void advance(std::size_t n) noexcept {
+        off_ += n;
+        skip_empty();
+    }
+
+private:
+    void skip_empty() noexcept {
+        while (idx_ < count_ && off_ == segs_[idx_].len) {
+            ++idx_;
+            off_ = 0;
+        }
+    }
+
+    const Segment* segs_;
+    std::size_t    count_;
+    std::size_t    idx_ = 0;
+    std::size_t    off_ = 0;
+};
+
+template <class Segment>
+std::size_t total_length(const Segment* segs, std::size_t count) noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (segs[i].len > SIZE_MAX - total) return SIZE_MAX;
+        total += segs[i].len;
+    }
+    return total;
+}
+
+// out = in ^ keystream(counter 1, ...) over `total` message bytes.
+void chacha20_crypt_v(const std::uint8_t key[32], const std::uint8_t nonce[12],
+                      const AeadSegment* in, std::size_t in_count,
+                      const AeadMutableSegment* out, std::size_t out_count,
+                      std::size_t total) noexcept {
+    std::uint32_t state[16];
+    chacha20_setup_state(state, key, nonce, 1);
+    alignas(64) std::uint8_t ks[kKeystreamChunk];
+    std::size_t const ks_used = (total < kKeystreamChunk) ? ((total + 63) & ~std::size_t{63}) : sizeof(ks);
+
+    SegmentCursor<AeadSegment>        src(in, in_count);
+    SegmentCursor<AeadMutableSegment> dst(out, out_count);
+    while (total > 0) {
+        std::size_t const chunk = (total < kKeystreamChunk) ? total : kKeystreamChunk;
+        chacha20_keystream(state, ks, (chunk + 63) / 64);
+        std::size_t used = 0;
+        while (used < chunk) {
+            std::size_t n = chunk - used;
+            n = (src.avail() < n) ? src.avail() : n;
+            n = (dst.avail() < n) ? dst.avail() : n;
+            xor_into(dst.ptr(), src.ptr(), ks + used, n);
+            src.advance(n);
+            dst.advance(n);
+            used += n;
+        }
+        total -= chunk;
+    }
+
+    detail::secure_erase(state, sizeof(state));
+    detail::secure_erase(ks, ks_used);
+}
+
+class Poly1305Stream {
+public:
+    explicit Poly1305Stream(Poly1305State& st) noexcept : st_(st) {}
+
+    void update(const std::uint8_t* data, std::size_t len) noexcept {
+        if (buf_len_ > 0) {
+            std::size_t const take = (16 - buf_len_ < len) ? 16 - buf_len_ : len;
+            std::memcpy(buf_ + buf_len_, data, take);
+            buf_len_ += take;
+            data += take;
+            len  -= take;
+            if (buf_len_ < 16) return;
+            st_.block(buf_, 16);
+            buf_len_ = 0;
+        }
+        st_.blocks(data, len / 16);
+        data += len & ~std::size_t{15};
+        len  &= 15;
+        std::memcpy(buf_, data, len);
+        buf_len_ = len;
+    }
+
+    // RFC 8439 pad16: zero-fill and flush a partial block.
+    void pad16() noexcept {
+        if (buf_len_ == 0) return;
+        std::memset(buf_ + buf_len_, 0, 16 - buf_len_);
+        st_.block(buf_, 16);
+        buf_len_ = 0;
+    }
+
+    ~Poly1305Stream() { detail::secure_erase(buf_, sizeof(buf_)); }
+
+private:
+    Poly1305State& st_;
+    std::uint8_t   buf_[16]{};
+    std::size_t    buf_len_ = 0;
+};
+
+template <class Segment>
+void aead_mac_v(const std::uint8_t poly_key[32],
+                const std::uint8_t* aad, std::size_t aad_len,
+                const Segment* ct, std::size_t ct_count, std::size_t ct_len,
+                std::uint8_t tag[16]) noexcept {
+    Poly1305State st;
+    st.init(poly_key);
+    {
+        Poly1305Stream mac(st);
+        if (aad_len > 0) mac.update(aad, aad_len);
+        mac.pad16();
+        for (std::size_t i = 0; i < ct_count; ++i) {
+            if (ct[i].len > 0) mac.update(ct[i].data, ct[i].len);
+        }
+        mac.pad16();
+    }
+    std::uint8_t lens[16];
+    store64_le(lens, static_cast<std::uint64_t>(aad_len));
+    store64_le(lens + 8, static_cast<std::uint64_t>(ct_len));
+    st.block(lens, 16);
+    st.finish(tag);
+    detail::secure_erase(&st, sizeof(st));
+}
+
+} // anonymous namespace
+
+bool aead_chacha20_poly1305_encrypt_v(
+    const std::uint8_t key[32],
+    const std::uint8_t nonce[12],
+    const std::uint8_t* aad, std::size_t aad_len,
+    const AeadSegment* in, std::size_t in_count,
+    const AeadMutableSegment* out, std::size_t out_count,
+    std::uint8_t tag[16]) noexcept {
+
+    std::size_t const total = total_length(in, in_count);
+    if (total == SIZE_MAX || total != total_length(out, out_count)) return false;
+
+    std::uint8_t poly_key[64];
+    chacha20_block(key, nonce, 0, poly_key);
+
+    chacha20_crypt_v(key, nonce, in, in_count, out, out_count, total);
+    aead_mac_v(poly_key, aad, aad_len, out, out_count, total, tag);
+
+    detail::secure_erase(poly_key, sizeof(poly_key));
+    return true;
+}
+
+bool aead_chacha20_poly1305_decrypt_v(
+    const std::uint8_t key[32],
+    const std::uint8_t nonce[12],
+    const std::uint8_t* aad, std::size_t aad_len,
+    const AeadSegment* in, std::size_t in_count,
+    const AeadMutableSegment* out, std::size_t out_count,
+    const std::uint8_t tag[16]) noexcept {
+
+    std::size_t const total = total_length(in, in_count);
+    if (total == SIZE_MAX || total != total_length(out, out_count)) return false;
+
+    std::uint8_t poly_key[64];
+    chacha20_block(key, nonce, 0, poly_key);
+
+    std::uint8_t computed_tag[16];
+    aead_mac_v(poly_key, aad, aad_len, in, in_count, total, computed_tag);
+    detail::secure_erase(poly_key, sizeof(poly_key));
+
+    bool const ok = poly1305_verify(computed_tag, tag);
+    detail::secure_erase(computed_tag, sizeof(computed_tag));
+    if (!ok) {
+        for (std::size_t i = 0; i < out_count; ++i) {
+            if (out[i].len > 0) std::memset(out[i].data, 0, out[i].len);
+        }
+        return false;
+    }
+
+    chacha20_crypt_v(key, nonce, in, in_count, out, out_count, total);
+    return true;
+}
+
 } // namespace secp256k1
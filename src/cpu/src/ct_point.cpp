@@ -40,6 +40,7 @@
 #include "secp256k1/field_52.hpp"
 #include "secp256k1/glv.hpp"
 
+#include <algorithm>
 #include <mutex>
 
 // AVX2 vectorized CT table lookup (x86-64 with -march=native)
@@ -1554,6 +1555,64 @@ FieldElement ecmult_const_xonly(const FieldElement& xn_fe, const FieldElement& x
     return x52.to_fe();
 }
 
+// --- Batched x-only ECDH -----------------------------------------------------
+// ecmult_const_xonly() for n independent (xn/xd, q) triples. The scalar
+// multiplies are unchanged; the n final denominators R.z² * g * xd share one
+// field inversion (Montgomery's trick: 3(n-1) muls + 1 inverse), done in
+// stack chunks of kXonlyBatchChunk. Degenerate entries (R at infinity, zero
+// denominator) get zero and are kept out of the shared product.
+namespace {
+constexpr std::size_t kXonlyBatchChunk = 32;
+} // namespace
+
+void ecmult_const_xonly_batch(const FieldElement* xn_fe, const FieldElement* xd_fe,
+                              const Scalar* q, FieldElement* x_out,
+                              std::size_t n) noexcept {
+    for (std::size_t base = 0; base < n; base += kXonlyBatchChunk) {
+        std::size_t const m = std::min(kXonlyBatchChunk, n - base);
+        FE52 rx[kXonlyBatchChunk];
+        FE52 denom[kXonlyBatchChunk];
+        FE52 prefix[kXonlyBatchChunk];
+        bool live[kXonlyBatchChunk];
+
+        FE52 acc = FE52::one();
+        for (std::size_t i = 0; i < m; ++i) {
+            FE52 const xn = FE52::from_fe(xn_fe[base + i]);
+            FE52 const xd = FE52::from_fe(xd_fe[base + i]);
+
+            FE52 const xn2 = xn.square();
+            FE52 const xn3 = xn2 * xn;
+            FE52 xd3       = xd.square() * xd;
+            xd3.mul_int_assign(7);
+            FE52 const g   = xn3 + xd3;
+
+            CTJacobianPoint const R = scalar_mul_jac_fe52_z1(g * xn, g.square(), q[base + i]);
+            rx[i] = R.x;
+            denom[i] = R.z.square() * g * xd;
+            live[i] = R.infinity == 0 && !denom[i].normalizes_to_zero();
+            if (live[i]) acc = acc * denom[i];
+            prefix[i] = acc;
+        }
+
+        FE52 inv = acc.inverse();
+        for (std::size_t i = m; i-- > 0;) {
+            if (!live[i]) {
+                x_out[base + i] = FieldElement::zero();
+                continue;
+            }
+            FE52 const before = (i == 0) ? FE52::one() : prefix[i - 1];
+            x_out[base + i] = (rx[i] * (inv * before)).to_fe();
+            inv = inv * denom[i];
+        }
+
+        secp256k1::detail::secure_erase(rx, sizeof(rx));
+        secp256k1::detail::secure_erase(denom, sizeof(denom));
+        secp256k1::detail::secure_erase(prefix, sizeof(prefix));
+        secp256k1::detail::secure_erase(&acc, sizeof(acc));
+        secp256k1::detail::secure_erase(&inv, sizeof(inv));
+    }
+}
+
 // --- CT Prebuilt Tables API --------------------------------------------------
 
 CTScalarMulTables build_scalar_mul_tables(const Point& p) noexcept {
@@ -3373,6 +3432,12 @@ FieldElement ecmult_const_xonly(const FieldElement& xn, const FieldElement& xd,
     return res.x();
 }
 
+void ecmult_const_xonly_batch(const FieldElement* xn, const FieldElement* xd,
+                              const Scalar* q, FieldElement* x_out,
+                              std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) x_out[i] = ecmult_const_xonly(xn[i], xd[i], q[i]);
+}
+
 #endif // SECP256K1_FAST_52BIT
 
 // --- CT Curve Check (uses 4x64 FieldElement at API boundary) -----------------
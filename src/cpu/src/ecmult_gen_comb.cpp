@@ -11,6 +11,7 @@
 #include "secp256k1/ct/ops.hpp"
 #include "secp256k1/sha256.hpp"
 #include "secp256k1/debug_invariants.hpp"
+#include "mapped_table_p.hpp"
 #include <atomic>
 #include <cstring>
 #include <fstream>
@@ -67,6 +68,8 @@ void CombGenContext::build_table() {
             table_[i].infinity = false;
         }
     }
+    entries_ = table_.data();
+    mapping_.reset();
 }
 
 void CombGenContext::init(unsigned teeth) {
@@ -117,7 +120,7 @@ Point CombGenContext::mul(const Scalar& k) const {
         uint32_t const idx = extract_comb_index(k, static_cast<unsigned>(b));
         if (SECP256K1_UNLIKELY(idx == 0)) continue;  // ~3% of positions (all teeth==0)
 
-        const auto& entry = table_[idx];
+        const auto& entry = entries_[idx];
         if (SECP256K1_UNLIKELY(entry.infinity)) continue;
 
         // Mixed addition: Jacobian R + Affine table entry (Z=1, non-infinity).
@@ -163,10 +166,10 @@ Point CombGenContext::mul_ct(const Scalar& k) const {
             uint64_t const mask = ct::eq_mask(static_cast<uint64_t>(i),
                                         static_cast<uint64_t>(idx));
             // CT conditional copy
-            ct::cmov256(selected.x.limbs_mut().data(), table_[i].x.limbs().data(), mask);
-            ct::cmov256(selected.y.limbs_mut().data(), table_[i].y.limbs().data(), mask);
+            ct::cmov256(selected.x.limbs_mut().data(), entries_[i].x.limbs().data(), mask);
+            ct::cmov256(selected.y.limbs_mut().data(), entries_[i].y.limbs().data(), mask);
             // CT update infinity flag
-            uint64_t const inf_val = table_[i].infinity ? UINT64_MAX : 0;
+            uint64_t const inf_val = entries_[i].infinity ? UINT64_MAX : 0;
             uint64_t sel_inf = selected.infinity ? UINT64_MAX : 0;
             sel_inf = ct::ct_select(inf_val, sel_inf, mask);
             selected.infinity = (sel_inf != 0);
@@ -190,7 +193,7 @@ Point CombGenContext::mul_ct(const Scalar& k) const {
 
 std::size_t CombGenContext::table_size_bytes() const noexcept {
     if (!ready()) return 0;
-    return table_.size() * sizeof(CombAffinePoint);
+    return (static_cast<std::size_t>(1) << teeth_) * sizeof(CombAffinePoint);
 }
 
 bool CombGenContext::save_cache(const std::string& path) const {
@@ -301,6 +304,70 @@ bool CombGenContext::load_cache(const std::string& path) {
         }
     }
 
+    entries_ = table_.data();
+    mapping_.reset();
+    return true;
+}
+
+namespace {
+
+// Mapped entries get the same on-curve validation as load_cache().
+bool comb_entries_on_curve(const CombAffinePoint* entries, std::size_t count) {
+    FieldElement const seven = FieldElement::from_uint64(7);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (entries[i].infinity) continue;
+        const FieldElement& x = entries[i].x;
+        const FieldElement& y = entries[i].y;
+        if (y * y != x * x * x + seven) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool CombGenContext::save_mapped(const std::string& path) const {
+    if (!ready()) return false;
+    std::size_t const count = static_cast<std::size_t>(1) << teeth_;
+
+    MappedTableHeader spec{};
+    spec.kind        = kMappedTableComb;
+    spec.entry_bytes = sizeof(CombAffinePoint);
+    spec.param0      = teeth_;
+    spec.param1      = spacing_;
+    spec.entry_count = count;
+
+    MappedTableWriter writer(path, spec);
+    std::vector<CombAffinePoint> staging(count);
+    copy_table_entries(staging.data(), entries_, count);
+    return writer.append(staging.data(), count * sizeof(CombAffinePoint)) && writer.commit();
+}
+
+bool CombGenContext::load_mapped(const std::string& path, bool huge_pages) {
+    auto table = std::make_shared<MappedTable>();
+    MappedTableOptions options;
+    options.huge_pages = huge_pages;
+    if (!table->open(path, kMappedTableComb, sizeof(CombAffinePoint), options)) {
+        return false;
+    }
+    MappedTableHeader const& h = table->header();
+    unsigned const teeth = h.param0;
+    unsigned const spacing = h.param1;
+    // Same bounds as load_cache().
+    if (teeth < 2 || teeth > 20 || spacing < 1 || spacing > 256
+           || h.entry_count != (std::uint64_t{1} << teeth)) return false;
+
+    const auto* entries = static_cast<const CombAffinePoint*>(table->payload());
+    if (!comb_entries_on_curve(entries, static_cast<std::size_t>(h.entry_count))) {
+        return false;
+    }
+
+    teeth_ = teeth;
+    spacing_ = spacing;
+    num_combs_ = 1;
+    table_.clear();
+    table_.shrink_to_fit();
+    entries_ = entries;
+    mapping_ = std::move(table);
     return true;
 }
 
@@ -9,7 +9,9 @@
 #include "secp256k1/coins/ethereum.hpp"
 #include "secp256k1/recovery.hpp"
 #include "secp256k1/ct/sign.hpp"
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 namespace secp256k1::coins {
 
@@ -131,6 +133,56 @@ ecrecover(const std::array<std::uint8_t, 32>& msg_hash,
     return ecrecover(msg_hash, sig.r, sig.s, sig.v);
 }
 
+std::size_t ecrecover_batch(const std::uint8_t* msgs32, const std::uint8_t* rs32,
+                            const std::uint8_t* ss32, const std::uint64_t* vs,
+                            std::size_t n, std::uint8_t* addrs20_out,
+                            std::uint8_t* ok_out) {
+    constexpr std::size_t kChunk = 256;
+    std::vector<std::array<std::uint8_t, 32>> hashes(kChunk);
+    std::vector<secp256k1::ECDSASignature> sigs(kChunk);
+    std::vector<int> recids(kChunk);
+    std::vector<fast::Point> keys(kChunk);
+    std::vector<std::uint8_t> xy(kChunk * 64), digests(kChunk * 32);
+
+    std::size_t n_ok = 0;
+    for (std::size_t lo = 0; lo < n; lo += kChunk) {
+        std::size_t const m = std::min(kChunk, n - lo);
+        for (std::size_t j = 0; j < m; ++j) {
+            std::size_t const i = lo + j;
+            std::memcpy(hashes[j].data(), msgs32 + i * 32, 32);
+            std::array<std::uint8_t, 32> r, s;
+            std::memcpy(r.data(), rs32 + i * 32, 32);
+            std::memcpy(s.data(), ss32 + i * 32, 32);
+            // Same parsing as ecrecover(): reduce mod n, zero is rejected below.
+            sigs[j].r = Scalar::from_bytes(r);
+            sigs[j].s = Scalar::from_bytes(s);
+            recids[j] = eip155_recid(vs[i]);
+        }
+        n_ok += secp256k1::ecdsa_recover_batch(hashes.data(), sigs.data(), recids.data(), m,
+                                               keys.data(), ok_out + lo);
+
+        // Keys are affine: x || y copies, then Keccak-256 four at a time.
+        for (std::size_t j = 0; j < m; ++j) {
+            if (ok_out[lo + j]) {
+                keys[j].x().to_bytes_into(xy.data() + j * 64);
+                keys[j].y().to_bytes_into(xy.data() + j * 64 + 32);
+            } else {
+                std::memset(xy.data() + j * 64, 0, 64);
+            }
+        }
+        keccak256_batch(xy.data(), 64, m, digests.data());
+        for (std::size_t j = 0; j < m; ++j) {
+            std::uint8_t* addr = addrs20_out + (lo + j) * 20;
+            if (ok_out[lo + j]) {
+                std::memcpy(addr, digests.data() + j * 32 + 12, 20);
+            } else {
+                std::memset(addr, 0, 20);
+            }
+        }
+    }
+    return n_ok;
+}
+
 // -- Verify -------------------------------------------------------------------
 
 bool eth_personal_verify(const std::uint8_t* msg, std::size_t msg_len,
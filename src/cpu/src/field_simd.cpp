@@ -0,0 +1,836 @@
+// ============================================================================
+// Lane-parallel field arithmetic -- AVX2 (4 x 10x26) and IFMA (8 x 5x52)
+// ============================================================================
+//
+// Every tier implements the same small interface ("Ops"): a lane group type
+// F, load/store from FieldElement arrays, and mul / sqr / add / sub /
+// mul_int. The point formulas are written once against that interface and
+// instantiated per tier, so the scalar instantiation (Ops = FieldElement
+// operators) is the reference the vector tiers are tested against.
+//
+// Representation invariant between ops: every F is weakly normalized --
+//   AVX2: limbs 0..8 < 2^27, limb 9 < 2^23   (libsecp magnitude 1)
+//   IFMA: limbs 0..3 < 2^52, limb 4 < 2^49   (fits the 52-bit IFMA inputs)
+// add / sub / mul_int renormalize their result, so mul/sqr inputs never
+// need magnitude tracking. sub adds 4p before subtracting, which covers any
+// weakly normalized subtrahend.
+//
+// The kernels use intrinsics, which may only be inlined into a function
+// with a matching target(). The Ops members carry their tier's target and
+// the exported wrappers are target() + flatten, so the shared templates
+// are inlined into the wrapper and compiled for that tier.
+//
+// MSVC has no vector extensions; SECP256K1_FIELD_SIMD_X86 stays undefined
+// there and every tier runs the scalar path.
+// ============================================================================
+
+#include "secp256k1/field_simd.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define SECP256K1_FIELD_SIMD_X86 1
+    #include <cpuid.h>
+    // File scope: immintrin.h pulls in <stdlib.h> (see hash_accel.cpp).
+    #include <immintrin.h>
+#endif
+
+namespace secp256k1::fast {
+
+namespace {
+
+// ============================================================================
+// Feature detection
+// ============================================================================
+
+#ifdef SECP256K1_FIELD_SIMD_X86
+struct SimdFeatures {
+    bool avx2 = false;
+    bool ifma = false;
+
+    SimdFeatures() noexcept {
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        std::uint64_t xcr0 = 0;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 27)) != 0) {
+            std::uint32_t lo = 0, hi = 0;
+            __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            xcr0 = (std::uint64_t(hi) << 32) | lo;
+        }
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            avx2 = (ebx & (1u << 5)) != 0 && (xcr0 & 0x06) == 0x06;
+            // AVX-512F (bit 16) + AVX512-IFMA (bit 21), ZMM state enabled.
+            ifma = (ebx & (1u << 16)) != 0 && (ebx & (1u << 21)) != 0 &&
+                   (xcr0 & 0xE6) == 0xE6;
+        }
+    #if defined(__has_feature)
+      #if __has_feature(memory_sanitizer)
+        // MSan cannot follow data through the vector intrinsics.
+        avx2 = ifma = false;
+      #endif
+    #endif
+    }
+};
+
+const SimdFeatures& simd_features() noexcept {
+    static const SimdFeatures f;
+    return f;
+}
+#endif
+
+// ============================================================================
+// Scalar tier (reference)
+// ============================================================================
+
+struct ScalarOps {
+    static constexpr std::size_t L = 1;
+    using F = FieldElement;
+
+    static void load(F& r, const FieldElement* src, std::size_t) noexcept { r = src[0]; }
+    static void store(FieldElement* dst, const F& a, std::size_t) noexcept { dst[0] = a; }
+
+    static void mul(F& r, const F& a, const F& b) noexcept { r = a * b; }
+    static void sqr(F& r, const F& a) noexcept { r = a.square(); }
+    static void add(F& r, const F& a, const F& b) noexcept { r = a + b; }
+    static void sub(F& r, const F& a, const F& b) noexcept { r = a - b; }
+
+    template <unsigned K>
+    static void mul_int(F& r, const F& a) noexcept {
+        static_assert(K == 2 || K == 3 || K == 4 || K == 8, "unsupported constant");
+        F const d = a + a;
+        if constexpr (K == 2) r = d;
+        if constexpr (K == 3) r = d + a;
+        if constexpr (K == 4) r = d + d;
+        if constexpr (K == 8) { F const q = d + d; r = q + q; }
+    }
+};
+
+// ============================================================================
+// Shared formulas
+// ============================================================================
+// Outputs are separate locals from the inputs (the batch drivers below load
+// into and store from lane groups), but each op may alias its own operands.
+
+// a = 0 doubling: XX = X^2, YY = Y^2, S = 4*X*YY, M = 3*XX,
+// X3 = M^2 - 2S, Y3 = M*(S - X3) - 8*YY^2, Z3 = 2*Y*Z.
+template <class Ops>
+inline void double_lanes(typename Ops::F& X3, typename Ops::F& Y3, typename Ops::F& Z3,
+                         const typename Ops::F& X, const typename Ops::F& Y,
+                         const typename Ops::F& Z) noexcept {
+    typename Ops::F xx, yy, s, m, t;
+    Ops::sqr(xx, X);
+    Ops::sqr(yy, Y);
+    Ops::mul(s, X, yy);
+    Ops::template mul_int<4>(s, s);
+    Ops::template mul_int<3>(m, xx);
+    Ops::sqr(yy, yy);                       // YYYY
+    Ops::template mul_int<8>(yy, yy);
+    Ops::mul(Z3, Y, Z);
+    Ops::template mul_int<2>(Z3, Z3);
+    Ops::sqr(t, m);
+    Ops::sub(t, t, s);
+    Ops::sub(X3, t, s);
+    Ops::sub(t, s, X3);
+    Ops::mul(t, m, t);
+    Ops::sub(Y3, t, yy);
+}
+
+// Mixed add, affine second operand (8M + 3S):
+// Z1Z1 = Z1^2, U2 = x2*Z1Z1, S2 = y2*Z1*Z1Z1, H = U2 - X1, R = S2 - Y1,
+// X3 = R^2 - H^3 - 2*X1*H^2, Y3 = R*(X1*H^2 - X3) - Y1*H^3, Z3 = Z1*H.
+template <class Ops>
+inline void add_mixed_lanes(typename Ops::F& X3, typename Ops::F& Y3, typename Ops::F& Z3,
+                            const typename Ops::F& X1, const typename Ops::F& Y1,
+                            const typename Ops::F& Z1, const typename Ops::F& x2,
+                            const typename Ops::F& y2) noexcept {
+    typename Ops::F zz, h, r, hh, hhh, v, t;
+    Ops::sqr(zz, Z1);
+    Ops::mul(h, x2, zz);
+    Ops::mul(zz, Z1, zz);
+    Ops::mul(r, y2, zz);
+    Ops::sub(h, h, X1);
+    Ops::sub(r, r, Y1);
+    Ops::sqr(hh, h);
+    Ops::mul(hhh, h, hh);
+    Ops::mul(v, X1, hh);
+    Ops::mul(Z3, Z1, h);
+    Ops::sqr(t, r);
+    Ops::sub(t, t, hhh);
+    Ops::template mul_int<2>(hh, v);
+    Ops::sub(X3, t, hh);
+    Ops::sub(t, v, X3);
+    Ops::mul(t, r, t);
+    Ops::mul(hhh, Y1, hhh);
+    Ops::sub(Y3, t, hhh);
+}
+
+// r = a^((p+1)/4) by libsecp256k1's secp256k1_fe_sqrt chain (253S + 13M);
+// r^2 == a iff a is a square.
+template <class Ops>
+inline void sqr_n(typename Ops::F& v, int n) noexcept {
+    for (int i = 0; i < n; ++i) Ops::sqr(v, v);
+}
+
+template <class Ops>
+inline void sqrt_lanes(typename Ops::F& r, const typename Ops::F& a) noexcept {
+    typename Ops::F x2, x3, x11, x22, x44, x88, t;
+    Ops::sqr(x2, a);
+    Ops::mul(x2, x2, a);
+    Ops::sqr(x3, x2);
+    Ops::mul(x3, x3, a);
+    t = x3;
+    sqr_n<Ops>(t, 3);
+    Ops::mul(t, t, x3);                     // x6
+    sqr_n<Ops>(t, 3);
+    Ops::mul(t, t, x3);                     // x9
+    sqr_n<Ops>(t, 2);
+    Ops::mul(x11, t, x2);
+    x22 = x11;
+    sqr_n<Ops>(x22, 11);
+    Ops::mul(x22, x22, x11);
+    x44 = x22;
+    sqr_n<Ops>(x44, 22);
+    Ops::mul(x44, x44, x22);
+    x88 = x44;
+    sqr_n<Ops>(x88, 44);
+    Ops::mul(x88, x88, x44);
+    t = x88;
+    sqr_n<Ops>(t, 88);
+    Ops::mul(t, t, x88);                    // x176
+    sqr_n<Ops>(t, 44);
+    Ops::mul(t, t, x44);                    // x220
+    sqr_n<Ops>(t, 3);
+    Ops::mul(t, t, x3);                     // x223
+    sqr_n<Ops>(t, 23);
+    Ops::mul(t, t, x22);
+    sqr_n<Ops>(t, 6);
+    Ops::mul(t, t, x2);
+    sqr_n<Ops>(t, 2);
+    r = t;
+}
+
+// Z3 = 0 after the generic formula: P1 at infinity or H = 0. Redo the lane
+// on the scalar path; P1 == -P2 keeps Z3 = 0.
+void add_mixed_fixup(const FieldElement& X1, const FieldElement& Y1, const FieldElement& Z1,
+                     const FieldElement& x2, const FieldElement& y2,
+                     FieldElement& X3, FieldElement& Y3, FieldElement& Z3) noexcept {
+    FieldElement const zero = FieldElement::zero();
+    if (Z1 == zero) {
+        X3 = x2;
+        Y3 = y2;
+        Z3 = FieldElement::one();
+        return;
+    }
+    FieldElement const zz = Z1.square();
+    if (x2 * zz == X1 && y2 * zz * Z1 == Y1) {
+        double_lanes<ScalarOps>(X3, Y3, Z3, x2, y2, FieldElement::one());
+    }
+}
+
+// ============================================================================
+// Batch drivers (one lane group at a time)
+// ============================================================================
+
+template <class Ops>
+inline void mul_batch_impl(const FieldElement* a, const FieldElement* b, FieldElement* out,
+                           std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; i += Ops::L) {
+        std::size_t const m = std::min(Ops::L, n - i);
+        typename Ops::F x, y;
+        Ops::load(x, a + i, m);
+        Ops::load(y, b + i, m);
+        Ops::mul(x, x, y);
+        Ops::store(out + i, x, m);
+    }
+}
+
+template <class Ops>
+inline void sqr_batch_impl(const FieldElement* a, FieldElement* out, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; i += Ops::L) {
+        std::size_t const m = std::min(Ops::L, n - i);
+        typename Ops::F x;
+        Ops::load(x, a + i, m);
+        Ops::sqr(x, x);
+        Ops::store(out + i, x, m);
+    }
+}
+
+// The scalar tier uses FieldElement::sqrt() (5x52 on FAST_52BIT builds),
+// which computes the same power.
+template <class Ops>
+inline void sqrt_batch_impl(const FieldElement* a, FieldElement* out, std::uint8_t* ok,
+                            std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; i += Ops::L) {
+        std::size_t const m = std::min(Ops::L, n - i);
+        FieldElement ro[Ops::L], sq[Ops::L];
+        if constexpr (Ops::L == 1) {
+            ro[0] = a[i].sqrt();
+            sq[0] = ro[0].square();
+        } else {
+            typename Ops::F x, r;
+            Ops::load(x, a + i, m);
+            sqrt_lanes<Ops>(r, x);
+            Ops::sqr(x, r);
+            Ops::store(ro, r, m);
+            Ops::store(sq, x, m);
+        }
+        for (std::size_t j = 0; j < m; ++j) ok[i + j] = sq[j] == a[i + j] ? 1 : 0;
+        std::copy(ro, ro + m, out + i);
+    }
+}
+
+template <class Ops>
+inline void double_batch_impl(const FieldElement* X, const FieldElement* Y, const FieldElement* Z,
+                              FieldElement* X3, FieldElement* Y3, FieldElement* Z3,
+                              std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; i += Ops::L) {
+        std::size_t const m = std::min(Ops::L, n - i);
+        typename Ops::F x, y, z, rx, ry, rz;
+        Ops::load(x, X + i, m);
+        Ops::load(y, Y + i, m);
+        Ops::load(z, Z + i, m);
+        double_lanes<Ops>(rx, ry, rz, x, y, z);
+        Ops::store(X3 + i, rx, m);
+        Ops::store(Y3 + i, ry, m);
+        Ops::store(Z3 + i, rz, m);
+    }
+}
+
+template <class Ops>
+inline void add_mixed_batch_impl(const FieldElement* X1, const FieldElement* Y1,
+                                 const FieldElement* Z1, const FieldElement* x2,
+                                 const FieldElement* y2, FieldElement* X3, FieldElement* Y3,
+                                 FieldElement* Z3, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; i += Ops::L) {
+        std::size_t const m = std::min(Ops::L, n - i);
+        typename Ops::F px, py, pz, qx, qy, rx, ry, rz;
+        Ops::load(px, X1 + i, m);
+        Ops::load(py, Y1 + i, m);
+        Ops::load(pz, Z1 + i, m);
+        Ops::load(qx, x2 + i, m);
+        Ops::load(qy, y2 + i, m);
+        add_mixed_lanes<Ops>(rx, ry, rz, px, py, pz, qx, qy);
+        // Stage the group so the fixups still see the inputs when the
+        // outputs alias them.
+        FieldElement ox[Ops::L], oy[Ops::L], oz[Ops::L];
+        Ops::store(ox, rx, m);
+        Ops::store(oy, ry, m);
+        Ops::store(oz, rz, m);
+        for (std::size_t j = 0; j < m; ++j) {
+            auto const& z = oz[j].limbs();
+            if ((z[0] | z[1] | z[2] | z[3]) == 0) {
+                add_mixed_fixup(X1[i + j], Y1[i + j], Z1[i + j], x2[i + j], y2[i + j],
+                                ox[j], oy[j], oz[j]);
+            }
+        }
+        std::copy(ox, ox + m, X3 + i);
+        std::copy(oy, oy + m, Y3 + i);
+        std::copy(oz, oz + m, Z3 + i);
+    }
+}
+
+#ifdef SECP256K1_FIELD_SIMD_X86
+
+typedef std::uint64_t u64x4 __attribute__((vector_size(32)));
+typedef std::uint64_t u64x8 __attribute__((vector_size(64)));
+
+#define FS_AVX2 inline __attribute__((target("avx2")))
+#define FS_IFMA inline __attribute__((target("avx512f,avx512ifma")))
+
+// Lane transpose: m elements -> limb-major words, zero-padded to L lanes.
+template <std::size_t L>
+inline void gather_limbs(std::uint64_t (&w)[4][L], const FieldElement* src,
+                         std::size_t m) noexcept {
+    std::memset(w, 0, sizeof(w));
+    for (std::size_t j = 0; j < m; ++j) {
+        auto const& l = src[j].limbs();
+        for (std::size_t k = 0; k < 4; ++k) w[k][j] = l[k];
+    }
+}
+
+// Values are fully reduced by the caller.
+template <std::size_t L>
+inline void scatter_limbs(FieldElement* dst, const std::uint64_t (&w)[4][L],
+                          std::size_t m) noexcept {
+    for (std::size_t j = 0; j < m; ++j) {
+        dst[j] = FieldElement::from_limbs_raw({w[0][j], w[1][j], w[2][j], w[3][j]});
+    }
+}
+
+// ============================================================================
+// AVX2 tier: 4 lanes x 10x26
+// ============================================================================
+// mul/sqr transcribe fe26_mul_inner / fe26_sqr_inner (field_26.cpp) with
+// every 32x32->64 product on VPMULUDQ. Column sums for mul and sqr are the
+// same shape, so both share one reduction.
+
+struct Avx2Ops {
+    static constexpr std::size_t L = 4;
+    using V = u64x4;
+    struct F { V n[10]; };
+
+    static constexpr std::uint64_t M  = 0x3FFFFFFULL;
+    static constexpr std::uint64_t R0 = 0x3D10ULL;
+
+    FS_AVX2 static V mul32(V a, V b) noexcept {
+        return (V)_mm256_mul_epu32((__m256i)a, (__m256i)b);
+    }
+    // x * k for k < 2^32 and x < 2^64 (high half folded in separately).
+    FS_AVX2 static V mul_k(V x, std::uint64_t k) noexcept {
+        V const kv = V{} + k;
+        return mul32(x, kv) + (mul32(x >> 32, kv) << 32);
+    }
+
+    // Column s of a*b (Sqr: a*a via doubled cross terms, a2 = 2a).
+    template <bool Sqr>
+    FS_AVX2 static V column(const F& a, const F& b, const F& a2, int s) noexcept {
+        V acc{};
+        int const lo = s > 9 ? s - 9 : 0;
+        if constexpr (Sqr) {
+            #pragma GCC unroll 10
+            for (int i = lo; i < s - i; ++i) acc += mul32(a2.n[i], a.n[s - i]);
+            if ((s & 1) == 0) acc += mul32(a.n[s / 2], a.n[s / 2]);
+        } else {
+            int const hi = s < 9 ? s : 9;
+            #pragma GCC unroll 10
+            for (int i = lo; i <= hi; ++i) acc += mul32(a.n[i], b.n[s - i]);
+        }
+        (void)b;
+        (void)a2;
+        return acc;
+    }
+
+    template <bool Sqr>
+    FS_AVX2 static void mul_impl(F& r, const F& a, const F& b, const F& a2) noexcept {
+        V const mask = V{} + M;
+        V t[10];
+        V d = column<Sqr>(a, b, a2, 9);
+        t[9] = d & mask; d >>= 26;
+        V c{};
+        #pragma GCC unroll 9
+        for (int k = 0; k < 9; ++k) {
+            c += column<Sqr>(a, b, a2, k);
+            d += column<Sqr>(a, b, a2, k + 10);
+            V const u = d & mask; d >>= 26;
+            c += mul32(u, V{} + R0);
+            t[k] = c & mask; c >>= 26;
+            c += u << 10;                       // u * R1
+        }
+        // Fold the upper carry d and t9 into column 9, then the overflow
+        // above 2^256 (c * 0x1000003D1) into columns 0..2.
+        c += mul_k(d, R0) + t[9];
+        r.n[9] = c & (mask >> 4); c >>= 22;
+        c += d << 14;                           // d * (R1 << 4)
+        d = mul_k(c, R0 >> 4) + t[0];
+        r.n[0] = d & mask; d >>= 26;
+        d += (c << 6) + t[1];                   // c * (R1 >> 4)
+        r.n[1] = d & mask; d >>= 26;
+        r.n[2] = d + t[2];
+        for (int k = 3; k < 9; ++k) r.n[k] = t[k];
+    }
+
+    FS_AVX2 static void normalize_weak(F& r) noexcept {
+        V const mask = V{} + M;
+        V const t = r.n[9] >> 22;
+        r.n[9] &= V{} + 0x3FFFFFULL;
+        r.n[0] += mul32(t, V{} + 0x3D1ULL);
+        r.n[1] += t << 6;
+        for (int k = 0; k < 9; ++k) {
+            r.n[k + 1] += r.n[k] >> 26;
+            r.n[k] &= mask;
+        }
+    }
+
+    FS_AVX2 static void mul(F& r, const F& a, const F& b) noexcept {
+        F out;
+        mul_impl<false>(out, a, b, a);
+        r = out;
+    }
+    FS_AVX2 static void sqr(F& r, const F& a) noexcept {
+        F a2, out;
+        for (int k = 0; k < 10; ++k) a2.n[k] = a.n[k] << 1;
+        mul_impl<true>(out, a, a, a2);
+        r = out;
+    }
+    FS_AVX2 static void add(F& r, const F& a, const F& b) noexcept {
+        for (int k = 0; k < 10; ++k) r.n[k] = a.n[k] + b.n[k];
+        normalize_weak(r);
+    }
+    FS_AVX2 static void sub(F& r, const F& a, const F& b) noexcept {
+        // 4p in 10x26 limbs
+        static constexpr std::uint64_t P4[10] = {
+            0xFFFF0BCULL, 0xFFFFEFCULL, 0xFFFFFFCULL, 0xFFFFFFCULL, 0xFFFFFFCULL,
+            0xFFFFFFCULL, 0xFFFFFFCULL, 0xFFFFFFCULL, 0xFFFFFFCULL, 0x0FFFFFCULL};
+        for (int k = 0; k < 10; ++k) r.n[k] = a.n[k] + (V{} + P4[k]) - b.n[k];
+        normalize_weak(r);
+    }
+    template <unsigned K>
+    FS_AVX2 static void mul_int(F& r, const F& a) noexcept {
+        for (int k = 0; k < 10; ++k) {
+            if constexpr (K == 3) r.n[k] = (a.n[k] << 1) + a.n[k];
+            else r.n[k] = a.n[k] << (K == 2 ? 1 : K == 4 ? 2 : 3);
+        }
+        normalize_weak(r);
+    }
+
+    FS_AVX2 static void load(F& r, const FieldElement* src, std::size_t m) noexcept {
+        alignas(32) std::uint64_t w[4][L];
+        gather_limbs<L>(w, src, m);
+        V l[4];
+        std::memcpy(l, w, sizeof(l));
+        V const mask = V{} + M;
+        r.n[0] = l[0] & mask;
+        r.n[1] = (l[0] >> 26) & mask;
+        r.n[2] = ((l[0] >> 52) | (l[1] << 12)) & mask;
+        r.n[3] = (l[1] >> 14) & mask;
+        r.n[4] = ((l[1] >> 40) | (l[2] << 24)) & mask;
+        r.n[5] = (l[2] >> 2) & mask;
+        r.n[6] = (l[2] >> 28) & mask;
+        r.n[7] = ((l[2] >> 54) | (l[3] << 10)) & mask;
+        r.n[8] = (l[3] >> 16) & mask;
+        r.n[9] = l[3] >> 42;
+    }
+
+    FS_AVX2 static void store(FieldElement* dst, const F& a, std::size_t m) noexcept {
+        // Two weak passes leave exact 26-bit limbs and a value < 2^256;
+        // then keep t + 2^256 - p wherever that carries out of 2^256.
+        F t = a;
+        normalize_weak(t);
+        normalize_weak(t);
+        F u = t;
+        u.n[0] += V{} + 0x3D1ULL;
+        u.n[1] += V{} + 0x40ULL;
+        for (int k = 0; k < 9; ++k) {
+            u.n[k + 1] += u.n[k] >> 26;
+            u.n[k] &= V{} + M;
+        }
+        V const ge = V{} - (u.n[9] >> 22);
+        u.n[9] &= V{} + 0x3FFFFFULL;
+        for (int k = 0; k < 10; ++k) t.n[k] = (u.n[k] & ge) | (t.n[k] & ~ge);
+        V l[4];
+        l[0] = t.n[0] | (t.n[1] << 26) | (t.n[2] << 52);
+        l[1] = (t.n[2] >> 12) | (t.n[3] << 14) | (t.n[4] << 40);
+        l[2] = (t.n[4] >> 24) | (t.n[5] << 2) | (t.n[6] << 28) | (t.n[7] << 54);
+        l[3] = (t.n[7] >> 10) | (t.n[8] << 16) | (t.n[9] << 42);
+        alignas(32) std::uint64_t w[4][L];
+        std::memcpy(w, l, sizeof(l));
+        scatter_limbs<L>(dst, w, m);
+    }
+};
+
+// ============================================================================
+// IFMA tier: 8 lanes x 5x52
+// ============================================================================
+// Products via VPMADD52LUQ / VPMADD52HUQ: column k collects lo52(a_i*b_j)
+// for i+j = k and hi52(a_i*b_j) for i+j = k-1. The upper five columns are
+// carried to 52 bits and folded with 2^260 = 0x1000003D10 (mod p), again
+// through IFMA.
+
+struct IfmaOps {
+    static constexpr std::size_t L = 8;
+    using V = u64x8;
+    struct F { V n[5]; };
+
+    static constexpr std::uint64_t M52  = 0xFFFFFFFFFFFFFULL;
+    static constexpr std::uint64_t M48  = 0xFFFFFFFFFFFFULL;
+    static constexpr std::uint64_t R256 = 0x1000003D1ULL;   // 2^256 mod p
+    static constexpr std::uint64_t R260 = 0x1000003D10ULL;  // 2^260 mod p
+
+    FS_IFMA static V madd_lo(V acc, V a, V b) noexcept {
+        return (V)_mm512_madd52lo_epu64((__m512i)acc, (__m512i)a, (__m512i)b);
+    }
+    FS_IFMA static V madd_hi(V acc, V a, V b) noexcept {
+        return (V)_mm512_madd52hi_epu64((__m512i)acc, (__m512i)a, (__m512i)b);
+    }
+
+    FS_IFMA static void reduce(F& r, V (&c)[10]) noexcept {
+        V const mask = V{} + M52;
+        V const k = V{} + R260;
+        for (int i = 5; i < 9; ++i) {
+            c[i + 1] += c[i] >> 52;
+            c[i] &= mask;
+        }
+        V const c10 = c[9] >> 52;
+        c[9] &= mask;
+        V o[5];
+        for (int i = 0; i < 5; ++i) o[i] = madd_lo(c[i], c[i + 5], k);
+        for (int i = 1; i < 5; ++i) o[i] = madd_hi(o[i], c[i + 4], k);
+        V const top = madd_lo(madd_hi(V{}, c[9], k), c10, k);   // weight 2^260
+        o[0] = madd_lo(o[0], top, k);
+        o[1] = madd_hi(o[1], top, k);
+        for (int i = 0; i < 5; ++i) r.n[i] = o[i];
+        normalize_weak(r);
+    }
+
+    FS_IFMA static void normalize_weak(F& r) noexcept {
+        V const mask = V{} + M52;
+        V const t = r.n[4] >> 48;
+        r.n[4] &= V{} + M48;
+        r.n[0] = madd_lo(r.n[0], t, V{} + R256);
+        for (int i = 0; i < 4; ++i) {
+            r.n[i + 1] += r.n[i] >> 52;
+            r.n[i] &= mask;
+        }
+    }
+
+    FS_IFMA static void mul(F& r, const F& a, const F& b) noexcept {
+        V c[10] = {};
+        for (int i = 0; i < 5; ++i) {
+            for (int j = 0; j < 5; ++j) {
+                c[i + j]     = madd_lo(c[i + j], a.n[i], b.n[j]);
+                c[i + j + 1] = madd_hi(c[i + j + 1], a.n[i], b.n[j]);
+            }
+        }
+        reduce(r, c);
+    }
+    FS_IFMA static void sqr(F& r, const F& a) noexcept {
+        V c[10] = {};
+        for (int i = 0; i < 5; ++i) {
+            for (int j = i + 1; j < 5; ++j) {
+                c[i + j]     = madd_lo(c[i + j], a.n[i], a.n[j]);
+                c[i + j + 1] = madd_hi(c[i + j + 1], a.n[i], a.n[j]);
+            }
+        }
+        for (auto& v : c) v += v;
+        for (int i = 0; i < 5; ++i) {
+            c[2 * i]     = madd_lo(c[2 * i], a.n[i], a.n[i]);
+            c[2 * i + 1] = madd_hi(c[2 * i + 1], a.n[i], a.n[i]);
+        }
+        reduce(r, c);
+    }
+    FS_IFMA static void add(F& r, const F& a, const F& b) noexcept {
+        for (int k = 0; k < 5; ++k) r.n[k] = a.n[k] + b.n[k];
+        normalize_weak(r);
+    }
+    FS_IFMA static void sub(F& r, const F& a, const F& b) noexcept {
+        // 4p in 5x52 limbs
+        static constexpr std::uint64_t P4[5] = {
+            0x3FFFFBFFFFF0BCULL, 0x3FFFFFFFFFFFFCULL, 0x3FFFFFFFFFFFFCULL,
+            0x3FFFFFFFFFFFFCULL, 0x3FFFFFFFFFFFCULL};
+        for (int k = 0; k < 5; ++k) r.n[k] = a.n[k] + (V{} + P4[k]) - b.n[k];
+        normalize_weak(r);
+    }
+    template <unsigned K>
+    FS_IFMA static void mul_int(F& r, const F& a) noexcept {
+        for (int k = 0; k < 5; ++k) {
+            if constexpr (K == 3) r.n[k] = (a.n[k] << 1) + a.n[k];
+            else r.n[k] = a.n[k] << (K == 2 ? 1 : K == 4 ? 2 : 3);
+        }
+        normalize_weak(r);
+    }
+
+    FS_IFMA static void load(F& r, const FieldElement* src, std::size_t m) noexcept {
+        alignas(64) std::uint64_t w[4][L];
+        gather_limbs<L>(w, src, m);
+        V l[4];
+        std::memcpy(l, w, sizeof(l));
+        V const mask = V{} + M52;
+        r.n[0] = l[0] & mask;
+        r.n[1] = ((l[0] >> 52) | (l[1] << 12)) & mask;
+        r.n[2] = ((l[1] >> 40) | (l[2] << 24)) & mask;
+        r.n[3] = ((l[2] >> 28) | (l[3] << 36)) & mask;
+        r.n[4] = l[3] >> 16;
+    }
+
+    FS_IFMA static void store(FieldElement* dst, const F& a, std::size_t m) noexcept {
+        F t = a;
+        normalize_weak(t);
+        normalize_weak(t);
+        F u = t;
+        u.n[0] += V{} + R256;
+        for (int k = 0; k < 4; ++k) {
+            u.n[k + 1] += u.n[k] >> 52;
+            u.n[k] &= V{} + M52;
+        }
+        V const ge = V{} - (u.n[4] >> 48);
+        u.n[4] &= V{} + M48;
+        for (int k = 0; k < 5; ++k) t.n[k] = (u.n[k] & ge) | (t.n[k] & ~ge);
+        V l[4];
+        l[0] = t.n[0] | (t.n[1] << 52);
+        l[1] = (t.n[1] >> 12) | (t.n[2] << 40);
+        l[2] = (t.n[2] >> 24) | (t.n[3] << 28);
+        l[3] = (t.n[3] >> 36) | (t.n[4] << 16);
+        alignas(64) std::uint64_t w[4][L];
+        std::memcpy(w, l, sizeof(l));
+        scatter_limbs<L>(dst, w, m);
+    }
+};
+
+#undef FS_IFMA
+#undef FS_AVX2
+
+#endif // SECP256K1_FIELD_SIMD_X86
+
+FieldSimdTier resolve(FieldSimdTier tier) noexcept {
+    return field_simd_available(tier) ? tier : FieldSimdTier::Scalar;
+}
+
+} // anonymous namespace
+
+#ifdef SECP256K1_FIELD_SIMD_X86
+
+namespace avx2 {
+
+__attribute__((target("avx2"), flatten))
+void mul_batch(const FieldElement* a, const FieldElement* b, FieldElement* out,
+               std::size_t n) noexcept {
+    mul_batch_impl<Avx2Ops>(a, b, out, n);
+}
+
+__attribute__((target("avx2"), flatten))
+void sqr_batch(const FieldElement* a, FieldElement* out, std::size_t n) noexcept {
+    sqr_batch_impl<Avx2Ops>(a, out, n);
+}
+
+__attribute__((target("avx2"), flatten))
+void sqrt_batch(const FieldElement* a, FieldElement* out, std::uint8_t* ok,
+                std::size_t n) noexcept {
+    sqrt_batch_impl<Avx2Ops>(a, out, ok, n);
+}
+
+__attribute__((target("avx2"), flatten))
+void double_batch(const FieldElement* X, const FieldElement* Y, const FieldElement* Z,
+                  FieldElement* X3, FieldElement* Y3, FieldElement* Z3, std::size_t n) noexcept {
+    double_batch_impl<Avx2Ops>(X, Y, Z, X3, Y3, Z3, n);
+}
+
+__attribute__((target("avx2"), flatten))
+void add_mixed_batch(const FieldElement* X1, const FieldElement* Y1, const FieldElement* Z1,
+                     const FieldElement* x2, const FieldElement* y2, FieldElement* X3,
+                     FieldElement* Y3, FieldElement* Z3, std::size_t n) noexcept {
+    add_mixed_batch_impl<Avx2Ops>(X1, Y1, Z1, x2, y2, X3, Y3, Z3, n);
+}
+
+} // namespace avx2
+
+namespace ifma {
+
+__attribute__((target("avx512f,avx512ifma"), flatten))
+void mul_batch(const FieldElement* a, const FieldElement* b, FieldElement* out,
+               std::size_t n) noexcept {
+    mul_batch_impl<IfmaOps>(a, b, out, n);
+}
+
+__attribute__((target("avx512f,avx512ifma"), flatten))
+void sqr_batch(const FieldElement* a, FieldElement* out, std::size_t n) noexcept {
+    sqr_batch_impl<IfmaOps>(a, out, n);
+}
+
+__attribute__((target("avx512f,avx512ifma"), flatten))
+void sqrt_batch(const FieldElement* a, FieldElement* out, std::uint8_t* ok,
+                std::size_t n) noexcept {
+    sqrt_batch_impl<IfmaOps>(a, out, ok, n);
+}
+
+__attribute__((target("avx512f,avx512ifma"), flatten))
+void double_batch(const FieldElement* X, const FieldElement* Y, const FieldElement* Z,
+                  FieldElement* X3, FieldElement* Y3, FieldElement* Z3, std::size_t n) noexcept {
+    double_batch_impl<IfmaOps>(X, Y, Z, X3, Y3, Z3, n);
+}
+
+__attribute__((target("avx512f,avx512ifma"), flatten))
+void add_mixed_batch(const FieldElement* X1, const FieldElement* Y1, const FieldElement* Z1,
+                     const FieldElement* x2, const FieldElement* y2, FieldElement* X3,
+                     FieldElement* Y3, FieldElement* Z3, std::size_t n) noexcept {
+    add_mixed_batch_impl<IfmaOps>(X1, Y1, Z1, x2, y2, X3, Y3, Z3, n);
+}
+
+} // namespace ifma
+
+#endif // SECP256K1_FIELD_SIMD_X86
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+bool field_simd_available(FieldSimdTier tier) noexcept {
+    switch (tier) {
+    case FieldSimdTier::Scalar:
+        return true;
+#ifdef SECP256K1_FIELD_SIMD_X86
+    case FieldSimdTier::AVX2:
+        return simd_features().avx2;
+    case FieldSimdTier::IFMA:
+        return simd_features().ifma;
+#endif
+    default:
+        return false;
+    }
+}
+
+FieldSimdTier field_simd_tier() noexcept {
+    static const FieldSimdTier tier =
+        field_simd_available(FieldSimdTier::IFMA) ? FieldSimdTier::IFMA :
+        field_simd_available(FieldSimdTier::AVX2) ? FieldSimdTier::AVX2 :
+                                                    FieldSimdTier::Scalar;
+    return tier;
+}
+
+const char* field_simd_tier_name(FieldSimdTier tier) noexcept {
+    switch (tier) {
+    case FieldSimdTier::AVX2: return "avx2";
+    case FieldSimdTier::IFMA: return "ifma";
+    default:                  return "scalar";
+    }
+}
+
+void field_mul_batch(const FieldElement* a, const FieldElement* b, FieldElement* out,
+                     std::size_t n, FieldSimdTier tier) noexcept {
+    switch (resolve(tier)) {
+#ifdef SECP256K1_FIELD_SIMD_X86
+    case FieldSimdTier::AVX2: avx2::mul_batch(a, b, out, n); return;
+    case FieldSimdTier::IFMA: ifma::mul_batch(a, b, out, n); return;
+#endif
+    default: mul_batch_impl<ScalarOps>(a, b, out, n); return;
+    }
+}
+
+void field_sqr_batch(const FieldElement* a, FieldElement* out, std::size_t n,
+                     FieldSimdTier tier) noexcept {
+    switch (resolve(tier)) {
+#ifdef SECP256K1_FIELD_SIMD_X86
+    case FieldSimdTier::AVX2: avx2::sqr_batch(a, out, n); return;
+    case FieldSimdTier::IFMA: ifma::sqr_batch(a, out, n); return;
+#endif
+    default: sqr_batch_impl<ScalarOps>(a, out, n); return;
+    }
+}
+
+void field_sqrt_batch(const FieldElement* a, FieldElement* out, std::uint8_t* ok,
+                      std::size_t n, FieldSimdTier tier) noexcept {
+    switch (resolve(tier)) {
+#ifdef SECP256K1_FIELD_SIMD_X86
+    case FieldSimdTier::AVX2: avx2::sqrt_batch(a, out, ok, n); return;
+    case FieldSimdTier::IFMA: ifma::sqrt_batch(a, out, ok, n); return;
+#endif
+    default: sqrt_batch_impl<ScalarOps>(a, out, ok, n); return;
+    }
+}
+
+void point_double_batch(const FieldElement* X, const FieldElement* Y, const FieldElement* Z,
+                        FieldElement* X3, FieldElement* Y3, FieldElement* Z3,
+                        std::size_t n, FieldSimdTier tier) noexcept {
+    switch (resolve(tier)) {
+#ifdef SECP256K1_FIELD_SIMD_X86
+    case FieldSimdTier::AVX2: avx2::double_batch(X, Y, Z, X3, Y3, Z3, n); return;
+    case FieldSimdTier::IFMA: ifma::double_batch(X, Y, Z, X3, Y3, Z3, n); return;
+#endif
+    default: double_batch_impl<ScalarOps>(X, Y, Z, X3, Y3, Z3, n); return;
+    }
+}
+
+void point_add_mixed_batch(const FieldElement* X1, const FieldElement* Y1, const FieldElement* Z1,
+                           const FieldElement* x2, const FieldElement* y2,
+                           FieldElement* X3, FieldElement* Y3, FieldElement* Z3,
+                           std::size_t n, FieldSimdTier tier) noexcept {
+    switch (resolve(tier)) {
+#ifdef SECP256K1_FIELD_SIMD_X86
+    case FieldSimdTier::AVX2: avx2::add_mixed_batch(X1, Y1, Z1, x2, y2, X3, Y3, Z3, n); return;
+    case FieldSimdTier::IFMA: ifma::add_mixed_batch(X1, Y1, Z1, x2, y2, X3, Y3, Z3, n); return;
+#endif
+    default: add_mixed_batch_impl<ScalarOps>(X1, Y1, Z1, x2, y2, X3, Y3, Z3, n); return;
+    }
+}
+
+} // namespace secp256k1::fast
@@ -5,7 +5,8 @@
 // Implementation tiers:
 //   Tier 0: SCALAR   -- Optimized portable C++, unrolled rounds
 //   Tier 1: SHA-NI   -- Intel SHA Extensions (hardware SHA-256)
-//   Tier 2: AVX2     -- 4-way multi-buffer SHA-256
+//   Tier 2: AVX2     -- 8-way multi-buffer SHA-256 + RIPEMD-160 (batch)
+//   Tier 3: AVX-512  -- 16-way multi-buffer SHA-256 + RIPEMD-160 (batch)
 //
 // All fixed-length hot-path functions (sha256_33, ripemd160_32, hash160_33)
 // use precomputed padding to eliminate branches and buffer management.
@@ -22,6 +23,8 @@
 
 #include "secp256k1/hash_accel.hpp"
 #include "secp256k1/sha256.hpp"
+#include "secp256k1/detail/secure_erase.hpp"
+#include "secp256k1/sha512.hpp"
 
 #include <cstring>
 
@@ -59,14 +62,24 @@ static struct CpuFeatures {
     bool avx512;
 
     CpuFeatures() noexcept {
+        // AVX state must also be enabled by the OS (XCR0): YMM for AVX2,
+        // YMM + opmask + ZMM for AVX-512.
+        std::uint64_t xcr0 = 0;
     #ifdef _MSC_VER
         int info[4];
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) != 0) xcr0 = _xgetbv(0);
         __cpuidex(info, 7, 0);
         sha_ni = (info[1] & (1 << 29)) != 0;
         avx2   = (info[1] & (1 << 5))  != 0;
         avx512 = (info[1] & (1 << 16)) != 0;
     #elif defined(__GNUC__) || defined(__clang__)
         unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 27)) != 0) {
+            std::uint32_t lo = 0, hi = 0;
+            __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            xcr0 = (std::uint64_t(hi) << 32) | lo;
+        }
         if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
             sha_ni = (ebx & (1 << 29)) != 0;
             avx2   = (ebx & (1 << 5))  != 0;
@@ -75,6 +88,8 @@ static struct CpuFeatures {
             sha_ni = avx2 = avx512 = false;
         }
     #endif
+        avx2   = avx2 && (xcr0 & 0x06) == 0x06;
+        avx512 = avx512 && (xcr0 & 0xE6) == 0xE6;
     }
 } const g_cpu_features;
 #endif
@@ -128,6 +143,14 @@ HashTier detect_hash_tier() noexcept {
     return HashTier::SCALAR;
 }
 
+HashTier batch_hash_tier() noexcept {
+#ifdef SECP256K1_HASH_MULTIBUFFER
+    if (avx512_available()) return HashTier::AVX512;
+    if (avx2_available())   return HashTier::AVX2;
+#endif
+    return detect_hash_tier();
+}
+
 const char* hash_tier_name(HashTier tier) noexcept {
     switch (tier) {
         case HashTier::ARM_SHA2: return "ARM SHA2";
@@ -698,6 +721,376 @@ void hash160_33(const std::uint8_t* pubkey33, std::uint8_t* out20) noexcept {
 
 #endif // SECP256K1_X86_TARGET
 
+// ============================================================================
+// AVX2 / AVX-512 -- Multi-buffer SHA-256 + RIPEMD-160 (8 / 16 lanes)
+// ============================================================================
+//
+// One independent message per 32-bit lane. The round functions are written
+// once over GCC/Clang vector types and force-inlined into thin wrappers that
+// carry the target("avx2") / target("avx512f") attribute, so the same source
+// compiles to VEX (8 lanes) and EVEX (16 lanes, native vprold) code while the
+// rest of the TU stays baseline x86-64.
+//
+// Both fixed shapes are a single block, so message loading is a transpose of
+// the data words plus constant padding words. hash160 never leaves registers
+// between the two hashes: RIPEMD-160 reads its input little-endian, so its
+// message words are just the byte-swapped SHA-256 state words.
+//
+// MSVC has no vector extensions; SECP256K1_HASH_MULTIBUFFER stays undefined
+// there and the batch functions keep the per-message SHA-NI/scalar loop.
+
+#ifdef SECP256K1_HASH_MULTIBUFFER
+
+namespace {
+
+#define MB_INLINE inline __attribute__((always_inline))
+
+typedef std::uint32_t u32x8  __attribute__((vector_size(32)));
+typedef std::uint32_t u32x16 __attribute__((vector_size(64)));
+typedef std::uint64_t u64x4  __attribute__((vector_size(32)));
+typedef std::uint64_t u64x8  __attribute__((vector_size(64)));
+
+// Lane-wise helpers are macros: a helper taking or returning a vector by
+// value has a baseline-ISA signature, which GCC flags with -Wpsabi even when
+// every call is inlined into a target() function.
+#define MB_SPLAT(V, x)  (V{} + static_cast<std::uint32_t>(x))
+#define MB_ROTR(x, n)   (((x) >> (n)) | ((x) << (32 - (n))))
+#define MB_ROTL(x, n)   (((x) << (n)) | ((x) >> (32 - (n))))
+#define MB_BSWAP(x)     (((x) << 24) | (((x) << 8) & 0x00FF0000u) | \
+                         (((x) >> 8) & 0x0000FF00u) | ((x) >> 24))
+#define MB_SPLAT64(V, x) (V{} + static_cast<std::uint64_t>(x))
+#define MB_ROTR64(x, n)  (((x) >> (n)) | ((x) << (64 - (n))))
+
+// -- SHA-256 ------------------------------------------------------------------
+
+// One block on every lane. w[] is the message and is overwritten by the
+// rolling 16-word schedule.
+template <typename V>
+MB_INLINE void mb_sha256_compress(V state[8], V w[16]) noexcept {
+    V a = state[0], b = state[1], c = state[2], d = state[3];
+    V e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (int i = 0; i < 64; ++i) {
+        if (i >= 16) {
+            V const w15 = w[(i - 15) & 15];
+            V const w2  = w[(i - 2) & 15];
+            V const s0  = MB_ROTR(w15, 7) ^ MB_ROTR(w15, 18) ^ (w15 >> 3);
+            V const s1  = MB_ROTR(w2, 17) ^ MB_ROTR(w2, 19) ^ (w2 >> 10);
+            w[i & 15] += s0 + w[(i - 7) & 15] + s1;
+        }
+        V const S1 = MB_ROTR(e, 6) ^ MB_ROTR(e, 11) ^ MB_ROTR(e, 25);
+        V const ch = (e & f) ^ (~e & g);
+        V const t1 = h + S1 + ch + SHA256_K[i] + w[i & 15];
+        V const S0 = MB_ROTR(a, 2) ^ MB_ROTR(a, 13) ^ MB_ROTR(a, 22);
+        V const maj = (a & b) ^ (a & c) ^ (b & c);
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + S0 + maj;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// SHA-256 of L packed messages of `len` (32 or 33) bytes -> state words.
+template <typename V, int L>
+MB_INLINE void mb_sha256_short(const std::uint8_t* in, std::size_t len, V state[8]) noexcept {
+    alignas(64) std::uint32_t lanes[8][L];
+    for (int l = 0; l < L; ++l) {
+        const std::uint8_t* p = in + static_cast<std::size_t>(l) * len;
+        for (int t = 0; t < 8; ++t) lanes[t][l] = load_be32(p + t * 4);
+    }
+    V w[16];
+    for (int t = 0; t < 8; ++t) std::memcpy(&w[t], lanes[t], sizeof(V));
+    if (len == 33) {
+        alignas(64) std::uint32_t last[L];
+        for (int l = 0; l < L; ++l) {
+            last[l] = (std::uint32_t(in[static_cast<std::size_t>(l) * 33 + 32]) << 24) | 0x00800000u;
+        }
+        std::memcpy(&w[8], last, sizeof(V));
+    } else {
+        w[8] = MB_SPLAT(V, 0x80000000u);
+    }
+    for (int t = 9; t < 15; ++t) w[t] = V{};
+    w[15] = MB_SPLAT(V, static_cast<std::uint32_t>(len * 8));
+
+    for (int t = 0; t < 8; ++t) state[t] = MB_SPLAT(V, SHA256_IV[t]);
+    mb_sha256_compress(state, w);
+}
+
+// -- RIPEMD-160 ---------------------------------------------------------------
+
+template <int R, typename V>
+MB_INLINE void mb_rmd_f(V& out, const V& x, const V& y, const V& z) noexcept {
+    if constexpr (R == 0) out = x ^ y ^ z;
+    else if constexpr (R == 1) out = (x & y) | (~x & z);
+    else if constexpr (R == 2) out = (x | ~y) ^ z;
+    else if constexpr (R == 3) out = (x & z) | (y & ~z);
+    else out = x ^ (y | ~z);
+}
+
+// Rounds 16*R .. 16*R+15 of both lines. The left line uses boolean function
+// R for the group, the right line uses them in reverse order (4 - R).
+template <typename V, int R>
+MB_INLINE void mb_rmd_group(V& al, V& bl, V& cl, V& dl, V& el,
+                            V& ar, V& br, V& cr, V& dr, V& er, const V x[16]) noexcept {
+    static constexpr std::uint8_t rl[80] = {
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+        7,4,13,1,10,6,15,3,12,0,9,5,2,14,11,8,
+        3,10,14,4,9,15,8,1,2,7,0,6,13,11,5,12,
+        1,9,11,10,0,8,12,4,13,3,7,15,14,5,6,2,
+        4,0,5,9,7,12,2,10,14,1,3,8,11,6,15,13
+    };
+    static constexpr std::uint8_t rr[80] = {
+        5,14,7,0,9,2,11,4,13,6,15,8,1,10,3,12,
+        6,11,3,7,0,13,5,10,14,15,8,12,4,9,1,2,
+        15,5,1,3,7,14,6,9,11,8,12,2,10,0,4,13,
+        8,6,4,1,3,11,15,0,5,12,2,13,9,7,10,14,
+        12,15,10,4,1,5,8,7,6,2,13,14,0,3,9,11
+    };
+    static constexpr std::uint8_t sl[80] = {
+        11,14,15,12,5,8,7,9,11,13,14,15,6,7,9,8,
+        7,6,8,13,11,9,7,15,7,12,15,9,11,7,13,12,
+        11,13,6,7,14,9,13,15,14,8,13,6,5,12,7,5,
+        11,12,14,15,14,15,9,8,9,14,5,6,8,6,5,12,
+        9,15,5,11,6,8,13,12,5,12,13,14,11,8,5,6
+    };
+    static constexpr std::uint8_t sr[80] = {
+        8,9,9,11,13,15,15,5,7,7,8,11,14,14,12,6,
+        9,13,15,7,12,8,9,11,7,7,12,7,6,15,13,11,
+        9,7,15,11,8,6,6,14,12,13,5,14,13,13,7,5,
+        15,5,8,11,14,14,6,14,6,9,12,9,12,5,15,8,
+        8,5,12,9,12,5,14,6,8,13,6,5,15,13,11,11
+    };
+    static constexpr std::uint32_t KL[5] = {0, 0x5A827999u, 0x6ED9EBA1u, 0x8F1BBCDCu, 0xA953FD4Eu};
+    static constexpr std::uint32_t KR[5] = {0x50A28BE6u, 0x5C4DD124u, 0x6D703EF3u, 0x7A6D76E9u, 0};
+
+    for (int j = 16 * R; j < 16 * R + 16; ++j) {
+        V fl, fr;
+        mb_rmd_f<R>(fl, bl, cl, dl);
+        mb_rmd_f<4 - R>(fr, br, cr, dr);
+
+        V tl = al + fl + x[rl[j]] + KL[R];
+        tl = MB_ROTL(tl, sl[j]) + el;
+        al = el; el = dl; dl = MB_ROTL(cl, 10); cl = bl; bl = tl;
+
+        V tr = ar + fr + x[rr[j]] + KR[R];
+        tr = MB_ROTL(tr, sr[j]) + er;
+        ar = er; er = dr; dr = MB_ROTL(cr, 10); cr = br; br = tr;
+    }
+}
+
+// RIPEMD-160 of one 32-byte message per lane, given as 8 little-endian words.
+template <typename V>
+MB_INLINE void mb_ripemd160_32(const V msg[8], V state[5]) noexcept {
+    V x[16];
+    for (int t = 0; t < 8; ++t) x[t] = msg[t];
+    x[8] = MB_SPLAT(V, 0x80u);
+    for (int t = 9; t < 16; ++t) x[t] = V{};
+    x[14] = MB_SPLAT(V, 256u);
+
+    V al = MB_SPLAT(V, RIPEMD160_IV[0]), bl = MB_SPLAT(V, RIPEMD160_IV[1]);
+    V cl = MB_SPLAT(V, RIPEMD160_IV[2]), dl = MB_SPLAT(V, RIPEMD160_IV[3]);
+    V el = MB_SPLAT(V, RIPEMD160_IV[4]);
+    V ar = al, br = bl, cr = cl, dr = dl, er = el;
+
+    mb_rmd_group<V, 0>(al, bl, cl, dl, el, ar, br, cr, dr, er, x);
+    mb_rmd_group<V, 1>(al, bl, cl, dl, el, ar, br, cr, dr, er, x);
+    mb_rmd_group<V, 2>(al, bl, cl, dl, el, ar, br, cr, dr, er, x);
+    mb_rmd_group<V, 3>(al, bl, cl, dl, el, ar, br, cr, dr, er, x);
+    mb_rmd_group<V, 4>(al, bl, cl, dl, el, ar, br, cr, dr, er, x);
+
+    V const iv1 = MB_SPLAT(V, RIPEMD160_IV[1]), iv2 = MB_SPLAT(V, RIPEMD160_IV[2]);
+    V const iv3 = MB_SPLAT(V, RIPEMD160_IV[3]), iv4 = MB_SPLAT(V, RIPEMD160_IV[4]);
+    V const iv0 = MB_SPLAT(V, RIPEMD160_IV[0]);
+    state[0] = iv1 + cl + dr;
+    state[1] = iv2 + dl + er;
+    state[2] = iv3 + el + ar;
+    state[3] = iv4 + al + br;
+    state[4] = iv0 + bl + cr;
+}
+
+// -- Transpose out ------------------------------------------------------------
+
+template <typename V, int L, bool BigEndian>
+MB_INLINE void mb_store(const V* words, int n_words, std::uint8_t* out, std::size_t stride) noexcept {
+    alignas(64) std::uint32_t lanes[8][L];
+    for (int t = 0; t < n_words; ++t) std::memcpy(lanes[t], &words[t], sizeof(V));
+    for (int l = 0; l < L; ++l) {
+        std::uint8_t* o = out + static_cast<std::size_t>(l) * stride;
+        for (int t = 0; t < n_words; ++t) {
+            if (BigEndian) store_be32(o + t * 4, lanes[t][l]);
+            else           store_le32(o + t * 4, lanes[t][l]);
+        }
+    }
+}
+
+// -- L-lane entry points ------------------------------------------------------
+
+template <typename V, int L>
+MB_INLINE void mb_sha256_33(const std::uint8_t* in, std::uint8_t* out32s) noexcept {
+    V state[8];
+    mb_sha256_short<V, L>(in, 33, state);
+    mb_store<V, L, true>(state, 8, out32s, 32);
+}
+
+template <typename V, int L>
+MB_INLINE void mb_ripemd160_32_lanes(const std::uint8_t* in, std::uint8_t* out20s) noexcept {
+    alignas(64) std::uint32_t lanes[8][L];
+    for (int l = 0; l < L; ++l) {
+        for (int t = 0; t < 8; ++t) {
+            lanes[t][l] = load_le32(in + static_cast<std::size_t>(l) * 32 + t * 4);
+        }
+    }
+    V msg[8];
+    for (int t = 0; t < 8; ++t) std::memcpy(&msg[t], lanes[t], sizeof(V));
+    V state[5];
+    mb_ripemd160_32(msg, state);
+    mb_store<V, L, false>(state, 5, out20s, 20);
+}
+
+template <typename V, int L>
+MB_INLINE void mb_hash160_33(const std::uint8_t* in, std::uint8_t* out20s) noexcept {
+    V sha[8];
+    mb_sha256_short<V, L>(in, 33, sha);
+    for (auto& w : sha) w = MB_BSWAP(w);
+    V state[5];
+    mb_ripemd160_32(sha, state);
+    mb_store<V, L, false>(state, 5, out20s, 20);
+}
+
+// -- SHA-512 / PBKDF2 ---------------------------------------------------------
+// 64-bit lanes: 4 per AVX2 register, 8 per AVX-512 register.
+
+template <typename V>
+MB_INLINE void mb_sha512_compress(V state[8], V w[16]) noexcept {
+    V a = state[0], b = state[1], c = state[2], d = state[3];
+    V e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (int i = 0; i < 80; ++i) {
+        if (i >= 16) {
+            V const w15 = w[(i - 15) & 15];
+            V const w2  = w[(i - 2) & 15];
+            V const s0  = MB_ROTR64(w15, 1) ^ MB_ROTR64(w15, 8) ^ (w15 >> 7);
+            V const s1  = MB_ROTR64(w2, 19) ^ MB_ROTR64(w2, 61) ^ (w2 >> 6);
+            w[i & 15] += s0 + w[(i - 7) & 15] + s1;
+        }
+        V const S1 = MB_ROTR64(e, 14) ^ MB_ROTR64(e, 18) ^ MB_ROTR64(e, 41);
+        V const ch = (e & f) ^ (~e & g);
+        V const t1 = h + S1 + ch + ::secp256k1::SHA512::K[i] + w[i & 15];
+        V const S0 = MB_ROTR64(a, 28) ^ MB_ROTR64(a, 34) ^ MB_ROTR64(a, 39);
+        V const maj = (a & b) ^ (a & c) ^ (b & c);
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + S0 + maj;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// PBKDF2-HMAC-SHA512 rounds 2..iterations on L lanes. Each round is two
+// compressions from the ipad / opad midstates on a single padded block:
+// [64-byte digest | 0x80 | zeros | length (128 + 64) * 8].
+template <typename V, int L>
+MB_INLINE void mb_pbkdf2_sha512(const std::uint64_t (*inner)[8], const std::uint64_t (*outer)[8],
+                                std::uint64_t (*t)[8], std::uint32_t iterations) noexcept {
+    alignas(64) std::uint64_t lanes[8][L];
+    V ist[8], ost[8], u[8], acc[8];
+    for (int k = 0; k < 8; ++k) {
+        for (int l = 0; l < L; ++l) lanes[k][l] = inner[l][k];
+        std::memcpy(&ist[k], lanes[k], sizeof(V));
+        for (int l = 0; l < L; ++l) lanes[k][l] = outer[l][k];
+        std::memcpy(&ost[k], lanes[k], sizeof(V));
+        for (int l = 0; l < L; ++l) lanes[k][l] = t[l][k];
+        std::memcpy(&u[k], lanes[k], sizeof(V));
+        acc[k] = u[k];
+    }
+
+    for (std::uint32_t it = 1; it < iterations; ++it) {
+        V w[16], st[8];
+        for (int k = 0; k < 8; ++k) { w[k] = u[k]; st[k] = ist[k]; }
+        w[8] = MB_SPLAT64(V, 0x8000000000000000ULL);
+        for (int k = 9; k < 15; ++k) w[k] = V{};
+        w[15] = MB_SPLAT64(V, (128 + 64) * 8);
+        mb_sha512_compress(st, w);
+
+        for (int k = 0; k < 8; ++k) { w[k] = st[k]; u[k] = ost[k]; }
+        w[8] = MB_SPLAT64(V, 0x8000000000000000ULL);
+        for (int k = 9; k < 15; ++k) w[k] = V{};
+        w[15] = MB_SPLAT64(V, (128 + 64) * 8);
+        mb_sha512_compress(u, w);
+
+        for (int k = 0; k < 8; ++k) acc[k] ^= u[k];
+    }
+
+    for (int k = 0; k < 8; ++k) {
+        std::memcpy(lanes[k], &acc[k], sizeof(V));
+        for (int l = 0; l < L; ++l) t[l][k] = lanes[k][l];
+    }
+    ::secp256k1::detail::secure_erase(lanes, sizeof(lanes));
+}
+
+#undef MB_ROTR64
+#undef MB_SPLAT64
+#undef MB_BSWAP
+#undef MB_ROTL
+#undef MB_ROTR
+#undef MB_SPLAT
+#undef MB_INLINE
+
+} // anonymous namespace
+
+namespace avx2 {
+
+__attribute__((target("avx2")))
+void sha256_33_x8(const std::uint8_t* pubkeys, std::uint8_t* out32s) noexcept {
+    mb_sha256_33<u32x8, 8>(pubkeys, out32s);
+}
+
+__attribute__((target("avx2")))
+void ripemd160_32_x8(const std::uint8_t* in32s, std::uint8_t* out20s) noexcept {
+    mb_ripemd160_32_lanes<u32x8, 8>(in32s, out20s);
+}
+
+__attribute__((target("avx2")))
+void hash160_33_x8(const std::uint8_t* pubkeys, std::uint8_t* out20s) noexcept {
+    mb_hash160_33<u32x8, 8>(pubkeys, out20s);
+}
+
+__attribute__((target("avx2")))
+void pbkdf2_sha512_x4(const std::uint64_t (*inner)[8], const std::uint64_t (*outer)[8],
+                      std::uint64_t (*t)[8], std::uint32_t iterations) noexcept {
+    mb_pbkdf2_sha512<u64x4, 4>(inner, outer, t, iterations);
+}
+
+} // namespace avx2
+
+namespace avx512 {
+
+__attribute__((target("avx512f")))
+void sha256_33_x16(const std::uint8_t* pubkeys, std::uint8_t* out32s) noexcept {
+    mb_sha256_33<u32x16, 16>(pubkeys, out32s);
+}
+
+__attribute__((target("avx512f")))
+void ripemd160_32_x16(const std::uint8_t* in32s, std::uint8_t* out20s) noexcept {
+    mb_ripemd160_32_lanes<u32x16, 16>(in32s, out20s);
+}
+
+__attribute__((target("avx512f")))
+void hash160_33_x16(const std::uint8_t* pubkeys, std::uint8_t* out20s) noexcept {
+    mb_hash160_33<u32x16, 16>(pubkeys, out20s);
+}
+
+__attribute__((target("avx512f")))
+void pbkdf2_sha512_x8(const std::uint64_t (*inner)[8], const std::uint64_t (*outer)[8],
+                      std::uint64_t (*t)[8], std::uint32_t iterations) noexcept {
+    mb_pbkdf2_sha512<u64x8, 8>(inner, outer, t, iterations);
+}
+
+} // namespace avx512
+
+#endif // SECP256K1_HASH_MULTIBUFFER
+
 // ============================================================================
 // Public API -- auto-dispatch to best available tier
 // ============================================================================
@@ -847,14 +1240,40 @@ void hash160_33(const std::uint8_t* pubkey33, std::uint8_t* out20) noexcept {
 // Batch operations
 // ============================================================================
 
+// Full 16-lane passes, then 8-lane passes, then the single-message path for
+// the last < 8 messages. Returns the number of messages already hashed.
+#ifdef SECP256K1_HASH_MULTIBUFFER
+template <typename X16, typename X8>
+static std::size_t multibuffer_passes(const std::uint8_t* in, std::size_t in_len,
+                                      std::uint8_t* out, std::size_t out_len,
+                                      std::size_t count, X16 x16, X8 x8,
+                                      bool allow_x8 = true) noexcept {
+    static const HashTier tier = batch_hash_tier();
+    std::size_t i = 0;
+    if (tier == HashTier::AVX512) {
+        for (; i + 16 <= count; i += 16) x16(in + i * in_len, out + i * out_len);
+    }
+    if (allow_x8 && (tier == HashTier::AVX512 || tier == HashTier::AVX2)) {
+        for (; i + 8 <= count; i += 8) x8(in + i * in_len, out + i * out_len);
+    }
+    return i;
+}
+#endif
+
 void sha256_33_batch(
     const std::uint8_t* pubkeys,
     std::uint8_t* out32s,
     std::size_t count) noexcept
 {
-    // Sequential dispatch per element (SHA-NI or scalar)
-    // Future: AVX2 4-way multi-buffer implementation
-    for (std::size_t i = 0; i < count; ++i) {
+    std::size_t i = 0;
+#ifdef SECP256K1_HASH_MULTIBUFFER
+    // SHA-NI hashes one message about as fast as an 8-lane AVX2 pass does
+    // per lane, so with SHA-NI only the 16-lane kernel is worth the transpose.
+    i = multibuffer_passes(pubkeys, 33, out32s, 32, count,
+                           avx512::sha256_33_x16, avx2::sha256_33_x8,
+                           !sha_ni_available());
+#endif
+    for (; i < count; ++i) {
         sha256_33(pubkeys + i * 33, out32s + i * 32);
     }
 }
@@ -864,7 +1283,12 @@ void ripemd160_32_batch(
     std::uint8_t* out20s,
     std::size_t count) noexcept
 {
-    for (std::size_t i = 0; i < count; ++i) {
+    std::size_t i = 0;
+#ifdef SECP256K1_HASH_MULTIBUFFER
+    i = multibuffer_passes(in32s, 32, out20s, 20, count,
+                           avx512::ripemd160_32_x16, avx2::ripemd160_32_x8);
+#endif
+    for (; i < count; ++i) {
         ripemd160_32(in32s + i * 32, out20s + i * 20);
     }
 }
@@ -874,13 +1298,54 @@ void hash160_33_batch(
     std::uint8_t* out20s,
     std::size_t count) noexcept
 {
-    // Fused pipeline: SHA256 -> RIPEMD160 per element
-    // SHA-NI handles SHA-256 in hardware
-    for (std::size_t i = 0; i < count; ++i) {
+    // Fused pipeline: SHA256 -> RIPEMD160, 16/8 lanes at a time; the tail
+    // goes through SHA-NI (when present) + scalar RIPEMD-160.
+    std::size_t i = 0;
+#ifdef SECP256K1_HASH_MULTIBUFFER
+    i = multibuffer_passes(pubkeys, 33, out20s, 20, count,
+                           avx512::hash160_33_x16, avx2::hash160_33_x8);
+#endif
+    for (; i < count; ++i) {
         hash160_33(pubkeys + i * 33, out20s + i * 20);
     }
 }
 
+void pbkdf2_sha512_iterate_batch(
+    const std::uint64_t (*inner)[8],
+    const std::uint64_t (*outer)[8],
+    std::uint64_t (*t)[8],
+    std::size_t count,
+    std::uint32_t iterations) noexcept
+{
+    std::size_t i = 0;
+#ifdef SECP256K1_HASH_MULTIBUFFER
+    static const HashTier tier = batch_hash_tier();
+    if (tier == HashTier::AVX512) {
+        for (; i + 8 <= count; i += 8) avx512::pbkdf2_sha512_x8(inner + i, outer + i, t + i, iterations);
+    }
+    if (tier == HashTier::AVX512 || tier == HashTier::AVX2) {
+        for (; i + 4 <= count; i += 4) avx2::pbkdf2_sha512_x4(inner + i, outer + i, t + i, iterations);
+    }
+#endif
+    for (; i < count; ++i) {
+        std::uint64_t u[8], w[16];
+        for (int k = 0; k < 8; ++k) u[k] = t[i][k];
+        for (std::uint32_t it = 1; it < iterations; ++it) {
+            std::uint64_t st[8];
+            for (int k = 0; k < 8; ++k) { w[k] = u[k]; st[k] = inner[i][k]; }
+            w[8] = 0x8000000000000000ULL;
+            for (int k = 9; k < 15; ++k) w[k] = 0;
+            w[15] = (128 + 64) * 8;
+            ::secp256k1::SHA512::compress_words(st, w);
+            for (int k = 0; k < 8; ++k) { w[k] = st[k]; u[k] = outer[i][k]; }
+            ::secp256k1::SHA512::compress_words(u, w);
+            for (int k = 0; k < 8; ++k) t[i][k] ^= u[k];
+        }
+        ::secp256k1::detail::secure_erase(u, sizeof(u));
+        ::secp256k1::detail::secure_erase(w, sizeof(w));
+    }
+}
+
 } // namespace secp256k1::hash
 
 // ============================================================================
@@ -23,6 +23,26 @@ ufsecp_error_t ufsecp_hash160(const uint8_t* data, size_t len,
     return UFSECP_OK;
 }
 
+ufsecp_error_t ufsecp_hash160_pubkey_batch(ufsecp_ctx* ctx,
+                                           const uint8_t* pubkeys33,
+                                           size_t count,
+                                           uint8_t* digests20_out) {
+    if (SECP256K1_UNLIKELY(!ctx || !pubkeys33 || !digests20_out)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    if (count == 0) return UFSECP_OK;
+    if (count > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
+    try {
+    // Pieces of >= 256 keys keep the 4/8-lane hash kernels fed; smaller pieces
+    // cost more in hand-off than they save.
+    ctx_pool(ctx).parallel_for(count, 256, [&](size_t begin, size_t end) {
+        secp256k1::hash::hash160_33_batch(pubkeys33 + begin * 33,
+                                          digests20_out + begin * 20,
+                                          end - begin);
+    });
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
+}
+
 ufsecp_error_t ufsecp_tagged_hash(const char* tag,
                                   const uint8_t* data, size_t len,
                                   uint8_t digest32_out[32]) {
@@ -144,6 +144,21 @@ static inline uint64_t siphash_rotl64(uint64_t x, int b) {
     return (x << b) | (x >> (64 - b));
 }
 
+static inline void sip_round(uint64_t& v0, uint64_t& v1, uint64_t& v2, uint64_t& v3) {
+    v0 += v1; v1 = siphash_rotl64(v1, 13); v1 ^= v0; v0 = siphash_rotl64(v0, 32);
+    v2 += v3; v3 = siphash_rotl64(v3, 16); v3 ^= v2;
+    v0 += v3; v3 = siphash_rotl64(v3, 21); v3 ^= v0;
+    v2 += v1; v1 = siphash_rotl64(v1, 17); v1 ^= v2; v2 = siphash_rotl64(v2, 32);
+}
+
+// Final SipHash word: trailing (len % 8) bytes plus the length byte.
+static inline uint64_t siphash_last_word(const uint8_t* data, size_t len) {
+    size_t const i = len & ~size_t{7};
+    uint64_t last = static_cast<uint64_t>(len & 0xff) << 56;
+    for (size_t j = 0; j < len - i; ++j) last |= static_cast<uint64_t>(data[i + j]) << (j * 8);
+    return last;
+}
+
 static uint64_t siphash24(const uint8_t key[16], const uint8_t* data, size_t len) {
     uint64_t k0, k1;
     std::memcpy(&k0, key, 8);
@@ -154,111 +169,318 @@ static uint64_t siphash24(const uint8_t key[16], const uint8_t* data, size_t len
     uint64_t v2 = k0 ^ 0x6c7967656e657261ULL;
     uint64_t v3 = k1 ^ 0x7465646279746573ULL;
 
-    auto sipround = [&]() {
-        v0 += v1; v1 = siphash_rotl64(v1, 13); v1 ^= v0; v0 = siphash_rotl64(v0, 32);
-        v2 += v3; v3 = siphash_rotl64(v3, 16); v3 ^= v2;
-        v0 += v3; v3 = siphash_rotl64(v3, 21); v3 ^= v0;
-        v2 += v1; v1 = siphash_rotl64(v1, 17); v1 ^= v2; v2 = siphash_rotl64(v2, 32);
-    };
-
     size_t i = 0;
     for (; i + 8 <= len; i += 8) {
         uint64_t m;
         std::memcpy(&m, data + i, 8);
         v3 ^= m;
-        sipround(); sipround();
+        sip_round(v0, v1, v2, v3); sip_round(v0, v1, v2, v3);
         v0 ^= m;
     }
-    // Remaining bytes + length byte
-    uint64_t last = static_cast<uint64_t>(len & 0xff) << 56;
-    size_t rem = len - i;
-    for (size_t j = 0; j < rem; ++j) last |= static_cast<uint64_t>(data[i + j]) << (j * 8);
+    uint64_t const last = siphash_last_word(data, len);
     v3 ^= last;
-    sipround(); sipround();
+    sip_round(v0, v1, v2, v3); sip_round(v0, v1, v2, v3);
     v0 ^= last;
     v2 ^= 0xff;
-    sipround(); sipround(); sipround(); sipround();
+    sip_round(v0, v1, v2, v3); sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3); sip_round(v0, v1, v2, v3);
     return v0 ^ v1 ^ v2 ^ v3;
 }
 
+// Four SipHash-2-4 evaluations in lock-step, one item per lane. The lane
+// loops compile to 256-bit vector ops; a lane whose item has fewer blocks
+// keeps its state (masked) until the longest item is done, then all four
+// finalise together. Scripts in a block are mostly 22-34 bytes, so lanes
+// rarely idle.
+static void siphash24_x4(const uint8_t key[16], const uint8_t* const data[4],
+                         const size_t len[4], uint64_t out[4]) {
+    constexpr size_t L = 4;
+    uint64_t k0, k1;
+    std::memcpy(&k0, key, 8);
+    std::memcpy(&k1, key + 8, 8);
+
+    uint64_t v0[L], v1[L], v2[L], v3[L], last[L];
+    size_t blocks[L];
+    size_t max_blocks = 0;
+    for (size_t l = 0; l < L; ++l) {
+        v0[l] = k0 ^ 0x736f6d6570736575ULL;
+        v1[l] = k1 ^ 0x646f72616e646f6dULL;
+        v2[l] = k0 ^ 0x6c7967656e657261ULL;
+        v3[l] = k1 ^ 0x7465646279746573ULL;
+        blocks[l] = len[l] / 8;
+        last[l] = siphash_last_word(data[l], len[l]);
+        max_blocks = std::max(max_blocks, blocks[l]);
+    }
+
+    auto rounds_x4 = [&](uint64_t* a0, uint64_t* a1, uint64_t* a2, uint64_t* a3) {
+        for (size_t l = 0; l < L; ++l) sip_round(a0[l], a1[l], a2[l], a3[l]);
+    };
+
+    // Block b of every lane; the length word is block `blocks[l]`.
+    for (size_t b = 0; b <= max_blocks; ++b) {
+        uint64_t m[L], keep[L], a0[L], a1[L], a2[L], a3[L];
+        for (size_t l = 0; l < L; ++l) {
+            if (b < blocks[l]) std::memcpy(&m[l], data[l] + 8 * b, 8);
+            else               m[l] = last[l];
+            keep[l] = b <= blocks[l] ? ~uint64_t{0} : 0;
+        }
+        for (size_t l = 0; l < L; ++l) {
+            a0[l] = v0[l]; a1[l] = v1[l]; a2[l] = v2[l]; a3[l] = v3[l] ^ m[l];
+        }
+        rounds_x4(a0, a1, a2, a3);
+        rounds_x4(a0, a1, a2, a3);
+        for (size_t l = 0; l < L; ++l) {
+            a0[l] ^= m[l];
+            v0[l] = (a0[l] & keep[l]) | (v0[l] & ~keep[l]);
+            v1[l] = (a1[l] & keep[l]) | (v1[l] & ~keep[l]);
+            v2[l] = (a2[l] & keep[l]) | (v2[l] & ~keep[l]);
+            v3[l] = (a3[l] & keep[l]) | (v3[l] & ~keep[l]);
+        }
+    }
+
+    for (size_t l = 0; l < L; ++l) v2[l] ^= 0xff;
+    for (int r = 0; r < 4; ++r) rounds_x4(v0, v1, v2, v3);
+    for (size_t l = 0; l < L; ++l) out[l] = v0[l] ^ v1[l] ^ v2[l] ^ v3[l];
+}
+
+// SipHash every item under `key`, four at a time.
+static void siphash24_many(const uint8_t key[16], const uint8_t* const* data,
+                           const size_t* sizes, size_t count, uint64_t* out) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) siphash24_x4(key, data + i, sizes + i, out + i);
+    for (; i < count; ++i) out[i] = siphash24(key, data[i], sizes[i]);
+}
+
 } // anonymous namespace
 
 static constexpr uint64_t GCS_P = 19;
 static constexpr uint64_t GCS_M = 784931ULL;
 
-// Encode a GCS filter: sort, delta-encode, Golomb-Rice encode with P=19
-static bool gcs_encode(const std::vector<uint64_t>& values,
-                        uint8_t* out, size_t* out_len) {
-    std::vector<uint64_t> sorted = values;
-    std::sort(sorted.begin(), sorted.end());
+// LSD radix sort of values below 2^bits, 11-bit digits (8 KB of counters
+// per pass, all passes counted in one read). Only the digits that can be non-zero are sorted, so
+// a filter of N < 2^12 items (values < N*M < 2^32) takes three passes. Small
+// inputs go to std::sort. `tmp` is scratch of n values.
+static void gcs_radix_sort(uint64_t* v, uint64_t* tmp, size_t n, unsigned bits) {
+    constexpr unsigned kDigit = 11;
+    constexpr size_t   kBins  = size_t{1} << kDigit;
+    if (n < 256) {
+        std::sort(v, v + n);
+        return;
+    }
+    unsigned const passes = bits == 0 ? 0 : (bits + kDigit - 1) / kDigit;
+    static thread_local std::vector<uint32_t> hist;
+    hist.assign(static_cast<size_t>(passes) * kBins, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (unsigned p = 0; p < passes; ++p) {
+            ++hist[p * kBins + ((v[i] >> (p * kDigit)) & (kBins - 1))];
+        }
+    }
+    uint64_t* src = v;
+    uint64_t* dst = tmp;
+    for (unsigned p = 0; p < passes; ++p) {
+        uint32_t* h = hist.data() + p * kBins;
+        if (h[(src[0] >> (p * kDigit)) & (kBins - 1)] == n) continue;   // digit constant
+        uint32_t sum = 0;
+        for (size_t b = 0; b < kBins; ++b) {
+            uint32_t const c = h[b];
+            h[b] = sum;
+            sum += c;
+        }
+        for (size_t i = 0; i < n; ++i) dst[h[(src[i] >> (p * kDigit)) & (kBins - 1)]++] = src[i];
+        std::swap(src, dst);
+    }
+    if (src != v) std::memcpy(v, src, n * sizeof(uint64_t));
+}
 
-    // Golomb-Rice encode: quotient (unary) + P-bit remainder
-    // Pack bits into bytes
-    std::vector<uint8_t> bits;
-    bits.reserve(sorted.size() * 4);
+namespace {
 
-    uint64_t prev = 0;
-    for (uint64_t v : sorted) {
-        uint64_t delta = v - prev;
-        prev = v;
-        uint64_t q = delta >> GCS_P;
-        uint64_t r = delta & ((1ULL << GCS_P) - 1);
-        // Write q ones then a zero (unary)
-        for (uint64_t i = 0; i < q; ++i) bits.push_back(1);
-        bits.push_back(0);
-        // Write P-bit remainder, MSB first
-        for (int i = static_cast<int>(GCS_P) - 1; i >= 0; --i) {
-            bits.push_back(static_cast<uint8_t>((r >> i) & 1));
+// Golomb-Rice bit writer into caller memory, the mirror of GcsReader: bits
+// collect left-aligned in one word, and whole bytes leave as one big-endian
+// 8-byte store while at least 8 bytes of the (exactly sized) output remain.
+// Bytes past the write position are rewritten by the next store, so the
+// zero tail of the word is harmless.
+class GcsWriter {
+public:
+    GcsWriter(uint8_t* out, size_t len) noexcept : p_(out), end_(out + len) {}
+
+    void put(uint64_t value, size_t q) noexcept {
+        for (; q >= 32; q -= 32) append(0xFFFFFFFFULL, 32);
+        // q ones, a zero, then the P-bit remainder: at most 31 + 1 + 19 bits
+        append((((uint64_t{1} << q) - 1) << (GCS_P + 1)) | value, static_cast<unsigned>(q + 1 + GCS_P));
+    }
+
+    void finish() noexcept {
+        flush();
+        while (fill_ > 0 && p_ < end_) {
+            *p_++ = static_cast<uint8_t>(acc_ >> 56);
+            acc_ <<= 8;
+            fill_ = fill_ > 8 ? fill_ - 8 : 0;
         }
     }
 
-    // Pack bits into bytes
-    size_t nbytes = (bits.size() + 7) / 8;
-    if (*out_len < nbytes) return false;
-    std::memset(out, 0, nbytes);
-    for (size_t i = 0; i < bits.size(); ++i) {
-        if (bits[i]) out[i / 8] |= static_cast<uint8_t>(0x80u >> (i % 8));
+private:
+    void append(uint64_t bits, unsigned n) noexcept {   // n <= 51, fill_ <= 7
+        acc_ |= bits << (64 - fill_ - n);
+        fill_ += n;
+        flush();
     }
-    *out_len = nbytes;
-    return true;
-}
 
-static bool gcs_decode(const uint8_t* filter, size_t filter_len, size_t n_items,
-                        std::vector<uint64_t>& out) {
-    out.clear();
-    out.reserve(n_items);
+    void flush() noexcept {
+        if (end_ - p_ >= 8) {
+            for (int i = 0; i < 8; ++i) p_[i] = static_cast<uint8_t>(acc_ >> (56 - 8 * i));
+            p_    += fill_ >> 3;
+            acc_ <<= fill_ & ~7u;
+            fill_ &= 7;
+        } else {
+            while (fill_ >= 8 && p_ < end_) {
+                *p_++ = static_cast<uint8_t>(acc_ >> 56);
+                acc_ <<= 8;
+                fill_ -= 8;
+            }
+        }
+    }
 
-    // Unpack bits
-    size_t bit_pos = 0;
-    auto read_bit = [&]() -> int {
-        if (bit_pos / 8 >= filter_len) return -1;
-        return (filter[bit_pos / 8] >> (7 - (bit_pos % 8))) & 1;
-    };
+    uint8_t*       p_;
+    uint8_t* const end_;
+    uint64_t       acc_  = 0;
+    unsigned       fill_ = 0;
+};
 
+} // anonymous namespace
+
+// Golomb-Rice encode values sorted ascending. Returns the encoded size in
+// bytes; the filter is written to out only if it fits in `cap`.
+static size_t gcs_encode_sorted(const uint64_t* sorted, size_t n, uint8_t* out, size_t cap) {
+    uint64_t bits = static_cast<uint64_t>(n) * (GCS_P + 1);
     uint64_t prev = 0;
-    for (size_t i = 0; i < n_items; ++i) {
-        // Read unary quotient
+    for (size_t i = 0; i < n; ++i) {
+        bits += (sorted[i] - prev) >> GCS_P;
+        prev = sorted[i];
+    }
+    size_t const nbytes = static_cast<size_t>((bits + 7) / 8);
+    if (nbytes > cap) return nbytes;
+
+    GcsWriter writer(out, nbytes);
+    prev = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t const delta = sorted[i] - prev;
+        prev = sorted[i];
+        writer.put(delta & ((1ULL << GCS_P) - 1), static_cast<size_t>(delta >> GCS_P));
+    }
+    writer.finish();
+    return nbytes;
+}
+
+// Hash every item into [0, N*M) and sort: the set a filter of `count` items
+// encodes.
+static void gcs_hashed_set(const uint8_t key[16],
+                           const uint8_t* const* data, const size_t* sizes, size_t count,
+                           std::vector<uint64_t>& values, std::vector<uint64_t>& scratch) {
+    uint64_t const modulus = static_cast<uint64_t>(count) * GCS_M;
+    values.resize(count);
+    scratch.resize(count);
+    siphash24_many(key, data, sizes, count, values.data());
+    for (uint64_t& v : values) v = mulhi64(v, modulus);
+    gcs_radix_sort(values.data(), scratch.data(), count,
+                   static_cast<unsigned>(std::bit_width(modulus)));
+}
+
+namespace {
+
+// Lazy Golomb-Rice reader over a BIP-158 bit stream (MSB-first). Keeps up to
+// 63 unread bits left-aligned in one word and refills a whole big-endian word
+// at a time, so the unary quotient is one countl_one and the remainder one
+// shift. Bits below `avail_` are either zero or the next stream bits, which
+// makes the OR in refill() idempotent.
+class GcsReader {
+public:
+    GcsReader(const uint8_t* data, size_t len) noexcept : p_(data), end_(data + len) {}
+
+    // Next absolute value of the set; false if the stream ends first.
+    bool next(uint64_t& value) noexcept {
         uint64_t q = 0;
-        while (true) {
-            int b = read_bit();
-            if (b < 0) return false;
-            ++bit_pos;
-            if (b == 0) break;
-            ++q;
+        for (;;) {
+            if (avail_ == 0 && !refill()) return false;
+            unsigned const ones = static_cast<unsigned>(std::countl_one(buf_));
+            if (ones < avail_) {
+                q += ones;
+                consume(ones + 1);
+                break;
+            }
+            q += avail_;
+            consume(avail_);
         }
-        // Read P-bit remainder
-        uint64_t r = 0;
-        for (size_t j = 0; j < GCS_P; ++j) {
-            int b = read_bit();
-            if (b < 0) return false;
-            ++bit_pos;
-            r = (r << 1) | static_cast<uint64_t>(b);
+        if (avail_ < GCS_P && (!refill() || avail_ < GCS_P)) return false;
+        uint64_t const r = buf_ >> (64 - GCS_P);
+        consume(static_cast<unsigned>(GCS_P));
+        prev_ += (q << GCS_P) | r;
+        value = prev_;
+        return true;
+    }
+
+private:
+    bool refill() noexcept {
+        if (end_ - p_ >= 8) {
+            uint64_t w = 0;
+            for (int i = 0; i < 8; ++i) w = (w << 8) | p_[i];
+            buf_ |= w >> avail_;
+            p_ += (63 - avail_) >> 3;
+            avail_ |= 56;
+        } else {
+            while (avail_ < 56 && p_ < end_) {
+                buf_ |= static_cast<uint64_t>(*p_++) << (56 - avail_);
+                avail_ += 8;
+            }
         }
-        uint64_t delta = (q << GCS_P) | r;
-        prev += delta;
-        out.push_back(prev);
+        return avail_ != 0;
+    }
+
+    void consume(unsigned n) noexcept {   // n <= avail_ <= 63
+        buf_ <<= n;
+        avail_ -= n;
     }
-    return true;
+
+    const uint8_t* p_;
+    const uint8_t* end_;
+    uint64_t       buf_   = 0;
+    unsigned       avail_ = 0;
+    uint64_t       prev_  = 0;
+};
+
+} // anonymous namespace
+
+// SipHash every query item and sort the raw hashes. mulhi64(h, N*M) is
+// monotone in h, so one sorted list serves filters of any size under `key`.
+static void gcs_hash_sorted(const uint8_t key[16],
+                             const uint8_t** query, const size_t* query_sizes,
+                             size_t query_count, std::vector<uint64_t>& out) {
+    static thread_local std::vector<uint64_t> scratch;
+    out.resize(query_count);
+    scratch.resize(query_count);
+    siphash24_many(key, query, query_sizes, query_count, out.data());
+    gcs_radix_sort(out.data(), scratch.data(), query_count, 64);
+}
+
+// Merge-join the filter stream against sorted query hashes; stops at the
+// first hit or once every query target is behind the stream.
+static ufsecp_error_t gcs_match_sorted(const uint8_t* filter, size_t filter_len,
+                                       size_t n_items,
+                                       const uint64_t* hashes, size_t count) noexcept {
+    if (count == 0 || n_items == 0) return UFSECP_ERR_NOT_FOUND;
+    uint64_t const modulus = static_cast<uint64_t>(n_items) * GCS_M;
+    GcsReader reader(filter, filter_len);
+    size_t qi = 0;
+    uint64_t target = mulhi64(hashes[0], modulus);
+    for (size_t i = 0; i < n_items; ++i) {
+        uint64_t v;
+        if (!reader.next(v)) return UFSECP_ERR_BAD_INPUT;
+        while (target < v) {
+            if (++qi == count) return UFSECP_ERR_NOT_FOUND;
+            target = mulhi64(hashes[qi], modulus);
+        }
+        if (target == v) return UFSECP_OK;
+    }
+    return UFSECP_ERR_NOT_FOUND;
 }
 
 ufsecp_error_t ufsecp_gcs_build(
@@ -270,21 +492,59 @@ ufsecp_error_t ufsecp_gcs_build(
     if (SECP256K1_UNLIKELY(!data_sizes && count > 0)) return UFSECP_ERR_NULL_ARG;
 
     try {
-    uint64_t const modulus = static_cast<uint64_t>(count) * GCS_M;
-    std::vector<uint64_t> hashed;
-    hashed.reserve(count);
+    static thread_local std::vector<uint64_t> values, scratch;
+    gcs_hashed_set(key, data, data_sizes, count, values, scratch);
+    size_t const need = gcs_encode_sorted(values.data(), count, filter_out, *filter_len);
+    if (need > *filter_len) return UFSECP_ERR_BUF_TOO_SMALL;
+    *filter_len = need;
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(nullptr)
+}
+
+ufsecp_error_t ufsecp_gcs_build_batch(
+    ufsecp_ctx* ctx,
+    const uint8_t* keys16,
+    const uint8_t** data, const size_t* data_sizes,
+    const size_t* item_counts, size_t filter_count,
+    uint8_t* filters_out, size_t filter_stride,
+    size_t* filter_lens_out) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    if (filter_count == 0) return UFSECP_OK;
+    if (SECP256K1_UNLIKELY(!keys16 || !item_counts || !filters_out || !filter_lens_out)) {
+        return UFSECP_ERR_NULL_ARG;
+    }
 
-    for (size_t i = 0; i < count; ++i) {
-        uint64_t h = siphash24(key, data[i], data_sizes[i]);
-        // Reduce modulo N*M using multiplication technique to avoid bias
-        hashed.push_back(mulhi64(h, modulus));
+    try {
+    // Filter i encodes items [first[i], first[i + 1]).
+    std::vector<size_t> first(filter_count + 1);
+    for (size_t i = 0; i < filter_count; ++i) {
+        if (item_counts[i] > SIZE_MAX - first[i]) {
+            return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "GCS item count overflow");
+        }
+        first[i + 1] = first[i] + item_counts[i];
+    }
+    if (SECP256K1_UNLIKELY((!data || !data_sizes) && first[filter_count] > 0)) {
+        return UFSECP_ERR_NULL_ARG;
     }
 
-    if (!gcs_encode(hashed, filter_out, filter_len)) {
-        return UFSECP_ERR_BUF_TOO_SMALL;
+    std::atomic<bool> too_small{false};
+    ctx_pool(ctx).parallel_for(filter_count, 0, [&](size_t begin, size_t end) {
+        static thread_local std::vector<uint64_t> values, scratch;
+        for (size_t i = begin; i < end; ++i) {
+            gcs_hashed_set(keys16 + 16 * i, data + first[i], data_sizes + first[i],
+                           item_counts[i], values, scratch);
+            filter_lens_out[i] = gcs_encode_sorted(values.data(), item_counts[i],
+                                                   filters_out + i * filter_stride,
+                                                   filter_stride);
+            if (filter_lens_out[i] > filter_stride) too_small.store(true, std::memory_order_relaxed);
+        }
+    });
+    if (too_small.load()) {
+        return ctx_set_err(ctx, UFSECP_ERR_BUF_TOO_SMALL, "GCS filter exceeds filter_stride");
     }
     return UFSECP_OK;
-    } UFSECP_CATCH_RETURN(nullptr)
+    } UFSECP_CATCH_RETURN(ctx)
 }
 
 ufsecp_error_t ufsecp_gcs_match(
@@ -294,22 +554,8 @@ ufsecp_error_t ufsecp_gcs_match(
     const uint8_t* item, size_t item_len) {
     if (SECP256K1_UNLIKELY(!key || !filter || !item)) return UFSECP_ERR_NULL_ARG;
 
-    try {
-    std::vector<uint64_t> decoded;
-    if (!gcs_decode(filter, filter_len, n_items, decoded)) {
-        return UFSECP_ERR_BAD_INPUT;
-    }
-
-    uint64_t const modulus = static_cast<uint64_t>(n_items) * GCS_M;
-    uint64_t h = siphash24(key, item, item_len);
-    uint64_t target = mulhi64(h, modulus);
-
-    for (uint64_t v : decoded) {
-        if (v == target) return UFSECP_OK;
-        if (v > target) break;
-    }
-    return UFSECP_ERR_NOT_FOUND;
-    } UFSECP_CATCH_RETURN(nullptr)
+    uint64_t const h = siphash24(key, item, item_len);
+    return gcs_match_sorted(filter, filter_len, n_items, &h, 1);
 }
 
 ufsecp_error_t ufsecp_gcs_match_any(
@@ -322,22 +568,52 @@ ufsecp_error_t ufsecp_gcs_match_any(
     if (SECP256K1_UNLIKELY(!query_sizes && query_count > 0)) return UFSECP_ERR_NULL_ARG;
 
     try {
-    std::vector<uint64_t> decoded;
-    if (!gcs_decode(filter, filter_len, n_items, decoded)) {
-        return UFSECP_ERR_BAD_INPUT;
+    static thread_local std::vector<uint64_t> hashes;
+    gcs_hash_sorted(key, query, query_sizes, query_count, hashes);
+    return gcs_match_sorted(filter, filter_len, n_items, hashes.data(), hashes.size());
+    } UFSECP_CATCH_RETURN(nullptr)
+}
+
+ufsecp_error_t ufsecp_gcs_match_any_batch(
+    ufsecp_ctx* ctx,
+    const uint8_t* keys16,
+    const uint8_t* const* filters, const size_t* filter_lens,
+    const size_t* n_items, size_t filter_count,
+    const uint8_t** query, const size_t* query_sizes, size_t query_count,
+    uint8_t* matches_out) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    if (filter_count == 0) return UFSECP_OK;
+    if (SECP256K1_UNLIKELY(!keys16 || !filters || !filter_lens || !n_items || !matches_out)) {
+        return UFSECP_ERR_NULL_ARG;
+    }
+    if (SECP256K1_UNLIKELY((!query || !query_sizes) && query_count > 0)) return UFSECP_ERR_NULL_ARG;
+    for (size_t i = 0; i < filter_count; ++i) {
+        if (!filters[i]) return ctx_set_err(ctx, UFSECP_ERR_NULL_ARG, "NULL filter in batch");
     }
 
-    uint64_t const modulus = static_cast<uint64_t>(n_items) * GCS_M;
-    for (size_t qi = 0; qi < query_count; ++qi) {
-        uint64_t h = siphash24(key, query[qi], query_sizes[qi]);
-        uint64_t target = mulhi64(h, modulus);
-        for (uint64_t v : decoded) {
-            if (v == target) return UFSECP_OK;
-            if (v > target) break;
+    try {
+    std::atomic<bool> malformed{false};
+    ctx_pool(ctx).parallel_for(filter_count, 0, [&](size_t begin, size_t end) {
+        // Consecutive filters under the same key (e.g. one block's basic and
+        // extended filters) reuse the hashed query set.
+        static thread_local std::vector<uint64_t> hashes;
+        const uint8_t* hashed_key = nullptr;
+        for (size_t i = begin; i < end; ++i) {
+            const uint8_t* key = keys16 + 16 * i;
+            if (!hashed_key || std::memcmp(hashed_key, key, 16) != 0) {
+                gcs_hash_sorted(key, query, query_sizes, query_count, hashes);
+                hashed_key = key;
+            }
+            ufsecp_error_t const rc = gcs_match_sorted(filters[i], filter_lens[i], n_items[i],
+                                                       hashes.data(), hashes.size());
+            matches_out[i] = rc == UFSECP_OK ? 1 : 0;
+            if (rc == UFSECP_ERR_BAD_INPUT) malformed.store(true, std::memory_order_relaxed);
         }
-    }
-    return UFSECP_ERR_NOT_FOUND;
-    } UFSECP_CATCH_RETURN(nullptr)
+    });
+    if (malformed.load()) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "GCS filter truncated");
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
 }
 
 /* ===========================================================================
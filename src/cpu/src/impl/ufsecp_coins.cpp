@@ -394,6 +394,53 @@ ufsecp_error_t ufsecp_silent_payment_scan(
     } UFSECP_CATCH_RETURN(ctx)
 }
 
+ufsecp_error_t ufsecp_silent_payment_scan_batch(
+    ufsecp_ctx* ctx,
+    const uint8_t scan_privkey[32],
+    const uint8_t spend_pubkey33[33],
+    const uint8_t* tweak_pubkeys33, size_t n_tweaks,
+    uint64_t* prefix64_out) {
+    if (SECP256K1_UNLIKELY(!ctx || !scan_privkey || !spend_pubkey33 ||
+        !tweak_pubkeys33 || !prefix64_out)) {
+        return UFSECP_ERR_NULL_ARG;
+    }
+    ctx_clear_err(ctx);
+    if (n_tweaks == 0) return UFSECP_OK;
+    if (n_tweaks > kMaxBatchN)
+        return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "tweak count too large");
+    // Fail-closed: no stale prefixes survive an error.
+    std::memset(prefix64_out, 0, n_tweaks * sizeof(uint64_t));
+    try {
+
+    Scalar scan_sk;
+    ScopeSecureErase<Scalar> scan_sk_erase{&scan_sk, sizeof(scan_sk)};
+    if (SECP256K1_UNLIKELY(!scalar_parse_strict_nonzero(scan_privkey, scan_sk))) {
+        return ctx_set_err(ctx, UFSECP_ERR_BAD_KEY, "scan privkey is zero or >= n");
+    }
+    const Point spend_pk = point_from_compressed(spend_pubkey33);
+    if (spend_pk.is_infinity()) {
+        return ctx_set_err(ctx, UFSECP_ERR_BAD_PUBKEY, "invalid spend pubkey");
+    }
+
+    auto& pool = ctx_pool(ctx);
+    std::vector<Point> tweaks(n_tweaks);
+    std::atomic<bool> bad{false};
+    pool.parallel_for(n_tweaks, 0, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            tweaks[i] = point_from_compressed(tweak_pubkeys33 + i * 33);
+            if (tweaks[i].is_infinity()) bad.store(true, std::memory_order_relaxed);
+        }
+    });
+    if (bad.load(std::memory_order_relaxed)) {
+        return ctx_set_err(ctx, UFSECP_ERR_BAD_PUBKEY, "invalid tweak pubkey");
+    }
+
+    secp256k1::fast_scan_prefix_batch(scan_sk, spend_pk, tweaks.data(), n_tweaks,
+                                      prefix64_out, &pool);
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
+}
+
 /* ===========================================================================
  * ECIES (Elliptic Curve Integrated Encryption Scheme)
  * =========================================================================== */
@@ -528,24 +575,92 @@ ufsecp_error_t ufsecp_bip324_handshake(
     return UFSECP_OK;
 }
 
+ufsecp_error_t ufsecp_bip324_handshake_batch(
+    ufsecp_ctx* ctx,
+    ufsecp_bip324_session* const* sessions,
+    const uint8_t* peer_ellswift64s,
+    size_t count,
+    uint8_t* session_ids32_out,
+    uint8_t* ok_out) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    if (count == 0) return UFSECP_OK;
+    if (SECP256K1_UNLIKELY(!sessions || !peer_ellswift64s)) return UFSECP_ERR_NULL_ARG;
+    if (count > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
+    try {
+
+    std::vector<secp256k1::Bip324Session*> cpp(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (!sessions[i] || !sessions[i]->cpp_session) {
+            return ctx_set_err(ctx, UFSECP_ERR_NULL_ARG, "NULL session in batch");
+        }
+        cpp[i] = sessions[i]->cpp_session;
+    }
+
+    std::vector<uint8_t> ok(count);
+    size_t const established = secp256k1::Bip324Session::complete_handshakes(
+        cpp.data(), peer_ellswift64s, count, ctx_pool(ctx), ok.data());
+
+    for (size_t i = 0; i < count; ++i) {
+        if (session_ids32_out) {
+            if (ok[i]) std::memcpy(session_ids32_out + 32 * i, cpp[i]->session_id().data(), 32);
+            else std::memset(session_ids32_out + 32 * i, 0, 32);
+        }
+        if (ok_out) ok_out[i] = ok[i];
+    }
+    if (established != count) {
+        return ctx_set_err(ctx, UFSECP_ERR_INTERNAL, "BIP-324 handshake failed");
+    }
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
+}
+
 ufsecp_error_t ufsecp_bip324_encrypt(
     ufsecp_bip324_session* session,
     const uint8_t* plaintext, size_t plaintext_len,
     uint8_t* out, size_t* out_len) {
-    if (SECP256K1_UNLIKELY(!session || !session->cpp_session || !out || !out_len)) return UFSECP_ERR_NULL_ARG;
     if (SECP256K1_UNLIKELY(!plaintext && plaintext_len > 0)) return UFSECP_ERR_NULL_ARG;
-    if (plaintext_len > SIZE_MAX - 19) return UFSECP_ERR_BAD_INPUT;
+    ufsecp_bip324_segment const part{plaintext, plaintext_len};
+    return ufsecp_bip324_encrypt_v(session, &part, 1, out, out_len);
+}
+
+ufsecp_error_t ufsecp_bip324_encrypt_v(
+    ufsecp_bip324_session* session,
+    const ufsecp_bip324_segment* parts, size_t part_count,
+    uint8_t* out, size_t* out_len) {
+    if (SECP256K1_UNLIKELY(!session || !session->cpp_session || !out || !out_len)) return UFSECP_ERR_NULL_ARG;
+    if (SECP256K1_UNLIKELY(!parts && part_count > 0)) return UFSECP_ERR_NULL_ARG;
+
+    using Cipher = secp256k1::Bip324Cipher;
+    size_t payload_len = 0;
+    for (size_t i = 0; i < part_count; ++i) {
+        if (SECP256K1_UNLIKELY(!parts[i].data && parts[i].len > 0)) return UFSECP_ERR_NULL_ARG;
+        if (parts[i].len > Cipher::kMaxPayload - payload_len) return UFSECP_ERR_BAD_INPUT;
+        payload_len += parts[i].len;
+    }
 
-    size_t const needed = plaintext_len + 19; // 3 (length) + payload + 16 (tag)
+    size_t const needed = payload_len + Cipher::kPacketOverhead; // 3 (length) + payload + 16 (tag)
     if (*out_len < needed) return UFSECP_ERR_BUF_TOO_SMALL;
-    try {
-    auto enc = session->cpp_session->encrypt(plaintext, plaintext_len);
-    if (enc.empty()) return UFSECP_ERR_INTERNAL;
 
-    std::memcpy(out, enc.data(), enc.size());
-    *out_len = enc.size();
+    // Convert the C segments field by field; the usual header + body packet
+    // fits the stack array, longer gather lists go to the heap.
+    constexpr size_t kStackParts = 16;
+    secp256k1::AeadSegment stack_segs[kStackParts]{};
+    std::vector<secp256k1::AeadSegment> heap_segs;
+    secp256k1::AeadSegment* segs = stack_segs;
+    if (part_count > kStackParts) {
+        try {
+            heap_segs.resize(part_count);
+        } catch (...) {
+            return UFSECP_ERR_INTERNAL;
+        }
+        segs = heap_segs.data();
+    }
+    for (size_t i = 0; i < part_count; ++i) segs[i] = {parts[i].data, parts[i].len};
+    size_t const written = session->cpp_session->encrypt_into(segs, part_count, out, *out_len);
+    if (written == 0) return UFSECP_ERR_INTERNAL;
+    *out_len = written;
     return UFSECP_OK;
-    } catch (...) { return UFSECP_ERR_INTERNAL; }
 }
 
 ufsecp_error_t ufsecp_bip324_decrypt(
@@ -557,21 +672,36 @@ ufsecp_error_t ufsecp_bip324_decrypt(
 
     // encrypted = [3B header][payload][16B tag], minimum length 19
     if (encrypted_len < 19) return UFSECP_ERR_BUF_TOO_SMALL;
+    if (*plaintext_len < encrypted_len - 19) return UFSECP_ERR_BUF_TOO_SMALL;
 
     const uint8_t* header = encrypted;
     const uint8_t* payload_tag = encrypted + 3;
     const size_t payload_tag_len = encrypted_len - 3;
-    try {
-    std::vector<uint8_t> dec;
-    if (!session->cpp_session->decrypt(header, payload_tag, payload_tag_len, dec)) {
+    size_t payload_len = 0;
+    if (!session->cpp_session->decrypt_into(header, payload_tag, payload_tag_len,
+                                            plaintext_out, *plaintext_len, payload_len)) {
         return UFSECP_ERR_VERIFY_FAIL;
     }
+    *plaintext_len = payload_len;
+    return UFSECP_OK;
+}
+
+ufsecp_error_t ufsecp_bip324_decrypt_in_place(
+    ufsecp_bip324_session* session,
+    uint8_t* packet, size_t packet_len,
+    size_t* payload_len_out) {
+    if (!session || !session->cpp_session || !packet || !payload_len_out)
+        return UFSECP_ERR_NULL_ARG;
+    *payload_len_out = 0;
+
+    if (packet_len < 19) return UFSECP_ERR_BUF_TOO_SMALL;
 
-    if (*plaintext_len < dec.size()) return UFSECP_ERR_BUF_TOO_SMALL;
-    if (dec.size() > 0) std::memcpy(plaintext_out, dec.data(), dec.size());
-    *plaintext_len = dec.size();
+    size_t payload_len = 0;
+    if (!session->cpp_session->decrypt_in_place(packet, packet_len, payload_len)) {
+        return UFSECP_ERR_VERIFY_FAIL;
+    }
+    *payload_len_out = payload_len;
     return UFSECP_OK;
-    } catch (...) { return UFSECP_ERR_INTERNAL; }
 }
 
 void ufsecp_bip324_destroy(ufsecp_bip324_session* session) {
@@ -786,6 +916,33 @@ ufsecp_error_t ufsecp_eth_ecrecover(ufsecp_ctx* ctx,
     return UFSECP_OK;
 }
 
+ufsecp_error_t ufsecp_eth_ecrecover_batch(ufsecp_ctx* ctx,
+                                          const uint8_t* msgs32,
+                                          const uint8_t* rs32,
+                                          const uint8_t* ss32,
+                                          const uint64_t* vs,
+                                          size_t count,
+                                          uint8_t* addrs20_out,
+                                          uint8_t* valid_out) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    if (count == 0) return UFSECP_OK;
+    if (SECP256K1_UNLIKELY(!msgs32 || !rs32 || !ss32 || !vs || !addrs20_out || !valid_out)) {
+        return UFSECP_ERR_NULL_ARG;
+    }
+    if (count > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
+    try {
+    // Pieces of >= 256 signatures keep the shared inversions and the 4-way
+    // Keccak amortized.
+    ctx_pool(ctx).parallel_for(count, 256, [&](size_t begin, size_t end) {
+        (void)secp256k1::coins::ecrecover_batch(msgs32 + begin * 32, rs32 + begin * 32,
+                                                ss32 + begin * 32, vs + begin, end - begin,
+                                                addrs20_out + begin * 20, valid_out + begin);
+    });
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
+}
+
 #endif /* SECP256K1_BUILD_ETHEREUM */
 
 /* ===========================================================================
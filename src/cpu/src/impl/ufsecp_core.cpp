@@ -76,6 +76,7 @@ ufsecp_error_t ufsecp_ctx_clone(const ufsecp_ctx* src, ufsecp_ctx** ctx_out) {
     dst->last_err.store(UFSECP_OK, std::memory_order_relaxed);
     dst->last_msg[0] = '\0';
     dst->selftest_ok = src->selftest_ok;
+    dst->pool        = src->pool;  // clones share the attached pool
 
     *ctx_out = dst;
     return UFSECP_OK;
@@ -102,6 +103,60 @@ size_t ufsecp_ctx_size(void) {
     return sizeof(ufsecp_ctx);
 }
 
+/* ===========================================================================
+ * Thread pool
+ * =========================================================================== */
+
+ufsecp_error_t ufsecp_thread_pool_create(unsigned n_threads,
+                                         const int* cpu_ids,
+                                         size_t n_cpu_ids,
+                                         ufsecp_thread_pool** pool_out) {
+    if (SECP256K1_UNLIKELY(!pool_out)) return UFSECP_ERR_NULL_ARG;
+    *pool_out = nullptr;
+    if (SECP256K1_UNLIKELY(n_cpu_ids != 0 && !cpu_ids)) return UFSECP_ERR_NULL_ARG;
+    try {
+        auto* handle = new ufsecp_thread_pool{};
+        handle->pool = std::make_shared<secp256k1::ThreadPool>(n_threads, cpu_ids, n_cpu_ids);
+        *pool_out = handle;
+        return UFSECP_OK;
+    } catch (...) {
+        return UFSECP_ERR_INTERNAL;
+    }
+}
+
+void ufsecp_thread_pool_destroy(ufsecp_thread_pool* pool) {
+    delete pool;  // workers are joined once the last attached ctx lets go
+}
+
+unsigned ufsecp_thread_pool_size(const ufsecp_thread_pool* pool) {
+    return (pool && pool->pool) ? pool->pool->size() : 0u;
+}
+
+ufsecp_error_t ufsecp_ctx_set_thread_pool(ufsecp_ctx* ctx,
+                                          const ufsecp_thread_pool* pool) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    ctx->pool = pool ? pool->pool : nullptr;
+    return UFSECP_OK;
+}
+
+ufsecp_error_t ufsecp_ctx_set_threads(ufsecp_ctx* ctx,
+                                      unsigned n_threads,
+                                      const int* cpu_ids,
+                                      size_t n_cpu_ids) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    if (SECP256K1_UNLIKELY(n_cpu_ids != 0 && !cpu_ids)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    try {
+        ctx->pool = std::make_shared<secp256k1::ThreadPool>(n_threads, cpu_ids, n_cpu_ids);
+        return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
+}
+
+unsigned ufsecp_ctx_threads(const ufsecp_ctx* ctx) {
+    return ctx ? ctx_pool(ctx).size() : 0u;
+}
+
 /* ===========================================================================
  * Context randomization / scalar blinding
  * =========================================================================== */
@@ -253,6 +308,39 @@ ufsecp_error_t ufsecp_pubkey_create(ufsecp_ctx* ctx,
     return UFSECP_OK;
 }
 
+ufsecp_error_t ufsecp_pubkey_create_batch(ufsecp_ctx* ctx,
+                                          size_t count,
+                                          const uint8_t* privkeys32,
+                                          uint8_t* pubkeys33_out) {
+    if (SECP256K1_UNLIKELY(!ctx || !privkeys32 || !pubkeys33_out)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    if (count == 0) return UFSECP_OK;
+    if (count > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
+    std::size_t total_out_bytes;
+    if (!checked_mul_size(count, std::size_t{33}, total_out_bytes))
+        return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch size overflow");
+    std::memset(pubkeys33_out, 0, total_out_bytes);
+
+    const ufsecp_error_t err = batch_parallel(ctx, count, pubkeys33_out, 33,
+        [&](size_t i) -> ufsecp_error_t {
+            Scalar sk;
+            if (SECP256K1_UNLIKELY(!scalar_parse_strict_nonzero(privkeys32 + i * 32, sk))) {
+                secp256k1::detail::secure_erase(&sk, sizeof(sk));
+                return UFSECP_ERR_BAD_KEY;
+            }
+            const Point pk = secp256k1::ct::generator_mul(sk);
+            secp256k1::detail::secure_erase(&sk, sizeof(sk));
+            if (SECP256K1_UNLIKELY(pk.is_infinity())) return UFSECP_ERR_BAD_KEY;
+            point_to_compressed(pk, pubkeys33_out + i * 33);
+            return UFSECP_OK;
+        });
+    if (SECP256K1_UNLIKELY(err != UFSECP_OK)) {
+        return ctx_set_err(ctx, err,
+            err == UFSECP_ERR_BAD_KEY ? "privkey[i] is zero or >= n" : "internal error");
+    }
+    return UFSECP_OK;
+}
+
 ufsecp_error_t ufsecp_pubkey_create_uncompressed(ufsecp_ctx* ctx,
                                                  const uint8_t privkey[32],
                                                  uint8_t pubkey65_out[65]) {
@@ -306,6 +394,36 @@ ufsecp_error_t ufsecp_pubkey_parse(ufsecp_ctx* ctx,
     return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "expected 33 or 65 byte pubkey");
 }
 
+ufsecp_error_t ufsecp_pubkey_parse_batch(ufsecp_ctx* ctx,
+                                         const uint8_t* pubkeys33,
+                                         size_t count,
+                                         uint8_t* valid_out,
+                                         uint8_t* x32s_out,
+                                         uint8_t* y32s_out) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    ctx_clear_err(ctx);
+    if (count == 0) return UFSECP_OK;
+    if (SECP256K1_UNLIKELY(!pubkeys33 || !valid_out)) return UFSECP_ERR_NULL_ARG;
+    if (count > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
+    try {
+    // Pieces of >= 256 keys keep the 4/8-lane sqrt kernel fed.
+    ctx_pool(ctx).parallel_for(count, 256, [&](size_t begin, size_t end) {
+        constexpr size_t kPiece = 256;
+        FE xs[kPiece], ys[kPiece];
+        for (size_t lo = begin; lo < end; lo += kPiece) {
+            const size_t m = std::min(kPiece, end - lo);
+            (void)secp256k1::pubkey_parse_batch(pubkeys33 + lo * 33, m, 33, xs, ys,
+                                                valid_out + lo);
+            for (size_t j = 0; j < m; ++j) {
+                if (x32s_out) xs[j].to_bytes_into(x32s_out + (lo + j) * 32);
+                if (y32s_out) ys[j].to_bytes_into(y32s_out + (lo + j) * 32);
+            }
+        }
+    });
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
+}
+
 ufsecp_error_t ufsecp_pubkey_xonly(ufsecp_ctx* ctx,
                                    const uint8_t privkey[32],
                                    uint8_t xonly32_out[32]) {
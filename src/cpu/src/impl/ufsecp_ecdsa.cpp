@@ -715,76 +715,6 @@ ufsecp_error_t ufsecp_schnorr_sign_verified(ufsecp_ctx* ctx,
     return UFSECP_OK;
 }
 
-// ---------------------------------------------------------------------------
-// batch_parallel: dispatch sign_one(i) over [0, count) using N CPU threads.
-// Each slot i writes to sigs64_out[i*64..(i+1)*64-1] — non-overlapping so
-// no synchronisation is needed on the output buffer.  On any slot error the
-// first error code is captured atomically; remaining slots in every thread
-// are zeroed and skipped.  After joining, the whole output is re-zeroed
-// fail-closed and the captured error is returned.
-// Serial fallback: when hardware_concurrency() <= 1 or count == 1.
-// ---------------------------------------------------------------------------
-template<typename Fn>
-static ufsecp_error_t batch_parallel(size_t count, uint8_t* sigs64_out, Fn sign_one)
-{
-    unsigned hw = std::thread::hardware_concurrency();
-    unsigned n_threads = (hw > 1) ? static_cast<unsigned>(
-        std::min<size_t>(hw, count)) : 1u;
-
-    if (n_threads <= 1) {
-        for (size_t i = 0; i < count; ++i) {
-            ufsecp_error_t e = sign_one(i);
-            if (SECP256K1_UNLIKELY(e != UFSECP_OK)) return e;
-        }
-        return UFSECP_OK;
-    }
-
-    // Stack-allocated thread pool — no heap allocation. kMaxParallelThreads
-    // caps at 64 (no real CPU batch-signing use-case needs more).
-    // std::thread default constructor is noexcept and creates an empty thread
-    // (joinable()==false), so the array init is safe and cheap.
-    static constexpr unsigned kMaxParallelThreads = 64u;
-    std::array<std::thread, kMaxParallelThreads> pool{};
-    n_threads = std::min(n_threads, kMaxParallelThreads);
-
-    std::atomic<int> first_err{static_cast<int>(UFSECP_OK)};
-    const size_t chunk = (count + n_threads - 1) / n_threads;
-    unsigned n_active = 0;
-    for (unsigned t = 0; t < n_threads; ++t) {
-        const size_t start = t * chunk;
-        const size_t end   = std::min(start + chunk, count);
-        if (start >= end) break;
-        pool[t] = std::thread([&, start, end]() {
-            for (size_t i = start; i < end; ++i) {
-                if (first_err.load(std::memory_order_relaxed) != static_cast<int>(UFSECP_OK)) {
-                    std::memset(sigs64_out + i * 64, 0, 64);
-                    continue;
-                }
-                const ufsecp_error_t e = sign_one(i);
-                if (SECP256K1_UNLIKELY(e != UFSECP_OK)) {
-                    int expected = static_cast<int>(UFSECP_OK);
-                    first_err.compare_exchange_strong(
-                        expected, static_cast<int>(e),
-                        std::memory_order_acq_rel, std::memory_order_relaxed);
-                    // zero remaining slots in this chunk
-                    for (size_t j = i + 1; j < end; ++j)
-                        std::memset(sigs64_out + j * 64, 0, 64);
-                    return;
-                }
-            }
-        });
-        ++n_active;
-    }
-    for (unsigned t = 0; t < n_active; ++t) pool[t].join();
-
-    const int err = first_err.load(std::memory_order_acquire);
-    if (err != static_cast<int>(UFSECP_OK)) {
-        std::memset(sigs64_out, 0, count * 64);
-        return static_cast<ufsecp_error_t>(err);
-    }
-    return UFSECP_OK;
-}
-
 ufsecp_error_t ufsecp_ecdsa_sign_batch(
     ufsecp_ctx* ctx,
     size_t count,
@@ -804,7 +734,7 @@ ufsecp_error_t ufsecp_ecdsa_sign_batch(
     // before an error is not visible.  batch_parallel re-zeros on error too.
     std::memset(sigs64_out, 0, count * 64);
 
-    const ufsecp_error_t err = batch_parallel(count, sigs64_out,
+    const ufsecp_error_t err = batch_parallel(ctx, count, sigs64_out, 64,
         [&](size_t i) -> ufsecp_error_t {
             std::array<uint8_t, 32> msg;
             std::memcpy(msg.data(), msgs32 + i * 32, 32);
@@ -850,7 +780,7 @@ ufsecp_error_t ufsecp_schnorr_sign_batch(
     // SEC-008/BSG-12 Fail-closed: pre-zero output.  batch_parallel re-zeros on error.
     std::memset(sigs64_out, 0, count * 64);
 
-    const ufsecp_error_t err = batch_parallel(count, sigs64_out,
+    const ufsecp_error_t err = batch_parallel(ctx, count, sigs64_out, 64,
         [&](size_t i) -> ufsecp_error_t {
             Scalar sk;
             if (SECP256K1_UNLIKELY(!scalar_parse_strict_nonzero(privkeys32 + i * 32, sk))) {
@@ -700,6 +700,196 @@ ufsecp_error_t ufsecp_bip39_to_entropy(ufsecp_ctx* ctx,
  * Batch verification
  * =========================================================================== */
 
+// Below this many entries per sub-batch the per-batch MSM setup (weights,
+// tables) outweighs what another participant saves, so small batches stay on
+// one thread.
+static constexpr std::size_t kMinVerifySubBatch = 256;
+
+// Parse entries [0, n) on the ctx pool. Returns the error of the LOWEST
+// failing index (same result as the serial loop) and stores that index.
+template <typename ParseFn>
+static ufsecp_error_t batch_parse_parallel(const ufsecp_ctx* ctx, std::size_t n,
+                                           ParseFn parse_one) {
+    std::atomic<std::size_t> first_bad{n};
+    ctx_pool(ctx).parallel_for(n, 0, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            if (i >= first_bad.load(std::memory_order_relaxed)) return;
+            if (parse_one(i) != UFSECP_OK) {
+                std::size_t cur = first_bad.load(std::memory_order_relaxed);
+                while (i < cur && !first_bad.compare_exchange_weak(
+                           cur, i, std::memory_order_relaxed)) {}
+                return;
+            }
+        }
+    });
+    const std::size_t bad = first_bad.load(std::memory_order_relaxed);
+    return bad < n ? parse_one(bad) : UFSECP_OK;
+}
+
+// Split a parsed batch into independent sub-batches (each with its own random
+// weights) and verify them on the ctx pool. The batch is valid iff every
+// sub-batch is valid, so this is as sound as one big batch.
+template <typename Entry>
+static bool batch_verify_parallel(const ufsecp_ctx* ctx, const Entry* batch,
+                                  std::size_t n,
+                                  bool (*verify)(const Entry*, std::size_t)) {
+    auto& pool = ctx_pool(ctx);
+    const std::size_t parts = std::min<std::size_t>(
+        pool.size(), std::max<std::size_t>(1, n / kMinVerifySubBatch));
+    if (parts <= 1) return verify(batch, n);
+
+    const std::size_t per = (n + parts - 1) / parts;
+    std::atomic<bool> ok{true};
+    pool.parallel_for(parts, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+            if (!ok.load(std::memory_order_relaxed)) return;
+            const std::size_t lo = p * per;
+            const std::size_t hi = std::min(n, lo + per);
+            if (lo < hi && !verify(batch + lo, hi - lo)) {
+                ok.store(false, std::memory_order_relaxed);
+            }
+        }
+    });
+    return ok.load(std::memory_order_relaxed);
+}
+
+// identify_invalid over contiguous chunks on the ctx pool; indices are
+// rebased and concatenated in chunk order, so the output stays sorted.
+template <typename Entry>
+static std::vector<std::size_t> batch_identify_parallel(
+    const ufsecp_ctx* ctx, const Entry* batch, std::size_t n,
+    void (*identify)(const Entry*, std::size_t, std::vector<std::size_t>&)) {
+    auto& pool = ctx_pool(ctx);
+    const std::size_t parts = std::min<std::size_t>(
+        pool.size(), std::max<std::size_t>(1, n / kMinVerifySubBatch));
+    std::vector<std::size_t> out;
+    if (parts <= 1) {
+        identify(batch, n, out);
+        return out;
+    }
+
+    const std::size_t per = (n + parts - 1) / parts;
+    std::vector<std::vector<std::size_t>> partial(parts);
+    pool.parallel_for(parts, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+            const std::size_t lo = p * per;
+            const std::size_t hi = std::min(n, lo + per);
+            if (lo >= hi) continue;
+            identify(batch + lo, hi - lo, partial[p]);
+            for (auto& idx : partial[p]) idx += lo;
+        }
+    });
+    for (auto& v : partial) out.insert(out.end(), v.begin(), v.end());
+    return out;
+}
+
+/* Each entry: 32-byte xonly pubkey | 32-byte msg | 64-byte sig = 128 bytes */
+static ufsecp_error_t parse_schnorr_batch(ufsecp_ctx* ctx, const uint8_t* entries,
+                                          std::size_t n,
+                                          std::vector<secp256k1::SchnorrBatchEntry>& batch) {
+    batch.resize(n);
+    const ufsecp_error_t err = batch_parse_parallel(ctx, n, [&](std::size_t i) {
+        const uint8_t* e = entries + i * 128;
+        // Strict: reject x-only pubkey >= p at ABI gate
+        FE pk_fe;
+        if (!FE::parse_bytes_strict(e, pk_fe)) return UFSECP_ERR_BAD_PUBKEY;
+        std::memcpy(batch[i].pubkey_x.data(), e, 32);
+        std::memcpy(batch[i].message.data(), e + 32, 32);
+        if (!secp256k1::SchnorrSignature::parse_strict(e + 64, batch[i].signature)) {
+            return UFSECP_ERR_BAD_SIG;
+        }
+        return UFSECP_OK;
+    });
+    if (err == UFSECP_ERR_BAD_PUBKEY) {
+        return ctx_set_err(ctx, err, "non-canonical pubkey (x>=p) in batch");
+    }
+    if (err != UFSECP_OK) return ctx_set_err(ctx, err, "invalid Schnorr sig in batch");
+    return UFSECP_OK;
+}
+
+// Decompress the 33-byte pubkey at entries + i*stride + 32 of every entry on
+// the ctx pool, 256 at a time through the lane-parallel sqrt, into
+// batch[i].public_key. valid[i] = 0 marks a key point_from_compressed would
+// reject; the per-entry parse reports it so the lowest failing index wins.
+template <typename Entry>
+static void decompress_batch_pubkeys(const ufsecp_ctx* ctx, const uint8_t* entries,
+                                     std::size_t n, std::size_t stride,
+                                     std::vector<Entry>& batch,
+                                     std::vector<uint8_t>& valid) {
+    valid.assign(n, 0);
+    ctx_pool(ctx).parallel_for(n, 256, [&](std::size_t begin, std::size_t end) {
+        constexpr std::size_t kPiece = 256;
+        FE xs[kPiece], ys[kPiece];
+        for (std::size_t lo = begin; lo < end; lo += kPiece) {
+            const std::size_t m = std::min(kPiece, end - lo);
+            (void)secp256k1::pubkey_parse_batch(entries + lo * stride + 32, m, stride,
+                                                xs, ys, valid.data() + lo);
+            for (std::size_t j = 0; j < m; ++j) {
+                batch[lo + j].public_key = valid[lo + j] ? Point::from_affine(xs[j], ys[j])
+                                                         : Point::infinity();
+            }
+        }
+    });
+}
+
+/* Each entry: 32-byte msg | 33-byte pubkey | 64-byte sig = 129 bytes */
+static ufsecp_error_t parse_ecdsa_batch(ufsecp_ctx* ctx, const uint8_t* entries,
+                                        std::size_t n,
+                                        std::vector<secp256k1::ECDSABatchEntry>& batch) {
+    batch.resize(n);
+    std::vector<uint8_t> pk_valid;
+    decompress_batch_pubkeys(ctx, entries, n, 129, batch, pk_valid);
+    const ufsecp_error_t err = batch_parse_parallel(ctx, n, [&](std::size_t i) {
+        const uint8_t* e = entries + i * 129;
+        std::memcpy(batch[i].msg_hash.data(), e, 32);
+        if (!pk_valid[i]) return UFSECP_ERR_BAD_PUBKEY;
+        std::array<uint8_t, 64> compact;
+        std::memcpy(compact.data(), e + 65, 64);
+        if (SECP256K1_UNLIKELY(!secp256k1::ECDSASignature::parse_compact_strict(compact, batch[i].signature))) {
+            return UFSECP_ERR_BAD_SIG;
+        }
+        return UFSECP_OK;
+    });
+    if (err == UFSECP_ERR_BAD_PUBKEY) return ctx_set_err(ctx, err, "invalid pubkey in batch");
+    if (err != UFSECP_OK) return ctx_set_err(ctx, err, "invalid ECDSA sig in batch");
+    return UFSECP_OK;
+}
+
+/* Each entry: 32-byte msg | 33-byte pubkey | 64-byte sig | 1-byte recid = 130 bytes */
+static ufsecp_error_t parse_ecdsa_recoverable_batch(
+    ufsecp_ctx* ctx, const uint8_t* entries, std::size_t n,
+    std::vector<secp256k1::ECDSARecoverableBatchEntry>& batch) {
+    batch.resize(n);
+    std::vector<uint8_t> pk_valid;
+    decompress_batch_pubkeys(ctx, entries, n, 130, batch, pk_valid);
+    const ufsecp_error_t err = batch_parse_parallel(ctx, n, [&](std::size_t i) {
+        const uint8_t* e = entries + i * 130;
+        std::memcpy(batch[i].msg_hash.data(), e, 32);
+        if (!pk_valid[i]) return UFSECP_ERR_BAD_PUBKEY;
+        std::array<uint8_t, 64> compact;
+        std::memcpy(compact.data(), e + 65, 64);
+        if (SECP256K1_UNLIKELY(!secp256k1::ECDSASignature::parse_compact_strict(compact, batch[i].signature))) {
+            return UFSECP_ERR_BAD_SIG;
+        }
+        if (e[129] > 3) return UFSECP_ERR_BAD_SIG;
+        batch[i].recid = e[129];
+        return UFSECP_OK;
+    });
+    if (err == UFSECP_ERR_BAD_PUBKEY) return ctx_set_err(ctx, err, "invalid pubkey in batch");
+    if (err != UFSECP_OK) return ctx_set_err(ctx, err, "invalid recoverable ECDSA sig in batch");
+    return UFSECP_OK;
+}
+
+static void copy_invalid_indices(const std::vector<std::size_t>& invalids,
+                                 size_t* invalid_out, size_t* invalid_count) {
+    size_t const capacity = *invalid_count;
+    size_t const count = invalids.size() < capacity ? invalids.size() : capacity;
+    *invalid_count = invalids.size();
+    for (size_t i = 0; i < count; ++i) {
+        invalid_out[i] = invalids[i];
+    }
+}
+
 ufsecp_error_t ufsecp_schnorr_batch_verify(ufsecp_ctx* ctx,
                                            const uint8_t* entries, size_t n) {
     if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
@@ -711,22 +901,12 @@ ufsecp_error_t ufsecp_schnorr_batch_verify(ufsecp_ctx* ctx,
     if (!checked_mul_size(n, std::size_t{128}, total_bytes))
         return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch size overflow");
     try {
-    /* Each entry: 32-byte xonly pubkey | 32-byte msg | 64-byte sig = 128 bytes */
-    std::vector<secp256k1::SchnorrBatchEntry> batch(n);
-    for (size_t i = 0; i < n; ++i) {
-        const uint8_t* e = entries + i * 128;
-        // Strict: reject x-only pubkey >= p at ABI gate
-        FE pk_fe;
-        if (!FE::parse_bytes_strict(e, pk_fe)) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_PUBKEY, "non-canonical pubkey (x>=p) in batch");
-        }
-        std::memcpy(batch[i].pubkey_x.data(), e, 32);
-        std::memcpy(batch[i].message.data(), e + 32, 32);
-        if (!secp256k1::SchnorrSignature::parse_strict(e + 64, batch[i].signature)) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_SIG, "invalid Schnorr sig in batch");
-        }
-    }
-    if (!secp256k1::schnorr_batch_verify(batch)) {
+    std::vector<secp256k1::SchnorrBatchEntry> batch;
+    const ufsecp_error_t perr = parse_schnorr_batch(ctx, entries, n, batch);
+    if (perr != UFSECP_OK) return perr;
+    // One weight vector, one equation; preprocessing and the MSM are split
+    // across the ctx pool (ufsecp_ctx_set_threads is the thread-count knob).
+    if (!secp256k1::schnorr_batch_verify(batch.data(), n, ctx_pool(ctx))) {
         return ctx_set_err(ctx, UFSECP_ERR_VERIFY_FAIL, "batch verify failed");
     }
     return UFSECP_OK;
@@ -744,22 +924,34 @@ ufsecp_error_t ufsecp_ecdsa_batch_verify(ufsecp_ctx* ctx,
     if (!checked_mul_size(n, std::size_t{129}, total_bytes))
         return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch size overflow");
     try {
-    /* Each entry: 32-byte msg | 33-byte pubkey | 64-byte sig = 129 bytes */
-    std::vector<secp256k1::ECDSABatchEntry> batch(n);
-    for (size_t i = 0; i < n; ++i) {
-        const uint8_t* e = entries + i * 129;
-        std::memcpy(batch[i].msg_hash.data(), e, 32);
-        batch[i].public_key = point_from_compressed(e + 32);
-        if (batch[i].public_key.is_infinity()) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_PUBKEY, "invalid pubkey in batch");
-        }
-        std::array<uint8_t, 64> compact;
-        std::memcpy(compact.data(), e + 65, 64);
-        if (SECP256K1_UNLIKELY(!secp256k1::ECDSASignature::parse_compact_strict(compact, batch[i].signature))) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_SIG, "invalid ECDSA sig in batch");
-        }
+    std::vector<secp256k1::ECDSABatchEntry> batch;
+    const ufsecp_error_t perr = parse_ecdsa_batch(ctx, entries, n, batch);
+    if (perr != UFSECP_OK) return perr;
+    if (SECP256K1_UNLIKELY(!batch_verify_parallel<secp256k1::ECDSABatchEntry>(
+            ctx, batch.data(), n, &secp256k1::ecdsa_batch_verify))) {
+        return ctx_set_err(ctx, UFSECP_ERR_VERIFY_FAIL, "batch verify failed");
     }
-    if (SECP256K1_UNLIKELY(!secp256k1::ecdsa_batch_verify(batch))) {
+    return UFSECP_OK;
+    } UFSECP_CATCH_RETURN(ctx)
+}
+
+ufsecp_error_t ufsecp_ecdsa_batch_verify_recoverable(ufsecp_ctx* ctx,
+                                                     const uint8_t* entries, size_t n) {
+    if (SECP256K1_UNLIKELY(!ctx)) return UFSECP_ERR_NULL_ARG;
+    if (n == 0) return UFSECP_OK;  /* empty batch is vacuously valid; entries ptr irrelevant */
+    if (SECP256K1_UNLIKELY(!entries)) return UFSECP_ERR_NULL_ARG;
+    if (n > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
+    ctx_clear_err(ctx);
+    std::size_t total_bytes = 0;
+    if (!checked_mul_size(n, std::size_t{130}, total_bytes))
+        return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch size overflow");
+    try {
+    std::vector<secp256k1::ECDSARecoverableBatchEntry> batch;
+    const ufsecp_error_t perr = parse_ecdsa_recoverable_batch(ctx, entries, n, batch);
+    if (perr != UFSECP_OK) return perr;
+    // recid pins R, so this is one randomized MSM over the whole batch (no
+    // per-signature x-coordinate checks), split across the ctx pool.
+    if (!secp256k1::ecdsa_batch_verify(batch.data(), n, ctx_pool(ctx))) {
         return ctx_set_err(ctx, UFSECP_ERR_VERIFY_FAIL, "batch verify failed");
     }
     return UFSECP_OK;
@@ -773,26 +965,13 @@ ufsecp_error_t ufsecp_schnorr_batch_identify_invalid(
     if (n > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
     ctx_clear_err(ctx);
     try {
-    std::vector<secp256k1::SchnorrBatchEntry> batch(n);
-    for (size_t i = 0; i < n; ++i) {
-        const uint8_t* e = entries + i * 128;
-        FE pk_fe;
-        if (!FE::parse_bytes_strict(e, pk_fe)) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_PUBKEY, "non-canonical pubkey (x>=p) in batch");
-        }
-        std::memcpy(batch[i].pubkey_x.data(), e, 32);
-        std::memcpy(batch[i].message.data(), e + 32, 32);
-        if (!secp256k1::SchnorrSignature::parse_strict(e + 64, batch[i].signature)) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_SIG, "invalid Schnorr sig in batch");
-        }
-    }
-    auto invalids = secp256k1::schnorr_batch_identify_invalid(batch.data(), n);
-    size_t const capacity = *invalid_count;
-    size_t const count = invalids.size() < capacity ? invalids.size() : capacity;
-    *invalid_count = invalids.size();
-    for (size_t i = 0; i < count; ++i) {
-        invalid_out[i] = invalids[i];
-    }
+    std::vector<secp256k1::SchnorrBatchEntry> batch;
+    const ufsecp_error_t perr = parse_schnorr_batch(ctx, entries, n, batch);
+    if (perr != UFSECP_OK) return perr;
+    copy_invalid_indices(
+        batch_identify_parallel<secp256k1::SchnorrBatchEntry>(
+            ctx, batch.data(), n, &secp256k1::schnorr_batch_identify_invalid),
+        invalid_out, invalid_count);
     return UFSECP_OK;
     } UFSECP_CATCH_RETURN(ctx)
 }
@@ -804,27 +983,13 @@ ufsecp_error_t ufsecp_ecdsa_batch_identify_invalid(
     if (n > kMaxBatchN) return ctx_set_err(ctx, UFSECP_ERR_BAD_INPUT, "batch count too large");
     ctx_clear_err(ctx);
     try {
-    std::vector<secp256k1::ECDSABatchEntry> batch(n);
-    for (size_t i = 0; i < n; ++i) {
-        const uint8_t* e = entries + i * 129;
-        std::memcpy(batch[i].msg_hash.data(), e, 32);
-        batch[i].public_key = point_from_compressed(e + 32);
-        if (batch[i].public_key.is_infinity()) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_PUBKEY, "invalid pubkey in batch");
-        }
-        std::array<uint8_t, 64> compact;
-        std::memcpy(compact.data(), e + 65, 64);
-        if (SECP256K1_UNLIKELY(!secp256k1::ECDSASignature::parse_compact_strict(compact, batch[i].signature))) {
-            return ctx_set_err(ctx, UFSECP_ERR_BAD_SIG, "invalid ECDSA sig in batch");
-        }
-    }
-    auto invalids = secp256k1::ecdsa_batch_identify_invalid(batch.data(), n);
-    size_t const capacity = *invalid_count;
-    size_t const count = invalids.size() < capacity ? invalids.size() : capacity;
-    *invalid_count = invalids.size();
-    for (size_t i = 0; i < count; ++i) {
-        invalid_out[i] = invalids[i];
-    }
+    std::vector<secp256k1::ECDSABatchEntry> batch;
+    const ufsecp_error_t perr = parse_ecdsa_batch(ctx, entries, n, batch);
+    if (perr != UFSECP_OK) return perr;
+    copy_invalid_indices(
+        batch_identify_parallel<secp256k1::ECDSABatchEntry>(
+            ctx, batch.data(), n, &secp256k1::ecdsa_batch_identify_invalid),
+        invalid_out, invalid_count);
     return UFSECP_OK;
     } UFSECP_CATCH_RETURN(ctx)
 }
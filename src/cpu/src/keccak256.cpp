@@ -9,6 +9,7 @@
 
 #include "secp256k1/coins/keccak256.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
+#include "secp256k1/hash_accel.hpp"   // avx2_available(), SECP256K1_HASH_MULTIBUFFER
 #include <cstring>
 
 namespace secp256k1::coins {
@@ -88,6 +89,119 @@ static void keccak_f1600(std::uint64_t state[25]) {
     }
 }
 
+// -- 4-way Keccak-f[1600] (AVX2) ----------------------------------------------
+// Four independent states, one message per 64-bit lane of a 256-bit vector
+// (state[i][k] = lane i of message k). Written over GCC/Clang vector types
+// and force-inlined into a target("avx2") wrapper, the same scheme as the
+// multi-buffer hashes in hash_accel.cpp; picked at runtime from the cached
+// CPUID flags. rho and pi walk the lanes in pi order so every rotation
+// count is a constant after unrolling.
+
+#ifdef SECP256K1_HASH_MULTIBUFFER
+
+#define KK_INLINE inline __attribute__((always_inline))
+// Macro, not a function: a vector by-value signature trips -Wpsabi.
+#define KK_ROTL(x, n)  (((x) << (n)) | ((x) >> (64 - (n))))
+
+typedef std::uint64_t kk_u64x4 __attribute__((vector_size(32)));
+
+// Lane visited at step i of the rho-pi walk from lane 1, and its rotation.
+static constexpr int KECCAK_PI_LANE[24] = {
+    10,  7, 11, 17, 18,  3,  5, 16,  8, 21, 24,  4,
+    15, 23, 19, 13, 12,  2, 20, 14, 22,  9,  6,  1,
+};
+static constexpr int KECCAK_PI_ROT[24] = {
+     1,  3,  6, 10, 15, 21, 28, 36, 45, 55,  2, 14,
+    27, 41, 56,  8, 25, 43, 62, 18, 39, 61, 20, 44,
+};
+
+template <class V>
+KK_INLINE void keccak_f1600_lanes(V st[25]) noexcept {
+    for (int round = 0; round < 24; ++round) {
+        // theta
+        V bc[5];
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; ++x) {
+            bc[x] = st[x] ^ st[x + 5] ^ st[x + 10] ^ st[x + 15] ^ st[x + 20];
+        }
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; ++x) {
+            V const d = bc[(x + 4) % 5] ^ KK_ROTL(bc[(x + 1) % 5], 1);
+#pragma GCC unroll 5
+            for (int y = 0; y < 25; y += 5) st[x + y] ^= d;
+        }
+
+        // rho + pi
+        V t = st[1];
+#pragma GCC unroll 24
+        for (int i = 0; i < 24; ++i) {
+            int const j = KECCAK_PI_LANE[i];
+            V const next = st[j];
+            st[j] = KK_ROTL(t, KECCAK_PI_ROT[i]);
+            t = next;
+        }
+
+        // chi
+#pragma GCC unroll 5
+        for (int y = 0; y < 25; y += 5) {
+            V const b0 = st[y], b1 = st[y + 1], b2 = st[y + 2], b3 = st[y + 3], b4 = st[y + 4];
+            st[y]     = b0 ^ (~b1 & b2);
+            st[y + 1] = b1 ^ (~b2 & b3);
+            st[y + 2] = b2 ^ (~b3 & b4);
+            st[y + 3] = b3 ^ (~b4 & b0);
+            st[y + 4] = b4 ^ (~b0 & b1);
+        }
+
+        // iota
+        st[0] ^= KECCAK_RC[round];
+    }
+}
+
+// keccak256 of four len-byte messages msgs + k*len into out32 + 32*k.
+__attribute__((target("avx2")))
+static void keccak256_x4_avx2(const std::uint8_t* msgs, std::size_t len, std::uint8_t* out32) {
+    constexpr std::size_t RATE = 136;
+    kk_u64x4 st[25] = {};
+    std::size_t off = 0;
+    for (; off + RATE <= len; off += RATE) {
+        for (std::size_t i = 0; i < RATE / 8; ++i) {
+            for (std::size_t k = 0; k < 4; ++k) {
+                std::uint64_t lane = 0;
+                std::memcpy(&lane, msgs + k * len + off + i * 8, 8);
+                st[i][k] ^= lane;
+            }
+        }
+        keccak_f1600_lanes(st);
+    }
+
+    // Final block with Keccak padding (0x01 ... 0x80).
+    std::size_t const rem = len - off;
+    for (std::size_t k = 0; k < 4; ++k) {
+        std::uint8_t last[RATE] = {};
+        if (rem != 0) std::memcpy(last, msgs + k * len + off, rem);
+        last[rem] = 0x01;
+        last[RATE - 1] |= 0x80;
+        for (std::size_t i = 0; i < RATE / 8; ++i) {
+            std::uint64_t lane = 0;
+            std::memcpy(&lane, last + i * 8, 8);
+            st[i][k] ^= lane;
+        }
+    }
+    keccak_f1600_lanes(st);
+
+    for (std::size_t k = 0; k < 4; ++k) {
+        for (std::size_t w = 0; w < 4; ++w) {
+            std::uint64_t const lane = st[w][k];
+            std::memcpy(out32 + k * 32 + w * 8, &lane, 8);
+        }
+    }
+}
+
+#undef KK_ROTL
+#undef KK_INLINE
+
+#endif // SECP256K1_HASH_MULTIBUFFER
+
 // -- Keccak256State -----------------------------------------------------------
 
 Keccak256State::Keccak256State() : buf_pos(0) {
@@ -159,4 +273,20 @@ std::array<std::uint8_t, 32> keccak256(const std::uint8_t* data, std::size_t len
     return ctx.finalize();
 }
 
+// -- Multi-Buffer -------------------------------------------------------------
+
+void keccak256_batch(const std::uint8_t* msgs, std::size_t len, std::size_t n,
+                     std::uint8_t* out32) {
+    std::size_t i = 0;
+#ifdef SECP256K1_HASH_MULTIBUFFER
+    if (hash::avx2_available()) {
+        for (; i + 4 <= n; i += 4) keccak256_x4_avx2(msgs + i * len, len, out32 + i * 32);
+    }
+#endif
+    for (; i < n; ++i) {
+        auto const h = keccak256(msgs + i * len, len);
+        std::memcpy(out32 + i * 32, h.data(), 32);
+    }
+}
+
 } // namespace secp256k1::coins
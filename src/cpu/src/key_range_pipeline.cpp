@@ -0,0 +1,229 @@
+// ============================================================================
+// Streaming key-range pipeline (see key_range_pipeline.hpp)
+// ============================================================================
+
+#include "secp256k1/key_range_pipeline.hpp"
+#include "secp256k1/config.hpp"
+#include "secp256k1/hash_accel.hpp"
+#include "secp256k1/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+namespace secp256k1::fast {
+
+namespace {
+
+inline std::uint64_t load_le64(const std::uint8_t* p) noexcept {
+    std::uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+    return v;
+}
+
+// Bloom word index from bytes 0..7, the two bit positions from bytes 8..9.
+// hash160 output is uniform, so no extra mixing is needed.
+inline std::uint64_t filter_bits(const std::uint8_t* h) noexcept {
+    std::uint64_t const b = load_le64(h + 8);
+    return (std::uint64_t{1} << (b & 63)) | (std::uint64_t{1} << ((b >> 6) & 63));
+}
+
+inline bool hash_less(const std::array<std::uint8_t, 20>& a,
+                      const std::array<std::uint8_t, 20>& b) noexcept {
+    return std::memcmp(a.data(), b.data(), 20) < 0;
+}
+
+// Per-run scratch: one tile of every intermediate, reused for each tile.
+struct TileScratch {
+    std::vector<FieldElement> x;
+    std::vector<FieldElement> inv;      // batch_add_affine scratch
+    std::vector<std::uint8_t> parity;
+    std::vector<std::uint8_t> pub;      // tile x 33
+    std::vector<std::uint8_t> h160;     // tile x 20
+    std::vector<std::size_t>  skip;     // k == 0 slots (no pubkey)
+
+    explicit TileScratch(std::size_t tile)
+        : x(tile), inv(tile), parity(tile), pub(tile * 33), h160(tile * 20) {}
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// Hash160Filter
+// ============================================================================
+
+Hash160Filter::Hash160Filter(const std::uint8_t* hashes, std::size_t count) {
+    sorted_.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::memcpy(sorted_[i].data(), hashes + i * 20, 20);
+    }
+    std::sort(sorted_.begin(), sorted_.end(), hash_less);
+    sorted_.erase(std::unique(sorted_.begin(), sorted_.end()), sorted_.end());
+
+    // ~16 bits per entry, power-of-two word count, at least one page.
+    std::size_t words = 64;
+    while (words * 4 < sorted_.size()) words *= 2;
+    bits_.assign(words, 0);
+    word_mask_ = words - 1;
+    for (const auto& h : sorted_) {
+        bits_[load_le64(h.data()) & word_mask_] |= filter_bits(h.data());
+    }
+}
+
+bool Hash160Filter::maybe_contains(const std::uint8_t* hash20) const noexcept {
+    if (bits_.empty()) return false;
+    std::uint64_t const want = filter_bits(hash20);
+    return (bits_[load_le64(hash20) & word_mask_] & want) == want;
+}
+
+bool Hash160Filter::contains(const std::uint8_t* hash20) const noexcept {
+    if (!maybe_contains(hash20)) return false;
+    std::array<std::uint8_t, 20> key;
+    std::memcpy(key.data(), hash20, 20);
+    return std::binary_search(sorted_.begin(), sorted_.end(), key, hash_less);
+}
+
+std::size_t Hash160Filter::memory_bytes() const noexcept {
+    return bits_.size() * sizeof(std::uint64_t) + sorted_.size() * 20;
+}
+
+// ============================================================================
+// KeyRangePipeline
+// ============================================================================
+
+KeyRangePipeline::KeyRangePipeline(const Scalar& step, std::size_t tile)
+    : step_(step), tile_(tile) {
+    if (step.is_zero()) throw std::invalid_argument("KeyRangePipeline: step must be non-zero");
+    if (tile == 0) throw std::invalid_argument("KeyRangePipeline: tile must be non-zero");
+
+    Point const q = Point::generator().scalar_mul(step);
+    offsets_   = precompute_point_multiples(q.x(), q.y(), tile);
+    tile_step_ = Point::generator().scalar_mul(step * Scalar::from_uint64(tile));
+}
+
+KeyRangeStats KeyRangePipeline::scan(const Scalar& start, std::uint64_t count,
+                                     const Hash160Filter& filter,
+                                     std::vector<KeyRangeMatch>& matches) const {
+    return scan_impl(start, count, filter, matches, nullptr);
+}
+
+KeyRangeStats KeyRangePipeline::scan(const Scalar& start, std::uint64_t count,
+                                     const Hash160Filter& filter,
+                                     std::vector<KeyRangeMatch>& matches,
+                                     ThreadPool& pool) const {
+    return scan_impl(start, count, filter, matches, &pool);
+}
+
+KeyRangeStats KeyRangePipeline::scan_impl(const Scalar& start, std::uint64_t count,
+                                          const Hash160Filter& filter,
+                                          std::vector<KeyRangeMatch>& matches,
+                                          ThreadPool* pool) const {
+    auto const t0 = std::chrono::steady_clock::now();
+    std::size_t const first_new = matches.size();
+    std::uint64_t const n_tiles = (count + tile_ - 1) / tile_;
+
+    std::mutex                 merge_mutex;
+    std::atomic<std::uint64_t> keys_done{0};
+
+    // Tiles [tb, te): one k*G for the first base, then B += tile * step * G.
+    auto run_tiles = [&](std::uint64_t tb, std::uint64_t te) {
+        TileScratch s(tile_);
+        std::vector<KeyRangeMatch> local;
+        std::uint64_t keys = 0;
+
+        // Base key for tile t is k_{t*tile - 1} = start + (t*tile - 1) * step.
+        Scalar const kb = start + Scalar::from_uint64(tb * tile_) * step_ - step_;
+        Point base = Point::generator().scalar_mul(kb);
+        FieldElement const zero = FieldElement::zero();
+
+        for (std::uint64_t t = tb; t < te; ++t) {
+            std::uint64_t const b = t * tile_;
+            auto const n = static_cast<std::size_t>(std::min<std::uint64_t>(tile_, count - b));
+
+            // 1. Affine add (base at infinity: the tile's points are T itself).
+            if (base.is_infinity()) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    s.x[j] = offsets_[j].x;
+                    s.parity[j] = static_cast<std::uint8_t>(
+                        Point::from_affine(offsets_[j].x, offsets_[j].y).has_even_y() ? 0 : 1);
+                }
+            } else {
+                base.normalize();
+                batch_add_affine_x_with_parity(base.x(), base.y(), offsets_.data(),
+                                               s.x.data(), s.parity.data(), n, s.inv);
+            }
+
+            // 2. Compress. X == 0 marks B == +-T[j]; those few keys are
+            //    recomputed directly (k == 0 has no pubkey and is skipped).
+            s.skip.clear();
+            for (std::size_t j = 0; j < n; ++j) {
+                std::uint8_t* pub = s.pub.data() + j * 33;
+                if (SECP256K1_UNLIKELY(s.x[j] == zero)) {
+                    Scalar const k = start + Scalar::from_uint64(b + j) * step_;
+                    Point const p = Point::generator().scalar_mul(k);
+                    if (p.is_infinity()) {
+                        s.skip.push_back(j);
+                        std::memset(pub, 0, 33);
+                    } else {
+                        auto const c = p.to_compressed();
+                        std::memcpy(pub, c.data(), 33);
+                    }
+                    continue;
+                }
+                pub[0] = static_cast<std::uint8_t>(0x02 | s.parity[j]);
+                s.x[j].to_bytes_into(pub + 1);
+            }
+
+            // 3. Hash, 4. probe.
+            hash::hash160_33_batch(s.pub.data(), s.h160.data(), n);
+            std::size_t next_skip = 0;
+            for (std::size_t j = 0; j < n; ++j) {
+                if (next_skip < s.skip.size() && s.skip[next_skip] == j) {
+                    ++next_skip;
+                    continue;
+                }
+                const std::uint8_t* h = s.h160.data() + j * 20;
+                if (SECP256K1_UNLIKELY(filter.contains(h))) {
+                    KeyRangeMatch m;
+                    m.index = b + j;
+                    m.key   = start + Scalar::from_uint64(m.index) * step_;
+                    std::memcpy(m.pubkey.data(), s.pub.data() + j * 33, 33);
+                    std::memcpy(m.hash160.data(), h, 20);
+                    local.push_back(m);
+                }
+            }
+            keys += n - s.skip.size();
+
+            base = base.add(tile_step_);
+        }
+
+        keys_done.fetch_add(keys, std::memory_order_relaxed);
+        if (!local.empty()) {
+            std::lock_guard<std::mutex> lk(merge_mutex);
+            matches.insert(matches.end(), local.begin(), local.end());
+        }
+    };
+
+    if (n_tiles != 0) {
+        if (pool != nullptr) {
+            pool->parallel_for(static_cast<std::size_t>(n_tiles), 0,
+                               [&](std::size_t b, std::size_t e) { run_tiles(b, e); });
+        } else {
+            run_tiles(0, n_tiles);
+        }
+    }
+
+    std::sort(matches.begin() + static_cast<std::ptrdiff_t>(first_new), matches.end(),
+              [](const KeyRangeMatch& a, const KeyRangeMatch& b) { return a.index < b.index; });
+
+    KeyRangeStats stats;
+    stats.keys    = keys_done.load(std::memory_order_relaxed);
+    stats.matches = matches.size() - first_new;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return stats;
+}
+
+} // namespace secp256k1::fast
@@ -0,0 +1,343 @@
+// ============================================================================
+// Read-only mapped table files (see mapped_table_p.hpp)
+// ============================================================================
+
+#include "mapped_table_p.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <process.h>   // _getpid()
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace secp256k1::fast {
+
+namespace {
+
+constexpr char kMagic[8] = {'U', 'F', 'S', 'E', 'C', 'P', 'M', 'T'};
+
+constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t P3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+inline std::uint64_t rotl64(std::uint64_t v, unsigned r) noexcept {
+    return (v << r) | (v >> (64U - r));
+}
+
+inline std::uint64_t load64(const std::uint8_t* p) noexcept {
+    std::uint64_t v = 0;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+inline std::uint64_t mix_round(std::uint64_t acc, std::uint64_t in) noexcept {
+    return rotl64(acc + in * P2, 31) * P1;
+}
+
+inline std::uint64_t merge_round(std::uint64_t h, std::uint64_t lane) noexcept {
+    h ^= mix_round(0, lane);
+    return h * P1 + P4;
+}
+
+[[maybe_unused]] constexpr std::size_t kHugePageBytes = std::size_t{2} << 20;
+
+} // anonymous namespace
+
+// ============================================================================
+// TableChecksum
+// ============================================================================
+
+TableChecksum::TableChecksum() noexcept
+    : lanes_{P1 + P2, P2, 0, 0 - P1}, buf_{} {}
+
+void TableChecksum::update(const void* data, std::size_t bytes) noexcept {
+    const auto* p = static_cast<const std::uint8_t*>(data);
+    total_ += bytes;
+
+    if (buf_len_ != 0) {
+        std::size_t const take = std::min<std::size_t>(32 - buf_len_, bytes);
+        std::memcpy(buf_ + buf_len_, p, take);
+        buf_len_ += take;
+        p += take;
+        bytes -= take;
+        if (buf_len_ < 32) return;
+        for (int l = 0; l < 4; ++l) lanes_[l] = mix_round(lanes_[l], load64(buf_ + 8 * l));
+        buf_len_ = 0;
+    }
+
+    std::uint64_t v0 = lanes_[0], v1 = lanes_[1], v2 = lanes_[2], v3 = lanes_[3];
+    for (; bytes >= 32; p += 32, bytes -= 32) {
+        v0 = mix_round(v0, load64(p));
+        v1 = mix_round(v1, load64(p + 8));
+        v2 = mix_round(v2, load64(p + 16));
+        v3 = mix_round(v3, load64(p + 24));
+    }
+    lanes_[0] = v0; lanes_[1] = v1; lanes_[2] = v2; lanes_[3] = v3;
+
+    if (bytes != 0) {
+        std::memcpy(buf_, p, bytes);
+        buf_len_ = bytes;
+    }
+}
+
+std::uint64_t TableChecksum::digest() const noexcept {
+    std::uint64_t h = 0;
+    if (total_ >= 32) {
+        h = rotl64(lanes_[0], 1) + rotl64(lanes_[1], 7) + rotl64(lanes_[2], 12) + rotl64(lanes_[3], 18);
+        for (auto lane : lanes_) h = merge_round(h, lane);
+    } else {
+        h = lanes_[2] + P5;
+    }
+    h += total_;
+
+    std::size_t i = 0;
+    for (; i + 8 <= buf_len_; i += 8) {
+        h ^= mix_round(0, load64(buf_ + i));
+        h = rotl64(h, 27) * P1 + P4;
+    }
+    for (; i < buf_len_; ++i) {
+        h ^= buf_[i] * P5;
+        h = rotl64(h, 11) * P1;
+    }
+
+    h ^= h >> 33; h *= P2;
+    h ^= h >> 29; h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+// ============================================================================
+// MappedTable
+// ============================================================================
+
+MappedTable::~MappedTable() {
+    close();
+}
+
+void MappedTable::close() noexcept {
+    if (base_ == nullptr) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(base_);
+    if (mapping_handle_ != nullptr) CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    mapping_handle_ = nullptr;
+#else
+    ::munmap(base_, length_);
+#endif
+    base_       = nullptr;
+    length_     = 0;
+    huge_pages_ = false;
+    header_     = MappedTableHeader{};
+}
+
+bool MappedTable::open(const std::string& path, std::uint32_t kind, std::uint32_t entry_bytes,
+                       const MappedTableOptions& options) {
+    close();
+
+    // -- Map the whole file read-only, shared --------------------------------
+#if defined(_WIN32)
+    HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(sizeof(MappedTableHeader))) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) return false;
+    void* const base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (base == nullptr) {
+        CloseHandle(mapping);
+        return false;
+    }
+    base_           = base;
+    mapping_handle_ = mapping;
+    length_         = static_cast<std::size_t>(size.QuadPart);
+    (void)options.huge_pages;   // large pages need SeLockMemoryPrivilege + anonymous memory
+#else
+    int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(MappedTableHeader))) {
+        ::close(fd);
+        return false;
+    }
+    auto const length = static_cast<std::size_t>(st.st_size);
+
+    void* base = MAP_FAILED;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (options.huge_pages) {
+        // File THP needs file offset and virtual address congruent mod 2 MiB:
+        // reserve an oversized window, then map the file at its aligned start.
+        void* const reserve = ::mmap(nullptr, length + kHugePageBytes, PROT_NONE,
+                                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (reserve != MAP_FAILED) {
+            auto const r  = reinterpret_cast<std::uintptr_t>(reserve);
+            auto const al = (r + kHugePageBytes - 1) & ~(std::uintptr_t{kHugePageBytes} - 1);
+            base = ::mmap(reinterpret_cast<void*>(al), length, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0);
+            if (base == MAP_FAILED) {
+                ::munmap(reserve, length + kHugePageBytes);
+            } else {
+                auto const page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+                auto const end  = (al + length + page - 1) & ~(page - 1);
+                if (al > r) ::munmap(reserve, al - r);
+                if (r + length + kHugePageBytes > end) {
+                    ::munmap(reinterpret_cast<void*>(end), r + length + kHugePageBytes - end);
+                }
+                huge_pages_ = (::madvise(base, length, MADV_HUGEPAGE) == 0);
+            }
+        }
+    }
+#endif
+    if (base == MAP_FAILED) {
+        base = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (base == MAP_FAILED) return false;
+    base_   = base;
+    length_ = length;
+#endif
+
+    // -- Validate ------------------------------------------------------------
+    std::memcpy(&header_, base_, sizeof(header_));
+    const MappedTableHeader& h = header_;
+    bool valid = std::memcmp(h.magic, kMagic, sizeof(kMagic)) == 0
+              && h.version == kMappedTableVersion
+              && h.header_bytes == sizeof(MappedTableHeader)
+              && h.kind == kind
+              && h.byte_order == kMappedTableByteOrder
+              && h.layout == kMappedTableLayout4x64
+              && h.entry_bytes == entry_bytes
+              && h.payload_offset >= sizeof(MappedTableHeader)
+              && h.payload_offset % kMappedTablePayloadAlign == 0
+              && h.payload_offset <= length_
+              && h.payload_bytes == length_ - h.payload_offset
+              && h.entry_count <= std::numeric_limits<std::uint64_t>::max() / entry_bytes
+              && h.entry_count * entry_bytes == h.payload_bytes;
+
+    if (valid && options.verify_checksum) {
+        MappedTableHeader zeroed = h;
+        zeroed.checksum = 0;
+        TableChecksum sum;
+        sum.update(payload(), static_cast<std::size_t>(h.payload_bytes));
+        sum.update(&zeroed, sizeof(zeroed));
+        valid = (sum.digest() == h.checksum);
+    }
+#if !defined(_WIN32) && defined(MADV_WILLNEED)
+    if (valid && !options.verify_checksum) {
+        (void)::madvise(base_, length_, MADV_WILLNEED);
+    }
+#endif
+
+    if (!valid) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// MappedTableWriter
+// ============================================================================
+
+MappedTableWriter::MappedTableWriter(const std::string& path, const MappedTableHeader& header)
+    : path_(path) {
+#if defined(_WIN32)
+    tmp_path_ = path + ".tmp." + std::to_string(_getpid());
+#else
+    tmp_path_ = path + ".tmp." + std::to_string(getpid());
+#endif
+    header_ = MappedTableHeader{};
+    std::memcpy(header_.magic, kMagic, sizeof(kMagic));
+    header_.version        = kMappedTableVersion;
+    header_.header_bytes   = sizeof(MappedTableHeader);
+    header_.kind           = header.kind;
+    header_.byte_order     = kMappedTableByteOrder;
+    header_.layout         = kMappedTableLayout4x64;
+    header_.entry_bytes    = header.entry_bytes;
+    header_.param0         = header.param0;
+    header_.param1         = header.param1;
+    header_.entry_count    = header.entry_count;
+    header_.payload_offset = kMappedTablePayloadAlign;
+    header_.payload_bytes  = header.entry_count * header.entry_bytes;
+
+    file_.open(tmp_path_, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) return;
+
+    // Placeholder header + padding; the real header is written by commit().
+    static const char zeros[kMappedTablePayloadAlign] = {};
+    file_.write(zeros, sizeof(zeros));
+    ok_ = file_.good();
+}
+
+MappedTableWriter::~MappedTableWriter() {
+    if (!committed_) {
+        if (file_.is_open()) file_.close();
+        (void)std::remove(tmp_path_.c_str());
+    }
+}
+
+bool MappedTableWriter::append(const void* data, std::size_t bytes) {
+    if (!ok_) return false;
+    file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    sum_.update(data, bytes);
+    written_ += bytes;
+    ok_ = file_.good();
+    return ok_;
+}
+
+bool MappedTableWriter::commit() {
+    if (!ok_ || written_ != header_.payload_bytes) return false;
+
+    // Payload first, then the header with its checksum field zeroed.
+    header_.checksum = 0;
+    sum_.update(&header_, sizeof(header_));
+    header_.checksum = sum_.digest();
+
+    file_.seekp(0, std::ios::beg);
+    file_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+    file_.close();
+    if (!file_.good()) {
+        ok_ = false;
+        return false;
+    }
+
+    if (std::rename(tmp_path_.c_str(), path_.c_str()) != 0) {
+#if defined(_WIN32)
+        // rename() does not replace an existing file on Windows.
+        (void)std::remove(path_.c_str());
+        if (std::rename(tmp_path_.c_str(), path_.c_str()) != 0)
+#endif
+        {
+            ok_ = false;
+            return false;
+        }
+    }
+    committed_ = true;
+    return true;
+}
+
+std::string mapped_table_path(const std::string& cache_path) {
+    static const std::string bin = ".bin";
+    if (cache_path.size() > bin.size() &&
+        cache_path.compare(cache_path.size() - bin.size(), bin.size(), bin) == 0) {
+        return cache_path.substr(0, cache_path.size() - bin.size()) + ".tbl";
+    }
+    return cache_path + ".tbl";
+}
+
+} // namespace secp256k1::fast
@@ -0,0 +1,158 @@
+// ============================================================================
+// Private: Read-only mapped table files
+// ============================================================================
+// Versioned, checksummed on-disk format for large precomputed point tables
+// (fixed-base windows, comb tables). The payload is the in-memory entry
+// layout itself, so a loader maps the file read-only and points its lookups
+// straight into the mapping: every process on the host shares one page-cache
+// copy instead of holding a private heap copy.
+//
+//   [0, 128)               MappedTableHeader
+//   [128, payload_offset)  zero padding (payload_offset is 4 KiB aligned)
+//   [payload_offset, end)  entry_count x entry_bytes
+//
+// The checksum is a 64-bit stripe hash over the payload followed by the
+// header (checksum field zeroed). It detects truncation, bit rot and files
+// written by a different build; it is not a MAC. Anyone able to replace the
+// file can already replace the legacy .bin caches.
+//
+// NOT part of the public API. Do not include from headers.
+// ============================================================================
+
+#pragma once
+#ifndef SECP256K1_MAPPED_TABLE_P_HPP
+#define SECP256K1_MAPPED_TABLE_P_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace secp256k1::fast {
+
+constexpr std::uint32_t kMappedTableVersion     = 1U;
+constexpr std::uint64_t kMappedTablePayloadAlign = 4096U;
+constexpr std::uint32_t kMappedTableByteOrder   = 0x01020304U;
+constexpr std::uint32_t kMappedTableLayout4x64  = 0x34783634U;  // "4x64": FieldElement limbs as stored in memory
+
+enum MappedTableKind : std::uint32_t {
+    kMappedTableFixedBase = 1U,   // param0 = window_bits, param1 = has_glv
+    kMappedTableComb      = 2U,   // param0 = teeth,       param1 = spacing
+};
+
+struct MappedTableHeader {
+    char          magic[8];        // "UFSECPMT"
+    std::uint32_t version;         // kMappedTableVersion
+    std::uint32_t header_bytes;    // sizeof(MappedTableHeader)
+    std::uint32_t kind;            // MappedTableKind
+    std::uint32_t byte_order;      // kMappedTableByteOrder as written by the host
+    std::uint32_t layout;          // kMappedTableLayout4x64
+    std::uint32_t entry_bytes;     // sizeof(entry) in the writing build
+    std::uint32_t param0;
+    std::uint32_t param1;
+    std::uint64_t entry_count;
+    std::uint64_t payload_offset;
+    std::uint64_t payload_bytes;
+    std::uint64_t checksum;
+    std::uint8_t  reserved[56];
+};
+static_assert(sizeof(MappedTableHeader) == 128, "MappedTableHeader must stay 128 bytes");
+
+// Streaming 4-lane 64-bit stripe hash (xxHash64-style rounds).
+class TableChecksum {
+public:
+    TableChecksum() noexcept;
+    void update(const void* data, std::size_t bytes) noexcept;
+    std::uint64_t digest() const noexcept;
+
+private:
+    std::uint64_t lanes_[4];
+    std::uint8_t  buf_[32];
+    std::size_t   buf_len_ = 0;
+    std::uint64_t total_   = 0;
+};
+
+struct MappedTableOptions {
+    bool huge_pages      = false;   // 2 MiB aligned mapping + MADV_HUGEPAGE
+    bool verify_checksum = true;    // hash the payload once on open
+};
+
+// A read-only, shared mapping of one table file. Closed on destruction.
+class MappedTable {
+public:
+    MappedTable() = default;
+    ~MappedTable();
+    MappedTable(const MappedTable&) = delete;
+    MappedTable& operator=(const MappedTable&) = delete;
+
+    // Map `path` and validate the header against kind / entry_bytes, the file
+    // size and (optionally) the checksum. Returns false and stays closed on
+    // any mismatch.
+    bool open(const std::string& path, std::uint32_t kind, std::uint32_t entry_bytes,
+              const MappedTableOptions& options);
+    void close() noexcept;
+
+    bool is_open() const noexcept { return base_ != nullptr; }
+    const MappedTableHeader& header() const noexcept { return header_; }
+    const void* payload() const noexcept {
+        return static_cast<const std::uint8_t*>(base_) + header_.payload_offset;
+    }
+    std::size_t mapped_bytes() const noexcept { return length_; }
+    bool huge_pages() const noexcept { return huge_pages_; }
+
+private:
+    void*             base_   = nullptr;
+    std::size_t       length_ = 0;
+    bool              huge_pages_ = false;
+    MappedTableHeader header_{};
+#if defined(_WIN32)
+    void*             mapping_handle_ = nullptr;
+#endif
+};
+
+// Writes a table file atomically: payload is streamed to "<path>.tmp.<pid>",
+// the header (with checksum) is written last, then the file is renamed over
+// `path`, so concurrent readers see either the old or the new complete file.
+class MappedTableWriter {
+public:
+    // `header` supplies kind, entry_bytes, param0/1 and entry_count; the
+    // writer fills in the remaining fields.
+    MappedTableWriter(const std::string& path, const MappedTableHeader& header);
+    ~MappedTableWriter();
+    MappedTableWriter(const MappedTableWriter&) = delete;
+    MappedTableWriter& operator=(const MappedTableWriter&) = delete;
+
+    bool ok() const noexcept { return ok_; }
+    bool append(const void* data, std::size_t bytes);
+    bool commit();
+
+private:
+    std::string       path_;
+    std::string       tmp_path_;
+    std::ofstream     file_;
+    MappedTableHeader header_{};
+    TableChecksum     sum_;
+    std::uint64_t     written_   = 0;
+    bool              ok_        = false;
+    bool              committed_ = false;
+};
+
+// Zero-initialised copy of {x, y, infinity} entries, so padding bytes in the
+// written payload are deterministic.
+template <class Entry>
+inline void copy_table_entries(Entry* dst, const Entry* src, std::size_t n) noexcept {
+    std::memset(static_cast<void*>(dst), 0, n * sizeof(Entry));
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i].x        = src[i].x;
+        dst[i].y        = src[i].y;
+        dst[i].infinity = src[i].infinity;
+    }
+}
+
+// "<dir>/cache_w18_glv.bin" -> "<dir>/cache_w18_glv.tbl"; other names get ".tbl" appended.
+std::string mapped_table_path(const std::string& cache_path);
+
+} // namespace secp256k1::fast
+
+#endif // SECP256K1_MAPPED_TABLE_P_HPP
@@ -15,9 +15,11 @@
 #include "secp256k1/pippenger.hpp"
 #include "secp256k1/multiscalar.hpp"
 #include "secp256k1/config.hpp"
+#include "secp256k1/thread_pool.hpp"
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <stdexcept>
 
 namespace secp256k1 {
 
@@ -235,14 +237,28 @@ Point pippenger_msm(const Scalar* scalars,
                     used[abs_d] = 1;
                     touched[touched_count++] = abs_d;
                     max_touched_digit = std::max(max_touched_digit, abs_d);
+                    if (!all_affine) {
+                        buckets[abs_d] = points[i];
+                    } else {
 #if defined(SECP256K1_FAST_52BIT)
-                    buckets[abs_d] = Point::from_affine52(points[i].X52(), points[i].Y52());
+                        buckets[abs_d] = Point::from_affine52(points[i].X52(), points[i].Y52());
 #else
-                    buckets[abs_d] = Point::from_affine(points[i].X(), points[i].Y());
+                        buckets[abs_d] = Point::from_affine(points[i].X(), points[i].Y());
 #endif
+                    }
                     if (is_neg) buckets[abs_d].negate_inplace();
                     continue;
                 }
+                // Jacobian input: the mixed-add fast path below needs z = 1.
+                if (!all_affine) {
+                    if (is_neg) {
+                        buckets[abs_d].add_inplace(points[i].negate());
+                    } else {
+                        buckets[abs_d].add_inplace(points[i]);
+                    }
+                    used[abs_d] = 2;
+                    continue;
+                }
 #if defined(SECP256K1_FAST_52BIT)
                 if (is_neg) {
                     buckets[abs_d].add_mixed52_neg_inplace(points[i].X52(), points[i].Y52());
@@ -373,6 +389,280 @@ Point pippenger_msm(const Scalar* scalars,
 // Not yet enabled by default -- the unsigned version above is simpler and
 // already very fast. This is provided for future optimization.
 
+// -- Affine-bucket Pippenger --------------------------------------------------
+// Per window: counting-sort the (signed) points by bucket, then reduce every
+// bucket by pairwise affine additions. One round adds pair (2t, 2t+1) of every
+// bucket with a single inversion of all the round's denominators, so a bucket
+// of k points needs ceil(log2 k) rounds; the window's inversion count is the
+// depth of its deepest bucket, not the number of adds.
+//
+// Degenerate pairs are folded into the same batch: P + P uses the tangent
+// slope 3x^2 / 2y, P + (-P) drops both entries (denominator replaced by 1).
+
+namespace {
+
+#if defined(SECP256K1_FAST_52BIT)
+using AffineFe = fast::FieldElement52;
+inline bool afe_is_zero(const AffineFe& a) noexcept { return a.normalizes_to_zero_var(); }
+#else
+using AffineFe = fast::FieldElement;
+inline bool afe_is_zero(const AffineFe& a) noexcept { return a == AffineFe::zero(); }
+#endif
+
+// Pair kinds within a reduction round.
+constexpr std::uint8_t kPairAdd    = 0;
+constexpr std::uint8_t kPairCancel = 1;   // P + (-P): both entries vanish
+
+struct AffineBucketScratch {
+    std::vector<AffineFe>      px, py;     // input points, affine, magnitude 1
+    std::vector<AffineFe>      bx, by;     // current window, grouped by bucket
+    std::vector<AffineFe>      num, den, acc;
+    std::vector<std::uint8_t>  kind;
+    std::vector<std::uint32_t> start, len; // bucket b occupies [start, start + len)
+    std::vector<std::uint32_t> active, next_active;
+};
+
+// Reduce every bucket in s.active to at most one entry.
+void reduce_buckets_affine(AffineBucketScratch& s) {
+    while (!s.active.empty()) {
+        // Pass 1: slope numerators / denominators and prefix products.
+        std::size_t m = 0;
+        for (std::uint32_t const b : s.active) {
+            std::uint32_t const base  = s.start[b];
+            std::uint32_t const pairs = s.len[b] >> 1;
+            for (std::uint32_t t = 0; t < pairs; ++t) {
+                std::uint32_t const i = base + 2 * t;
+                AffineFe const dx = s.bx[i + 1] + s.bx[i].negate(1);
+                AffineFe const dy = s.by[i + 1] + s.by[i].negate(1);
+                s.kind[m] = kPairAdd;
+                if (SECP256K1_UNLIKELY(afe_is_zero(dx))) {
+                    if (afe_is_zero(dy)) {
+                        // Doubling: lambda = 3x^2 / 2y (y != 0 on secp256k1).
+                        AffineFe const x2 = s.bx[i].square();
+                        s.num[m] = x2 + x2 + x2;
+                        s.den[m] = s.by[i] + s.by[i];
+                    } else {
+                        s.kind[m] = kPairCancel;
+                        s.den[m]  = AffineFe::one();
+                    }
+                } else {
+                    s.num[m] = dy;
+                    s.den[m] = dx;
+                }
+                s.acc[m] = (m == 0) ? s.den[0] : s.acc[m - 1] * s.den[m];
+                ++m;
+            }
+        }
+
+        // Montgomery's trick: one inversion, den[p] <- 1 / den[p].
+        AffineFe inv = s.acc[m - 1].inverse();
+        for (std::size_t p = m - 1; p > 0; --p) {
+            AffineFe const next = inv * s.den[p];
+            s.den[p] = inv * s.acc[p - 1];
+            inv = next;
+        }
+        s.den[0] = inv;
+
+        // Pass 2: sums, compacted to the front of each bucket. Entry t is
+        // written at or below slot 2t, so reads of later pairs stay intact.
+        s.next_active.clear();
+        m = 0;
+        for (std::uint32_t const b : s.active) {
+            std::uint32_t const base  = s.start[b];
+            std::uint32_t const pairs = s.len[b] >> 1;
+            std::uint32_t out = base;
+            for (std::uint32_t t = 0; t < pairs; ++t, ++m) {
+                if (SECP256K1_UNLIKELY(s.kind[m] == kPairCancel)) continue;
+                std::uint32_t const i = base + 2 * t;
+                AffineFe const lambda = s.num[m] * s.den[m];
+                AffineFe x3 = lambda.square() + s.bx[i].negate(1) + s.bx[i + 1].negate(1);
+                x3.normalize_weak();
+                AffineFe y3 = lambda * (s.bx[i] + x3.negate(1)) + s.by[i].negate(1);
+                y3.normalize_weak();
+                s.bx[out] = x3;
+                s.by[out] = y3;
+                ++out;
+            }
+            if ((s.len[b] & 1U) != 0) {
+                s.bx[out] = s.bx[base + s.len[b] - 1];
+                s.by[out] = s.by[base + s.len[b] - 1];
+                ++out;
+            }
+            s.len[b] = out - base;
+            if (s.len[b] >= 2) s.next_active.push_back(b);
+        }
+        s.active.swap(s.next_active);
+    }
+}
+
+} // anonymous namespace
+
+Point pippenger_msm_affine(const Scalar* scalars,
+                           const Point* points,
+                           std::size_t n) {
+    if (n == 0) return Point::infinity();
+    if (n == 1) return points[0].scalar_mul(scalars[0]);
+    if (n > UINT32_MAX / 2) return pippenger_msm(scalars, points, n);
+
+    unsigned const c = std::max(2U, pippenger_optimal_window(n));
+    unsigned const num_windows = 256 / c + 1;
+    std::size_t const half = std::size_t{1} << (c - 1);
+    std::int32_t const base = std::int32_t{1} << c;
+
+    AffineBucketScratch s;
+
+    // Affine inputs, one batched inversion for any Jacobian points.
+    s.px.resize(n);
+    s.py.resize(n);
+    std::vector<std::uint8_t> skip(n);
+    bool all_affine = true;
+    for (std::size_t i = 0; i < n; ++i) {
+        skip[i] = static_cast<std::uint8_t>(points[i].is_infinity() || scalars[i].is_zero());
+        if (!skip[i] && !points[i].is_normalized()) all_affine = false;
+    }
+    if (all_affine) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (skip[i]) continue;
+#if defined(SECP256K1_FAST_52BIT)
+            s.px[i] = points[i].X52();
+            s.py[i] = points[i].Y52();
+            s.px[i].normalize_weak();
+            s.py[i].normalize_weak();
+#else
+            s.px[i] = points[i].X();
+            s.py[i] = points[i].Y();
+#endif
+        }
+    } else {
+        std::vector<fast::FieldElement> ax(n), ay(n);
+        Point::batch_normalize(points, n, ax.data(), ay.data());
+        for (std::size_t i = 0; i < n; ++i) {
+#if defined(SECP256K1_FAST_52BIT)
+            s.px[i] = AffineFe::from_fe(ax[i]);
+            s.py[i] = AffineFe::from_fe(ay[i]);
+#else
+            s.px[i] = ax[i];
+            s.py[i] = ay[i];
+#endif
+        }
+    }
+
+    // Signed digits, window-major: digits[w * n + i] in [-2^(c-1), 2^(c-1)].
+    std::vector<std::int16_t> digits(static_cast<std::size_t>(num_windows) * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (skip[i]) continue;
+        std::int32_t carry = 0;
+        for (unsigned w = 0; w < num_windows; ++w) {
+            unsigned const bit_off = w * c;
+            std::int32_t d = carry + ((bit_off < 256)
+                ? static_cast<std::int32_t>(extract_digit(scalars[i], bit_off, std::min(c, 256 - bit_off)))
+                : 0);
+            carry = 0;
+            if (d > static_cast<std::int32_t>(half)) {
+                d -= base;
+                carry = 1;
+            }
+            digits[static_cast<std::size_t>(w) * n + i] = static_cast<std::int16_t>(d);
+        }
+    }
+
+    s.bx.resize(n);
+    s.by.resize(n);
+    s.num.resize(n / 2 + 1);
+    s.den.resize(n / 2 + 1);
+    s.acc.resize(n / 2 + 1);
+    s.kind.resize(n / 2 + 1);
+    s.start.resize(half + 2);
+    s.len.resize(half + 1);
+    s.active.reserve(half);
+    s.next_active.reserve(half);
+
+    Point result = Point::infinity();
+    for (int w = static_cast<int>(num_windows) - 1; w >= 0; --w) {
+        if (w < static_cast<int>(num_windows) - 1) {
+            for (unsigned shift = 0; shift < c; ++shift) result.dbl_inplace();
+        }
+        std::int16_t const* row = digits.data() + static_cast<std::size_t>(w) * n;
+
+        // Counting sort by |digit|; negative digits store -P.
+        std::fill(s.len.begin(), s.len.end(), 0U);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (row[i] != 0) ++s.len[static_cast<std::size_t>(row[i] < 0 ? -row[i] : row[i])];
+        }
+        std::uint32_t total = 0;
+        for (std::size_t b = 0; b <= half; ++b) {
+            s.start[b] = total;
+            total += s.len[b];
+        }
+        s.start[half + 1] = total;
+        if (total == 0) continue;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::int32_t const d = row[i];
+            if (d == 0) continue;
+            std::size_t const b = static_cast<std::size_t>(d < 0 ? -d : d);
+            std::uint32_t const slot = s.start[b + 1] - s.len[b]--;
+            s.bx[slot] = s.px[i];
+            if (d < 0) {
+                s.by[slot] = s.py[i].negate(1);
+                s.by[slot].normalize_weak();
+            } else {
+                s.by[slot] = s.py[i];
+            }
+        }
+        s.active.clear();
+        std::size_t max_bucket = 0;
+        for (std::size_t b = 1; b <= half; ++b) {
+            s.len[b] = s.start[b + 1] - s.start[b];
+            if (s.len[b] != 0) max_bucket = b;
+            if (s.len[b] >= 2) s.active.push_back(static_cast<std::uint32_t>(b));
+        }
+
+        reduce_buckets_affine(s);
+
+        // Aggregate: running sum over affine buckets (mixed adds).
+        Point running_sum = Point::infinity();
+        Point partial_sum = Point::infinity();
+        bool running_nonempty = false;
+        bool partial_nonempty = false;
+        for (std::size_t b = max_bucket; b >= 1; --b) {
+            if (s.len[b] != 0) {
+                std::uint32_t const k = s.start[b];
+                if (running_nonempty) {
+#if defined(SECP256K1_FAST_52BIT)
+                    running_sum.add_mixed52_inplace(s.bx[k], s.by[k]);
+#else
+                    running_sum.add_mixed_inplace(s.bx[k], s.by[k]);
+#endif
+                } else {
+#if defined(SECP256K1_FAST_52BIT)
+                    running_sum = Point::from_affine52(s.bx[k], s.by[k]);
+#else
+                    running_sum = Point::from_affine(s.bx[k], s.by[k]);
+#endif
+                    running_nonempty = true;
+                }
+            }
+            if (running_nonempty) {
+                if (partial_nonempty) {
+                    partial_sum.add_inplace(running_sum);
+                } else {
+                    partial_sum = running_sum;
+                    partial_nonempty = true;
+                }
+            }
+        }
+        if (partial_nonempty) result.add_inplace(partial_sum);
+    }
+    return result;
+}
+
+Point pippenger_msm_affine(const std::vector<Scalar>& scalars,
+                           const std::vector<Point>& points) {
+    std::size_t const n = std::min(scalars.size(), points.size());
+    if (n == 0) return Point::infinity();
+    return pippenger_msm_affine(scalars.data(), points.data(), n);
+}
+
 // -- Vector convenience -------------------------------------------------------
 Point pippenger_msm(const std::vector<Scalar>& scalars,
                     const std::vector<Point>& points) {
@@ -385,15 +675,41 @@ Point pippenger_msm(const std::vector<Scalar>& scalars,
 // Strauss for very small MSMs, Pippenger from n >= 48.
 // Current crossover on the optimized CPU path is ~48 points.
 // N=64 Schnorr batch -> 128 points in MSM -> Pippenger path.
+//
+// Affine buckets from n >= 1024 (c=8, ~8 points per bucket): measured
+// 1.1-1.4x over Jacobian buckets at 1k-64k points. Below that the per-round
+// inversion and the shallow buckets (4 rounds at n=512, c=7) eat the gain.
+static constexpr std::size_t kAffineMsmMinPoints = 1024;
+
+MsmEngine msm_select_engine(std::size_t n) {
+    if (n < 48) return MsmEngine::Strauss;
+    if (n < kAffineMsmMinPoints) return MsmEngine::Pippenger;
+    return MsmEngine::PippengerAffine;
+}
+
 Point msm(const Scalar* scalars,
           const Point* points,
-          std::size_t n) {
-    if (n < 48) {
+          std::size_t n,
+          MsmEngine engine) {
+    if (engine == MsmEngine::Auto) engine = msm_select_engine(n);
+    switch (engine) {
+    case MsmEngine::Strauss:
         return multi_scalar_mul(scalars, points, n);
+    case MsmEngine::PippengerAffine:
+        return pippenger_msm_affine(scalars, points, n);
+    case MsmEngine::Pippenger:
+    case MsmEngine::Auto:
+        break;
     }
     return pippenger_msm(scalars, points, n);
 }
 
+Point msm(const Scalar* scalars,
+          const Point* points,
+          std::size_t n) {
+    return msm(scalars, points, n, MsmEngine::Auto);
+}
+
 Point msm(const std::vector<Scalar>& scalars,
           const std::vector<Point>& points) {
     std::size_t const n = std::min(scalars.size(), points.size());
@@ -401,4 +717,233 @@ Point msm(const std::vector<Scalar>& scalars,
     return msm(scalars.data(), points.data(), n);
 }
 
+// -- Parallel MSM (point-set partition) ---------------------------------------
+// Window partition (each thread owns a subset of the c-bit windows) needs the
+// digit table shared and ends with a serial doubling chain per window; point
+// partition reuses the single-thread kernel unchanged and scales with the
+// number of slices. Below ~2048 points per slice the smaller window width
+// chosen for the slice costs more than the extra participant saves.
+static constexpr std::size_t kParallelMsmMinSlice = 2048;
+
+Point msm_parallel(const Scalar* scalars,
+                   const Point* points,
+                   std::size_t n,
+                   ThreadPool& pool,
+                   unsigned max_threads) {
+    unsigned const threads = (max_threads == 0) ? pool.size()
+                                                : std::min(max_threads, pool.size());
+    std::size_t const parts = std::min<std::size_t>(threads, n / kParallelMsmMinSlice);
+    if (parts <= 1) return msm(scalars, points, n);
+
+    std::size_t const per = (n + parts - 1) / parts;
+    std::vector<Point> partial(parts, Point::infinity());
+    pool.parallel_for(parts, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+            std::size_t const lo = p * per;
+            if (lo >= n) continue;
+            partial[p] = msm(scalars + lo, points + lo, std::min(per, n - lo));
+        }
+    });
+
+    Point result = partial[0];
+    for (std::size_t p = 1; p < parts; ++p) result.add_inplace(partial[p]);
+    return result;
+}
+
+// -- Prepared MSM -------------------------------------------------------------
+// One bucket set for all windows: digit j of s_i lands in bucket |d| as
+// +-(2^(c*j) * P_i), so sum_b b * bucket[b] is already the full MSM.
+
+unsigned prepared_msm_optimal_window(std::size_t n) {
+    if (n == 0) return 2;
+    unsigned best_c = 2;
+    double best_cost = 0.0;
+    for (unsigned c = 2; c <= PreparedMsm::kMaxWindowBits; ++c) {
+        double const cost = static_cast<double>(n) * static_cast<double>(256 / c + 1)
+                          + static_cast<double>(std::size_t{1} << c);
+        if (c == 2 || cost < best_cost) {
+            best_cost = cost;
+            best_c = c;
+        }
+    }
+    return best_c;
+}
+
+PreparedMsm::PreparedMsm(const Point* points, std::size_t n, unsigned window_bits)
+    : n_(n) {
+    if (window_bits == 0) window_bits = prepared_msm_optimal_window(n);
+    if (window_bits < 2 || window_bits > kMaxWindowBits) {
+        throw std::invalid_argument("PreparedMsm: window_bits must be 0 or 2..16");
+    }
+    c_ = window_bits;
+    windows_ = 256 / c_ + 1;   // +1 absorbs the signed-digit carry (see BUG-01 above)
+    table_.resize(n * windows_);
+    infinity_.assign(n, 0);
+
+    // Jacobian multiples per point (c doublings between windows), normalized
+    // in chunks with one shared inversion each.
+    constexpr std::size_t kChunk = 1024;
+    std::vector<Point> jac;
+    std::vector<fast::FieldElement> xs(kChunk + windows_);
+    std::vector<fast::FieldElement> ys(kChunk + windows_);
+    jac.reserve(kChunk + windows_);
+    std::size_t chunk_first = 0;   // table_ index of jac[0]
+    auto flush = [&]() {
+        if (jac.empty()) return;
+        Point::batch_normalize(jac.data(), jac.size(), xs.data(), ys.data());
+        for (std::size_t k = 0; k < jac.size(); ++k) {
+#if defined(SECP256K1_FAST_52BIT)
+            table_[chunk_first + k] = {fast::FieldElement52::from_fe(xs[k]),
+                                       fast::FieldElement52::from_fe(ys[k])};
+#else
+            table_[chunk_first + k] = {xs[k], ys[k]};
+#endif
+        }
+        chunk_first += jac.size();
+        jac.clear();
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        if (jac.size() >= kChunk) flush();
+        if (points[i].is_infinity()) {
+            infinity_[i] = 1;
+            flush();
+            chunk_first += windows_;   // entries stay zero, never read
+            continue;
+        }
+        Point q = points[i];
+        for (unsigned j = 0; j < windows_; ++j) {
+            jac.push_back(q);
+            if (j + 1 < windows_) {
+                for (unsigned d = 0; d < c_; ++d) q.dbl_inplace();
+            }
+        }
+    }
+    flush();
+}
+
+PreparedMsm::PreparedMsm(const std::vector<Point>& points, unsigned window_bits)
+    : PreparedMsm(points.data(), points.size(), window_bits) {}
+
+std::size_t PreparedMsm::memory_bytes() const noexcept {
+    return table_.size() * sizeof(Entry) + infinity_.size();
+}
+
+Point PreparedMsm::msm_range(const Scalar* scalars, std::size_t begin, std::size_t end) const {
+    if (begin >= end) return Point::infinity();
+    unsigned const c = c_;
+    std::size_t const half = std::size_t{1} << (c - 1);
+    std::int32_t const base = std::int32_t{1} << c;
+
+    static thread_local std::vector<Point>        tl_buckets;
+    static thread_local std::vector<std::uint8_t> tl_used;
+    if (tl_buckets.size() < half + 1) tl_buckets.resize(half + 1);
+    if (tl_used.size()    < half + 1) tl_used.resize(half + 1);
+    Point*        buckets = tl_buckets.data();
+    std::uint8_t* used    = tl_used.data();
+    std::memset(used, 0, (half + 1) * sizeof(std::uint8_t));
+    std::size_t max_touched = 0;
+
+    // used[b]: 0 = empty, 1 = one affine entry (z = 1), 2 = Jacobian sum
+    std::int32_t digits[256 / 2 + 1];
+    for (std::size_t i = begin; i < end; ++i) {
+        if (infinity_[i] != 0 || scalars[i].is_zero()) continue;
+
+        std::int32_t carry = 0;
+        for (unsigned j = 0; j < windows_; ++j) {
+            unsigned const bit_off = j * c;
+            std::int32_t d = carry + ((bit_off < 256)
+                ? static_cast<std::int32_t>(extract_digit(scalars[i], bit_off, c)) : 0);
+            carry = 0;
+            if (d > static_cast<std::int32_t>(half)) {
+                d -= base;
+                carry = 1;
+            }
+            digits[j] = d;
+        }
+
+        const Entry* row = table_.data() + i * windows_;
+        for (unsigned j = 0; j < windows_; ++j) {
+            std::int32_t const d = digits[j];
+            if (d == 0) continue;
+            bool const is_neg = d < 0;
+            std::size_t const b = static_cast<std::size_t>(is_neg ? -d : d);
+            const Entry& e = row[j];
+            if (!used[b]) {
+                used[b] = 1;
+                max_touched = std::max(max_touched, b);
+#if defined(SECP256K1_FAST_52BIT)
+                buckets[b] = Point::from_affine52(e.x, e.y);
+#else
+                buckets[b] = Point::from_affine(e.x, e.y);
+#endif
+                if (is_neg) buckets[b].negate_inplace();
+                continue;
+            }
+#if defined(SECP256K1_FAST_52BIT)
+            if (is_neg) buckets[b].add_mixed52_neg_inplace(e.x, e.y);
+            else        buckets[b].add_mixed52_inplace(e.x, e.y);
+#else
+            if (is_neg) buckets[b].sub_mixed_inplace(e.x, e.y);
+            else        buckets[b].add_mixed_inplace(e.x, e.y);
+#endif
+            used[b] = 2;
+        }
+    }
+
+    // Running-sum aggregation, as in pippenger_msm, once for all windows.
+    Point running_sum = Point::infinity();
+    Point partial_sum = Point::infinity();
+    bool running_nonempty = false;
+    bool partial_nonempty = false;
+    for (std::size_t b = max_touched; b >= 1; --b) {
+        if (used[b] != 0) {
+            if (running_nonempty) {
+                running_sum.add_inplace(buckets[b]);
+            } else {
+                running_sum = buckets[b];
+                running_nonempty = true;
+            }
+        }
+        if (running_nonempty) {
+            if (partial_nonempty) {
+                partial_sum.add_inplace(running_sum);
+            } else {
+                partial_sum = running_sum;
+                partial_nonempty = true;
+            }
+        }
+    }
+    return partial_nonempty ? partial_sum : Point::infinity();
+}
+
+Point PreparedMsm::msm(const Scalar* scalars, std::size_t n) const {
+    return msm_range(scalars, 0, std::min(n, n_));
+}
+
+Point PreparedMsm::msm(const std::vector<Scalar>& scalars) const {
+    return msm(scalars.data(), scalars.size());
+}
+
+Point PreparedMsm::msm(const Scalar* scalars, std::size_t n, ThreadPool& pool) const {
+    n = std::min(n, n_);
+    // A slice pays one full aggregation (~2^c adds); keep it a small share.
+    std::size_t const min_slice = std::max<std::size_t>(std::size_t{4} << c_, 256);
+    std::size_t const parts = std::min<std::size_t>(pool.size(), n / min_slice);
+    if (parts <= 1) return msm_range(scalars, 0, n);
+
+    std::size_t const per = (n + parts - 1) / parts;
+    std::vector<Point> partial(parts, Point::infinity());
+    pool.parallel_for(parts, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+            std::size_t const lo = p * per;
+            if (lo >= n) continue;
+            partial[p] = msm_range(scalars, lo, std::min(n, lo + per));
+        }
+    });
+
+    Point result = partial[0];
+    for (std::size_t p = 1; p < parts; ++p) result.add_inplace(partial[p]);
+    return result;
+}
+
 } // namespace secp256k1
@@ -78,6 +78,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -103,6 +104,7 @@
 #include <queue>
 #include <condition_variable>
 #include <sstream>
+#include "mapped_table_p.hpp"
 #endif
 
 #if (SECP256K1_DEBUG_SPLIT || SECP256K1_DEBUG_GLV || SECP256K1_PROFILE_DECOMP) && !SECP256K1_ESP32_BUILD
@@ -445,6 +447,15 @@ SECP256K1_INLINE void batch_inverse(std::vector<FieldElement>& inputs) {
     return {x3, y3, z3, false};
 }
 
+// One window's entries, over owned (vector) or mapped storage.
+struct WindowSpan {
+    const AffinePointPacked* entries{nullptr};
+    std::size_t count{0};
+
+    [[nodiscard]] std::size_t size() const noexcept { return count; }
+    const AffinePointPacked& operator[](std::size_t i) const noexcept { return entries[i]; }
+};
+
 struct PrecomputeContext {
     FixedBaseConfig config{};
     unsigned window_bits{0};
@@ -453,8 +464,22 @@ struct PrecomputeContext {
     FieldElement beta;
     std::vector<std::vector<AffinePointPacked>> base_tables;
     std::vector<std::vector<AffinePointPacked>> psi_tables;
+    // Per-window views used by every lookup. They point into base_tables /
+    // psi_tables, or into `mapping` when the tables are a shared read-only
+    // file mapping (base_tables / psi_tables then stay empty).
+    std::vector<WindowSpan> base_windows;
+    std::vector<WindowSpan> psi_windows;
+    std::shared_ptr<const void> mapping;
+    bool huge_pages{false};
 };
 
+void bind_owned_windows(PrecomputeContext& ctx) {
+    ctx.base_windows.clear();
+    ctx.psi_windows.clear();
+    for (const auto& window : ctx.base_tables) ctx.base_windows.push_back({window.data(), window.size()});
+    for (const auto& window : ctx.psi_tables) ctx.psi_windows.push_back({window.data(), window.size()});
+}
+
 [[nodiscard]] std::size_t expected_window_count(unsigned window_bits) {
     return (256U + window_bits - 1U) / window_bits;
 }
@@ -477,6 +502,13 @@ struct PrecomputeContext {
     if (ctx.digit_count != expected_digit_count(ctx.window_bits)) {
         return false;
     }
+    if (ctx.base_windows.size() != ctx.window_count ||
+        ctx.psi_windows.size() != (ctx.config.enable_glv ? ctx.window_count : 0U)) {
+        return false;
+    }
+    if (ctx.mapping) {
+        return ctx.base_tables.empty() && ctx.psi_tables.empty();
+    }
     if (ctx.base_tables.size() != ctx.window_count) {
         return false;
     }
@@ -638,6 +670,31 @@ FixedBaseConfig g_config{};
 // preventing a use-after-free (PRECOMPUTE-GCONTEXT-UAF). build_context() still returns
 // a unique_ptr, which converts to shared_ptr on assignment.
 std::shared_ptr<PrecomputeContext> g_context;
+// How g_context was obtained; reset together with it.
+FixedBaseLoadInfo g_load_info{};
+
+#if !SECP256K1_ESP32_BUILD
+// Interim table window for FixedBaseConfig::background_load.
+constexpr unsigned kFallbackWindowBits = 8U;
+
+// State of the background loader. Guarded by g_mutex except the progress
+// counters, which its worker (and build_context's workers) bump lock-free.
+struct BackgroundLoad {
+    bool active = false;                          // worker thread running
+    bool failed = false;                          // worker gave up; w=8 table stays live
+    std::shared_ptr<std::atomic<bool>> cancel;    // per worker, set by configure_fixed_base
+    ProgressCallback user_callback = nullptr;     // forwarded from FixedBaseConfig
+    std::atomic<std::size_t> points_done{0};
+    std::atomic<std::size_t> points_total{0};
+    std::condition_variable done_cv;
+
+    BackgroundLoad() = default;
+    BackgroundLoad(const BackgroundLoad&) = delete;
+    BackgroundLoad& operator=(const BackgroundLoad&) = delete;
+    ~BackgroundLoad();
+};
+BackgroundLoad g_background;
+#endif
 
 Scalar make_scalar(const std::array<std::uint8_t, 32>& bytes) {
     return Scalar::from_bytes(bytes);
@@ -1071,11 +1128,39 @@ void fill_tables_for_window(const Point& base_point,
     }
 
     Point current = base_point;
+#if SECP256K1_ESP32_BUILD
     base_table[1] = to_affine(current);
     for (std::size_t digit = 2; digit < digit_count; ++digit) {
         current.add_inplace(base_point);
         base_table[digit] = to_affine(current);
     }
+#else
+    // Jacobian multiples (mixed additions of the affine base) in chunks, one
+    // shared inversion per chunk (Point::batch_normalize) instead of one per entry.
+    Point affine_base = base_point;
+    affine_base.normalize();
+    FieldElement const bx = affine_base.x();
+    FieldElement const by = affine_base.y();
+    constexpr std::size_t kChunk = 256;
+    std::vector<Point> chunk(kChunk);
+    std::vector<FieldElement> xs(kChunk);
+    std::vector<FieldElement> ys(kChunk);
+    for (std::size_t first = 1; first < digit_count; first += kChunk) {
+        std::size_t const n = std::min(kChunk, digit_count - first);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (first + i > 1) {
+                current.add_mixed_inplace(bx, by);
+            }
+            chunk[i] = current;
+        }
+        Point::batch_normalize(chunk.data(), n, xs.data(), ys.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            base_table[first + i] = chunk[i].is_infinity()
+                ? AffinePointPacked{FieldElement::zero(), FieldElement::one(), true}
+                : AffinePointPacked{xs[i], ys[i], false};
+        }
+    }
+#endif
 
     if (psi_table != nullptr) {
         psi_table->resize(digit_count);
@@ -1346,7 +1431,10 @@ struct WindowData {
     return ctx;
 }
 
-std::unique_ptr<PrecomputeContext> build_context(const FixedBaseConfig& config) {
+// `cancel` (optional) abandons the build between windows; the caller then
+// discards the incomplete context.
+std::unique_ptr<PrecomputeContext> build_context(const FixedBaseConfig& config,
+                                                 const std::atomic<bool>* cancel = nullptr) {
     if (config.window_bits < 2U || config.window_bits > 30U) {
         throw std::runtime_error("window_bits must be between 2 and 30");
     }
@@ -1395,6 +1483,9 @@ std::unique_ptr<PrecomputeContext> build_context(const FixedBaseConfig& config)
             if (window >= ctx->window_count) {
                 break;
             }
+            if (cancel != nullptr && cancel->load(std::memory_order_relaxed)) {
+                break;
+            }
             std::vector<AffinePointPacked>* psi_ptr = config.enable_glv ? &ctx->psi_tables[window] : nullptr;
             fill_tables_for_window(window_bases[window], ctx->digit_count, ctx->beta, ctx->base_tables[window], psi_ptr);
             
@@ -1418,7 +1509,11 @@ std::unique_ptr<PrecomputeContext> build_context(const FixedBaseConfig& config)
             thread.join();
         }
     }
+    if (cancel != nullptr && cancel->load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
 
+    bind_owned_windows(*ctx);
     return ctx;
 }
 #endif // !SECP256K1_ESP32_BUILD
@@ -1449,6 +1544,7 @@ std::unique_ptr<PrecomputeContext> build_context(const FixedBaseConfig& config)
         }
     }
 
+    bind_owned_windows(*ctx);
     return ctx;
 }
 #endif
@@ -2232,17 +2328,17 @@ ScalarDecomposition split_scalar_internal(const Scalar& scalar) {
 #if defined(__clang__)
 __attribute__((no_sanitize("memory")))
 #endif
-std::string get_default_cache_path(unsigned window_bits) {
+std::string get_default_cache_path(const FixedBaseConfig& config) {
     // Build cache filename with GLV suffix if enabled
-    std::string filename = "cache_w" + std::to_string(window_bits);
-    if (g_config.enable_glv) {
+    std::string filename = "cache_w" + std::to_string(config.window_bits);
+    if (config.enable_glv) {
         filename += "_glv";
     }
     filename += ".bin";
     
     // Use configured cache directory
-    if (!g_config.cache_dir.empty()) {
-        std::string cache_path = g_config.cache_dir + "/" + filename;
+    if (!config.cache_dir.empty()) {
+        std::string cache_path = config.cache_dir + "/" + filename;
         // Use stat() instead of std::filesystem::exists() to avoid
         // MSan false positives from uninstrumented libstdc++ internals.
         struct stat st;
@@ -2294,14 +2390,7 @@ bool read_affine_point(std::ifstream& file, AffinePointPacked& point) {
     return true;
 }
 
-// Internal version without lock - must be called with g_mutex already locked
-bool save_precompute_cache_locked(const std::string& path) {
-    if (!g_context) {
-        return false;  // Nothing to save
-    }
-    
-    PrecomputeContext const& ctx = *g_context;
-    
+bool write_precompute_cache(const PrecomputeContext& ctx, const std::string& path) {
     // Atomic write: write to a temporary file, then rename.
     // This prevents cross-process races where a reader sees a partially-written file
     // (e.g. when CTest runs tests in parallel with -j).
@@ -2333,9 +2422,9 @@ bool save_precompute_cache_locked(const std::string& path) {
     }
     
     // Write base tables
-    for (const auto& window : ctx.base_tables) {
-        for (const auto& point : window) {
-            if (!write_affine_point(file, point)) {
+    for (const auto& window : ctx.base_windows) {
+        for (std::size_t d = 0; d < window.size(); ++d) {
+            if (!write_affine_point(file, window[d])) {
                 (void)remove_file_if_exists(tmp_path);
                 return false;
             }
@@ -2344,9 +2433,9 @@ bool save_precompute_cache_locked(const std::string& path) {
     
     // Write psi tables if GLV enabled
     if (ctx.config.enable_glv) {
-        for (const auto& window : ctx.psi_tables) {
-            for (const auto& point : window) {
-                if (!write_affine_point(file, point)) {
+        for (const auto& window : ctx.psi_windows) {
+            for (std::size_t d = 0; d < window.size(); ++d) {
+                if (!write_affine_point(file, window[d])) {
                     (void)remove_file_if_exists(tmp_path);
                     return false;
                 }
@@ -2371,6 +2460,12 @@ bool save_precompute_cache_locked(const std::string& path) {
 }
 
 // Internal version without lock - must be called with g_mutex already locked
+bool save_precompute_cache_locked(const std::string& path) {
+    return g_context && write_precompute_cache(*g_context, path);
+}
+
+// Reads a legacy cache file into a new context for `config`. nullptr on any
+// mismatch, truncation or cancellation.
 // MSan note: std::string (uninstrumented libc++) triggers use-of-uninitialized-value
 // false positives in __is_long() / c_str() / data() when string SSO bits are not
 // tracked. These are file-path management functions (not crypto) so we suppress
@@ -2378,24 +2473,26 @@ bool save_precompute_cache_locked(const std::string& path) {
 #if defined(__clang__)
 __attribute__((no_sanitize("memory")))
 #endif
-bool load_precompute_cache_locked(const std::string& path, unsigned max_windows) {
+std::unique_ptr<PrecomputeContext> read_precompute_cache(const FixedBaseConfig& config,
+                                                         const std::string& path, unsigned max_windows,
+                                                         const std::atomic<bool>* cancel = nullptr) {
 #if SECP256K1_DEBUG_GLV
     auto load_start = std::chrono::steady_clock::now();
 #endif
     
     std::ifstream file(path, std::ios::binary);
     if (!file.is_open()) {
-        return false;
+        return nullptr;
     }
     
     // Read and validate header
     CacheHeader header{};
     file.read(reinterpret_cast<char*>(&header), sizeof(header));
     if (!file.good() || header.magic != CACHE_MAGIC || header.version != CACHE_VERSION) {
-        return false;
+        return nullptr;
     }
-    if (!validate_cache_header_for_config(header, g_config, max_windows)) {
-        return false;
+    if (!validate_cache_header_for_config(header, config, max_windows)) {
+        return nullptr;
     }
     
     // Validate file size to reject truncated/partially-written files.
@@ -2410,10 +2507,10 @@ bool load_precompute_cache_locked(const std::string& path, unsigned max_windows)
         file.seekg(0, std::ios::end);
         auto const actual_size = static_cast<std::size_t>(file.tellg());
         if (actual_size < min_size) {
-            return false;  // Truncated file -- reject
+            return nullptr;  // Truncated file -- reject
         }
         file.seekg(sizeof(CacheHeader), std::ios::beg);
-        if (!file.good()) return false;
+        if (!file.good()) return nullptr;
     }
     
 #if SECP256K1_DEBUG_GLV
@@ -2427,7 +2524,7 @@ bool load_precompute_cache_locked(const std::string& path, unsigned max_windows)
     // Create new context from cache. Runtime behavior continues to come from
     // the caller's effective config; the cache must match it, not override it.
     auto ctx = std::make_unique<PrecomputeContext>();
-    ctx->config = g_config;
+    ctx->config = config;
     ctx->window_bits = header.window_bits;
     ctx->window_count = header.window_count;
     ctx->digit_count = header.digit_count;
@@ -2447,14 +2544,28 @@ bool load_precompute_cache_locked(const std::string& path, unsigned max_windows)
         ctx->psi_tables.resize(ctx->window_count);
     }
     
-    // Read base tables
+    // Read base tables, then psi tables. Progress counts windows of both.
+    std::size_t const windows_total = ctx->window_count * (ctx->config.enable_glv ? 2U : 1U);
+    std::size_t windows_read = 0;
+    auto window_read = [&]() {
+        ++windows_read;
+        if (config.progress_callback) {
+            config.progress_callback(windows_read * ctx->digit_count, windows_total * ctx->digit_count,
+                                     static_cast<unsigned>(windows_read),
+                                     static_cast<unsigned>(windows_total));
+        }
+        return cancel == nullptr || !cancel->load(std::memory_order_relaxed);
+    };
     for (std::size_t w = 0; w < ctx->window_count; ++w) {
         ctx->base_tables[w].resize(ctx->digit_count);
         for (std::size_t d = 0; d < ctx->digit_count; ++d) {
             if (!read_affine_point(file, ctx->base_tables[w][d])) {
-                return false;
+                return nullptr;
             }
         }
+        if (!window_read()) {
+            return nullptr;
+        }
     }
     
     // Read psi tables if GLV enabled
@@ -2463,29 +2574,139 @@ bool load_precompute_cache_locked(const std::string& path, unsigned max_windows)
             ctx->psi_tables[w].resize(ctx->digit_count);
             for (std::size_t d = 0; d < ctx->digit_count; ++d) {
                 if (!read_affine_point(file, ctx->psi_tables[w][d])) {
-                    return false;
+                    return nullptr;
                 }
             }
+            if (!window_read()) {
+                return nullptr;
+            }
         }
     }
     
     file.close();
+    bind_owned_windows(*ctx);
     if (!file.good() || !validate_precompute_context(*ctx)) {
-        return false;
+        return nullptr;
     }
     
-    // Install the loaded context
-    g_context = std::move(ctx);
-    
 #if SECP256K1_DEBUG_GLV
     auto load_end = std::chrono::steady_clock::now();
     auto load_ms = std::chrono::duration_cast<std::chrono::milliseconds>(load_end - load_start).count();
     std::cout << "[CACHE] Cache loaded in " << load_ms << " ms" << '\n';
 #endif
     
+    return ctx;
+}
+
+// Internal version without lock - must be called with g_mutex already locked
+bool load_precompute_cache_locked(const std::string& path, unsigned max_windows) {
+    auto ctx = read_precompute_cache(g_config, path, max_windows);
+    if (!ctx) {
+        return false;
+    }
+    g_context = std::move(ctx);
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Mapped tables (cache_w{bits}[_glv].tbl, see mapped_table_p.hpp)
+// ----------------------------------------------------------------------------
+// Payload: window_count x digit_count base entries, then (GLV) the same for
+// psi, each entry the in-memory AffinePointPacked. Lookups index the mapping
+// directly, so N processes share one page-cache copy.
+
+static_assert(std::is_trivially_copyable_v<AffinePointPacked>,
+              "mapped tables alias AffinePointPacked storage");
+
+bool write_precompute_table(const PrecomputeContext& ctx, const std::string& path) {
+    std::size_t const tables = ctx.config.enable_glv ? 2U : 1U;
+
+    MappedTableHeader spec{};
+    spec.kind        = kMappedTableFixedBase;
+    spec.entry_bytes = sizeof(AffinePointPacked);
+    spec.param0      = ctx.window_bits;
+    spec.param1      = ctx.config.enable_glv ? 1U : 0U;
+    spec.entry_count = static_cast<std::uint64_t>(ctx.window_count) * ctx.digit_count * tables;
+
+    MappedTableWriter writer(path, spec);
+    if (!writer.ok()) {
+        return false;
+    }
+    std::vector<AffinePointPacked> staging(ctx.digit_count);
+    auto append_windows = [&](const std::vector<WindowSpan>& windows) {
+        for (const auto& window : windows) {
+            copy_table_entries(staging.data(), window.entries, window.size());
+            if (!writer.append(staging.data(), window.size() * sizeof(AffinePointPacked))) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!append_windows(ctx.base_windows) || !append_windows(ctx.psi_windows)) {
+        return false;
+    }
+    return writer.commit();
+}
+
+#if defined(__clang__)
+__attribute__((no_sanitize("memory")))
+#endif
+std::unique_ptr<PrecomputeContext> map_precompute_table(const FixedBaseConfig& config,
+                                                        const std::string& path, unsigned max_windows) {
+    auto table = std::make_shared<MappedTable>();
+    MappedTableOptions options;
+    options.huge_pages      = config.huge_pages;
+    options.verify_checksum = config.verify_table_checksum;
+    if (!table->open(path, kMappedTableFixedBase, sizeof(AffinePointPacked), options)) {
+        return nullptr;
+    }
+
+    // Reuse the legacy header rules (window/digit counts, GLV, max_windows).
+    MappedTableHeader const& mh = table->header();
+    if (mh.param1 > 1U || !is_valid_window_bits(mh.param0)) {
+        return nullptr;
+    }
+    std::size_t const digit_count = expected_digit_count(mh.param0);
+    std::size_t const tables = mh.param1 != 0U ? 2U : 1U;
+    if (mh.entry_count % (digit_count * tables) != 0U) {
+        return nullptr;
+    }
+    CacheHeader header{};
+    header.magic        = CACHE_MAGIC;
+    header.version      = CACHE_VERSION;
+    header.window_bits  = mh.param0;
+    header.window_count = static_cast<std::uint32_t>(mh.entry_count / (digit_count * tables));
+    header.digit_count  = digit_count;
+    header.has_glv      = mh.param1;
+    if (!validate_cache_header_for_config(header, config, max_windows)) {
+        return nullptr;
+    }
+
+    auto ctx = std::make_unique<PrecomputeContext>();
+    ctx->config       = config;
+    ctx->window_bits  = header.window_bits;
+    ctx->window_count = header.window_count;
+    ctx->digit_count  = digit_count;
+    ctx->beta         = FieldElement::from_bytes(kBetaBytes);
+    ctx->huge_pages   = table->huge_pages();
+
+    const auto* entries = static_cast<const AffinePointPacked*>(table->payload());
+    for (std::size_t w = 0; w < ctx->window_count; ++w) {
+        ctx->base_windows.push_back({entries + w * digit_count, digit_count});
+    }
+    if (tables == 2U) {
+        entries += ctx->window_count * digit_count;
+        for (std::size_t w = 0; w < ctx->window_count; ++w) {
+            ctx->psi_windows.push_back({entries + w * digit_count, digit_count});
+        }
+    }
+    ctx->mapping = std::move(table);
+    if (!validate_precompute_context(*ctx)) {
+        return nullptr;
+    }
+    return ctx;
+}
+
 #if defined(__clang__)
 __attribute__((no_sanitize("memory")))
 #endif
@@ -2493,10 +2714,10 @@ __attribute__((no_sanitize("memory")))
 // Load precomputed table from the compiled-in static arrays (precompute_static_w8.cpp).
 // Called once per process when SECP256K1_CORE_BACKEND_MODE is ON.
 // No file I/O, no heap allocation for the table data itself.
-static bool load_precompute_from_static_w8() {
+std::unique_ptr<PrecomputeContext> static_precompute_context(const FixedBaseConfig& config) {
     using namespace STATIC_W_NS;
     auto ctx = std::make_unique<PrecomputeContext>();
-    ctx->config             = g_config;
+    ctx->config             = config;
     // The static table always includes the GLV psi-tables.  Force enable_glv=true
     // so validate_precompute_context() does not reject non-empty psi_tables when
     // the global config still has the default enable_glv=false.
@@ -2529,52 +2750,196 @@ static bool load_precompute_from_static_w8() {
             load_point(kPsiTable[w][d],  ctx->psi_tables[w][d]);
         }
     }
-    if (!validate_precompute_context(*ctx)) return false;
-    g_context = std::move(ctx);
-    return true;
+    bind_owned_windows(*ctx);
+    if (!validate_precompute_context(*ctx)) return nullptr;
+    return ctx;
 }
 #endif // SECP256K1_CORE_BACKEND_MODE
 
 #if defined(__clang__)
 __attribute__((no_sanitize("memory")))
 #endif
-void ensure_built_locked() {
-    if (!g_context) {
+FixedBaseSource build_or_load(const FixedBaseConfig& config, std::shared_ptr<PrecomputeContext>& out,
+                              const std::atomic<bool>* cancel = nullptr) {
 #if defined(SECP256K1_CORE_BACKEND_MODE)
-        if (load_precompute_from_static_w8()) return;
-        // Fallback: in-memory build (should not normally be reached)
+    if ((out = static_precompute_context(config))) return FixedBaseSource::Static;
+    // Fallback: in-memory build (should not normally be reached)
 #endif
-        // Try to load from cache if enabled
-        if (g_config.use_cache) {
-            // MSan-safe path selection: std::string::empty() reads SSO bits which
-            // are untracked under MSan with uninstrumented libc++, causing false
-            // positives. Use the scalar bool flag instead to avoid __is_long().
-            std::string cache_path = g_config.cache_path_set
-                                         ? g_config.cache_path
-                                         : get_default_cache_path(g_config.window_bits);
-            
-            // Try to load existing cache (using _locked version since we already have the mutex)
-            if (load_precompute_cache_locked(cache_path, g_config.max_windows_to_load)) {
-                // Successfully loaded from cache
-                return;
-            }
-            
-            // Cache load failed, use in-memory generation
-            g_context = build_context(g_config);
-            if (!g_context || !validate_precompute_context(*g_context)) {
-                throw std::runtime_error("Precompute context validation failed after cache fallback rebuild");
+    // In-memory build; false only when cancelled.
+    auto build = [&](const char* failure) {
+        out = build_context(config, cancel);
+        if (out && !validate_precompute_context(*out)) {
+            throw std::runtime_error(failure);
+        }
+        return static_cast<bool>(out);
+    };
+
+    if (!config.use_cache) {
+        // Cache disabled, just build in memory
+        return build("Precompute context validation failed") ? FixedBaseSource::Built
+                                                              : FixedBaseSource::None;
+    }
+
+    // MSan-safe path selection: std::string::empty() reads SSO bits which
+    // are untracked under MSan with uninstrumented libc++, causing false
+    // positives. Use the scalar bool flag instead to avoid __is_long().
+    std::string cache_path = config.cache_path_set
+                                 ? config.cache_path
+                                 : get_default_cache_path(config);
+    unsigned const max_windows = config.max_windows_to_load;
+
+    if (config.use_mmap) {
+        std::string const table_path = mapped_table_path(cache_path);
+        if ((out = map_precompute_table(config, table_path, max_windows))) {
+            return FixedBaseSource::MappedFile;
+        }
+        // Convert the legacy cache (or build), publish the mapped table, then
+        // switch to the mapping so this process drops its private copy too.
+        FixedBaseSource source = FixedBaseSource::CacheFile;
+        if (!(out = read_precompute_cache(config, cache_path, max_windows, cancel))) {
+            if (!build("Precompute context validation failed after mapped table rebuild")) {
+                return FixedBaseSource::None;
             }
-            
-            // Save to cache for next time
-            save_precompute_cache_locked(cache_path);
-        } else {
-            // Cache disabled, just build in memory
-            g_context = build_context(g_config);
-            if (!g_context || !validate_precompute_context(*g_context)) {
-                throw std::runtime_error("Precompute context validation failed");
+            source = FixedBaseSource::Built;
+        }
+        if (write_precompute_table(*out, table_path)) {
+            if (auto mapped = map_precompute_table(config, table_path, max_windows)) {
+                out = std::move(mapped);
             }
         }
+        return source;
+    }
+
+    // Try to load existing cache
+    if ((out = read_precompute_cache(config, cache_path, max_windows, cancel))) {
+        return FixedBaseSource::CacheFile;
+    }
+
+    // Cache load failed, use in-memory generation
+    if (!build("Precompute context validation failed after cache fallback rebuild")) {
+        return FixedBaseSource::None;
+    }
+
+    // Save to cache for next time
+    (void)write_precompute_cache(*out, cache_path);
+    return FixedBaseSource::Built;
+}
+
+void record_load_info_locked(FixedBaseSource source, std::chrono::steady_clock::time_point start) {
+    PrecomputeContext const& ctx = *g_context;
+    std::size_t const tables = ctx.config.enable_glv ? 2U : 1U;
+    g_load_info = FixedBaseLoadInfo{};
+    g_load_info.source = source;
+    g_load_info.ready_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    g_load_info.table_bytes = ctx.window_count * ctx.digit_count * tables * sizeof(AffinePointPacked);
+    g_load_info.shared_mapping = static_cast<bool>(ctx.mapping);
+    g_load_info.huge_pages = ctx.huge_pages;
+}
+
+// ----------------------------------------------------------------------------
+// Background load (FixedBaseConfig::background_load)
+// ----------------------------------------------------------------------------
+// The first call installs a w=8 table (~1 MB, a few ms to build) and starts a
+// detached worker that builds / loads / maps the configured tables without
+// holding g_mutex. The worker swaps them into g_context under the lock;
+// readers already work on a shared_ptr snapshot, so calls in flight finish on
+// the w=8 table and the next call takes the fast path.
+
+void background_progress(std::size_t done, std::size_t total, unsigned window, unsigned windows) {
+    // build_context workers report out of order: keep the maximum.
+    std::size_t seen = g_background.points_done.load(std::memory_order_relaxed);
+    while (seen < done &&
+           !g_background.points_done.compare_exchange_weak(seen, done, std::memory_order_relaxed)) {
+    }
+    g_background.points_total.store(total, std::memory_order_relaxed);
+    if (ProgressCallback const user = g_background.user_callback) {
+        user(done, total, window, windows);
+    }
+}
+
+void run_background_load(FixedBaseConfig config, std::shared_ptr<std::atomic<bool>> cancel) {
+    auto const start = std::chrono::steady_clock::now();
+    std::shared_ptr<PrecomputeContext> ctx;
+    FixedBaseSource source = FixedBaseSource::None;
+    bool failed = false;
+    try {
+        source = build_or_load(config, ctx, cancel.get());
+    } catch (...) {
+        failed = true;  // keep serving from the w=8 table
+    }
+
+    std::lock_guard<std::mutex> const lock(g_mutex);
+    if (!cancel->load(std::memory_order_relaxed)) {
+        if (ctx && source != FixedBaseSource::None) {
+            ctx->config.progress_callback = g_background.user_callback;
+            g_context = std::move(ctx);
+            record_load_info_locked(source, start);
+        }
+        g_background.failed = failed;
+    }
+    g_background.active = false;
+    g_background.done_cv.notify_all();
+}
+
+void start_background_load_locked() {
+    FixedBaseConfig quick = g_config;
+    quick.window_bits = kFallbackWindowBits;
+    quick.thread_count = 1U;
+    quick.progress_callback = nullptr;
+    std::shared_ptr<PrecomputeContext> fallback = build_context(quick);
+    if (!fallback || !validate_precompute_context(*fallback)) {
+        throw std::runtime_error("Fallback precompute context validation failed");
+    }
+    g_context = std::move(fallback);
+
+    FixedBaseConfig full = g_config;
+    full.progress_callback = &background_progress;
+    g_background.user_callback = g_config.progress_callback;
+    g_background.points_done.store(0, std::memory_order_relaxed);
+    g_background.points_total.store(0, std::memory_order_relaxed);
+    g_background.failed = false;
+    g_background.cancel = std::make_shared<std::atomic<bool>>(false);
+    try {
+        std::thread(run_background_load, std::move(full), g_background.cancel).detach();
+        g_background.active = true;
+    } catch (...) {
+        g_background.failed = true;  // no thread: stay on the w=8 table
+    }
+}
+
+// Cancels an in-flight background load and waits for its worker to exit.
+void stop_background_load_locked(std::unique_lock<std::mutex>& lock) {
+    if (g_background.cancel) {
+        g_background.cancel->store(true, std::memory_order_relaxed);
+    }
+    g_background.done_cv.wait(lock, [] { return !g_background.active; });
+    g_background.cancel.reset();
+    g_background.failed = false;
+}
+
+BackgroundLoad::~BackgroundLoad() {
+    // Static destruction: the worker publishes into g_context / g_load_info,
+    // so it must be gone before they are.
+    std::unique_lock<std::mutex> lock(g_mutex);
+    stop_background_load_locked(lock);
+}
+
+void ensure_built_locked() {
+    if (g_context) {
+        return;
     }
+    auto const start = std::chrono::steady_clock::now();
+#if !defined(SECP256K1_CORE_BACKEND_MODE)
+    // (CORE_BACKEND_MODE: the compiled-in table is ready without any work.)
+    if (g_config.background_load && g_config.window_bits > kFallbackWindowBits) {
+        start_background_load_locked();
+        record_load_info_locked(FixedBaseSource::Fallback, start);
+        return;
+    }
+#endif
+    FixedBaseSource const source = build_or_load(g_config, g_context);
+    record_load_info_locked(source, start);
 }
 
 } // namespace
@@ -2647,6 +3012,14 @@ bool load_fixed_base_config_file(const std::string& path, FixedBaseConfig& out)
             bool b = false; if (parse_bool(val, b)) cfg.use_comb = b;
         } else if (key == "comb_width") {
             unsigned u = 0; if (parse_uint(val, u)) cfg.comb_width = u;
+        } else if (key == "background_load") {
+            bool b = false; if (parse_bool(val, b)) cfg.background_load = b;
+        } else if (key == "use_mmap") {
+            bool b = false; if (parse_bool(val, b)) cfg.use_mmap = b;
+        } else if (key == "huge_pages") {
+            bool b = false; if (parse_bool(val, b)) cfg.huge_pages = b;
+        } else if (key == "verify_table_checksum") {
+            bool b = false; if (parse_bool(val, b)) cfg.verify_table_checksum = b;
         } else if (key == "autotune") {
             bool b = false; if (parse_bool(val, b)) cfg.autotune = b;
         } else if (key == "autotune_iters") {
@@ -2699,6 +3072,12 @@ bool write_default_fixed_base_config(const std::string& path) {
     out << "# Cache behavior\n";
     out << "use_cache=true\n";
     out << "max_windows=0\n\n";
+    out << "# Shared read-only tables: map cache_w{bits}[ _glv].tbl (one page-cache copy per host)\n";
+    out << "use_mmap=false\n";
+    out << "huge_pages=false\n";
+    out << "verify_table_checksum=true\n\n";
+    out << "# Answer from a small w=8 table at once, switch when the full table is loaded\n";
+    out << "background_load=false\n\n";
     out << "# Optional advanced settings\n";
     out << "thread_count=0\n";
     out << "use_comb=false\n";
@@ -3043,6 +3422,10 @@ bool write_fixed_base_config(const std::string& path, const FixedBaseConfig& cfg
     out << "use_jsf=" << (cfg.use_jsf ? "true" : "false") << "\n";
     out << "use_cache=" << (cfg.use_cache ? "true" : "false") << "\n";
     out << "max_windows=" << cfg.max_windows_to_load << "\n";
+    out << "use_mmap=" << (cfg.use_mmap ? "true" : "false") << "\n";
+    out << "huge_pages=" << (cfg.huge_pages ? "true" : "false") << "\n";
+    out << "verify_table_checksum=" << (cfg.verify_table_checksum ? "true" : "false") << "\n";
+    out << "background_load=" << (cfg.background_load ? "true" : "false") << "\n";
     out << "thread_count=" << cfg.thread_count << "\n";
     out << "use_comb=" << (cfg.use_comb ? "true" : "false") << "\n";
     out << "comb_width=" << cfg.comb_width << "\n";
@@ -3266,21 +3649,42 @@ void configure_fixed_base(const FixedBaseConfig& config) {
         g_config.enable_glv = false;
     }
     g_context.reset();
+    g_load_info = FixedBaseLoadInfo{};
 }
 
 void ensure_fixed_base_ready() {
     if (!g_context) {
         g_context = build_context(g_config);
+        g_load_info.source = FixedBaseSource::Built;
     }
 }
 
 bool fixed_base_ready() {
     return static_cast<bool>(g_context);
 }
+
+FixedBaseLoadInfo fixed_base_load_info() {
+    return g_load_info;
+}
+
+FixedBaseStatus fixed_base_status() {
+    FixedBaseStatus status;
+    status.ready = static_cast<bool>(g_context);
+    status.fast_path = status.ready;
+    status.progress = status.ready ? 1.0 : 0.0;
+    status.window_bits = g_context ? g_context->window_bits : 0U;
+    return status;
+}
+
+bool wait_fixed_base_fast_path(unsigned /*timeout_ms*/) {
+    return static_cast<bool>(g_context);
+}
 #else
 // Desktop version with full features
 void configure_fixed_base(const FixedBaseConfig& config) {
-    std::lock_guard<std::mutex> const lock(g_mutex);
+    std::unique_lock<std::mutex> lock(g_mutex);
+    // The old configuration's background load, if any, is abandoned.
+    stop_background_load_locked(lock);
     g_config = config;
 
     // Adaptive GLV override: if enabled and window_bits below threshold, disable GLV.
@@ -3292,6 +3696,8 @@ void configure_fixed_base(const FixedBaseConfig& config) {
     // SECP256K1_CACHE_DIR  -> overrides cache directory containing cache_w{bits}[ _glv].bin
     // SECP256K1_CACHE_PATH -> overrides exact cache file path
     // SECP256K1_MAX_WINDOWS -> limits how many windows to load from cache (for memory control)
+    // SECP256K1_CACHE_MMAP -> use the shared mapped table format (FixedBaseConfig::use_mmap)
+    // SECP256K1_BACKGROUND_LOAD -> serve from a w=8 table while loading (FixedBaseConfig::background_load)
     if (const char* env_dir = std::getenv("SECP256K1_CACHE_DIR")) {
         if (*env_dir && std::string(env_dir).find("..") == std::string::npos) { // lgtm[cpp/path-injection]
             g_config.cache_dir = env_dir;
@@ -3309,7 +3715,22 @@ void configure_fixed_base(const FixedBaseConfig& config) {
             g_config.max_windows_to_load = v;
         }
     }
+    // SECP256K1_CACHE_MMAP=1 -> shared read-only mapped tables (.tbl)
+    if (const char* env_mmap = std::getenv("SECP256K1_CACHE_MMAP")) {
+        if (env_mmap[0] == '1' || env_mmap[0] == 't' || env_mmap[0] == 'T' ||
+            env_mmap[0] == 'y' || env_mmap[0] == 'Y') {
+            g_config.use_mmap = true;
+        }
+    }
+    // SECP256K1_BACKGROUND_LOAD=1 -> answer immediately, switch to the full tables when loaded
+    if (const char* env_bg = std::getenv("SECP256K1_BACKGROUND_LOAD")) {
+        if (env_bg[0] == '1' || env_bg[0] == 't' || env_bg[0] == 'T' ||
+            env_bg[0] == 'y' || env_bg[0] == 'Y') {
+            g_config.background_load = true;
+        }
+    }
     g_context.reset();
+    g_load_info = FixedBaseLoadInfo{};
 }
 
 void ensure_fixed_base_ready() {
@@ -3321,6 +3742,41 @@ bool fixed_base_ready() {
     std::lock_guard<std::mutex> const lock(g_mutex);
     return static_cast<bool>(g_context);
 }
+
+FixedBaseLoadInfo fixed_base_load_info() {
+    std::lock_guard<std::mutex> const lock(g_mutex);
+    return g_load_info;
+}
+
+FixedBaseStatus fixed_base_status() {
+    std::lock_guard<std::mutex> const lock(g_mutex);
+    FixedBaseStatus status;
+    status.ready = static_cast<bool>(g_context);
+    status.fast_path = status.ready && g_load_info.source != FixedBaseSource::Fallback;
+    status.loading = g_background.active;
+    status.failed = g_background.failed;
+    status.window_bits = g_context ? g_context->window_bits : 0U;
+    if (status.fast_path) {
+        status.progress = 1.0;
+    } else if (status.loading) {
+        std::size_t const total = g_background.points_total.load(std::memory_order_relaxed);
+        std::size_t const done = g_background.points_done.load(std::memory_order_relaxed);
+        status.progress = total != 0U ? static_cast<double>(std::min(done, total)) / static_cast<double>(total)
+                                      : 0.0;
+    }
+    return status;
+}
+
+bool wait_fixed_base_fast_path(unsigned timeout_ms) {
+    std::unique_lock<std::mutex> lock(g_mutex);
+    auto const idle = [] { return !g_background.active; };
+    if (timeout_ms == 0U) {
+        g_background.done_cv.wait(lock, idle);
+    } else {
+        g_background.done_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), idle);
+    }
+    return g_context && g_load_info.source != FixedBaseSource::Fallback;
+}
 #endif // !SECP256K1_ESP32_BUILD
 
 ScalarDecomposition split_scalar_glv(const Scalar& scalar) {
@@ -3337,8 +3793,8 @@ namespace {
 JacobianPoint shamir_windowed_glv(
     const int32_t* digits1,               // k1 window digits (window_count elements)
     const int32_t* digits2,               // k2 window digits (window_count elements)
-    const std::vector<std::vector<AffinePointPacked>>& P_tables,  // G tables
-    const std::vector<std::vector<AffinePointPacked>>& Q_tables,  // psi(G) tables
+    const std::vector<WindowSpan>& P_tables,  // G tables
+    const std::vector<WindowSpan>& Q_tables,  // psi(G) tables
     std::size_t window_count
 ) {
 #if SECP256K1_PROFILE_DECOMP
@@ -3580,7 +4036,7 @@ Point scalar_mul_generator(const Scalar& scalar) {
     JacobianPoint result{FieldElement::zero(), FieldElement::one(), FieldElement::zero(), true};
     const std::size_t window_count = ctx.window_count;
 
-    auto accumulate = [&](const std::vector<int32_t>& digits, const std::vector<std::vector<AffinePointPacked>>& tables) {
+    auto accumulate = [&](const std::vector<int32_t>& digits, const std::vector<WindowSpan>& tables) {
         if (digits.size() != window_count) {
             throw std::runtime_error("Digit count does not match precompute window count");
         }
@@ -3710,7 +4166,7 @@ Point scalar_mul_generator(const Scalar& scalar) {
         } else {
             // Windowed interleaving path with precomputed tables
             // Process both digit streams simultaneously in one pass.
-            result = shamir_windowed_glv(digits1, digits2, ctx.base_tables, ctx.psi_tables, window_count);
+            result = shamir_windowed_glv(digits1, digits2, ctx.base_windows, ctx.psi_windows, window_count);
         }
         
 #if SECP256K1_DEBUG_GLV
@@ -3726,7 +4182,7 @@ Point scalar_mul_generator(const Scalar& scalar) {
         static thread_local std::vector<int32_t> tl_digits;
         tl_digits.resize(window_count);
         fill_window_digits_into(scalar, ctx.window_bits, window_count, tl_digits.data());
-        accumulate(tl_digits, ctx.base_tables);
+        accumulate(tl_digits, ctx.base_windows);
     }
 
     // Phase 3: Convert Jacobian back to Point
@@ -3765,7 +4221,7 @@ Point scalar_mul_generator_glv_predecomposed(const Scalar& k1, const Scalar& k2,
         AffinePointPacked const aPsiG = to_affine(apply_endomorphism(Point::generator()));
         result = shamir_jsf_glv(k1, k2, aG, aPsiG, neg1, neg2);
     } else {
-        result = shamir_windowed_glv(digits1, digits2, ctx.base_tables, ctx.psi_tables, window_count);
+        result = shamir_windowed_glv(digits1, digits2, ctx.base_windows, ctx.psi_windows, window_count);
     }
     return Point::from_jacobian_coords(result.x, result.y, result.z, result.infinity);
 }
@@ -3804,7 +4260,7 @@ void batch_scalar_mul_generator(const Scalar* scalars, Point* results, std::size
 
     // Inline accumulate for the non-GLV path (mirrors scalar_mul_generator).
     auto do_accumulate = [&](const int32_t* digits,
-                              const std::vector<std::vector<AffinePointPacked>>& tables,
+                              const std::vector<WindowSpan>& tables,
                               JacobianPoint& result) {
         for (std::size_t w = 0; w < wc; ++w) {
             int32_t const d = digits[w];
@@ -3834,10 +4290,10 @@ void batch_scalar_mul_generator(const Scalar* scalars, Point* results, std::size
             if (dec.neg1) for (std::size_t w = 0; w < wc; ++w) if (tl_d1[w]) tl_d1[w] = -tl_d1[w];
             if (dec.neg2) for (std::size_t w = 0; w < wc; ++w) if (tl_d2[w]) tl_d2[w] = -tl_d2[w];
             result = shamir_windowed_glv(tl_d1.data(), tl_d2.data(),
-                                         ctx.base_tables, ctx.psi_tables, wc);
+                                         ctx.base_windows, ctx.psi_windows, wc);
         } else {
             fill_window_digits_into(scalars[i], wb, wc, tl_d1.data());
-            do_accumulate(tl_d1.data(), ctx.base_tables, result);
+            do_accumulate(tl_d1.data(), ctx.base_windows, result);
         }
         results[i] = Point::from_jacobian_coords(result.x, result.y, result.z, result.infinity);
     }
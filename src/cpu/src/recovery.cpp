@@ -4,8 +4,11 @@
 #include "secp256k1/ct/scalar.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
 #include "secp256k1/field_52_impl.hpp"
+#include "secp256k1/field_simd.hpp"
 #include "signing_helpers_p.hpp"
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 namespace secp256k1 {
 
@@ -155,18 +158,10 @@ RecoverableSignature ecdsa_sign_recoverable(
 
 // -- Public Key Recovery ------------------------------------------------------
 
-std::pair<Point, bool> ecdsa_recover(
-    const std::array<uint8_t, 32>& msg_hash,
-    const ECDSASignature& sig,
-    int recid) {
-
-    if (recid < 0 || recid > 3) return {Point::infinity(), false};
-    if (sig.r.is_zero() || sig.s.is_zero()) return {Point::infinity(), false};
-
-    // Step 1: Reconstruct R.x
-    // if recid bit 1 is set, R.x = r + n (the x-coordinate overflowed)
+// Step 1 of recovery: R.x = r, or r + n when recid bit 1 is set (the
+// x-coordinate overflowed). recid must be 0..3. Fails if r + n would exceed p.
+static bool nonce_point_x(const ECDSASignature& sig, int recid, FieldElement& rx_fe) {
     auto r_bytes = sig.r.to_bytes();
-    FieldElement rx_fe;
 
     if (recid & 2) {
         // R.x = r + n -- need to add order to r as field element.
@@ -199,7 +194,7 @@ std::pair<Point, bool> ecdsa_recover(
             eq_run = eq_run & (1u - byte_lt) & (1u - byte_gt);
         }
         // r >= (p - n) (including equality) -> reject, matching upstream's `>= 0`.
-        if (lt == 0u) return {Point::infinity(), false};
+        if (lt == 0u) return false;
 
         auto n_fe = FieldElement::from_bytes(SECP256K1_ORDER_BYTES);
         auto r_fe_val = FieldElement::from_bytes(r_bytes);
@@ -207,10 +202,30 @@ std::pair<Point, bool> ecdsa_recover(
     } else {
         rx_fe = FieldElement::from_bytes(r_bytes);
     }
+    return true;
+}
+
+std::pair<Point, bool> ecdsa_lift_r(const ECDSASignature& sig, int recid) {
+    if (recid < 0 || recid > 3) return {Point::infinity(), false};
+    if (sig.r.is_zero()) return {Point::infinity(), false};
+
+    // Step 1: Reconstruct R.x
+    FieldElement rx_fe;
+    if (!nonce_point_x(sig, recid, rx_fe)) return {Point::infinity(), false};
 
     // Step 2: Lift x to curve point R with correct y parity
-    int const y_parity = recid & 1;
-    auto [R, valid] = lift_x(rx_fe, y_parity);
+    return lift_x(rx_fe, recid & 1);
+}
+
+std::pair<Point, bool> ecdsa_recover(
+    const std::array<uint8_t, 32>& msg_hash,
+    const ECDSASignature& sig,
+    int recid) {
+
+    if (recid < 0 || recid > 3) return {Point::infinity(), false};
+    if (sig.r.is_zero() || sig.s.is_zero()) return {Point::infinity(), false};
+
+    auto [R, valid] = ecdsa_lift_r(sig, recid);
     if (!valid) return {Point::infinity(), false};
 
     // Step 3: Recover public key
@@ -234,6 +249,77 @@ std::pair<Point, bool> ecdsa_recover(
     return {Q, true};
 }
 
+// -- Batch Public Key Recovery ------------------------------------------------
+
+std::size_t ecdsa_recover_batch(const std::array<uint8_t, 32>* msg_hashes,
+                                const ECDSASignature* sigs, const int* recids,
+                                std::size_t n, Point* out, std::uint8_t* ok_out) {
+    // 256 signatures per pass: enough to amortize the two inversions, small
+    // enough that the scratch stays in L1/L2.
+    constexpr std::size_t kChunk = 256;
+    std::vector<FieldElement> rx(kChunk), ry(kChunk), qx(kChunk), qy(kChunk);
+    std::vector<Scalar> r_inv(kChunk);
+    std::vector<Point> q(kChunk);
+    std::uint8_t live[kChunk], root_ok[kChunk];
+    FieldElement const seven = FieldElement::from_uint64(7);
+
+    std::size_t n_ok = 0;
+    for (std::size_t lo = 0; lo < n; lo += kChunk) {
+        std::size_t const m = std::min(kChunk, n - lo);
+        const ECDSASignature* sig = sigs + lo;
+
+        // Steps 1-2: R.x per entry, then y = sqrt(x^3 + 7) for all at once.
+        for (std::size_t j = 0; j < m; ++j) {
+            int const recid = recids[lo + j];
+            live[j] = recid >= 0 && recid <= 3 && !sig[j].r.is_zero() && !sig[j].s.is_zero() &&
+                      nonce_point_x(sig[j], recid, rx[j]);
+            if (!live[j]) rx[j] = FieldElement::zero();
+            qx[j] = rx[j].square() * rx[j] + seven;
+        }
+        fast::field_sqrt_batch(qx.data(), ry.data(), root_ok, m);
+
+        // r^-1 for every live entry from one inversion (prefix products).
+        Scalar acc = Scalar::one();
+        for (std::size_t j = 0; j < m; ++j) {
+            live[j] = live[j] && root_ok[j];
+            if (!live[j]) continue;
+            r_inv[j] = acc;
+            acc = acc * sig[j].r;
+        }
+        Scalar inv = acc.inverse();
+        for (std::size_t j = m; j-- > 0;) {
+            if (!live[j]) continue;
+            Scalar const r_inv_j = r_inv[j] * inv;
+            inv = inv * sig[j].r;
+            r_inv[j] = r_inv_j;
+        }
+
+        // Step 3: Q = (-z * r^-1) * G + (s * r^-1) * R, left in Jacobian form.
+        for (std::size_t j = 0; j < m; ++j) {
+            q[j] = Point::infinity();
+            if (!live[j]) continue;
+            int const recid = recids[lo + j];
+            if ((ry[j].limbs()[0] & 1u) != static_cast<std::uint64_t>(recid & 1)) {
+                ry[j] = ry[j].negate();
+            }
+            Point const R = Point::from_affine(rx[j], ry[j]);
+            Scalar const z = Scalar::from_bytes(msg_hashes[lo + j]);
+            Scalar const u1 = z.negate_var() * r_inv[j];
+            Scalar const u2 = sig[j].s * r_inv[j];
+            q[j] = Point::dual_scalar_mul_gen_point(u1, u2, R);
+        }
+
+        Point::batch_normalize(q.data(), m, qx.data(), qy.data());
+        for (std::size_t j = 0; j < m; ++j) {
+            bool const ok = live[j] && !q[j].is_infinity();
+            out[lo + j] = ok ? Point::from_affine(qx[j], qy[j]) : Point::infinity();
+            ok_out[lo + j] = ok ? 1 : 0;
+            n_ok += ok ? 1 : 0;
+        }
+    }
+    return n_ok;
+}
+
 // -- Compact Serialization ----------------------------------------------------
 
 std::array<uint8_t, 65> recoverable_to_compact(
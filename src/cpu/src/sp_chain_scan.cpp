@@ -0,0 +1,282 @@
+// ============================================================================
+// Resumable BIP-352 chain scanner (see sp_chain_scan.hpp)
+// ============================================================================
+
+#include "secp256k1/sp_chain_scan.hpp"
+#include "secp256k1/address.hpp"
+#include "secp256k1/thread_pool.hpp"
+#include "secp256k1/detail/secure_erase.hpp"
+#include "sp_scan_batch_impl.hpp"   // sp_decompress_tweak
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace secp256k1 {
+
+using fast::Point;
+using fast::Scalar;
+
+namespace {
+
+constexpr std::size_t kTweakBytes = 33;
+
+// Below this many tweaks per slice the per-slice KPlan walk and batch
+// inversions stop amortising (same bound as fast_scan_prefix_batch).
+constexpr std::size_t kMinSlice = 512;
+
+constexpr std::uint8_t kCheckpointMagic[4] = {'S', 'P', 'C', '1'};
+
+std::uint32_t load_le32(const std::uint8_t* p) noexcept {
+    return static_cast<std::uint32_t>(p[0])
+         | (static_cast<std::uint32_t>(p[1]) << 8)
+         | (static_cast<std::uint32_t>(p[2]) << 16)
+         | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::uint64_t load_le64(const std::uint8_t* p) noexcept {
+    return static_cast<std::uint64_t>(load_le32(p))
+         | (static_cast<std::uint64_t>(load_le32(p + 4)) << 32);
+}
+
+void store_le32(std::uint8_t* p, std::uint32_t v) noexcept {
+    for (int i = 0; i < 4; ++i) p[i] = static_cast<std::uint8_t>(v >> (8 * i));
+}
+
+void store_le64(std::uint8_t* p, std::uint64_t v) noexcept {
+    for (int i = 0; i < 8; ++i) p[i] = static_cast<std::uint8_t>(v >> (8 * i));
+}
+
+} // anonymous namespace
+
+// -- Tweak index ------------------------------------------------------------
+
+void sp_tweak_index_append(std::vector<std::uint8_t>& out, std::uint32_t height,
+                           const std::uint8_t* tweaks33, std::size_t count) {
+    std::size_t const at = out.size();
+    out.resize(at + SpTweakIndexReader::kRecordHeaderBytes + count * kTweakBytes);
+    store_le32(out.data() + at, height);
+    store_le32(out.data() + at + 4, static_cast<std::uint32_t>(count));
+    if (count != 0) {
+        std::memcpy(out.data() + at + SpTweakIndexReader::kRecordHeaderBytes,
+                    tweaks33, count * kTweakBytes);
+    }
+}
+
+SpTweakIndexReader::SpTweakIndexReader(const std::uint8_t* data, std::size_t size,
+                                       std::size_t offset) noexcept
+    : data_(data), size_(size), offset_(std::min(offset, size)) {}
+
+bool SpTweakIndexReader::next(SpTweakBlock& block) noexcept {
+    if (malformed_ || offset_ >= size_) return false;
+    std::size_t const left = size_ - offset_;
+    if (left < kRecordHeaderBytes) {
+        malformed_ = true;
+        return false;
+    }
+    const std::uint8_t* p = data_ + offset_;
+    std::uint32_t const count = load_le32(p + 4);
+    if (static_cast<std::uint64_t>(count) * kTweakBytes > left - kRecordHeaderBytes) {
+        malformed_ = true;
+        return false;
+    }
+    block.height   = load_le32(p);
+    block.count    = count;
+    block.tweaks33 = p + kRecordHeaderBytes;
+    offset_ += kRecordHeaderBytes + static_cast<std::size_t>(count) * kTweakBytes;
+    return true;
+}
+
+void SpTweakIndexReader::seek(std::size_t offset) noexcept {
+    offset_    = std::min(offset, size_);
+    malformed_ = false;
+}
+
+SpTweakIndexFile::~SpTweakIndexFile() {
+    close();
+}
+
+void SpTweakIndexFile::close() noexcept {
+    if (base_ == nullptr) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(base_);
+    if (mapping_handle_ != nullptr) CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    mapping_handle_ = nullptr;
+#else
+    ::munmap(base_, length_);
+#endif
+    base_   = nullptr;
+    length_ = 0;
+}
+
+bool SpTweakIndexFile::open(const std::string& path) {
+    close();
+#if defined(_WIN32)
+    HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) return false;
+    void* const base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (base == nullptr) {
+        CloseHandle(mapping);
+        return false;
+    }
+    base_           = base;
+    mapping_handle_ = mapping;
+    length_         = static_cast<std::size_t>(size.QuadPart);
+#else
+    int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    auto const length = static_cast<std::size_t>(st.st_size);
+    void* const base = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) return false;
+#if defined(MADV_SEQUENTIAL)
+    (void)::madvise(base, length, MADV_SEQUENTIAL);
+#endif
+    base_   = base;
+    length_ = length;
+#endif
+    return true;
+}
+
+// -- Checkpoint -------------------------------------------------------------
+
+std::array<std::uint8_t, SpScanCheckpoint::kSerializedBytes>
+SpScanCheckpoint::serialize() const noexcept {
+    std::array<std::uint8_t, kSerializedBytes> out{};
+    std::memcpy(out.data(), kCheckpointMagic, 4);
+    store_le32(out.data() + 4, next_height);
+    store_le64(out.data() + 8, index_offset);
+    store_le64(out.data() + 16, tweaks_scanned);
+    return out;
+}
+
+bool SpScanCheckpoint::parse(const std::uint8_t* data, std::size_t len,
+                             SpScanCheckpoint& out) noexcept {
+    if (data == nullptr || len != kSerializedBytes) return false;
+    if (std::memcmp(data, kCheckpointMagic, 4) != 0) return false;
+    out.next_height    = load_le32(data + 4);
+    out.index_offset   = load_le64(data + 8);
+    out.tweaks_scanned = load_le64(data + 16);
+    return true;
+}
+
+// -- Scanner ----------------------------------------------------------------
+
+SpChainScanner::SpChainScanner(const Scalar& scan_privkey, const Point& spend_pubkey,
+                               BlockCallback on_block, const SpChainScanOptions& options)
+    : scan_privkey_(scan_privkey),
+      spend_pubkey_(spend_pubkey),
+      on_block_(std::move(on_block)),
+      options_(options) {
+    if (options_.batch_tweaks == 0) {
+        throw std::invalid_argument("SpChainScanner: batch_tweaks must be non-zero");
+    }
+}
+
+SpChainScanner::~SpChainScanner() {
+    detail::secure_erase(&scan_privkey_, sizeof(scan_privkey_));
+}
+
+void SpChainScanner::queue_block(std::uint32_t height, const std::uint8_t* tweaks33,
+                                 std::size_t count, std::uint64_t end_offset) {
+    pending_.push_back({height, static_cast<std::uint32_t>(count), end_offset});
+    if (count != 0) {
+        pending_tweaks_.insert(pending_tweaks_.end(), tweaks33, tweaks33 + count * kTweakBytes);
+    }
+    if (pending_tweaks_.size() >= options_.batch_tweaks * kTweakBytes) flush();
+}
+
+void SpChainScanner::add_block(std::uint32_t height, const std::uint8_t* tweaks33,
+                               std::size_t count) {
+    std::uint64_t const end = pending_.empty() ? checkpoint_.index_offset
+                                               : pending_.back().end_offset;
+    queue_block(height, tweaks33, count, end);
+}
+
+void SpChainScanner::flush() {
+    if (pending_.empty()) return;
+    auto const t0 = std::chrono::steady_clock::now();
+
+    std::size_t const n = pending_tweaks_.size() / kTweakBytes;
+    points_.resize(n);
+    xonly_.resize(n);
+    valid_.resize(n);
+
+    // Every participant runs the whole stage chain on its own slice.
+    auto run_slice = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            points_[i] = detail::sp_decompress_tweak(pending_tweaks_.data() + i * kTweakBytes);
+        }
+        fast_scan_tweak_outputs(scan_privkey_, spend_pubkey_, points_.data() + begin,
+                                end - begin, xonly_.data() + begin, valid_.data() + begin);
+    };
+    if (n != 0) {
+        if (options_.pool != nullptr) {
+            options_.pool->parallel_for(n, kMinSlice, run_slice);
+        } else {
+            run_slice(0, n);
+        }
+    }
+
+    stats_.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    stats_.blocks  += pending_.size();
+    stats_.tweaks  += n;
+
+    std::size_t at = 0;
+    for (const PendingBlock& b : pending_) {
+        if (on_block_) on_block_(b.height, xonly_.data() + at, valid_.data() + at, b.count);
+        at += b.count;
+    }
+
+    checkpoint_.next_height     = pending_.back().height + 1;
+    checkpoint_.index_offset    = pending_.back().end_offset;
+    checkpoint_.tweaks_scanned += n;
+    pending_.clear();
+    pending_tweaks_.clear();
+    if (on_checkpoint_) on_checkpoint_(checkpoint_);
+}
+
+bool SpChainScanner::scan_index(const std::uint8_t* data, std::size_t size) {
+    SpTweakIndexReader reader(data, size, static_cast<std::size_t>(checkpoint_.index_offset));
+    SpTweakBlock block;
+    while (reader.next(block)) {
+        queue_block(block.height, block.tweaks33, block.count, reader.offset());
+    }
+    flush();
+    return !reader.malformed();
+}
+
+void SpChainScanner::resume(const SpScanCheckpoint& cp) {
+    pending_.clear();
+    pending_tweaks_.clear();
+    checkpoint_ = cp;
+}
+
+} // namespace secp256k1
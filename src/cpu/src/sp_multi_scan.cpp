@@ -0,0 +1,252 @@
+// ============================================================================
+// Multi-recipient BIP-352 scanning (see sp_multi_scan.hpp)
+// ============================================================================
+
+#include "secp256k1/sp_multi_scan.hpp"
+#include "secp256k1/precompute.hpp"
+#include "secp256k1/thread_pool.hpp"
+#include "secp256k1/detail/csprng.hpp"
+#include "secp256k1/detail/secure_erase.hpp"
+#include "sp_scan_batch_impl.hpp"   // sp_tag_midstate, sp_shared_secret_scalar, sp_decompress_tweak
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace secp256k1 {
+
+using fast::KPlan;
+using fast::Point;
+using fast::Scalar;
+
+namespace {
+
+const std::array<std::uint32_t, 8>& bip352_midstate() {
+    static const auto st = detail::sp_tag_midstate("BIP0352/SharedSecret");
+    return st;
+}
+
+// Same scalar with the GLV sign flags folded into the wNAF digits, so the
+// tables built by batch_scan_precompute for a sign-free plan serve it.
+KPlan fold_signs(const KPlan& plan) noexcept {
+    KPlan out = plan;
+    if (out.neg1) {
+        for (std::size_t i = 0; i < out.wnaf1_len; ++i) out.wnaf1[i] = -out.wnaf1[i];
+        out.neg1 = false;
+    }
+    if (out.neg2) {
+        for (std::size_t i = 0; i < out.wnaf2_len; ++i) out.wnaf2[i] = -out.wnaf2[i];
+        out.neg2 = false;
+    }
+    return out;
+}
+
+// Open-addressed set of the block's x-only outputs. Slots are picked by a
+// keyed mix of the first 8 bytes, so outputs ground to share a prefix
+// cannot be aimed at one probe chain.
+class OutputSet {
+public:
+    OutputSet(const std::array<std::uint8_t, 32>* outputs, std::size_t n)
+        : outputs_(outputs) {
+        std::size_t cap = 16;
+        while (cap < 2 * n) cap <<= 1;
+        mask_ = cap - 1;
+        slots_.assign(cap, 0);
+        detail::csprng_fill(reinterpret_cast<unsigned char*>(&seed_), sizeof(seed_));
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t s = slot(outputs[i].data());
+            while (slots_[s] != 0) {
+                if (outputs_[slots_[s] - 1] == outputs[i]) break;   // keep the first index
+                s = (s + 1) & mask_;
+            }
+            if (slots_[s] == 0) slots_[s] = static_cast<std::uint32_t>(i + 1);
+        }
+    }
+
+    // Index + 1 of the output equal to x, or 0.
+    std::uint32_t find(const std::array<std::uint8_t, 32>& x) const noexcept {
+        for (std::size_t s = slot(x.data()); slots_[s] != 0; s = (s + 1) & mask_) {
+            if (outputs_[slots_[s] - 1] == x) return slots_[s];
+        }
+        return 0;
+    }
+
+private:
+    std::size_t slot(const std::uint8_t* x) const noexcept {
+        std::uint64_t v;
+        std::memcpy(&v, x, 8);
+        v ^= seed_;
+        v ^= v >> 33; v *= 0xff51afd7ed558ccdULL;
+        v ^= v >> 33; v *= 0xc4ceb9fe1a85ec53ULL;
+        v ^= v >> 33;
+        return static_cast<std::size_t>(v) & mask_;
+    }
+
+    const std::array<std::uint8_t, 32>* outputs_;
+    std::vector<std::uint32_t>          slots_;
+    std::size_t                         mask_ = 0;
+    std::uint64_t                       seed_ = 0;
+};
+
+template <typename Fn>
+void run_items(ThreadPool* pool, std::size_t count, Fn&& fn) {
+    if (count == 0) return;
+    if (pool == nullptr) {
+        fn(std::size_t{0}, count);
+    } else {
+        pool->parallel_for(count, 1, fn);
+    }
+}
+
+} // anonymous namespace
+
+SpMultiScanner::SpMultiScanner(std::vector<SpRecipient> recipients, std::size_t cache_min_keys)
+    : recipients_(std::move(recipients)), cache_min_keys_(cache_min_keys) {
+    plans_.reserve(recipients_.size());
+    for (const SpRecipient& r : recipients_) plans_.push_back(KPlan::from_scalar(r.scan_privkey));
+}
+
+SpMultiScanner::~SpMultiScanner() {
+    for (SpRecipient& r : recipients_) detail::secure_erase(&r.scan_privkey, sizeof(r.scan_privkey));
+    if (!plans_.empty()) detail::secure_erase(plans_.data(), plans_.size() * sizeof(KPlan));
+}
+
+std::vector<SpMultiMatch>
+SpMultiScanner::scan(const std::uint8_t* tweaks33, std::size_t n_tweaks,
+                     const std::array<std::uint8_t, 32>* outputs, std::size_t n_outputs,
+                     ThreadPool* pool) const {
+    if (n_tweaks == 0 || n_outputs == 0 || recipients_.empty()) return {};
+    std::vector<Point> pts(n_tweaks);
+    run_items(pool, (n_tweaks + kChunk - 1) / kChunk, [&](std::size_t begin, std::size_t end) {
+        std::size_t const hi = std::min(end * kChunk, n_tweaks);
+        for (std::size_t i = begin * kChunk; i < hi; ++i) {
+            pts[i] = detail::sp_decompress_tweak(tweaks33 + i * 33);
+        }
+    });
+    return scan(pts.data(), n_tweaks, outputs, n_outputs, pool);
+}
+
+std::vector<SpMultiMatch>
+SpMultiScanner::scan(const Point* tweaks, std::size_t n_tweaks,
+                     const std::array<std::uint8_t, 32>* outputs, std::size_t n_outputs,
+                     ThreadPool* pool) const {
+    std::vector<SpMultiMatch> matches;
+    std::size_t const m_keys = recipients_.size();
+    if (n_tweaks == 0 || n_outputs == 0 || m_keys == 0) return matches;
+
+    const auto& midstate = bip352_midstate();
+    OutputSet const set(outputs, n_outputs);
+
+    // The fixed-k ladder expects finite inputs: G stands in for infinity
+    // tweaks, whose results are dropped.
+    std::vector<Point> pts(tweaks, tweaks + n_tweaks);
+    std::vector<std::uint8_t> live(n_tweaks);
+    for (std::size_t i = 0; i < n_tweaks; ++i) {
+        live[i] = !pts[i].is_infinity();
+        if (!live[i]) pts[i] = Point::generator();
+    }
+
+#if defined(SECP256K1_FAST_52BIT)
+    bool const use_cache = m_keys >= cache_min_keys_;
+#else
+    bool const use_cache = false;   // batch_scan_* tables need 5x52 limbs
+#endif
+    KPlan const table_plan = fold_signs(plans_[0]);   // window width only; signs are folded per key
+
+    std::mutex merge_mutex;
+    std::vector<Point::PointScanCacheHandle> caches;
+
+    for (std::size_t tile_lo = 0; tile_lo < n_tweaks; tile_lo += kTile) {
+        std::size_t const tile_n = std::min(kTile, n_tweaks - tile_lo);
+        std::size_t const chunks = (tile_n + kChunk - 1) / kChunk;
+
+        if (use_cache) {
+            caches.assign(chunks, nullptr);
+            run_items(pool, chunks, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t c = begin; c < end; ++c) {
+                    std::size_t const lo = tile_lo + c * kChunk;
+                    std::size_t const len = std::min(kChunk, n_tweaks - lo);
+                    caches[c] = Point::batch_scan_precompute(table_plan, pts.data() + lo, len);
+                }
+            });
+        }
+
+        // One item = one recipient x one chunk; consecutive items share a key.
+        run_items(pool, m_keys * chunks, [&](std::size_t begin, std::size_t end) {
+            static thread_local std::vector<Point>                        tl_pts;
+            static thread_local std::vector<std::array<std::uint8_t, 33>> tl_comp;
+            static thread_local std::vector<Scalar>                       tl_t;
+            static thread_local std::vector<std::uint8_t>                 tl_ok;
+            static thread_local std::vector<std::array<std::uint8_t, 32>> tl_x;
+            tl_pts.resize(kChunk);
+            tl_comp.resize(kChunk);
+            tl_t.resize(kChunk);
+            tl_ok.resize(kChunk);
+            tl_x.resize(kChunk);
+
+            std::vector<SpMultiMatch> local;
+            std::size_t plan_key = SIZE_MAX;
+            KPlan folded{};
+            for (std::size_t item = begin; item < end; ++item) {
+                std::size_t const m = item / chunks;
+                std::size_t const c = item % chunks;
+                std::size_t const lo = tile_lo + c * kChunk;
+                std::size_t const len = std::min(kChunk, n_tweaks - lo);
+                const SpRecipient& r = recipients_[m];
+
+                // S_i = scan_m x T_i
+                if (use_cache) {
+                    if (plan_key != m) {
+                        folded = fold_signs(plans_[m]);
+                        plan_key = m;
+                    }
+                    Point::batch_scan_run_lockstep(caches[c], folded, 0, tl_pts.data(), len);
+                } else {
+                    Point::batch_scalar_mul_fixed_k(plans_[m], pts.data() + lo, len, tl_pts.data());
+                }
+                Point::batch_to_compressed(tl_pts.data(), len, tl_comp.data());
+
+                // t_i = tagged_hash(ser(S_i) || 0u32); C_i = t_i x G + B_spend
+                for (std::size_t i = 0; i < len; ++i) {
+                    tl_ok[i] = 0;
+                    tl_t[i] = Scalar::zero();
+                    if (!live[lo + i] || tl_pts[i].is_infinity()) continue;
+                    tl_ok[i] = detail::sp_shared_secret_scalar(midstate, tl_comp[i].data(), 0, tl_t[i]);
+                }
+                fast::batch_scalar_mul_generator(tl_t.data(), tl_pts.data(), len);
+                for (std::size_t i = 0; i < len; ++i) tl_pts[i] = tl_pts[i].add(r.spend_pubkey);
+                Point::batch_x_only_bytes(tl_pts.data(), len, tl_x.data());
+
+                for (std::size_t i = 0; i < len; ++i) {
+                    if (!tl_ok[i] || tl_pts[i].is_infinity()) continue;
+                    std::uint32_t hit = set.find(tl_x[i]);
+                    // A hit at k continues with k + 1 (rare: single-point ops).
+                    Scalar t = tl_t[i];
+                    for (std::uint32_t k = 0; hit != 0;) {
+                        local.push_back({static_cast<std::uint32_t>(m),
+                                         static_cast<std::uint32_t>(lo + i), hit - 1, k, t});
+                        if (++k >= n_outputs) break;
+                        if (!detail::sp_shared_secret_scalar(midstate, tl_comp[i].data(), k, t)) break;
+                        Point const next = Point::generator().scalar_mul(t).add(r.spend_pubkey);
+                        if (next.is_infinity()) break;
+                        hit = set.find(next.x_only_bytes());
+                    }
+                }
+            }
+            if (!local.empty()) {
+                std::lock_guard<std::mutex> lk(merge_mutex);
+                matches.insert(matches.end(), local.begin(), local.end());
+            }
+            detail::secure_erase(&folded, sizeof(folded));
+        });
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const SpMultiMatch& a, const SpMultiMatch& b) {
+        if (a.recipient != b.recipient) return a.recipient < b.recipient;
+        if (a.tweak_index != b.tweak_index) return a.tweak_index < b.tweak_index;
+        return a.k < b.k;
+    });
+    return matches;
+}
+
+} // namespace secp256k1
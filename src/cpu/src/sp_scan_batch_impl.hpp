@@ -49,6 +49,46 @@ sp_tag_midstate(std::string_view tag) {
     return st;
 }
 
+// t_k = tagged_hash(ser(S) || k_be32) from a sp_tag_midstate(): one SHA256
+// compression. False if the digest is zero or >= n.
+inline bool sp_shared_secret_scalar(const std::array<std::uint32_t, 8>& tag_midstate,
+                                    const std::uint8_t s_comp[33], std::uint32_t k,
+                                    fast::Scalar& out) noexcept {
+    std::uint8_t blk[64] = {};
+    std::memcpy(blk, s_comp, 33);
+    blk[33] = static_cast<std::uint8_t>(k >> 24);
+    blk[34] = static_cast<std::uint8_t>(k >> 16);
+    blk[35] = static_cast<std::uint8_t>(k >> 8);
+    blk[36] = static_cast<std::uint8_t>(k);
+    blk[37] = 0x80;
+    blk[62] = 0x03; blk[63] = 0x28;   // bit length (64 + 37) * 8 = 808
+    std::uint32_t h[8];
+    std::memcpy(h, tag_midstate.data(), 32);
+    sha256_compress_dispatch(blk, h);
+    std::uint8_t t[32];
+    for (int b = 0; b < 8; ++b) {
+        t[b*4+0] = static_cast<std::uint8_t>(h[b] >> 24);
+        t[b*4+1] = static_cast<std::uint8_t>(h[b] >> 16);
+        t[b*4+2] = static_cast<std::uint8_t>(h[b] >>  8);
+        t[b*4+3] = static_cast<std::uint8_t>(h[b]);
+    }
+    return fast::Scalar::parse_bytes_strict_nonzero(t, out);
+}
+
+// Index-server tweak (33-byte compressed point) -> affine Point; infinity for
+// anything that is not a valid encoding (bad prefix, x >= p, x off the curve).
+inline fast::Point sp_decompress_tweak(const std::uint8_t in[33]) noexcept {
+    using fast::FieldElement;
+    if (in[0] != 0x02 && in[0] != 0x03) return fast::Point::infinity();
+    FieldElement x;
+    if (!FieldElement::parse_bytes_strict(in + 1, x)) return fast::Point::infinity();
+    FieldElement const y2 = x * x * x + FieldElement::from_uint64(7);
+    FieldElement y = y2.sqrt();
+    if (y * y != y2) return fast::Point::infinity();
+    if (((y.limbs()[0] & 1) != 0) != (in[0] == 0x03)) y = y.negate();
+    return fast::Point::from_affine(x, y);
+}
+
 // Shared scan_batch pipeline.
 //
 // BatchMatchT must be brace-initialisable from
@@ -0,0 +1,230 @@
+// ============================================================================
+// ThreadPool -- persistent work-stealing pool (see thread_pool.hpp)
+// ============================================================================
+
+#include "secp256k1/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace secp256k1 {
+
+namespace {
+
+// Cap on participants. No batch API benefits from more, and the cap keeps the
+// per-participant slice array small enough to live in a couple of pages.
+constexpr unsigned kMaxParticipants = 256;
+
+// One contiguous slice of the index space. Owner and thieves both claim from
+// `next` with fetch_add, so every grain is handed out exactly once. Padded to
+// a cache line so owners do not false-share their cursors.
+struct alignas(64) Slice {
+    std::atomic<std::size_t> next{0};
+    std::size_t              end{0};
+};
+
+void pin_current_thread(int cpu) noexcept {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+} // anonymous namespace
+
+struct ThreadPool::Impl {
+    unsigned                 participants = 1;
+    std::vector<std::thread> workers;
+    std::unique_ptr<Slice[]> slices;
+
+    // Serialises jobs. Already set => caller runs the job inline. An atomic
+    // flag rather than a mutex: a nested call comes from a thread that would
+    // already own the mutex, and try_lock() on an owned mutex is UB.
+    std::atomic<bool> busy{false};
+
+    // Job hand-off between the caller and the parked workers.
+    std::mutex              m;
+    std::condition_variable cv_start;
+    std::condition_variable cv_done;
+    std::uint64_t           generation = 0;
+    unsigned                pending    = 0;
+    bool                    stop       = false;
+
+    // Current job (written under m before generation is bumped).
+    RangeFn     fn     = nullptr;
+    void*       state  = nullptr;
+    std::size_t grain  = 1;
+    unsigned    active = 0;       // participants taking part in this job
+
+    std::atomic<bool>  failed{false};
+    std::exception_ptr error;     // first exception, guarded by m
+
+    void work(unsigned self) noexcept {
+        auto drain = [&](Slice& s) -> bool {
+            for (;;) {
+                if (failed.load(std::memory_order_relaxed)) return false;
+                const std::size_t b = s.next.fetch_add(grain, std::memory_order_relaxed);
+                if (b >= s.end) return true;
+                const std::size_t e = std::min(b + grain, s.end);
+                try {
+                    fn(state, b, e);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lk(m);
+                    if (!error) error = std::current_exception();
+                    failed.store(true, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+        };
+        if (!drain(slices[self])) return;
+        for (unsigned k = 1; k < active; ++k) {
+            if (!drain(slices[(self + k) % active])) return;
+        }
+    }
+
+    // Wake every started worker with stop set and join it.
+    void shutdown() noexcept {
+        {
+            std::lock_guard<std::mutex> lk(m);
+            stop = true;
+        }
+        cv_start.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+    void worker_loop(unsigned self, int cpu) {
+        if (cpu >= 0) pin_current_thread(cpu);
+        std::uint64_t seen = 0;
+        for (;;) {
+            unsigned n_active = 0;
+            {
+                std::unique_lock<std::mutex> lk(m);
+                cv_start.wait(lk, [&] { return stop || generation != seen; });
+                if (stop) return;
+                seen     = generation;
+                n_active = active;
+            }
+            if (self >= n_active) continue;  // not needed for this job
+            work(self);
+            {
+                std::lock_guard<std::mutex> lk(m);
+                if (--pending == 0) cv_done.notify_one();
+            }
+        }
+    }
+};
+
+ThreadPool::ThreadPool(unsigned n_threads, const int* cpu_ids, std::size_t n_cpu_ids)
+    : impl_(new Impl) {
+    if (n_threads == 0) n_threads = std::thread::hardware_concurrency();
+    if (n_threads == 0) n_threads = 1;
+    n_threads = std::min(n_threads, kMaxParticipants);
+
+    impl_->participants = n_threads;
+    impl_->slices.reset(new Slice[n_threads]);
+    impl_->workers.reserve(n_threads - 1);
+    // Participant 0 is always the calling thread; workers are 1..n-1.
+    try {
+        for (unsigned i = 1; i < n_threads; ++i) {
+            const int cpu = (cpu_ids != nullptr && n_cpu_ids != 0)
+                          ? cpu_ids[(i - 1) % n_cpu_ids] : -1;
+            impl_->workers.emplace_back([this, i, cpu] { impl_->worker_loop(i, cpu); });
+        }
+    } catch (...) {
+        // Thread creation failed part-way: the workers already running must
+        // be joined before impl_ goes away (a joinable std::thread destructor
+        // calls std::terminate).
+        impl_->shutdown();
+        throw;
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    impl_->shutdown();
+}
+
+unsigned ThreadPool::size() const noexcept {
+    return impl_->participants;
+}
+
+void ThreadPool::run(std::size_t count, std::size_t grain, RangeFn fn, void* state) {
+    if (count == 0) return;
+    Impl& p = *impl_;
+    if (grain == 0) {
+        grain = std::max<std::size_t>(1, count / (std::size_t{p.participants} * 8));
+    }
+
+    const std::size_t pieces = (count + grain - 1) / grain;
+    if (p.participants == 1 || pieces == 1) {
+        fn(state, 0, count);
+        return;
+    }
+
+    // Busy (concurrent caller, or nested call from inside a job): run inline.
+    if (p.busy.exchange(true, std::memory_order_acquire)) {
+        fn(state, 0, count);
+        return;
+    }
+    struct BusyGuard {
+        std::atomic<bool>& flag;
+        ~BusyGuard() { flag.store(false, std::memory_order_release); }
+    } busy_guard{p.busy};
+
+    const unsigned active = static_cast<unsigned>(
+        std::min<std::size_t>(p.participants, pieces));
+
+    // Even split in whole grains; the last slice absorbs the remainder.
+    const std::size_t per = ((pieces + active - 1) / active) * grain;
+    for (unsigned i = 0; i < active; ++i) {
+        const std::size_t b = std::min(count, per * i);
+        p.slices[i].next.store(b, std::memory_order_relaxed);
+        p.slices[i].end = (i + 1 == active) ? count : std::min(count, b + per);
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(p.m);
+        p.fn      = fn;
+        p.state   = state;
+        p.grain   = grain;
+        p.active  = active;
+        p.pending = active - 1;
+        p.error   = nullptr;
+        p.failed.store(false, std::memory_order_relaxed);
+        ++p.generation;
+    }
+    p.cv_start.notify_all();
+
+    p.work(0);
+
+    std::exception_ptr err;
+    {
+        std::unique_lock<std::mutex> lk(p.m);
+        p.cv_done.wait(lk, [&] { return p.pending == 0; });
+        err = p.error;
+        p.error = nullptr;
+    }
+    if (err) std::rethrow_exception(err);
+}
+
+ThreadPool& ThreadPool::global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+} // namespace secp256k1
@@ -15,12 +15,14 @@
 #include "ufsecp.h"
 
 #include <atomic>
+#include <bit>
 #include <cstring>
 #include <cstdint>
 #include <cstdlib>
 #include <algorithm>
 #include <array>
 #include <limits>
+#include <memory>
 #include <string>
 #include <new>
 #include <thread>
@@ -49,6 +51,8 @@
 #include "secp256k1/init.hpp"
 #include "secp256k1/bip39.hpp"
 #include "secp256k1/batch_verify.hpp"
+#include "secp256k1/hash_accel.hpp"
+#include "secp256k1/thread_pool.hpp"
 #include "secp256k1/musig2.hpp"
 #include "secp256k1/frost.hpp"
 #include "secp256k1/adaptor.hpp"
@@ -95,8 +99,21 @@ struct ufsecp_ctx {
     // and never read by the library.
     char              last_msg[128];
     bool              selftest_ok;
+    // Worker pool used by the batch entry points. Empty = process-wide
+    // secp256k1::ThreadPool::global(). Shared so that clones and the
+    // ufsecp_thread_pool handle can outlive each other in any order.
+    std::shared_ptr<secp256k1::ThreadPool> pool;
 };
 
+/* Opaque pool handle: a reference to a shared ThreadPool. */
+struct ufsecp_thread_pool {
+    std::shared_ptr<secp256k1::ThreadPool> pool;
+};
+
+static inline secp256k1::ThreadPool& ctx_pool(const ufsecp_ctx* ctx) {
+    return ctx->pool ? *ctx->pool : secp256k1::ThreadPool::global();
+}
+
 // BUG-4 FIX: per-thread error message storage.
 // ctx_set_err writes here; ufsecp_last_error_msg reads here.
 // Eliminates the TSan data race when two threads share one ufsecp_ctx and
@@ -306,6 +323,47 @@ struct ScopeExit {
     ScopeExit& operator=(const ScopeExit&) = delete;
 };
 
+// ---------------------------------------------------------------------------
+// batch_parallel: dispatch item(i) over [0, count) on the context's pool.
+// Each slot i writes to out[i*stride..(i+1)*stride-1] — non-overlapping so
+// no synchronisation is needed on the output buffer.  Workers are persistent
+// (see thread_pool.hpp) and steal pieces from each other, so a slow chunk
+// does not set the batch latency.  On any slot error the first error code is
+// captured atomically and the remaining slots are skipped.  After the job,
+// the whole output is re-zeroed fail-closed and the captured error returned.
+// ---------------------------------------------------------------------------
+template<typename Fn>
+static ufsecp_error_t batch_parallel(const ufsecp_ctx* ctx, size_t count,
+                                     uint8_t* out, size_t stride, Fn item)
+{
+    std::atomic<int> first_err{static_cast<int>(UFSECP_OK)};
+    try {
+        ctx_pool(ctx).parallel_for(count, 0, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (first_err.load(std::memory_order_relaxed) != static_cast<int>(UFSECP_OK))
+                    return;
+                const ufsecp_error_t e = item(i);
+                if (SECP256K1_UNLIKELY(e != UFSECP_OK)) {
+                    int expected = static_cast<int>(UFSECP_OK);
+                    first_err.compare_exchange_strong(
+                        expected, static_cast<int>(e),
+                        std::memory_order_acq_rel, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        });
+    } catch (...) {
+        first_err.store(static_cast<int>(UFSECP_ERR_INTERNAL), std::memory_order_relaxed);
+    }
+
+    const int err = first_err.load(std::memory_order_acquire);
+    if (err != static_cast<int>(UFSECP_OK)) {
+        std::memset(out, 0, count * stride);
+        return static_cast<ufsecp_error_t>(err);
+    }
+    return UFSECP_OK;
+}
+
 static inline Point point_from_compressed(const uint8_t pub[33]) {
     // Strict: only accept 0x02/0x03 prefix, reject x >= p
     if (pub[0] != 0x02 && pub[0] != 0x03) return Point::infinity();
@@ -0,0 +1,292 @@
+// ============================================================================
+// Gap-limit wallet scanning (see wallet_scan.hpp)
+// ============================================================================
+
+#include "secp256k1/wallet_scan.hpp"
+#include "secp256k1/field_simd.hpp"
+#include "secp256k1/hash_accel.hpp"
+#include "secp256k1/precompute.hpp"
+#include "secp256k1/tagged_hash.hpp"
+#include "secp256k1/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace secp256k1 {
+
+using fast::FieldElement;
+using fast::Point;
+using fast::Scalar;
+
+namespace {
+
+template <typename Table>
+void sort_unique(Table& t) {
+    // Stable: among equal keys the first added index survives.
+    std::stable_sort(t.begin(), t.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    t.erase(std::unique(t.begin(), t.end(),
+                        [](const auto& a, const auto& b) { return a.first == b.first; }),
+            t.end());
+}
+
+template <typename Table>
+std::int64_t lookup(const Table& t, const std::uint8_t* key) noexcept {
+    using Key = typename Table::value_type::first_type;
+    auto it = std::lower_bound(t.begin(), t.end(), key,
+                               [](const auto& e, const std::uint8_t* k) {
+                                   return std::memcmp(e.first.data(), k, std::tuple_size_v<Key>) < 0;
+                               });
+    if (it == t.end() || std::memcmp(it->first.data(), key, it->first.size()) != 0) return -1;
+    return it->second;
+}
+
+template <typename Fn>
+void run_items(ThreadPool* pool, std::size_t count, Fn&& fn) {
+    if (count == 0) return;
+    if (pool == nullptr) {
+        fn(std::size_t{0}, count);
+    } else {
+        pool->parallel_for(count, 1, fn);
+    }
+}
+
+// Per-thread buffers for one window of children.
+struct Window {
+    std::vector<FieldElement>                  x, y, X, Y, Z;
+    std::vector<std::array<std::uint8_t, 33>>  comp;
+    std::vector<std::array<std::uint8_t, 20>>  h160;
+    std::vector<std::array<std::uint8_t, 32>>  qx;
+    std::vector<Scalar>                        t;
+    std::vector<Point>                         pts;
+    std::unique_ptr<bool[]>                    ok, tr_ok;
+
+    explicit Window(std::size_t n)
+        : x(n), y(n), X(n), Y(n), Z(n), comp(n), h160(n), qx(n), t(n), pts(n),
+          ok(new bool[n]), tr_ok(new bool[n]) {}
+};
+
+} // anonymous namespace
+
+// -- ScriptPubKeySet ----------------------------------------------------------
+
+ScriptPubKeySet::ScriptPubKeySet(const std::vector<std::vector<std::uint8_t>>& scripts) {
+    for (std::size_t i = 0; i < scripts.size(); ++i) {
+        add(scripts[i].data(), scripts[i].size(), static_cast<std::uint32_t>(i));
+    }
+    finalize();
+}
+
+bool ScriptPubKeySet::add(const std::uint8_t* script, std::size_t len, std::uint32_t index) {
+    if (script == nullptr) return false;
+    if (len == 25 && script[0] == 0x76 && script[1] == 0xa9 && script[2] == 0x14 &&
+        script[23] == 0x88 && script[24] == 0xac) {
+        std::array<std::uint8_t, 20> h{};
+        std::memcpy(h.data(), script + 3, 20);
+        p2pkh_.emplace_back(h, index);
+    } else if (len == 22 && script[0] == 0x00 && script[1] == 0x14) {
+        std::array<std::uint8_t, 20> h{};
+        std::memcpy(h.data(), script + 2, 20);
+        p2wpkh_.emplace_back(h, index);
+    } else if (len == 34 && script[0] == 0x51 && script[1] == 0x20) {
+        std::array<std::uint8_t, 32> q{};
+        std::memcpy(q.data(), script + 2, 32);
+        p2tr_.emplace_back(q, index);
+    } else {
+        return false;
+    }
+    finalized_ = false;
+    return true;
+}
+
+void ScriptPubKeySet::finalize() {
+    sort_unique(p2pkh_);
+    sort_unique(p2wpkh_);
+    sort_unique(p2tr_);
+    finalized_ = true;
+}
+
+std::int64_t ScriptPubKeySet::find_p2pkh(const std::uint8_t* hash20) const noexcept {
+    return lookup(p2pkh_, hash20);
+}
+
+std::int64_t ScriptPubKeySet::find_p2wpkh(const std::uint8_t* hash20) const noexcept {
+    return lookup(p2wpkh_, hash20);
+}
+
+std::int64_t ScriptPubKeySet::find_p2tr(const std::uint8_t* output_x32) const noexcept {
+    return lookup(p2tr_, output_x32);
+}
+
+// -- WalletScanner ------------------------------------------------------------
+
+WalletScanner::WalletScanner(WalletScanOptions options) : options_(std::move(options)) {}
+
+std::vector<WalletScanHit>
+WalletScanner::scan(const ExtendedKey* xpubs, std::size_t n_xpubs,
+                    const ScriptPubKeySet& scripts, ThreadPool* pool,
+                    WalletScanStats* stats) const {
+    std::vector<WalletScanHit> hits;
+    if (stats != nullptr) *stats = {};
+    if (xpubs == nullptr || n_xpubs == 0 || options_.gap_limit == 0) return hits;
+
+    ScriptPubKeySet sorted_copy;
+    const ScriptPubKeySet* set = &scripts;
+    if (!scripts.finalized()) {
+        sorted_copy = scripts;
+        sorted_copy.finalize();
+        set = &sorted_copy;
+    }
+    if (set->size() == 0) return hits;
+
+    auto const types = options_.types;
+    bool const want_h160 = (types & (static_cast<std::uint8_t>(WalletOutputType::P2PKH) |
+                                     static_cast<std::uint8_t>(WalletOutputType::P2WPKH))) != 0;
+    bool const want_p2pkh  = (types & static_cast<std::uint8_t>(WalletOutputType::P2PKH)) != 0;
+    bool const want_p2wpkh = (types & static_cast<std::uint8_t>(WalletOutputType::P2WPKH)) != 0;
+    bool const want_p2tr   = (types & static_cast<std::uint8_t>(WalletOutputType::P2TR)) != 0;
+    if (!want_h160 && !want_p2tr) return hits;
+
+    std::size_t const per_xpub = options_.branches.empty() ? 1 : options_.branches.size();
+    std::size_t const n_chains = n_xpubs * per_xpub;
+    std::uint64_t const gap = options_.gap_limit;
+    std::mutex merge_mutex;
+    std::uint64_t total_chains = 0, total_derived = 0;
+
+    run_items(pool, n_chains, [&](std::size_t begin, std::size_t end) {
+        static thread_local Window w(kChunk);
+        std::vector<WalletScanHit> local;
+        std::uint64_t chains = 0, derived = 0;
+
+        for (std::size_t item = begin; item < end; ++item) {
+            std::size_t const xi = item / per_xpub;
+            std::uint32_t branch = WalletScanHit::kNoBranch;
+            ExtendedKey chain = xpubs[xi].to_public();
+            if (!options_.branches.empty()) {
+                branch = options_.branches[item % per_xpub];
+                if (branch & 0x80000000u) continue;
+                auto [child, ok] = chain.derive_child(branch);
+                if (!ok) continue;
+                chain = child;
+            }
+            ++chains;
+
+            // Walk [0, window_end); every hit pushes window_end out to
+            // hit + 1 + gap. Normal indices stop at 2^31.
+            std::uint64_t next = 0, window_end = gap;
+            while (next < window_end && next < 0x80000000u) {
+                std::size_t const len = static_cast<std::size_t>(
+                    std::min<std::uint64_t>({kChunk, window_end - next, 0x80000000u - next}));
+                auto const first = static_cast<std::uint32_t>(next);
+                if (!derive_children_pubkeys(chain, first, static_cast<std::uint32_t>(len),
+                                             w.x.data(), w.y.data(), w.ok.get())) {
+                    break;
+                }
+                derived += len;
+
+                auto record = [&](std::size_t i, WalletOutputType type, std::int64_t script) {
+                    WalletScanHit hit;
+                    hit.xpub_index   = static_cast<std::uint32_t>(xi);
+                    hit.branch       = branch;
+                    hit.child_index  = first + static_cast<std::uint32_t>(i);
+                    hit.type         = type;
+                    hit.script_index = static_cast<std::uint32_t>(script);
+                    // Address strings for hits only.
+                    switch (type) {
+                    case WalletOutputType::P2PKH:
+                        hit.address = address_p2pkh(Point::from_affine(w.x[i], w.y[i]), options_.network);
+                        break;
+                    case WalletOutputType::P2WPKH:
+                        hit.address = address_p2wpkh(Point::from_affine(w.x[i], w.y[i]), options_.network);
+                        break;
+                    case WalletOutputType::P2TR:
+                        hit.address = address_p2tr_raw(w.qx[i], options_.network);
+                        break;
+                    }
+                    local.push_back(std::move(hit));
+                    window_end = std::max<std::uint64_t>(window_end, next + i + 1 + gap);
+                };
+
+                for (std::size_t i = 0; i < len; ++i) {
+                    if (!w.ok[i]) {
+                        w.comp[i].fill(0);
+                        continue;
+                    }
+                    w.comp[i][0] = static_cast<std::uint8_t>(0x02 | (w.y[i].limbs()[0] & 1));
+                    w.x[i].to_bytes_into(w.comp[i].data() + 1);
+                }
+
+                if (want_h160) {
+                    hash::hash160_33_batch(w.comp[0].data(), w.h160[0].data(), len);
+                    for (std::size_t i = 0; i < len; ++i) {
+                        if (!w.ok[i]) continue;
+                        if (want_p2pkh) {
+                            std::int64_t const s = set->find_p2pkh(w.h160[i].data());
+                            if (s >= 0) record(i, WalletOutputType::P2PKH, s);
+                        }
+                        if (want_p2wpkh) {
+                            std::int64_t const s = set->find_p2wpkh(w.h160[i].data());
+                            if (s >= 0) record(i, WalletOutputType::P2WPKH, s);
+                        }
+                    }
+                }
+
+                if (want_p2tr) {
+                    // Q = P + H_TapTweak(x(P))*G with P lifted to even y.
+                    for (std::size_t i = 0; i < len; ++i) {
+                        w.tr_ok[i] = false;
+                        w.t[i] = Scalar::zero();
+                        if (!w.ok[i]) continue;
+                        auto const th = detail::cached_tagged_hash(detail::g_taptweak_midstate,
+                                                                   w.comp[i].data() + 1, 32);
+                        w.tr_ok[i] = Scalar::parse_bytes_strict(th, w.t[i]);
+                        if (w.y[i].limbs()[0] & 1) w.y[i] = w.y[i].negate();
+                    }
+                    fast::batch_scalar_mul_generator(w.t.data(), w.pts.data(), len);
+                    for (std::size_t i = 0; i < len; ++i) {
+                        w.X[i] = w.pts[i].X();
+                        w.Y[i] = w.pts[i].Y();
+                        w.Z[i] = w.pts[i].z();
+                    }
+                    fast::point_add_mixed_batch(w.X.data(), w.Y.data(), w.Z.data(),
+                                                w.x.data(), w.y.data(),
+                                                w.X.data(), w.Y.data(), w.Z.data(), len);
+                    for (std::size_t i = 0; i < len; ++i) {
+                        w.pts[i] = Point::from_jacobian_coords(w.X[i], w.Y[i], w.Z[i],
+                                                               w.Z[i] == FieldElement::zero());
+                    }
+                    Point::batch_x_only_bytes(w.pts.data(), len, w.qx.data());
+                    for (std::size_t i = 0; i < len; ++i) {
+                        if (!w.ok[i] || !w.tr_ok[i] || w.pts[i].is_infinity()) continue;
+                        std::int64_t const s = set->find_p2tr(w.qx[i].data());
+                        if (s >= 0) record(i, WalletOutputType::P2TR, s);
+                    }
+                }
+                next += len;
+            }
+        }
+
+        std::lock_guard<std::mutex> lk(merge_mutex);
+        hits.insert(hits.end(), std::make_move_iterator(local.begin()),
+                    std::make_move_iterator(local.end()));
+        total_chains += chains;
+        total_derived += derived;
+    });
+
+    std::sort(hits.begin(), hits.end(), [](const WalletScanHit& a, const WalletScanHit& b) {
+        if (a.xpub_index != b.xpub_index) return a.xpub_index < b.xpub_index;
+        if (a.branch != b.branch) return a.branch < b.branch;
+        if (a.child_index != b.child_index) return a.child_index < b.child_index;
+        return a.type < b.type;
+    });
+    if (stats != nullptr) {
+        stats->chains = total_chains;
+        stats->derived = total_derived;
+    }
+    return hits;
+}
+
+} // namespace secp256k1
@@ -8,8 +8,12 @@
 #include "secp256k1/field.hpp"
 #include "secp256k1/ct/point.hpp"
 #include "secp256k1/pippenger.hpp"
+#include "secp256k1/detail/csprng.hpp"
 #include "secp256k1/detail/secure_erase.hpp"
 #include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 
 namespace secp256k1 {
 namespace zk {
@@ -307,30 +311,71 @@ bool dleq_verify(const DLEQProof& proof,
 // Bulletproof Generator Vectors
 // ============================================================================
 
+namespace {
+
+// lift_x(H("Bulletproof/gen" || tag || LE32(i)))
+Point derive_generator(std::uint8_t tag, std::size_t i) {
+    std::uint8_t buf[5];
+    buf[0] = tag;
+    buf[1] = static_cast<std::uint8_t>(i & 0xFF);
+    buf[2] = static_cast<std::uint8_t>((i >> 8) & 0xFF);
+    buf[3] = static_cast<std::uint8_t>((i >> 16) & 0xFF);
+    buf[4] = static_cast<std::uint8_t>((i >> 24) & 0xFF);
+    auto hash = detail::cached_tagged_hash(g_bp_gen_midstate, buf, sizeof(buf));
+    return lift_x_even(FieldElement::from_bytes(hash));
+}
+
+} // anonymous namespace
+
 const GeneratorVectors& get_generator_vectors() {
     static const GeneratorVectors vecs = []() {
         GeneratorVectors v{};
         for (std::size_t i = 0; i < RANGE_PROOF_BITS; ++i) {
-            // G_i = lift_x(H("Bulletproof/gen" || "G" || LE32(i)))
-            std::uint8_t buf_g[5];
-            buf_g[0] = 'G';
-            buf_g[1] = static_cast<std::uint8_t>(i & 0xFF);
-            buf_g[2] = static_cast<std::uint8_t>((i >> 8) & 0xFF);
-            buf_g[3] = static_cast<std::uint8_t>((i >> 16) & 0xFF);
-            buf_g[4] = static_cast<std::uint8_t>((i >> 24) & 0xFF);
-            auto hash_g = detail::cached_tagged_hash(g_bp_gen_midstate, buf_g, 5);
-            v.G[i] = lift_x_even(FieldElement::from_bytes(hash_g));
-
-            // H_i = lift_x(H("Bulletproof/gen" || "H" || LE32(i)))
-            buf_g[0] = 'H';
-            auto hash_h = detail::cached_tagged_hash(g_bp_gen_midstate, buf_g, 5);
-            v.H[i] = lift_x_even(FieldElement::from_bytes(hash_h));
+            v.G[i] = derive_generator('G', i);
+            v.H[i] = derive_generator('H', i);
+        }
+        return v;
+    }();
+    return vecs;
+}
+
+const AggregateGeneratorVectors& get_aggregate_generator_vectors() {
+    static const AggregateGeneratorVectors vecs = []() {
+        const auto& base = get_generator_vectors();
+        AggregateGeneratorVectors v;
+        v.G.assign(base.G.begin(), base.G.end());
+        v.H.assign(base.H.begin(), base.H.end());
+        v.G.reserve(AGG_RANGE_PROOF_MAX_BITS);
+        v.H.reserve(AGG_RANGE_PROOF_MAX_BITS);
+        for (std::size_t i = RANGE_PROOF_BITS; i < AGG_RANGE_PROOF_MAX_BITS; ++i) {
+            v.G.push_back(derive_generator('G', i));
+            v.H.push_back(derive_generator('H', i));
         }
         return v;
     }();
     return vecs;
 }
 
+namespace {
+
+// Fixed bases of the merged range-proof check, in verifier order:
+// G_0..G_{n-1}, H_0..H_{n-1}, G, U (= H_ped).
+const PreparedMsm& range_proof_fixed_bases() {
+    static const PreparedMsm prepared = []() {
+        const auto& gens = get_generator_vectors();
+        std::vector<Point> bases;
+        bases.reserve(2 * RANGE_PROOF_BITS + 2);
+        bases.insert(bases.end(), gens.G.begin(), gens.G.end());
+        bases.insert(bases.end(), gens.H.begin(), gens.H.end());
+        bases.push_back(Point::generator());
+        bases.push_back(pedersen_generator_H());
+        return PreparedMsm(bases);
+    }();
+    return prepared;
+}
+
+} // anonymous namespace
+
 
 // ============================================================================
 // 3. Bulletproof Range Proof
@@ -595,7 +640,6 @@ RangeProof range_prove(std::uint64_t value,
 
 bool range_verify(const PedersenCommitment& commitment,
                   const RangeProof& proof) {
-    const auto& gens = get_generator_vectors();
     const Point& H_ped = pedersen_generator_H();
 
     // Recompute Fiat-Shamir challenges
@@ -727,14 +771,17 @@ bool range_verify(const PedersenCommitment& commitment,
         }
     }
 
-    // Merged verification: compute P_check - expected == 0 as single MSM
+    // Merged verification: compute P_check - expected == 0 as one multi-scalar sum
     // P_check = A + x*S + sum((-z - a*s_i)*G_i) + sum((z + z2*2^i*y^{-i} - b*s_inv_i*y^{-i})*H_i)
     //         - mu*G + (t_hat - a*b)*U + sum(x_j^2*L_j + x_j^{-2}*R_j)
     //
-    // Total points: 2 (A,S) + 128 (G_i) + 128 (H_i) + 1 (G) + 1 (U) + 12 (L,R) = ~144
-    constexpr std::size_t MSM_SIZE = 2 + 2*RANGE_PROOF_BITS + 1 + 1 + 2*RANGE_PROOF_LOG2;
-    Scalar msm_s[MSM_SIZE];
-    Point  msm_p[MSM_SIZE];
+    // Fixed bases (G_i, H_i, G, U) go through the prepared tables; the 2 + 12
+    // proof points (A, S, L_j, R_j) through a small Strauss MSM.
+    constexpr std::size_t FIXED_SIZE = 2*RANGE_PROOF_BITS + 2;
+    constexpr std::size_t VAR_SIZE   = 2 + 2*RANGE_PROOF_LOG2;
+    Scalar fixed_s[FIXED_SIZE];
+    Scalar msm_s[VAR_SIZE];
+    Point  msm_p[VAR_SIZE];
 
     std::size_t idx = 0;
 
@@ -771,29 +818,21 @@ bool range_verify(const PedersenCommitment& commitment,
 
     // G_i coefficients: -z - a*s_i  (P_check: -z*G_i, expected: a*s_i*G_i, diff: -z - a*s_i)
     for (std::size_t i = 0; i < RANGE_PROOF_BITS; ++i) {
-        msm_s[idx] = neg_z - proof.a * s_coeff[i];
-        msm_p[idx] = gens.G[i];
-        ++idx;
+        fixed_s[i] = neg_z - proof.a * s_coeff[i];
     }
 
     // H_i coefficients: (z + z2*2^i*y_inv^i) - b*s_inv[i]*y_inv^i
     for (std::size_t i = 0; i < RANGE_PROOF_BITS; ++i) {
         Scalar const h_pcheck = z + z2 * two_powers[i] * y_inv_powers[i];
         Scalar const h_expect = proof.b * s_inv[i] * y_inv_powers[i];
-        msm_s[idx] = h_pcheck - h_expect;
-        msm_p[idx] = gens.H[i];
-        ++idx;
+        fixed_s[RANGE_PROOF_BITS + i] = h_pcheck - h_expect;
     }
 
     // -mu * G (generator)
-    msm_s[idx] = proof.mu.negate();
-    msm_p[idx] = Point::generator();
-    ++idx;
+    fixed_s[2*RANGE_PROOF_BITS] = proof.mu.negate();
 
     // (t_hat - a*b) * U  (H_ped)
-    msm_s[idx] = proof.t_hat - ab;
-    msm_p[idx] = H_ped;
-    ++idx;
+    fixed_s[2*RANGE_PROOF_BITS + 1] = proof.t_hat - ab;
 
     // L_j and R_j contributions
     for (std::size_t j = 0; j < RANGE_PROOF_LOG2; ++j) {
@@ -806,8 +845,423 @@ bool range_verify(const PedersenCommitment& commitment,
         ++idx;
     }
 
-    // Single MSM: if result is infinity, verification passes
-    Point const final_check = msm(msm_s, msm_p, MSM_SIZE);
+    // If the sum is infinity, verification passes
+    Point final_check = range_proof_fixed_bases().msm(fixed_s, FIXED_SIZE);
+    final_check.add_inplace(msm(msm_s, msm_p, VAR_SIZE));
+    return final_check.is_infinity();
+}
+
+
+// ============================================================================
+// 3b. Aggregated Bulletproof Range Proof
+// ============================================================================
+
+namespace {
+
+// log2 of m rounded up to a power of two; 0 for m = 1.
+std::size_t aggregate_log_m(std::size_t m) noexcept {
+    std::size_t log_m = 0;
+    while ((std::size_t{1} << log_m) < m) ++log_m;
+    return log_m;
+}
+
+// Fixed bases of the aggregated check for N = 64 << log_m, same order as
+// range_proof_fixed_bases(), which is the log_m = 0 instance. Built on first
+// use per size.
+const PreparedMsm& aggregate_fixed_bases(std::size_t log_m) {
+    constexpr std::size_t kSizes = AGG_RANGE_PROOF_MAX_LOG2 - RANGE_PROOF_LOG2 + 1;
+    static std::once_flag once[kSizes];
+    static PreparedMsm prepared[kSizes];
+    if (log_m == 0) return range_proof_fixed_bases();
+    std::call_once(once[log_m], [log_m]() {
+        const auto& gens = get_aggregate_generator_vectors();
+        std::size_t const n = RANGE_PROOF_BITS << log_m;
+        std::vector<Point> bases;
+        bases.reserve(2 * n + 2);
+        bases.insert(bases.end(), gens.G.begin(), gens.G.begin() + static_cast<std::ptrdiff_t>(n));
+        bases.insert(bases.end(), gens.H.begin(), gens.H.begin() + static_cast<std::ptrdiff_t>(n));
+        bases.push_back(Point::generator());
+        bases.push_back(pedersen_generator_H());
+        prepared[log_m] = PreparedMsm(bases);
+    });
+    return prepared[log_m];
+}
+
+// y, z = H_y, H_z(A || S || V_0 || ... || V_{m-1}); for m = 1 these are the
+// single-proof challenges.
+void aggregate_challenges_yz(const Point& A, const Point& S,
+                             const PedersenCommitment* commitments, std::size_t m,
+                             Scalar& y, Scalar& z) {
+    std::uint8_t buf[33 * (2 + AGG_RANGE_PROOF_MAX_M)];
+    auto const A_comp = A.to_compressed();
+    auto const S_comp = S.to_compressed();
+    std::memcpy(buf, A_comp.data(), 33);
+    std::memcpy(buf + 33, S_comp.data(), 33);
+    for (std::size_t j = 0; j < m; ++j) {
+        auto const V_comp = commitments[j].to_compressed();
+        std::memcpy(buf + 66 + 33 * j, V_comp.data(), 33);
+    }
+    std::size_t const len = 66 + 33 * m;
+    y = Scalar::from_bytes(detail::cached_tagged_hash(g_bp_y_midstate, buf, len));
+    z = Scalar::from_bytes(detail::cached_tagged_hash(g_bp_z_midstate, buf, len));
+}
+
+// x = H_x(T1 || T2 || y || z), as in the single proof.
+Scalar aggregate_challenge_x(const Point& T1, const Point& T2, const Scalar& y, const Scalar& z) {
+    std::uint8_t buf[33 + 33 + 32 + 32];
+    auto const T1_comp = T1.to_compressed();
+    auto const T2_comp = T2.to_compressed();
+    auto const y_bytes = y.to_bytes();
+    auto const z_bytes = z.to_bytes();
+    std::memcpy(buf, T1_comp.data(), 33);
+    std::memcpy(buf + 33, T2_comp.data(), 33);
+    std::memcpy(buf + 66, y_bytes.data(), 32);
+    std::memcpy(buf + 98, z_bytes.data(), 32);
+    return Scalar::from_bytes(detail::cached_tagged_hash(g_bp_x_midstate, buf, sizeof(buf)));
+}
+
+// Inner-product round challenge H_ip(L || R).
+Scalar ip_challenge(const Point& L, const Point& R) {
+    std::uint8_t buf[33 + 33];
+    auto const L_comp = L.to_compressed();
+    auto const R_comp = R.to_compressed();
+    std::memcpy(buf, L_comp.data(), 33);
+    std::memcpy(buf + 33, R_comp.data(), 33);
+    return Scalar::from_bytes(detail::cached_tagged_hash(g_bp_ip_midstate, buf, sizeof(buf)));
+}
+
+} // anonymous namespace
+
+AggregatedRangeProof range_prove_aggregated(const std::uint64_t* values,
+                                            const Scalar* blindings,
+                                            const PedersenCommitment* commitments,
+                                            std::size_t m,
+                                            const std::array<std::uint8_t, 32>& aux_rand) {
+    if (m == 0 || m > AGG_RANGE_PROOF_MAX_M) {
+        throw std::invalid_argument("range_prove_aggregated: m must be in [1, AGG_RANGE_PROOF_MAX_M]");
+    }
+    std::size_t const log_m = aggregate_log_m(m);
+    std::size_t const N = RANGE_PROOF_BITS << log_m;
+    const auto& gens = get_aggregate_generator_vectors();
+    const Point& H_ped = pedersen_generator_H();
+
+    AggregatedRangeProof proof{};
+    proof.rounds = RANGE_PROOF_LOG2 + log_m;
+
+    // Bits of v_0 || v_1 || ...; padding slots up to the power of two hold 0.
+    std::vector<std::uint64_t> bits(N, 0);
+    std::vector<Scalar> a_L(N), a_R(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t const j = i / RANGE_PROOF_BITS;
+        bits[i] = j < m ? (values[j] >> (i % RANGE_PROOF_BITS)) & 1 : 0;
+        a_L[i] = Scalar::from_uint64(bits[i]);
+        a_R[i] = a_L[i] - Scalar::one();
+    }
+
+    // Nonce seed binds every value, blinding and commitment.
+    Scalar secret;
+    std::array<std::uint8_t, 32> msg{};
+    {
+        SHA256 sec_h;
+        SHA256 msg_h;
+        for (std::size_t j = 0; j < m; ++j) {
+            auto b_bytes = blindings[j].to_bytes();
+            std::uint8_t v_bytes[8];
+            for (int k = 0; k < 8; ++k) v_bytes[k] = static_cast<std::uint8_t>(values[j] >> (8 * k));
+            sec_h.update(b_bytes.data(), 32);
+            sec_h.update(v_bytes, 8);
+            detail::secure_erase(b_bytes.data(), b_bytes.size());
+            detail::secure_erase(v_bytes, sizeof(v_bytes));
+            auto const V_comp = commitments[j].to_compressed();
+            msg_h.update(V_comp.data(), 33);
+        }
+        auto sec_digest = sec_h.finalize();
+        secret = Scalar::from_bytes(sec_digest);
+        detail::secure_erase(sec_digest.data(), sec_digest.size());
+        msg = msg_h.finalize();
+    }
+    const Scalar alpha = derive_nonce(secret, commitments[0].point, msg.data(), aux_rand.data());
+    detail::secure_erase(&secret, sizeof(secret));
+    auto alpha_bytes = alpha.to_bytes();
+    const Scalar rho = Scalar::from_bytes(SHA256::hash(alpha_bytes.data(), 32));
+
+    std::vector<Scalar> s_L(N), s_R(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        std::uint8_t buf[32 + 2 + 1];
+        std::memcpy(buf, alpha_bytes.data(), 32);
+        buf[32] = static_cast<std::uint8_t>(i & 0xFF);
+        buf[33] = static_cast<std::uint8_t>(i >> 8);
+        buf[34] = 'L';
+        s_L[i] = Scalar::from_bytes(SHA256::hash(buf, sizeof(buf)));
+        buf[34] = 'R';
+        s_R[i] = Scalar::from_bytes(SHA256::hash(buf, sizeof(buf)));
+    }
+
+    // A = alpha*G + sum(a_L[i]*G_i + a_R[i]*H_i)
+    //   = alpha*G - sum(H_i) + sum(bit_i ? G_i + H_i : O), selected without
+    //     branching on the value bits.
+    {
+        ct::CTJacobianPoint acc = ct::CTJacobianPoint::from_point(ct::generator_mul(alpha));
+        ct::CTJacobianPoint const inf = ct::CTJacobianPoint::make_infinity();
+        Point sum_H = Point::infinity();
+        for (std::size_t i = 0; i < N; ++i) {
+            ct::CTJacobianPoint const gh = ct::CTJacobianPoint::from_point(gens.G[i].add(gens.H[i]));
+            std::uint64_t const mask = 0 - bits[i];
+            acc = ct::point_add_complete(acc, ct::point_select(gh, inf, mask));
+            sum_H.add_inplace(gens.H[i]);
+        }
+        proof.A = acc.to_point().add(sum_H.negate());
+    }
+
+    // S = rho*G + sum(s_L[i]*G_i + s_R[i]*H_i), over the prepared bases
+    const PreparedMsm& bases = aggregate_fixed_bases(log_m);
+    std::vector<Scalar> sc(2 * N + 2, Scalar::zero());
+    for (std::size_t i = 0; i < N; ++i) {
+        sc[i] = s_L[i];
+        sc[N + i] = s_R[i];
+    }
+    sc[2 * N] = rho;
+    proof.S = bases.msm(sc.data(), sc.size());
+
+    Scalar y, z;
+    aggregate_challenges_yz(proof.A, proof.S, commitments, m, y, z);
+
+    // y^i, and z^(2+j) * 2^(i mod 64) for the block j that holds index i
+    std::vector<Scalar> y_powers(N);
+    y_powers[0] = Scalar::one();
+    for (std::size_t i = 1; i < N; ++i) y_powers[i] = y_powers[i - 1] * y;
+
+    Scalar two_powers[RANGE_PROOF_BITS];
+    two_powers[0] = Scalar::one();
+    for (std::size_t i = 1; i < RANGE_PROOF_BITS; ++i) two_powers[i] = two_powers[i - 1] + two_powers[i - 1];
+
+    std::vector<Scalar> z_blocks(std::size_t{1} << log_m);
+    z_blocks[0] = z * z;
+    for (std::size_t j = 1; j < z_blocks.size(); ++j) z_blocks[j] = z_blocks[j - 1] * z;
+
+    std::vector<Scalar> zt(N);   // z^(2+j) * 2^(i mod 64)
+    for (std::size_t i = 0; i < N; ++i) {
+        zt[i] = z_blocks[i / RANGE_PROOF_BITS] * two_powers[i % RANGE_PROOF_BITS];
+    }
+
+    // t_1 = <a_L - z, y^N * s_R> + <s_L, y^N * (a_R + z) + zt>,  t_2 = <s_L, y^N * s_R>
+    Scalar t1 = Scalar::zero();
+    Scalar t2 = Scalar::zero();
+    for (std::size_t i = 0; i < N; ++i) {
+        Scalar const l0_i = a_L[i] - z;
+        Scalar const r0_i = y_powers[i] * (a_R[i] + z) + zt[i];
+        Scalar const r1_i = y_powers[i] * s_R[i];
+        t1 = t1 + l0_i * r1_i + s_L[i] * r0_i;
+        t2 = t2 + s_L[i] * r1_i;
+    }
+
+    Scalar const tau1 = Scalar::from_bytes(SHA256::hash(rho.to_bytes().data(), 32));
+    Scalar const tau2 = Scalar::from_bytes(SHA256::hash(tau1.to_bytes().data(), 32));
+    proof.T1 = H_ped.scalar_mul(t1).add(ct::generator_mul(tau1));
+    proof.T2 = H_ped.scalar_mul(t2).add(ct::generator_mul(tau2));
+
+    Scalar const x = aggregate_challenge_x(proof.T1, proof.T2, y, z);
+
+    // l(x), r(x) and t_hat = <l(x), r(x)>
+    std::vector<Scalar> a_vec(N), b_vec(N);
+    Scalar t_hat = Scalar::zero();
+    for (std::size_t i = 0; i < N; ++i) {
+        a_vec[i] = (a_L[i] - z) + s_L[i] * x;
+        b_vec[i] = y_powers[i] * (a_R[i] + z + s_R[i] * x) + zt[i];
+        t_hat = t_hat + a_vec[i] * b_vec[i];
+    }
+    proof.t_hat = t_hat;
+
+    // tau_x = tau_2*x^2 + tau_1*x + sum(z^(2+j) * gamma_j);  mu = alpha + rho*x
+    Scalar tau_x = tau2 * (x * x) + tau1 * x;
+    for (std::size_t j = 0; j < m; ++j) tau_x = tau_x + z_blocks[j] * blindings[j];
+    proof.tau_x = tau_x;
+    proof.mu = alpha + rho * x;
+
+    // Inner product argument. The folded generators are never formed:
+    // G'_k = sum(gc[i]*G_i) and H'_k = sum(hc[i]*H_i) over the original
+    // indices i = k (mod current length), so L and R are MSMs over the
+    // prepared bases. hc starts at y^-i (H'_i = y^-i * H_i, as range_prove).
+    std::vector<Scalar> gc(N, Scalar::one());
+    std::vector<Scalar> hc(N);
+    {
+        const Scalar y_inv = y.inverse();
+        hc[0] = Scalar::one();
+        for (std::size_t i = 1; i < N; ++i) hc[i] = hc[i - 1] * y_inv;
+    }
+
+    std::vector<Scalar> sc_R(2 * N + 2, Scalar::zero());
+    std::size_t n = N;
+    for (std::size_t round = 0; round < proof.rounds; ++round) {
+        n /= 2;
+
+        // L = <a_lo, G'_hi> + <b_hi, H'_lo> + <a_lo, b_hi>*U
+        // R = <a_hi, G'_lo> + <b_lo, H'_hi> + <a_hi, b_lo>*U
+        Scalar c_L = Scalar::zero();
+        Scalar c_R = Scalar::zero();
+        for (std::size_t k = 0; k < n; ++k) {
+            c_L = c_L + a_vec[k] * b_vec[n + k];
+            c_R = c_R + a_vec[n + k] * b_vec[k];
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            std::size_t const k = i & (2 * n - 1);
+            if (k < n) {
+                sc[i] = Scalar::zero();
+                sc[N + i] = b_vec[n + k] * hc[i];
+                sc_R[i] = a_vec[n + k] * gc[i];
+                sc_R[N + i] = Scalar::zero();
+            } else {
+                sc[i] = a_vec[k - n] * gc[i];
+                sc[N + i] = Scalar::zero();
+                sc_R[i] = Scalar::zero();
+                sc_R[N + i] = b_vec[k - n] * hc[i];
+            }
+        }
+        sc[2 * N] = Scalar::zero();
+        sc[2 * N + 1] = c_L;
+        sc_R[2 * N + 1] = c_R;
+        proof.L[round] = bases.msm(sc.data(), sc.size());
+        proof.R[round] = bases.msm(sc_R.data(), sc_R.size());
+
+        Scalar const x_r = ip_challenge(proof.L[round], proof.R[round]);
+        Scalar const x_r_inv = x_r.inverse();
+
+        // a' = a_lo*x + a_hi*x^-1, b' = b_lo*x^-1 + b_hi*x
+        // G' = G_lo*x^-1 + G_hi*x, H' = H_lo*x + H_hi*x^-1
+        for (std::size_t k = 0; k < n; ++k) {
+            a_vec[k] = a_vec[k] * x_r + a_vec[n + k] * x_r_inv;
+            b_vec[k] = b_vec[k] * x_r_inv + b_vec[n + k] * x_r;
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            bool const lo = (i & (2 * n - 1)) < n;
+            gc[i] = gc[i] * (lo ? x_r_inv : x_r);
+            hc[i] = hc[i] * (lo ? x_r : x_r_inv);
+        }
+    }
+    proof.a = a_vec[0];
+    proof.b = b_vec[0];
+
+    detail::secure_erase(bits.data(), bits.size() * sizeof(std::uint64_t));
+    detail::secure_erase(a_L.data(), a_L.size() * sizeof(Scalar));
+    detail::secure_erase(a_R.data(), a_R.size() * sizeof(Scalar));
+    detail::secure_erase(s_L.data(), s_L.size() * sizeof(Scalar));
+    detail::secure_erase(s_R.data(), s_R.size() * sizeof(Scalar));
+    detail::secure_erase(a_vec.data(), a_vec.size() * sizeof(Scalar));
+    detail::secure_erase(b_vec.data(), b_vec.size() * sizeof(Scalar));
+    detail::secure_erase(sc.data(), sc.size() * sizeof(Scalar));
+    detail::secure_erase(sc_R.data(), sc_R.size() * sizeof(Scalar));
+    detail::secure_erase(alpha_bytes.data(), alpha_bytes.size());
+    return proof;
+}
+
+bool range_verify_aggregated(const PedersenCommitment* commitments,
+                             std::size_t m,
+                             const AggregatedRangeProof& proof) {
+    if (commitments == nullptr || m == 0 || m > AGG_RANGE_PROOF_MAX_M) return false;
+    std::size_t const log_m = aggregate_log_m(m);
+    std::size_t const N = RANGE_PROOF_BITS << log_m;
+    std::size_t const rounds = RANGE_PROOF_LOG2 + log_m;
+    if (proof.rounds != rounds) return false;
+
+    Scalar y, z;
+    aggregate_challenges_yz(proof.A, proof.S, commitments, m, y, z);
+    Scalar const x = aggregate_challenge_x(proof.T1, proof.T2, y, z);
+
+    Scalar x_rounds[AGG_RANGE_PROOF_MAX_LOG2];
+    Scalar x_inv_rounds[AGG_RANGE_PROOF_MAX_LOG2];
+    Scalar s0 = Scalar::one();
+    for (std::size_t k = 0; k < rounds; ++k) {
+        x_rounds[k] = ip_challenge(proof.L[k], proof.R[k]);
+        x_inv_rounds[k] = x_rounds[k].inverse();
+        s0 = s0 * x_inv_rounds[k];
+    }
+
+    // s_i = prod(bit of i for round k set ? x_k : x_k^-1), round 0 being the
+    // most significant bit; built by doubling: s[i + 2^b] = s[i] * x_k^2.
+    // Flipping every bit gives s_i^-1 = s_{N-1-i}.
+    std::vector<Scalar> s_coeff(N);
+    s_coeff[0] = s0;
+    for (std::size_t b = 0, half = 1; b < rounds; ++b, half <<= 1) {
+        Scalar const x2_k = x_rounds[rounds - 1 - b] * x_rounds[rounds - 1 - b];
+        for (std::size_t i = 0; i < half; ++i) s_coeff[half + i] = s_coeff[i] * x2_k;
+    }
+
+    Scalar two_powers[RANGE_PROOF_BITS];
+    two_powers[0] = Scalar::one();
+    for (std::size_t i = 1; i < RANGE_PROOF_BITS; ++i) two_powers[i] = two_powers[i - 1] + two_powers[i - 1];
+
+    // z^(2+j) for every block, padding included
+    Scalar z_blocks[AGG_RANGE_PROOF_MAX_M];
+    Scalar sum_z_blocks = Scalar::zero();
+    z_blocks[0] = z * z;
+    for (std::size_t j = 0; j < (std::size_t{1} << log_m); ++j) {
+        if (j != 0) z_blocks[j] = z_blocks[j - 1] * z;
+        sum_z_blocks = sum_z_blocks + z_blocks[j];
+    }
+
+    // Random weight of the polynomial check; a forged proof passes the merged
+    // equation for at most one value of it.
+    Scalar c;
+    {
+        std::array<std::uint8_t, 32> rnd{};
+        do {
+            detail::csprng_fill(rnd.data(), rnd.size());
+            c = Scalar::from_bytes(rnd);
+        } while (c.is_zero());
+    }
+
+    // Fixed scalars, in aggregate_fixed_bases() order:
+    //   G_i: -z - a*s_i
+    //   H_i: z + (z^(2+j)*2^(i mod 64) - b*s_i^-1) * y^-i
+    //   G:   -mu + c*tau_x
+    //   U:   t_hat - a*b + c*(t_hat - delta)
+    // with delta = (z - z^2)*sum(y^i) - z*sum(z^(2+j))*(2^64 - 1).
+    std::vector<Scalar> fixed_s(2 * N + 2);
+    Scalar const neg_z = z.negate();
+    Scalar const y_inv = y.inverse();
+    Scalar y_pow = Scalar::one();
+    Scalar y_inv_pow = Scalar::one();
+    Scalar sum_y = Scalar::zero();
+    for (std::size_t i = 0; i < N; ++i) {
+        fixed_s[i] = neg_z - proof.a * s_coeff[i];
+        Scalar const zt = z_blocks[i / RANGE_PROOF_BITS] * two_powers[i % RANGE_PROOF_BITS];
+        fixed_s[N + i] = z + (zt - proof.b * s_coeff[N - 1 - i]) * y_inv_pow;
+        sum_y = sum_y + y_pow;
+        y_pow = y_pow * y;
+        y_inv_pow = y_inv_pow * y_inv;
+    }
+    Scalar const delta = (z - z * z) * sum_y
+                       - z * sum_z_blocks * Scalar::from_uint64(~std::uint64_t{0});
+    fixed_s[2 * N] = c * proof.tau_x - proof.mu;
+    fixed_s[2 * N + 1] = proof.t_hat - proof.a * proof.b + c * (proof.t_hat - delta);
+
+    // Proof points: A, S, T1, T2, V_j, L_k, R_k
+    constexpr std::size_t VAR_MAX = 4 + AGG_RANGE_PROOF_MAX_M + 2 * AGG_RANGE_PROOF_MAX_LOG2;
+    Scalar msm_s[VAR_MAX];
+    Point  msm_p[VAR_MAX];
+    std::size_t idx = 0;
+    Scalar const cx = c * x;
+    msm_s[idx] = Scalar::one();
+    msm_p[idx++] = proof.A;
+    msm_s[idx] = x;
+    msm_p[idx++] = proof.S;
+    msm_s[idx] = cx.negate();
+    msm_p[idx++] = proof.T1;
+    msm_s[idx] = (cx * x).negate();
+    msm_p[idx++] = proof.T2;
+    for (std::size_t j = 0; j < m; ++j) {
+        msm_s[idx] = (c * z_blocks[j]).negate();
+        msm_p[idx++] = commitments[j].point;
+    }
+    for (std::size_t k = 0; k < rounds; ++k) {
+        msm_s[idx] = x_rounds[k] * x_rounds[k];
+        msm_p[idx++] = proof.L[k];
+        msm_s[idx] = x_inv_rounds[k] * x_inv_rounds[k];
+        msm_p[idx++] = proof.R[k];
+    }
+
+    Point final_check = aggregate_fixed_bases(log_m).msm(fixed_s.data(), fixed_s.size());
+    final_check.add_inplace(msm(msm_s, msm_p, idx));
     return final_check.is_infinity();
 }
 
@@ -816,15 +1270,191 @@ bool range_verify(const PedersenCommitment& commitment,
 // Batch Operations
 // ============================================================================
 
+namespace {
+
+// Montgomery batch inversion: one inverse for n scalars. Returns false (and
+// leaves v unspecified) if any entry is zero.
+bool scalar_batch_inverse(Scalar* v, std::size_t n) {
+    if (n == 0) return true;
+    std::vector<Scalar> acc(n);
+    acc[0] = v[0];
+    for (std::size_t i = 1; i < n; ++i) acc[i] = acc[i - 1] * v[i];
+    if (acc[n - 1].is_zero()) return false;
+    Scalar inv = acc[n - 1].inverse();
+    for (std::size_t i = n; i-- > 1; ) {
+        Scalar const vi = v[i];
+        v[i] = inv * acc[i - 1];
+        inv = inv * vi;
+    }
+    v[0] = inv;
+    return true;
+}
+
+} // anonymous namespace
+
+// All proofs are checked by one equation: proof k contributes its inner
+// product check with weight w_k and its polynomial check with weight v_k
+// (as the two halves of range_verify). Terms on the fixed bases G_i, H_i,
+// G, U are summed across proofs before the MSM, so the whole batch costs
+// one 130-base prepared MSM plus a Pippenger over the 17 proof points
+// (A, S, V, T1, T2, L_j, R_j) of every proof.
 bool batch_range_verify(const PedersenCommitment* commitments,
                         const RangeProof* proofs,
                         std::size_t count) {
-    for (std::size_t i = 0; i < count; ++i) {
-        if (!range_verify(commitments[i], proofs[i])) {
-            return false;
+    if (count == 0) return true;
+    if (commitments == nullptr || proofs == nullptr) return false;
+    if (count == 1) return range_verify(commitments[0], proofs[0]);
+
+    // Proof points in transcript order; one inversion serialises them all.
+    constexpr std::size_t kPoints = 5 + 2 * RANGE_PROOF_LOG2;
+    std::vector<Point> pts(kPoints * count);
+    for (std::size_t k = 0; k < count; ++k) {
+        const RangeProof& p = proofs[k];
+        Point* const q = pts.data() + kPoints * k;
+        q[0] = p.A;
+        q[1] = p.S;
+        q[2] = commitments[k].point;
+        q[3] = p.T1;
+        q[4] = p.T2;
+        for (std::size_t j = 0; j < RANGE_PROOF_LOG2; ++j) {
+            q[5 + 2 * j] = p.L[j];
+            q[6 + 2 * j] = p.R[j];
         }
     }
-    return true;
+    std::vector<std::array<std::uint8_t, 33>> comp(pts.size());
+    Point::batch_to_compressed(pts.data(), pts.size(), comp.data());
+
+    // Challenges y, z, x, x_j; inv holds y^-1, x_j^-1 for one batch inversion.
+    constexpr std::size_t kInv = 1 + RANGE_PROOF_LOG2;
+    std::vector<Scalar> yzx(3 * count);
+    std::vector<Scalar> x_rounds(RANGE_PROOF_LOG2 * count);
+    std::vector<Scalar> inv(kInv * count);
+
+    // Weight seed: SHA256 over the whole batch, XORed with CSPRNG bytes so
+    // the weights cannot be predicted by whoever built the proofs.
+    SHA256 seed_ctx;
+    for (std::size_t k = 0; k < count; ++k) {
+        const std::array<std::uint8_t, 33>* const c = comp.data() + kPoints * k;
+        std::uint8_t buf[33 + 33 + 33 + 32 + 32];
+        std::memcpy(buf, c[0].data(), 33);
+        std::memcpy(buf + 33, c[1].data(), 33);
+        std::memcpy(buf + 66, c[2].data(), 33);
+        Scalar const y = Scalar::from_bytes(detail::cached_tagged_hash(g_bp_y_midstate, buf, 99));
+        Scalar const z = Scalar::from_bytes(detail::cached_tagged_hash(g_bp_z_midstate, buf, 99));
+
+        auto const y_bytes = y.to_bytes();
+        auto const z_bytes = z.to_bytes();
+        std::memcpy(buf, c[3].data(), 33);
+        std::memcpy(buf + 33, c[4].data(), 33);
+        std::memcpy(buf + 66, y_bytes.data(), 32);
+        std::memcpy(buf + 98, z_bytes.data(), 32);
+        yzx[3 * k] = y;
+        yzx[3 * k + 1] = z;
+        yzx[3 * k + 2] = Scalar::from_bytes(detail::cached_tagged_hash(g_bp_x_midstate, buf, 130));
+
+        inv[kInv * k] = y;
+        for (std::size_t j = 0; j < RANGE_PROOF_LOG2; ++j) {
+            std::memcpy(buf, c[5 + 2 * j].data(), 33);
+            std::memcpy(buf + 33, c[6 + 2 * j].data(), 33);
+            Scalar const x_j = Scalar::from_bytes(detail::cached_tagged_hash(g_bp_ip_midstate, buf, 66));
+            x_rounds[RANGE_PROOF_LOG2 * k + j] = x_j;
+            inv[kInv * k + 1 + j] = x_j;
+        }
+
+        const RangeProof& p = proofs[k];
+        for (std::size_t j = 0; j < kPoints; ++j) seed_ctx.update(c[j].data(), 33);
+        for (const Scalar* sc : {&p.tau_x, &p.mu, &p.t_hat, &p.a, &p.b}) {
+            auto const b = sc->to_bytes();
+            seed_ctx.update(b.data(), 32);
+        }
+    }
+    if (!scalar_batch_inverse(inv.data(), inv.size())) return false;
+
+    auto seed = seed_ctx.finalize();
+    {
+        std::uint8_t rnd[32];
+        detail::csprng_fill(rnd, sizeof(rnd));
+        for (std::size_t i = 0; i < 32; ++i) seed[i] ^= rnd[i];
+        detail::secure_erase(rnd, sizeof(rnd));
+    }
+    SHA256 weight_base;
+    weight_base.update(seed.data(), seed.size());
+    auto weight = [&weight_base](std::size_t index) {
+        std::uint8_t le[4];
+        for (int i = 0; i < 4; ++i) le[i] = static_cast<std::uint8_t>(index >> (8 * i));
+        SHA256 h = weight_base;
+        h.update(le, sizeof(le));
+        Scalar w = Scalar::from_bytes(h.finalize());
+        if (w.is_zero()) w = Scalar::one();   // never drop a proof from the sum
+        return w;
+    };
+
+    // 2^64 - 1 = sum(2^i)
+    Scalar const sum_2 = Scalar::from_uint64(~std::uint64_t{0});
+
+    constexpr std::size_t FIXED_SIZE = 2 * RANGE_PROOF_BITS + 2;
+    Scalar fixed_s[FIXED_SIZE];
+    for (auto& f : fixed_s) f = Scalar::zero();
+    std::vector<Scalar> var_s(pts.size());
+
+    for (std::size_t k = 0; k < count; ++k) {
+        const RangeProof& p = proofs[k];
+        Scalar const& y = yzx[3 * k];
+        Scalar const& z = yzx[3 * k + 1];
+        Scalar const& x = yzx[3 * k + 2];
+        const Scalar* const xr = x_rounds.data() + RANGE_PROOF_LOG2 * k;
+        const Scalar* const xr_inv = inv.data() + kInv * k + 1;
+        Scalar const& y_inv = inv[kInv * k];
+        Scalar const w = weight(2 * k);
+        Scalar const v = weight(2 * k + 1);
+
+        // s_i, built by doubling as in range_verify_aggregated; s_i^-1 = s_{63-i}
+        Scalar s_coeff[RANGE_PROOF_BITS];
+        s_coeff[0] = Scalar::one();
+        for (std::size_t j = 0; j < RANGE_PROOF_LOG2; ++j) s_coeff[0] = s_coeff[0] * xr_inv[j];
+        for (std::size_t b = 0, half = 1; b < RANGE_PROOF_LOG2; ++b, half <<= 1) {
+            Scalar const x2_j = xr[RANGE_PROOF_LOG2 - 1 - b] * xr[RANGE_PROOF_LOG2 - 1 - b];
+            for (std::size_t i = 0; i < half; ++i) s_coeff[half + i] = s_coeff[i] * x2_j;
+        }
+
+        Scalar const z2 = z * z;
+        Scalar const wz = w * z;
+        Scalar const wa = w * p.a;
+        Scalar const wb = w * p.b;
+        Scalar wz2_2i = w * z2;   // w * z^2 * 2^i
+        Scalar y_pow = Scalar::one();
+        Scalar y_inv_pow = Scalar::one();
+        Scalar sum_y = Scalar::zero();
+        for (std::size_t i = 0; i < RANGE_PROOF_BITS; ++i) {
+            fixed_s[i] = fixed_s[i] - wz - wa * s_coeff[i];
+            fixed_s[RANGE_PROOF_BITS + i] = fixed_s[RANGE_PROOF_BITS + i] + wz
+                + (wz2_2i - wb * s_coeff[RANGE_PROOF_BITS - 1 - i]) * y_inv_pow;
+            wz2_2i = wz2_2i + wz2_2i;
+            sum_y = sum_y + y_pow;
+            y_pow = y_pow * y;
+            y_inv_pow = y_inv_pow * y_inv;
+        }
+        Scalar const delta = (z - z2) * sum_y - z2 * z * sum_2;
+        fixed_s[2 * RANGE_PROOF_BITS] = fixed_s[2 * RANGE_PROOF_BITS] + v * p.tau_x - w * p.mu;
+        fixed_s[2 * RANGE_PROOF_BITS + 1] = fixed_s[2 * RANGE_PROOF_BITS + 1]
+            + w * (p.t_hat - p.a * p.b) + v * (p.t_hat - delta);
+
+        Scalar* const s = var_s.data() + kPoints * k;
+        Scalar const vx = v * x;
+        s[0] = w;                   // A
+        s[1] = w * x;               // S
+        s[2] = (v * z2).negate();   // V
+        s[3] = vx.negate();         // T1
+        s[4] = (vx * x).negate();   // T2
+        for (std::size_t j = 0; j < RANGE_PROOF_LOG2; ++j) {
+            s[5 + 2 * j] = w * xr[j] * xr[j];
+            s[6 + 2 * j] = w * xr_inv[j] * xr_inv[j];
+        }
+    }
+
+    Point check = range_proof_fixed_bases().msm(fixed_s, FIXED_SIZE);
+    check.add_inplace(msm(var_s.data(), pts.data(), pts.size()));
+    return check.is_infinity();
 }
 
 void batch_commit(const Scalar* values,
@@ -37,6 +37,7 @@ int test_v4_features_run();
 int test_coins_run();
 int test_batch_add_affine_run();
 int test_hash_accel_run();
+int test_thread_pool_run();
 int run_exhaustive_tests();
 int test_comprehensive_run();
 int test_bip340_vectors_run();
@@ -80,6 +81,7 @@ static const TestModule MODULES[] = {
     { "coins layer",                      test_coins_run },
     { "affine batch addition",             test_batch_add_affine_run },
     { "accelerated hashing",                test_hash_accel_run },
+    { "thread pool",                        test_thread_pool_run },
     { "exhaustive algebraic verification",  run_exhaustive_tests },
     { "comprehensive 500+ test suite",        test_comprehensive_run },
     { "BIP-340 official test vectors",          test_bip340_vectors_run },
@@ -6,10 +6,14 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <vector>
 #include <chrono>
 
 #include "secp256k1/batch_add_affine.hpp"
+#include "secp256k1/hash_accel.hpp"
+#include "secp256k1/key_range_pipeline.hpp"
+#include "secp256k1/thread_pool.hpp"
 #include "secp256k1/point.hpp"
 #include "secp256k1/scalar.hpp"
 #include "secp256k1/precompute.hpp"
@@ -414,6 +418,101 @@ static void test_negate_table() {
 
 // -- Entry point --------------------------------------------------------------
 
+// -- Test 11: Key-range pipeline (affine add -> hash160 -> filter) -----------
+
+static std::array<std::uint8_t, 20> key_hash160(const Scalar& k) {
+    auto const pub = scalar_mul_generator(k).to_compressed();
+    std::array<std::uint8_t, 20> h{};
+    secp256k1::hash::hash160_33(pub.data(), h.data());
+    return h;
+}
+
+static void test_key_range_pipeline() {
+    (void)std::printf("[BatchAffine] Key-range pipeline...\n");
+
+    Scalar const step  = Scalar::from_uint64(3);
+    Scalar const start = Scalar::from_uint64(5);
+    constexpr std::uint64_t COUNT = 2500;   // last tile is partial
+    auto key_at = [&](const Scalar& st, std::uint64_t i) {
+        return st + Scalar::from_uint64(i) * step;
+    };
+
+    // Targets: tile borders and the partial last tile, plus unrelated junk.
+    const std::uint64_t planted[] = {0, 255, 256, 1000, 2499};
+    std::vector<std::uint8_t> targets;
+    for (std::uint64_t i : planted) {
+        auto const h = key_hash160(key_at(start, i));
+        targets.insert(targets.end(), h.begin(), h.end());
+    }
+    for (std::uint64_t j = 0; j < 300; ++j) {
+        auto const h = key_hash160(Scalar::from_uint64(1000003 + j));
+        targets.insert(targets.end(), h.begin(), h.end());
+    }
+    targets.insert(targets.end(), targets.begin(), targets.begin() + 20);  // duplicate
+    Hash160Filter const filter(targets.data(), targets.size() / 20);
+    check(filter.size() == 305, "filter de-duplicates");
+    check(filter.contains(targets.data() + 20), "filter contains inserted hash");
+    auto const absent = key_hash160(Scalar::from_uint64(77));
+    check(!filter.contains(absent.data()), "filter rejects absent hash");
+
+    KeyRangePipeline const pipe(step, 256);
+    std::vector<KeyRangeMatch> serial;
+    auto const st = pipe.scan(start, COUNT, filter, serial);
+    bool ok = serial.size() == 5 && st.keys == COUNT && st.matches == 5;
+    for (std::size_t m = 0; ok && m < serial.size(); ++m) {
+        Scalar const k = key_at(start, planted[m]);
+        auto const pub = scalar_mul_generator(k).to_compressed();
+        ok = serial[m].index == planted[m] && serial[m].key == k
+          && std::memcmp(serial[m].pubkey.data(), pub.data(), 33) == 0;
+    }
+    check(ok, "serial scan finds planted keys (index, key, pubkey)");
+
+    secp256k1::ThreadPool pool(4);
+    std::vector<KeyRangeMatch> pooled;
+    auto const pt = pipe.scan(start, COUNT, filter, pooled, pool);
+    bool same = pooled.size() == serial.size() && pt.keys == st.keys;
+    for (std::size_t m = 0; same && m < pooled.size(); ++m) {
+        same = pooled[m].index == serial[m].index && pooled[m].key == serial[m].key;
+    }
+    check(same, "pooled scan == serial scan");
+
+    // Degenerate bases. With T[4] = 15G:
+    //   start 18  -> tile base 15G == T[4], index 4 is the doubling 30G;
+    //   start -12 -> tile base -15G == -T[4], index 4 is k = 0 (skipped);
+    //   start 3   -> tile base is the point at infinity.
+    struct Degenerate { Scalar start; std::uint64_t idx[2]; std::uint64_t keys; const char* name; };
+    const Degenerate cases[] = {
+        {Scalar::from_uint64(18), {4, 9}, 20, "base == T[j]: doubling slot matched"},
+        {Scalar::from_uint64(12).negate(), {3, 5}, 19, "base == -T[j]: k == 0 skipped, neighbours matched"},
+        {Scalar::from_uint64(3), {0, 7}, 20, "base at infinity: tile matched"},
+    };
+    KeyRangePipeline const small(step, 16);
+    for (const auto& c : cases) {
+        std::vector<std::uint8_t> t;
+        for (std::uint64_t i : c.idx) {
+            auto const h = key_hash160(key_at(c.start, i));
+            t.insert(t.end(), h.begin(), h.end());
+        }
+        Hash160Filter const f(t.data(), 2);
+        std::vector<KeyRangeMatch> got;
+        auto const s = small.scan(c.start, 20, f, got);
+        check(got.size() == 2 && got[0].index == c.idx[0] && got[1].index == c.idx[1]
+              && s.keys == c.keys, c.name);
+    }
+
+    // Throughput: 64K keys through one thread and through the pool.
+    {
+        std::vector<KeyRangeMatch> none;
+        KeyRangePipeline const big(Scalar::one());
+        auto const s1 = big.scan(Scalar::from_uint64(0x123456789ull), 1u << 16, filter, none);
+        auto const sp = big.scan(Scalar::from_uint64(0x123456789ull), 1u << 16, filter, none, pool);
+        (void)std::printf("  Pipeline: %.2f Mkeys/s (1 thread), %.2f Mkeys/s (%u threads)\n",
+                          s1.keys_per_second() / 1e6, sp.keys_per_second() / 1e6, pool.size());
+        check(s1.keys == (1u << 16) && sp.keys == s1.keys && none.empty(),
+              "throughput run: all keys processed, no false matches");
+    }
+}
+
 int test_batch_add_affine_run() {
     (void)std::printf("\n=== Affine Batch Addition Tests ===\n");
 
@@ -428,6 +527,7 @@ int test_batch_add_affine_run() {
     test_precompute_small_edge_cases();
     test_negate_table();
     test_large_batch();
+    test_key_range_pipeline();
 
     (void)std::printf("\n  Affine batch add: %d passed, %d failed\n", g_pass, g_fail);
     return g_fail;
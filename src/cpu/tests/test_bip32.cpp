@@ -8,6 +8,8 @@
 #include <cstdio>
 #include <cstring>
 #include <array>
+#include <string>
+#include <vector>
 
 using namespace secp256k1;
 
@@ -182,6 +184,118 @@ static void test_bip32_path() {
     }
 }
 
+// -- Batched Child Ranges -----------------------------------------------------
+
+static bool same_key(const ExtendedKey& a, const ExtendedKey& b) {
+    return a.key == b.key && a.chain_code == b.chain_code && a.depth == b.depth &&
+           a.child_number == b.child_number && a.parent_fingerprint == b.parent_fingerprint &&
+           a.is_private == b.is_private && a.pub_prefix == b.pub_prefix;
+}
+
+// Every element of derive_children_range must equal derive_child.
+static bool range_matches(const ExtendedKey& parent, uint32_t first, uint32_t count) {
+    auto range = derive_children_range(parent, first, count);
+    if (range.size() != count) return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        auto [child, ok] = parent.derive_child(first + i);
+        if (range[i].second != ok || (ok && !same_key(range[i].first, child))) return false;
+    }
+    return true;
+}
+
+static void test_bip32_children_range() {
+    printf("\n--- BIP-32 Child Ranges ---\n");
+
+    uint8_t seed[16];
+    hex_to_bytes("000102030405060708090a0b0c0d0e0f", seed, 16);
+    auto [master, ok] = bip32_master_key(seed, 16);
+    CHECK(ok, "Master key OK for range test");
+    auto [account, ok_a] = bip32_derive_path(master, "m/84'/0'/0'/0");
+    CHECK(ok_a, "m/84'/0'/0'/0 derivation succeeds");
+    auto xpub = account.to_public();
+
+    CHECK(range_matches(account, 0, 37), "xprv normal range matches derive_child");
+    CHECK(range_matches(account, 0x80000000u, 9), "xprv hardened range matches derive_child");
+    CHECK(range_matches(xpub, 0, 37), "xpub range matches derive_child");
+    CHECK(range_matches(xpub, 1000, 1), "xpub single child matches derive_child");
+    CHECK(range_matches(xpub, 0x7FFFFFF0u, 16), "xpub range up to the hardened boundary");
+
+    auto hard = derive_children_range(xpub, 0x80000000u, 4);
+    bool none = hard.size() == 4;
+    for (const auto& h : hard) none = none && !h.second;
+    CHECK(none, "xpub hardened range: every child fails");
+
+    CHECK(derive_children_range(xpub, 0, 0).empty(), "empty range");
+    CHECK(derive_children_range(xpub, 0x7FFFFFFFu, 2).empty(), "range crossing 0x80000000 rejected");
+    CHECK(derive_children_range(master, 0xFFFFFFFFu, 2).empty(), "range wrapping 2^32 rejected");
+
+    // Affine public keys of a normal range, from an xprv parent.
+    constexpr uint32_t kPub = 19;
+    std::vector<secp256k1::fast::FieldElement> px(kPub), py(kPub);
+    bool pub_ok[kPub];
+    bool const ran = derive_children_pubkeys(account, 5, kPub, px.data(), py.data(), pub_ok);
+    bool pub_match = ran;
+    for (uint32_t i = 0; ran && i < kPub; ++i) {
+        auto [child, ok_c] = account.derive_child(5 + i);
+        auto const pk = child.public_key();
+        pub_match = pub_match && pub_ok[i] == ok_c && pk.x() == px[i] && pk.y() == py[i];
+    }
+    CHECK(pub_match, "derive_children_pubkeys matches derive_child");
+    CHECK(!derive_children_pubkeys(account, 0x80000000u, 1, px.data(), py.data(), pub_ok),
+          "derive_children_pubkeys rejects hardened indices");
+}
+
+// -- Derivation Cache ---------------------------------------------------------
+
+static void test_bip32_derivation_cache() {
+    printf("\n--- BIP-32 Derivation Cache ---\n");
+
+    uint8_t seed[16];
+    hex_to_bytes("000102030405060708090a0b0c0d0e0f", seed, 16);
+    auto [master, ok] = bip32_master_key(seed, 16);
+    (void)ok;
+
+    DerivationCache cache(master);
+    bool match = true;
+    for (uint32_t i = 0; i < 8; ++i) {
+        std::string const path = "m/84'/0'/0'/0/" + std::to_string(i);
+        auto [ref, ok_ref] = bip32_derive_path(master, path);
+        auto [got, ok_got] = cache.derive(path);
+        match = match && ok_ref && ok_got && same_key(ref, got);
+    }
+    CHECK(match, "cached derivation == bip32_derive_path");
+    CHECK(cache.size() == 4, "only the 4 parent prefixes are cached");
+    CHECK(cache.misses() == 4 + 8, "4 prefix levels derived once, plus one leaf per call");
+
+    auto [m_key, ok_m] = cache.derive("m");
+    CHECK(ok_m && same_key(m_key, master), "path m returns the master");
+    auto [bad, ok_bad] = cache.derive("m/84'/x");
+    (void)bad;
+    CHECK(!ok_bad, "malformed path fails");
+
+    auto range = cache.derive_children_range("m/84'/0'/0'/1", 0, 20);
+    auto [change, ok_c] = bip32_derive_path(master, "m/84'/0'/0'/1");
+    bool range_ok = ok_c && range.size() == 20;
+    for (uint32_t i = 0; range_ok && i < 20; ++i) {
+        auto [child, ok_child] = change.derive_child(i);
+        range_ok = range[i].second && ok_child && same_key(range[i].first, child);
+    }
+    CHECK(range_ok, "cache derive_children_range == derive_child");
+    CHECK(cache.size() == 5, "change branch added one cache entry");
+
+    // xpub-rooted cache: hardened steps fail, normal ones work.
+    DerivationCache pub_cache(master.to_public());
+    auto [hp, ok_hp] = pub_cache.derive("m/0'/1");
+    (void)hp;
+    CHECK(!ok_hp, "xpub cache: hardened path fails");
+    auto [np, ok_np] = pub_cache.derive("m/0/1");
+    auto [np_ref, ok_np_ref] = bip32_derive_path(master.to_public(), "m/0/1");
+    CHECK(ok_np && ok_np_ref && same_key(np, np_ref), "xpub cache: normal path matches");
+
+    cache.clear();
+    CHECK(cache.size() == 0, "clear empties the cache");
+}
+
 // -- Serialization ------------------------------------------------------------
 
 static void test_bip32_serialize() {
@@ -241,6 +355,8 @@ int test_bip32_run() {
     test_bip32_master();
     test_bip32_derive();
     test_bip32_path();
+    test_bip32_children_range();
+    test_bip32_derivation_cache();
     test_bip32_serialize();
     test_bip32_seed_validation();
 
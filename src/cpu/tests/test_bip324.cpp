@@ -11,11 +11,13 @@
 #include "secp256k1/hkdf.hpp"
 #include "secp256k1/scalar.hpp"
 #include "secp256k1/point.hpp"
+#include "secp256k1/thread_pool.hpp"
 
 #include <cstdio>
 #include <cstdint>
 #include <cstring>
 #include <array>
+#include <memory>
 #include <vector>
 #include <algorithm>
 
@@ -196,6 +198,46 @@ static void test_chacha20_poly1305() {
     nonce2[0] = 1;
     chacha20_block(key, nonce2, 0, block2);
     CHECK(std::memcmp(block1, block2, 64) != 0, "ChaCha20 different nonces → different output");
+
+    // Multi-block keystream (4/8/16 blocks per call) == one block at a time,
+    // including a 32-bit counter wrap inside a wide call.
+    bool stream_ok = true;
+    for (std::uint32_t counter : {1u, 0xFFFFFFF9u}) {
+        for (std::size_t len : {std::size_t{1}, std::size_t{200}, std::size_t{256}, std::size_t{960},
+                                std::size_t{1024}, std::size_t{2001}}) {
+            std::vector<std::uint8_t> stream(len, 0);
+            chacha20_crypt(key, nonce, counter, stream.data(), len);
+            for (std::size_t off = 0; off < len; off += 64) {
+                chacha20_block(key, nonce, counter + static_cast<std::uint32_t>(off / 64), block1);
+                std::size_t const n = std::min<std::size_t>(64, len - off);
+                stream_ok = stream_ok && std::memcmp(stream.data() + off, block1, n) == 0;
+            }
+        }
+    }
+    CHECK(stream_ok, "ChaCha20 multi-block keystream matches single blocks");
+
+    // Long messages take the SIMD Poly1305 path; 1-byte segments force the
+    // scalar block path through the scatter/gather MAC.
+    bool mac_ok = true;
+    const std::uint8_t aad13[13] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+    for (std::size_t len : {std::size_t{255}, std::size_t{256}, std::size_t{1000}, std::size_t{4099}}) {
+        std::vector<std::uint8_t> plain(len);
+        for (std::size_t i = 0; i < len; ++i) plain[i] = static_cast<std::uint8_t>(i * 29 + 11);
+        std::vector<std::uint8_t> ct_fast(len), ct_seg(len);
+        std::uint8_t tag_fast[16], tag_seg[16];
+        aead_chacha20_poly1305_encrypt(key, nonce, aad13, sizeof(aad13), plain.data(), len,
+                                       ct_fast.data(), tag_fast);
+        std::vector<AeadSegment> in(len);
+        std::vector<AeadMutableSegment> out(len);
+        for (std::size_t i = 0; i < len; ++i) {
+            in[i] = AeadSegment{plain.data() + i, 1};
+            out[i] = AeadMutableSegment{ct_seg.data() + i, 1};
+        }
+        aead_chacha20_poly1305_encrypt_v(key, nonce, aad13, sizeof(aad13), in.data(), len,
+                                         out.data(), len, tag_seg);
+        mac_ok = mac_ok && ct_fast == ct_seg && std::memcmp(tag_fast, tag_seg, 16) == 0;
+    }
+    CHECK(mac_ok, "AEAD long messages: SIMD and per-block paths agree");
 }
 
 // ============================================================================
@@ -587,6 +629,217 @@ static void test_bip324_random_keys() {
           "Different random sessions → different session_id");
 }
 
+// ============================================================================
+// 11. Caller buffers: scatter/gather, encrypt_into, in-place decrypt
+// ============================================================================
+
+static void test_bip324_caller_buffers() {
+    std::printf("\n--- BIP-324 Caller Buffers ---\n");
+
+    std::uint8_t key[32];
+    for (int i = 0; i < 32; ++i) key[i] = static_cast<std::uint8_t>(0xA0 + i);
+    std::vector<std::uint8_t> msg(300);
+    for (std::size_t i = 0; i < msg.size(); ++i) msg[i] = static_cast<std::uint8_t>(i * 7 + 3);
+
+    // Scatter/gather AEAD == contiguous AEAD, with differently split lists
+    {
+        std::uint8_t nonce[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        const std::uint8_t aad[5] = {0xDE, 0xAD, 0xBE, 0xEF, 0x01};
+        std::vector<std::uint8_t> ref(msg.size());
+        std::uint8_t ref_tag[16];
+        aead_chacha20_poly1305_encrypt(key, nonce, aad, sizeof(aad), msg.data(), msg.size(),
+                                       ref.data(), ref_tag);
+
+        AeadSegment const in[4] = {{msg.data(), 1}, {msg.data() + 1, 0},
+                                   {msg.data() + 1, 70}, {msg.data() + 71, 229}};
+        std::vector<std::uint8_t> ct(msg.size());
+        AeadMutableSegment const out[2] = {{ct.data(), 64}, {ct.data() + 64, 236}};
+        std::uint8_t tag[16];
+        bool ok = aead_chacha20_poly1305_encrypt_v(key, nonce, aad, sizeof(aad),
+                                                   in, 4, out, 2, tag);
+        CHECK(ok && ct == ref && std::memcmp(tag, ref_tag, 16) == 0,
+              "AEAD_v: segmented encrypt matches contiguous");
+
+        AeadSegment const cin[3] = {{ct.data(), 17}, {ct.data() + 17, 200}, {ct.data() + 217, 83}};
+        std::vector<std::uint8_t> pt(msg.size());
+        AeadMutableSegment const pout[1] = {{pt.data(), pt.size()}};
+        ok = aead_chacha20_poly1305_decrypt_v(key, nonce, aad, sizeof(aad), cin, 3, pout, 1, tag);
+        CHECK(ok && pt == msg, "AEAD_v: segmented decrypt roundtrip");
+
+        AeadMutableSegment const short_out[1] = {{pt.data(), pt.size() - 1}};
+        CHECK(!aead_chacha20_poly1305_encrypt_v(key, nonce, aad, sizeof(aad),
+                                                in, 4, short_out, 1, tag),
+              "AEAD_v: length mismatch rejected");
+
+        tag[0] ^= 0x01;
+        ok = aead_chacha20_poly1305_decrypt_v(key, nonce, aad, sizeof(aad), cin, 3, pout, 1, tag);
+        CHECK(!ok && std::all_of(pt.begin(), pt.end(), [](std::uint8_t b) { return b == 0; }),
+              "AEAD_v: bad tag rejected and output zeroed");
+    }
+
+    // encrypt_into: gather list (short and long) == vector encrypt
+    for (std::size_t part_count : {std::size_t{2}, std::size_t{20}}) {
+        Bip324Cipher ref_cipher, cipher;
+        ref_cipher.init(key);
+        cipher.init(key);
+        auto ref = ref_cipher.encrypt(nullptr, 0, msg.data(), msg.size());
+
+        std::vector<AeadSegment> parts(part_count);
+        std::size_t const step = msg.size() / part_count;
+        for (std::size_t i = 0; i < part_count; ++i) {
+            std::size_t const begin = i * step;
+            std::size_t const end = (i + 1 == part_count) ? msg.size() : begin + step;
+            parts[i] = AeadSegment{msg.data() + begin, end - begin};
+        }
+        std::vector<std::uint8_t> pkt(msg.size() + Bip324Cipher::kPacketOverhead);
+        std::size_t const n = cipher.encrypt_into(nullptr, 0, parts.data(), parts.size(),
+                                                  pkt.data(), pkt.size());
+        CHECK(n == ref.size() && pkt == ref, part_count == 2
+              ? "encrypt_into: 2-part gather matches encrypt"
+              : "encrypt_into: 20-part gather matches encrypt");
+        CHECK(cipher.packet_counter() == 1, "encrypt_into: counter incremented");
+    }
+
+    // encrypt_into: payload staged in the packet buffer, plus failure cases
+    {
+        Bip324Cipher ref_cipher, cipher;
+        ref_cipher.init(key);
+        cipher.init(key);
+        auto ref = ref_cipher.encrypt(nullptr, 0, msg.data(), msg.size());
+
+        std::vector<std::uint8_t> pkt(msg.size() + Bip324Cipher::kPacketOverhead);
+        CHECK(cipher.encrypt_into(nullptr, 0, msg.data(), msg.size(), pkt.data(), pkt.size() - 1) == 0
+              && cipher.packet_counter() == 0,
+              "encrypt_into: short buffer rejected, counter unchanged");
+
+        std::memcpy(pkt.data() + 3, msg.data(), msg.size());
+        AeadSegment const staged[2] = {{pkt.data() + 3, 100}, {pkt.data() + 103, 200}};
+        std::size_t const n = cipher.encrypt_into(nullptr, 0, staged, 2, pkt.data(), pkt.size());
+        CHECK(n == ref.size() && pkt == ref, "encrypt_into: in-place sealing matches encrypt");
+    }
+
+    // decrypt_into / decrypt_in_place
+    {
+        Bip324Session a(true, KEY_A);
+        Bip324Session b(false, KEY_B);
+        b.complete_handshake(a.our_ellswift_encoding().data());
+        a.complete_handshake(b.our_ellswift_encoding().data());
+
+        const std::uint8_t hdr[4] = {'i', 'n', 'v', 0};
+        AeadSegment const parts[2] = {{hdr, sizeof(hdr)}, {msg.data(), msg.size()}};
+        std::vector<std::uint8_t> pkt(4 + msg.size() + Bip324Cipher::kPacketOverhead);
+        CHECK(a.encrypt_into(parts, 2, pkt.data(), pkt.size()) == pkt.size(),
+              "Session encrypt_into: header + body");
+
+        std::vector<std::uint8_t> out(pkt.size() - Bip324Cipher::kPacketOverhead);
+        std::size_t payload_len = 0;
+        bool ok = b.decrypt_into(pkt.data(), pkt.data() + 3, pkt.size() - 3,
+                                 out.data(), out.size(), payload_len);
+        CHECK(ok && payload_len == out.size() && std::memcmp(out.data(), hdr, 4) == 0 &&
+              std::memcmp(out.data() + 4, msg.data(), msg.size()) == 0,
+              "Session decrypt_into: payload matches");
+
+        auto pkt2 = a.encrypt(msg.data(), msg.size());
+        auto tampered = pkt2;
+        tampered[10] ^= 0x40;
+        CHECK(!b.decrypt_in_place(tampered.data(), tampered.size(), payload_len),
+              "Session decrypt_in_place: tampered packet rejected");
+        CHECK(b.decrypt_in_place(pkt2.data(), pkt2.size(), payload_len) &&
+              payload_len == msg.size() &&
+              std::memcmp(pkt2.data() + 3, msg.data(), msg.size()) == 0,
+              "Session decrypt_in_place: payload at packet + 3 after rejection");
+
+        auto pkt3 = a.encrypt(msg.data(), msg.size());
+        ok = b.decrypt_into(pkt3.data(), pkt3.data() + 3, pkt3.size() - 3,
+                            pkt3.data() + 3, msg.size(), payload_len);
+        CHECK(ok && payload_len == msg.size() &&
+              std::memcmp(pkt3.data() + 3, msg.data(), msg.size()) == 0,
+              "Session decrypt_into: output aliasing contents");
+
+        Bip324Session idle(true);
+        CHECK(idle.encrypt_into(msg.data(), msg.size(), pkt.data(), pkt.size()) == 0,
+              "Session encrypt_into: rejected before handshake");
+    }
+}
+
+// ============================================================================
+// 12. Batched handshakes and ElligatorSwift decode
+// ============================================================================
+
+static void test_bip324_batch_handshake() {
+    std::printf("\n--- BIP-324 Batched Handshakes ---\n");
+
+    // Spans three chunks of kHandshakeBatch, the last one partial.
+    constexpr std::size_t N = 2 * Bip324Session::kHandshakeBatch + 7;
+
+    auto make_key = [](std::size_t i, std::uint8_t role, std::uint8_t key[32]) {
+        for (int j = 0; j < 32; ++j) key[j] = static_cast<std::uint8_t>(i * 31 + j * 7 + role);
+        key[0] = 0x11;
+    };
+
+    // Encodings are randomized, so every pair is completed with one side on
+    // the batch path and the other on complete_handshake(): set A batches the
+    // responders serially, set B batches the initiators on a pool.
+    std::vector<std::unique_ptr<Bip324Session>> a_i, a_r, b_i, b_r;
+    std::vector<std::uint8_t> a_ell(64 * N), b_ell(64 * N);
+    for (std::size_t i = 0; i < N; ++i) {
+        std::uint8_t ki[32], kr[32];
+        make_key(i, 1, ki);
+        make_key(i, 2, kr);
+        a_i.push_back(std::make_unique<Bip324Session>(true, ki));
+        a_r.push_back(std::make_unique<Bip324Session>(false, kr));
+        b_i.push_back(std::make_unique<Bip324Session>(true, ki));
+        b_r.push_back(std::make_unique<Bip324Session>(false, kr));
+        std::memcpy(&a_ell[64 * i], a_i[i]->our_ellswift_encoding().data(), 64);
+        std::memcpy(&b_ell[64 * i], b_r[i]->our_ellswift_encoding().data(), 64);
+    }
+
+    bool single_ok = true;
+    for (std::size_t i = 0; i < N; ++i) {
+        single_ok &= a_i[i]->complete_handshake(a_r[i]->our_ellswift_encoding().data());
+        single_ok &= b_r[i]->complete_handshake(b_i[i]->our_ellswift_encoding().data());
+    }
+    CHECK(single_ok, "Batch: single-path peers complete");
+
+    std::vector<Bip324Session*> pa(N), pb(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        pa[i] = a_r[i].get();
+        pb[i] = b_i[i].get();
+    }
+
+    std::vector<std::uint8_t> ok(N, 0xFF);
+    std::size_t const n_a = Bip324Session::complete_handshakes(pa.data(), a_ell.data(), N, ok.data());
+    CHECK(n_a == N && std::all_of(ok.begin(), ok.end(), [](std::uint8_t v) { return v == 1; }),
+          "Batch: serial batch establishes every responder");
+
+    ThreadPool pool(4);
+    std::size_t const n_b = Bip324Session::complete_handshakes(pb.data(), b_ell.data(), N, pool);
+    CHECK(n_b == N, "Batch: pooled batch establishes every initiator");
+
+    bool same_ids = true, talk = true;
+    for (std::size_t i = 0; i < N; ++i) {
+        same_ids &= a_i[i]->session_id() == a_r[i]->session_id();
+        same_ids &= b_i[i]->session_id() == b_r[i]->session_id();
+        std::uint8_t const msg[3] = {static_cast<std::uint8_t>(i), 1, 2};
+        auto dec = decrypt_or_empty(*a_r[i], a_i[i]->encrypt(msg, 3));
+        talk &= dec.size() == 3 && std::memcmp(dec.data(), msg, 3) == 0;
+        dec = decrypt_or_empty(*b_r[i], b_i[i]->encrypt(msg, 3));
+        talk &= dec.size() == 3 && std::memcmp(dec.data(), msg, 3) == 0;
+    }
+    CHECK(same_ids, "Batch: session IDs match the complete_handshake() peer");
+    CHECK(talk, "Batch: batched sessions interoperate with single-path peers");
+
+    // Null entries and already-established sessions are skipped
+    Bip324Session fresh(false, KEY_B);
+    Bip324Session* mixed[3] = {a_r[0].get(), nullptr, &fresh};
+    std::uint8_t mixed_ell[3 * 64] = {};
+    std::memcpy(mixed_ell + 128, a_i[0]->our_ellswift_encoding().data(), 64);
+    std::uint8_t mixed_ok[3] = {9, 9, 9};
+    std::size_t const n_mixed = Bip324Session::complete_handshakes(mixed, mixed_ell, 3, mixed_ok);
+    CHECK(n_mixed == 1 && mixed_ok[0] == 0 && mixed_ok[1] == 0 && mixed_ok[2] == 1,
+          "Batch: null and established sessions report failure");
+}
+
 // ============================================================================
 // Entry point
 // ============================================================================
@@ -604,6 +857,8 @@ int test_bip324_run() {
     test_bip324_sizes();
     test_bip324_tamper();
     test_bip324_random_keys();
+    test_bip324_caller_buffers();
+    test_bip324_batch_handshake();
 
     std::printf("\n=== BIP-324: %d/%d passed ===\n", tests_passed, tests_run);
     return (tests_passed == tests_run) ? 0 : 1;
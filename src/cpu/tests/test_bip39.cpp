@@ -10,6 +10,8 @@
 #include <cstdio>
 #include <cstring>
 #include <array>
+#include <string>
+#include <vector>
 
 using namespace secp256k1;
 
@@ -80,6 +82,17 @@ static void test_pbkdf2() {
         "f76cab2868a39b9f7840edce4fef5a82be67335c77a6068e04112754f27ccf4e";
     hex_to_bytes(expected_2_hex, expected, 64);
     CHECK(std::memcmp(output, expected, 64) == 0, "PBKDF2-HMAC-SHA512 (c=2)");
+
+    // c=4096 runs the full iteration loop from the cached pad midstates
+    pbkdf2_hmac_sha512(
+        reinterpret_cast<const uint8_t*>(pwd), std::strlen(pwd),
+        reinterpret_cast<const uint8_t*>(salt), std::strlen(salt),
+        4096, output, 64);
+    const char* expected_4096_hex =
+        "d197b1b33db0143e018b12f3d1d1479e6cdebdcc97c5c0f87f6902e072f457b5"
+        "143f30602641b3d55cd335988cb36b84376060ecd532e039b742a239434af2d5";
+    hex_to_bytes(expected_4096_hex, expected, 64);
+    CHECK(std::memcmp(output, expected, 64) == 0, "PBKDF2-HMAC-SHA512 (c=4096)");
 }
 
 // ---------------------------------------------------------------------------
@@ -264,6 +277,54 @@ static void test_mnemonic_to_seed() {
     }
 }
 
+// ---------------------------------------------------------------------------
+// Test: Batch seed derivation (multi-buffer PBKDF2) vs the single call
+// ---------------------------------------------------------------------------
+static void test_mnemonic_to_seed_batch() {
+    printf("\n--- Mnemonic to Seed (batch) ---\n");
+
+    // 13 entries: one full 8-lane pass, one 4-lane pass and a scalar tail.
+    // Entry 3 is empty, entry 6 is longer than the 128-byte HMAC block
+    // (the key is hashed first), passphrases vary in length.
+    std::vector<std::string> mnemonics, passphrases;
+    for (int i = 0; i < 13; ++i) {
+        uint8_t entropy[32];
+        for (int j = 0; j < 32; ++j) entropy[j] = static_cast<uint8_t>(i * 31 + j);
+        auto [m, ok] = bip39_generate(i == 6 ? 32 : 16, entropy);
+        mnemonics.push_back(i == 3 ? std::string() : m);
+        passphrases.push_back(i % 3 == 0 ? std::string() : "TREZOR" + std::string(i, 'x'));
+    }
+    CHECK(mnemonics[6].size() > 128, "long mnemonic exceeds HMAC block");
+
+    for (size_t n : {size_t{1}, size_t{5}, size_t{13}}) {
+        std::vector<std::array<uint8_t, 64>> seeds(n);
+        bool ok[13];
+        bip39_mnemonic_to_seed_batch(mnemonics.data(), passphrases.data(), n, seeds.data(), ok);
+        bool match = true;
+        for (size_t i = 0; i < n; ++i) {
+            auto [ref, ref_ok] = bip39_mnemonic_to_seed(mnemonics[i], passphrases[i]);
+            match = match && seeds[i] == ref && ok[i] == ref_ok;
+        }
+        CHECK(match, n == 1 ? "batch of 1 matches single call"
+                     : n == 5 ? "batch of 5 matches single call"
+                              : "batch of 13 matches single call");
+    }
+
+    // Trezor TV1 in every lane, no passphrase array.
+    const std::string tv1 = "abandon abandon abandon abandon abandon abandon "
+                            "abandon abandon abandon abandon abandon about";
+    std::vector<std::string> same(9, tv1);
+    std::vector<std::array<uint8_t, 64>> seeds(9);
+    bip39_mnemonic_to_seed_batch(same.data(), nullptr, 9, seeds.data());
+    bool all = true;
+    for (const auto& s : seeds) {
+        all = all && bytes_to_hex(s.data(), 64) ==
+            "5eb00bbddcf069084889a8ab9155568165f5c453ccb85e70811aaed6f6da5fc1"
+            "9a5ac40b389cd370d086206dec8aa6c43daea6690f20ad3d8d48b2d2ce9e38e4";
+    }
+    CHECK(all, "batch without passphrases matches vector in every lane");
+}
+
 // ---------------------------------------------------------------------------
 // Test: Mnemonic -> Entropy roundtrip
 // ---------------------------------------------------------------------------
@@ -373,6 +434,7 @@ int test_bip39_run() {
     test_entropy_to_mnemonic();
     test_validate();
     test_mnemonic_to_seed();
+    test_mnemonic_to_seed_batch();
     test_mnemonic_to_entropy();
     test_random_generation();
     test_edge_cases();
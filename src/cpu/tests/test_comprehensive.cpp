@@ -44,6 +44,10 @@
 #include "secp256k1/batch_add_affine.hpp"
 #include "secp256k1/batch_verify.hpp"
 
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -52,6 +56,7 @@
 #include <vector>
 #include <array>
 #include <cstdint>
+#include <thread>
 
 using FE = secp256k1::fast::FieldElement;
 using SC = secp256k1::fast::Scalar;
@@ -82,6 +87,34 @@ static bool pt_eq(const PT& a, const PT& b) {
            a.y().to_bytes() == b.y().to_bytes();
 }
 
+// Scratch file path in the temp directory (falls back to CWD).
+static std::string temp_file_path(const std::string& name) {
+    std::error_code ec;
+    std::filesystem::path dir = std::filesystem::temp_directory_path(ec);
+    if (ec) dir = std::filesystem::current_path();
+    auto const tick = std::chrono::steady_clock::now().time_since_epoch().count();
+    return (dir / ("ufsecp_" + name + "_" + std::to_string(tick))).string();
+}
+
+// Flip one byte of a file in place.
+static bool flip_file_byte(const std::string& path, std::streamoff offset) {
+    std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!f) return false;
+    char c = 0;
+    f.seekg(offset);
+    f.read(&c, 1);
+    c = static_cast<char>(c ^ 0x5A);
+    f.seekp(offset);
+    f.write(&c, 1);
+    return f.good();
+}
+
+// Progress callback that parks a background fixed-base load until released.
+static std::atomic<bool> g_load_gate_open{true};
+static void gated_progress(size_t, size_t, unsigned, unsigned) {
+    while (!g_load_gate_open.load()) std::this_thread::yield();
+}
+
 // secp256k1 prime p = 2^256 - 0x1000003D1
 static FE secp256k1_p_minus_1() {
     // p-1 = FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2E
@@ -1907,6 +1940,72 @@ static void test_msm() {
     PT const multi_result = secp256k1::multi_scalar_mul(
         std::vector<SC>{s_a, s_b}, std::vector<PT>{P_a, P_b});
     CHECK(pt_eq(multi_result, naive2), "multi_scalar_mul(n=2)");
+
+    // 23.11: PreparedMsm over a fixed point set, fresh scalars per call
+    std::vector<PT> fixed_pts(n2);
+    for (std::size_t i = 0; i < n2; ++i) {
+        fixed_pts[i] = (i % 3 == 0) ? points2[i] : points2[i].dbl();  // mixed affine / Jacobian
+    }
+    fixed_pts[7] = PT::infinity();
+    secp256k1::PreparedMsm const prepared(fixed_pts);
+    CHECK(prepared.size() == n2 && prepared.memory_bytes() > 0, "PreparedMsm size");
+    CHECK(prepared.window_bits() == secp256k1::prepared_msm_optimal_window(n2), "PreparedMsm auto window");
+    for (int round = 0; round < 3; ++round) {
+        std::vector<SC> ks(n2);
+        for (std::size_t i = 0; i < n2; ++i) {
+            ks[i] = SC::from_uint64(static_cast<uint64_t>(i * 7919 + round * 104729 + 1));
+            if (static_cast<int>(i % 5) == round) ks[i] = ks[i].negate();          // top-heavy digits
+        }
+        ks[3] = SC::zero();
+        ks[4] = secp256k1_n() - SC::one();
+        CHECK(pt_eq(prepared.msm(ks), secp256k1::msm(ks, fixed_pts)),
+              "PreparedMsm(n=256) round " + std::to_string(round));
+        CHECK(pt_eq(prepared.msm(ks.data(), 40),
+                    secp256k1::msm(ks.data(), fixed_pts.data(), 40)), "PreparedMsm prefix");
+    }
+
+    // 23.12: explicit window widths, including c dividing 256 (carry window)
+    std::vector<SC> ks_small(16);
+    for (std::size_t i = 0; i < ks_small.size(); ++i) {
+        ks_small[i] = (SC::from_uint64(0xFFFFFFFFFFFFFFFFULL) * SC::from_uint64(i + 3)).negate();
+    }
+    PT const ref_small = secp256k1::multi_scalar_mul(ks_small.data(), fixed_pts.data(), 16);
+    for (unsigned c : {2U, 4U, 7U, 8U, 13U, 16U}) {
+        secp256k1::PreparedMsm const pc(fixed_pts.data(), 16, c);
+        CHECK(pt_eq(pc.msm(ks_small), ref_small), "PreparedMsm c=" + std::to_string(c));
+    }
+    CHECK(secp256k1::PreparedMsm().msm(ks_small).is_infinity(), "PreparedMsm(empty)==O");
+
+    // 23.13: affine-bucket engine vs Jacobian buckets (auto path from n >= 1024)
+    const std::size_t n3 = 1100;
+    std::vector<SC> ks3(n3);
+    std::vector<PT> pts3(n3);
+    P = G.dbl();
+    for (std::size_t i = 0; i < n3; ++i) {
+        ks3[i] = SC::from_uint64(static_cast<uint64_t>(i * 1000003 + 11)) * ks_small[i % 16];
+        pts3[i] = (i % 4 == 1) ? P.dbl() : P;                   // mixed affine / Jacobian
+        P = P.add(G);
+    }
+    pts3[5] = PT::infinity();
+    ks3[6] = SC::zero();
+    pts3[9] = pts3[8];   ks3[9] = ks3[8];                        // same bucket every window
+    pts3[11] = pts3[10].negate(); ks3[11] = ks3[10];             // cancels every window
+    CHECK(secp256k1::msm_select_engine(n3) == secp256k1::MsmEngine::PippengerAffine, "msm engine(n=1100)");
+    CHECK(secp256k1::msm_select_engine(64) == secp256k1::MsmEngine::Pippenger, "msm engine(n=64)");
+    PT const jac3 = secp256k1::msm(ks3.data(), pts3.data(), n3, secp256k1::MsmEngine::Pippenger);
+    CHECK(pt_eq(secp256k1::pippenger_msm_affine(ks3, pts3), jac3), "Pippenger affine(n=1100)");
+    CHECK(pt_eq(secp256k1::msm(ks3, pts3), jac3), "MSM auto(n=1100)");
+    CHECK(pt_eq(secp256k1::msm(scalars2.data(), points2.data(), n2, secp256k1::MsmEngine::PippengerAffine),
+                naive2_big), "Pippenger affine(n=256)");
+
+    // Degenerate pairs: P+P (tangent slope) and P+(-P) inside one bucket
+    std::vector<SC> const same_k(4, s_a);
+    std::vector<PT> const dup = {P_a, P_a, P_a, P_a};
+    CHECK(pt_eq(secp256k1::pippenger_msm_affine(same_k, dup), P_a.scalar_mul(s_a * SC::from_uint64(4))),
+          "Pippenger affine doubling");
+    std::vector<PT> const opp = {P_a, P_a.negate(), P_b, P_a};
+    CHECK(pt_eq(secp256k1::pippenger_msm_affine(same_k, opp), P_a.add(P_b).scalar_mul(s_a)),
+          "Pippenger affine cancellation");
 }
 
 // ============================================================================
@@ -1981,6 +2080,26 @@ static void test_comb_gen() {
     // 24.10: One scalar
     SC const s_one = SC::one();
     CHECK(pt_eq(ctx.mul(s_one), G), "comb_mul(1)==G");
+
+    // 24.11: Mapped table round trip (shared read-only mapping)
+    std::string const tbl = temp_file_path("comb_t6") + ".tbl";
+    CHECK(ctx.save_mapped(tbl), "comb save_mapped");
+    secp256k1::fast::CombGenContext mapped;
+    CHECK(mapped.load_mapped(tbl), "comb load_mapped");
+    CHECK(mapped.mapped() && mapped.teeth() == 6, "comb mapped teeth==6");
+    CHECK(pt_eq(mapped.mul(large), ctx.mul(large)), "mapped comb_mul(large)");
+    CHECK(pt_eq(mapped.mul_ct(s42), G.scalar_mul(s42)), "mapped comb_mul_ct(42)");
+    mapped = secp256k1::fast::CombGenContext{};
+    CHECK(mapped.load_mapped(tbl, /*huge_pages=*/true), "comb load_mapped(huge_pages)");
+    CHECK(pt_eq(mapped.mul(s42), G.scalar_mul(s42)), "mapped(huge) comb_mul(42)");
+
+    // 24.12: Corrupted or legacy files are rejected
+    CHECK(flip_file_byte(tbl, 4096 + 200), "corrupt mapped comb table");
+    secp256k1::fast::CombGenContext rejected;
+    CHECK(!rejected.load_mapped(tbl), "corrupted mapped comb table rejected");
+    CHECK(ctx.save_cache(tbl), "comb save_cache over .tbl");
+    CHECK(!rejected.load_mapped(tbl), "legacy comb cache rejected by load_mapped");
+    std::remove(tbl.c_str());
 }
 
 // ============================================================================
@@ -2550,6 +2669,110 @@ static void test_precompute() {
     // 34.5: compute_wnaf
     auto wnaf = compute_wnaf(key, 4);
     CHECK(!wnaf.empty(), "compute_wnaf non-empty");
+
+    // 34.6: Shared mapped fixed-base tables (use_mmap)
+    std::string const stem = temp_file_path("fixed_w6");
+    FixedBaseConfig cfg{};
+    cfg.window_bits = 6;
+    cfg.enable_glv = true;
+    cfg.thread_count = 1;
+    cfg.use_mmap = true;
+    cfg.cache_path = stem + ".bin";
+    cfg.cache_path_set = true;
+
+    SC const keys[] = {SC::from_uint64(1), SC::from_uint64(0xFFFF), key, secp256k1_n() - SC::one(),
+                       SC::from_hex("DEADBEEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF01234567")};
+    auto check_generator_muls = [&](const std::string& tag) {
+        for (const auto& k : keys) {
+            CHECK(pt_eq(scalar_mul_generator(k), scalar_mul_arbitrary(G, k)), tag + " k*G");
+        }
+        PT out[5];
+        batch_scalar_mul_generator(keys, out, 5);
+        CHECK(pt_eq(out[4], scalar_mul_arbitrary(G, keys[4])), tag + " batch k*G");
+    };
+
+    configure_fixed_base(cfg);
+    CHECK(fixed_base_load_info().source == FixedBaseSource::None, "load info reset by configure");
+    ensure_fixed_base_ready();
+    FixedBaseLoadInfo const built = fixed_base_load_info();
+    CHECK(built.source == FixedBaseSource::Built, "first use builds the table");
+    CHECK(built.shared_mapping, "builder switches to the published mapping");
+    CHECK(built.table_bytes > 0, "table_bytes reported");
+    check_generator_muls("built+mapped");
+
+    configure_fixed_base(cfg);
+    ensure_fixed_base_ready();
+    FixedBaseLoadInfo const mapped = fixed_base_load_info();
+    CHECK(mapped.source == FixedBaseSource::MappedFile, "second use maps the .tbl");
+    CHECK(mapped.shared_mapping && mapped.table_bytes == built.table_bytes, "mapped table size");
+    check_generator_muls("mapped");
+    std::cout << "    table ready: build " << built.ready_ms << " ms, map "
+              << mapped.ready_ms << " ms (" << mapped.table_bytes << " bytes)" << '\n';
+
+    cfg.huge_pages = true;
+    cfg.verify_table_checksum = false;
+    configure_fixed_base(cfg);
+    ensure_fixed_base_ready();
+    CHECK(fixed_base_load_info().source == FixedBaseSource::MappedFile, "huge_pages / no-verify map");
+    check_generator_muls("mapped(huge)");
+
+    // Corrupt payload: checksum rejects it, the table is rebuilt and republished.
+    cfg.huge_pages = false;
+    cfg.verify_table_checksum = true;
+    CHECK(flip_file_byte(stem + ".tbl", 4096 + 1000), "corrupt mapped table");
+    configure_fixed_base(cfg);
+    ensure_fixed_base_ready();
+    CHECK(fixed_base_load_info().source == FixedBaseSource::Built, "corrupted .tbl rebuilt");
+    check_generator_muls("rebuilt");
+
+    // A .tbl for another window size is not used.
+    cfg.window_bits = 5;
+    configure_fixed_base(cfg);
+    ensure_fixed_base_ready();
+    CHECK(fixed_base_load_info().source == FixedBaseSource::Built, "window mismatch rebuilt");
+    check_generator_muls("w5");
+
+    std::remove((stem + ".tbl").c_str());
+    std::remove((stem + ".bin").c_str());
+    cfg.use_cache = false;
+    cfg.use_mmap = false;
+    configure_fixed_base(cfg);
+
+    // 34.7: background_load -- w=8 answers first, the w=10 table takes over
+    cfg.window_bits = 10;
+    cfg.background_load = true;
+    cfg.progress_callback = gated_progress;
+    g_load_gate_open = false;
+    configure_fixed_base(cfg);
+    CHECK(!fixed_base_status().ready, "background: nothing live before first use");
+    ensure_fixed_base_ready();
+    FixedBaseStatus st = fixed_base_status();
+    CHECK(st.ready && !st.fast_path && st.loading, "background: fallback live, load in flight");
+    CHECK(st.window_bits == 8 && st.progress < 1.0, "background: w=8 fallback");
+    CHECK(fixed_base_load_info().source == FixedBaseSource::Fallback, "background: source Fallback");
+    CHECK(!wait_fixed_base_fast_path(1), "background: wait times out while parked");
+    check_generator_muls("fallback");
+
+    g_load_gate_open = true;
+    CHECK(wait_fixed_base_fast_path(), "background: fast path after load");
+    st = fixed_base_status();
+    CHECK(st.fast_path && !st.loading && !st.failed, "background: load finished");
+    CHECK(st.window_bits == 10 && st.progress == 1.0, "background: w=10 live");
+    CHECK(fixed_base_load_info().source == FixedBaseSource::Built, "background: source Built");
+    check_generator_muls("background");
+
+    // Reconfiguring abandons an unfinished load.
+    cfg.window_bits = 12;
+    configure_fixed_base(cfg);
+    ensure_fixed_base_ready();
+    configure_fixed_base(cfg);
+    st = fixed_base_status();
+    CHECK(!st.ready && !st.loading, "background: configure cancels the load");
+
+    cfg.window_bits = 5;
+    cfg.background_load = false;
+    cfg.progress_callback = nullptr;
+    configure_fixed_base(cfg);
 }
 
 // ============================================================================
@@ -11,6 +11,7 @@
 //   7. eth_personal_verify -- verify personal_sign signature
 //   8. Round-trip -- sign + recover + verify
 //   9. Multi-chain -- EIP-155 with various chain IDs
+//  10. Batches -- keccak256_batch / ecrecover_batch vs the one-shot calls
 // ============================================================================
 
 #include <cstdio>
@@ -18,6 +19,7 @@
 #include <cstring>
 #include <string>
 #include <array>
+#include <vector>
 
 #include "secp256k1/coins/keccak256.hpp"
 #include "secp256k1/coins/ethereum.hpp"
@@ -401,6 +403,66 @@ static void test_keccak256_vectors() {
     PASS();
 }
 
+static void test_batches() {
+    std::printf("\n--- Batch Keccak-256 / ecrecover ---\n");
+
+    TEST("keccak256_batch == keccak256 (lengths around the rate)");
+    for (std::size_t len : {std::size_t{0}, std::size_t{64}, std::size_t{135},
+                            std::size_t{136}, std::size_t{200}}) {
+        constexpr std::size_t n = 7;   // one 4-way group + scalar tail
+        std::vector<uint8_t> msgs(len * n + 1), out(32 * n);
+        for (std::size_t i = 0; i < msgs.size(); ++i) msgs[i] = static_cast<uint8_t>(i * 31 + len);
+        keccak256_batch(msgs.data(), len, n, out.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            auto const h = keccak256(msgs.data() + i * len, len);
+            ASSERT_TRUE(std::memcmp(h.data(), out.data() + i * 32, 32) == 0, "batch digest mismatch");
+        }
+    }
+    PASS();
+
+    // 300 signatures (one full chunk + a partial one), some made invalid.
+    constexpr std::size_t N = 300;
+    std::vector<uint8_t> msgs(N * 32), rs(N * 32), ss(N * 32), addrs(N * 20), ok(N);
+    std::vector<uint64_t> vs(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        std::array<uint8_t, 32> hash{};
+        hash[0] = static_cast<uint8_t>(i);
+        hash[1] = static_cast<uint8_t>(i >> 8);
+        auto const sig = eth_sign_hash(hash, Scalar::from_uint64(1000 + i * 7919), i % 3 == 0 ? 0 : 1);
+        std::memcpy(msgs.data() + i * 32, hash.data(), 32);
+        std::memcpy(rs.data() + i * 32, sig.r.data(), 32);
+        std::memcpy(ss.data() + i * 32, sig.s.data(), 32);
+        vs[i] = sig.v;
+    }
+    std::memset(rs.data() + 5 * 32, 0, 32);      // r = 0
+    std::memset(ss.data() + 6 * 32, 0, 32);      // s = 0
+    vs[7] = 5;                                   // bad v
+    vs[8] ^= 1;                                  // other parity: another key
+    std::memset(rs.data() + 9 * 32, 0xFF, 32);   // recid 2 with r >= p - n
+    vs[9] = 29;
+    rs[260 * 32 + 31] ^= 1;                      // r may not lift
+
+    TEST("ecrecover_batch == ecrecover per entry");
+    std::size_t const n_ok = ecrecover_batch(msgs.data(), rs.data(), ss.data(), vs.data(), N,
+                                             addrs.data(), ok.data());
+    std::size_t ref_ok = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        std::array<uint8_t, 32> hash{}, r{}, s{};
+        std::memcpy(hash.data(), msgs.data() + i * 32, 32);
+        std::memcpy(r.data(), rs.data() + i * 32, 32);
+        std::memcpy(s.data(), ss.data() + i * 32, 32);
+        auto const [addr, good] = ecrecover(hash, r, s, vs[i]);
+        ASSERT_TRUE(ok[i] == (good ? 1 : 0), "validity differs from ecrecover");
+        std::array<uint8_t, 20> const expect = good ? addr : std::array<uint8_t, 20>{};
+        ASSERT_TRUE(std::memcmp(expect.data(), addrs.data() + i * 20, 20) == 0,
+                    "address differs from ecrecover");
+        ref_ok += good ? 1 : 0;
+    }
+    ASSERT_TRUE(n_ok == ref_ok && ok[5] == 0 && ok[6] == 0 && ok[7] == 0 && ok[9] == 0,
+                "count / rejected entries");
+    PASS();
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -421,6 +483,7 @@ int test_ethereum_run() {
     test_personal_sign();
     test_multi_chain();
     test_keccak256_vectors();
+    test_batches();
 
     std::printf("\n========================================\n");
     std::printf("  Result: %d passed, %d failed (total %d)\n",
@@ -268,6 +268,84 @@ static void test_bip324_session(ufsecp_ctx* ctx) {
     CHECK(pt_len == msg_len, "decrypted length matches");
     CHECK(std::memcmp(pt.data(), msg, msg_len) == 0, "decrypted content matches");
 
+    // Scatter/gather encrypt: header + body sealed without concatenation
+    const std::uint8_t hdr[] = "BIP-324 ";
+    const std::uint8_t body[] = "test payload";
+    ufsecp_bip324_segment const parts[2] = {{hdr, sizeof(hdr) - 1}, {body, sizeof(body) - 1}};
+    ct_len = ct.size();
+    err = ufsecp_bip324_encrypt_v(session_a, parts, 2, ct.data(), &ct_len);
+    CHECK(err == UFSECP_OK, "bip324_encrypt_v ok");
+    CHECK(ct_len == msg_len + 19, "encrypt_v packet length");
+
+    // In-place decrypt: payload lands at packet + 3
+    std::size_t in_place_len = 0;
+    err = ufsecp_bip324_decrypt_in_place(session_b, ct.data(), ct_len, &in_place_len);
+    CHECK(err == UFSECP_OK, "bip324_decrypt_in_place ok");
+    CHECK(in_place_len == msg_len, "in-place payload length");
+    CHECK(std::memcmp(ct.data() + 3, msg, msg_len) == 0, "in-place payload matches");
+
+    // In-place encrypt (plaintext staged at out + 3), tamper rejected in place
+    std::memcpy(ct.data() + 3, msg, msg_len);
+    ct_len = ct.size();
+    err = ufsecp_bip324_encrypt(session_a, ct.data() + 3, msg_len, ct.data(), &ct_len);
+    CHECK(err == UFSECP_OK, "bip324_encrypt in place ok");
+    std::vector<std::uint8_t> tampered(ct.begin(), ct.begin() + static_cast<std::ptrdiff_t>(ct_len));
+    tampered[5] ^= 0x01;
+    CHECK(ufsecp_bip324_decrypt_in_place(session_b, tampered.data(), tampered.size(), &in_place_len)
+              == UFSECP_ERR_VERIFY_FAIL, "decrypt_in_place rejects tampered packet");
+    pt_len = pt.size();
+    err = ufsecp_bip324_decrypt(session_b, ct.data(), ct_len, pt.data(), &pt_len);
+    CHECK(err == UFSECP_OK && pt_len == msg_len &&
+          std::memcmp(pt.data(), msg, msg_len) == 0, "counter unchanged after rejected packet");
+
+    CHECK(ufsecp_bip324_encrypt_v(session_a, nullptr, 1, ct.data(), &ct_len) == UFSECP_ERR_NULL_ARG,
+          "encrypt_v NULL parts rejected");
+    CHECK(ufsecp_bip324_decrypt_in_place(session_b, ct.data(), 18, &in_place_len) == UFSECP_ERR_BUF_TOO_SMALL,
+          "decrypt_in_place short packet rejected");
+
+    // Batched handshake: three initiator/responder pairs
+    {
+        constexpr std::size_t kPairs = 3;
+        ufsecp_bip324_session* ini[kPairs] = {};
+        ufsecp_bip324_session* res[kPairs] = {};
+        std::uint8_t ell_ini[64 * kPairs], ell_res[64 * kPairs];
+        bool created = true;
+        for (std::size_t i = 0; i < kPairs; ++i) {
+            created &= ufsecp_bip324_create(ctx, 1, &ini[i], ell_ini + 64 * i) == UFSECP_OK;
+            created &= ufsecp_bip324_create(ctx, 0, &res[i], ell_res + 64 * i) == UFSECP_OK;
+        }
+        CHECK(created, "bip324 batch: sessions created");
+
+        std::uint8_t sid_ini[32 * kPairs], sid_res[32 * kPairs], ok[kPairs] = {};
+        CHECK(ufsecp_bip324_handshake_batch(ctx, ini, ell_res, kPairs, sid_ini, ok) == UFSECP_OK &&
+              ok[0] == 1 && ok[1] == 1 && ok[2] == 1, "bip324_handshake_batch initiators ok");
+        CHECK(ufsecp_bip324_handshake_batch(ctx, res, ell_ini, kPairs, sid_res, nullptr) == UFSECP_OK,
+              "bip324_handshake_batch responders ok");
+        CHECK(std::memcmp(sid_ini, sid_res, sizeof(sid_ini)) == 0, "bip324 batch: session IDs match");
+
+        std::uint8_t pkt[1 + 19];
+        std::size_t pkt_len = sizeof(pkt);
+        std::uint8_t const one = 0x5A;
+        std::uint8_t back[1];
+        std::size_t back_len = sizeof(back);
+        CHECK(ufsecp_bip324_encrypt(ini[2], &one, 1, pkt, &pkt_len) == UFSECP_OK &&
+              ufsecp_bip324_decrypt(res[2], pkt, pkt_len, back, &back_len) == UFSECP_OK &&
+              back_len == 1 && back[0] == one, "bip324 batch: sessions interoperate");
+
+        CHECK(ufsecp_bip324_handshake_batch(ctx, ini, ell_res, kPairs, sid_ini, ok) == UFSECP_ERR_INTERNAL &&
+              ok[0] == 0, "bip324_handshake_batch rejects established sessions");
+        ufsecp_bip324_session* with_null[2] = {ini[0], nullptr};
+        CHECK(ufsecp_bip324_handshake_batch(ctx, with_null, ell_res, 2, nullptr, nullptr) == UFSECP_ERR_NULL_ARG,
+              "bip324_handshake_batch NULL session rejected");
+        CHECK(ufsecp_bip324_handshake_batch(ctx, nullptr, nullptr, 0, nullptr, nullptr) == UFSECP_OK,
+              "bip324_handshake_batch count 0 ok");
+
+        for (std::size_t i = 0; i < kPairs; ++i) {
+            ufsecp_bip324_destroy(ini[i]);
+            ufsecp_bip324_destroy(res[i]);
+        }
+    }
+
     // Cleanup
     ufsecp_bip324_destroy(session_a);
     ufsecp_bip324_destroy(session_b);
@@ -572,6 +650,202 @@ static void test_frost_aggregate_zero_partial_sig(ufsecp_ctx* ctx) {
           "frost_aggregate: clears output before rejecting zero partial scalar");
 }
 
+// ============================================================================
+// Thread pool + pooled batch entry points
+// ============================================================================
+
+static void test_thread_pool_batch(ufsecp_ctx* ctx) {
+    std::printf("\n=== FFI: thread pool + batch entry points ===\n");
+
+    ufsecp_thread_pool* pool = nullptr;
+    CHECK(ufsecp_thread_pool_create(4, nullptr, 0, &pool) == UFSECP_OK && pool != nullptr,
+          "thread_pool_create(4)");
+    CHECK(ufsecp_thread_pool_size(pool) == 4, "thread_pool_size == 4");
+    ufsecp_thread_pool_destroy(pool);
+    CHECK(ufsecp_thread_pool_create(2, nullptr, 3, &pool) == UFSECP_ERR_NULL_ARG && pool == nullptr,
+          "thread_pool_create: n_cpu_ids without cpu_ids rejected");
+    CHECK(ufsecp_thread_pool_create(4, nullptr, 0, &pool) == UFSECP_OK, "thread_pool_create again");
+
+    ufsecp_ctx* pctx = nullptr;
+    CHECK(ufsecp_ctx_create(&pctx) == UFSECP_OK, "ctx_create (pooled)");
+    CHECK(ufsecp_ctx_set_thread_pool(pctx, pool) == UFSECP_OK, "ctx_set_thread_pool");
+    ufsecp_thread_pool_destroy(pool);  // ctx keeps the pool alive
+    CHECK(ufsecp_ctx_threads(pctx) == 4, "ctx_threads == 4 after handle destroyed");
+    ufsecp_ctx* clone = nullptr;
+    CHECK(ufsecp_ctx_clone(pctx, &clone) == UFSECP_OK && ufsecp_ctx_threads(clone) == 4,
+          "clone shares attached pool");
+    ufsecp_ctx_destroy(clone);
+    CHECK(ufsecp_ctx_set_threads(ctx, 1, nullptr, 0) == UFSECP_OK && ufsecp_ctx_threads(ctx) == 1,
+          "ctx_set_threads(1) -> serial reference ctx");
+
+    // 600 entries: enough that batch verify splits into several sub-batches.
+    constexpr std::size_t N = 600;
+    std::vector<std::uint8_t> keys(N * 32), msgs(N * 32), aux(N * 32, 0x11);
+    for (std::size_t i = 0; i < N; ++i) {
+        keys[i * 32 + 31] = static_cast<std::uint8_t>(i + 1);
+        keys[i * 32 + 30] = static_cast<std::uint8_t>((i + 1) >> 8);
+        keys[i * 32]      = 0x01;
+        msgs[i * 32]      = static_cast<std::uint8_t>(i);
+        msgs[i * 32 + 1]  = static_cast<std::uint8_t>(i >> 8);
+    }
+
+    // pubkey_create_batch == per-key pubkey_create
+    std::vector<std::uint8_t> pubs(N * 33), ref33(33);
+    CHECK(ufsecp_pubkey_create_batch(pctx, N, keys.data(), pubs.data()) == UFSECP_OK,
+          "pubkey_create_batch ok");
+    bool pubs_ok = true;
+    for (std::size_t i = 0; i < N; i += 37) {
+        pubs_ok &= ufsecp_pubkey_create(ctx, keys.data() + i * 32, ref33.data()) == UFSECP_OK
+                && std::memcmp(ref33.data(), pubs.data() + i * 33, 33) == 0;
+    }
+    CHECK(pubs_ok, "pubkey_create_batch matches pubkey_create");
+    {
+        std::vector<std::uint8_t> bad = keys, out(N * 33);
+        std::memset(bad.data() + 300 * 32, 0, 32);
+        CHECK(ufsecp_pubkey_create_batch(pctx, N, bad.data(), out.data()) == UFSECP_ERR_BAD_KEY,
+              "pubkey_create_batch: zero key rejected");
+        CHECK(std::vector<std::uint8_t>(N * 33, 0) == out, "pubkey_create_batch: fail-closed zeroing");
+    }
+
+    // hash160_pubkey_batch == ufsecp_hash160
+    std::vector<std::uint8_t> h160(N * 20);
+    std::uint8_t ref20[20];
+    CHECK(ufsecp_hash160_pubkey_batch(pctx, pubs.data(), N, h160.data()) == UFSECP_OK,
+          "hash160_pubkey_batch ok");
+    bool h_ok = true;
+    for (std::size_t i = 0; i < N; i += 41) {
+        ufsecp_hash160(pubs.data() + i * 33, 33, ref20);
+        h_ok &= std::memcmp(ref20, h160.data() + i * 20, 20) == 0;
+    }
+    CHECK(h_ok, "hash160_pubkey_batch matches hash160");
+
+    // pubkey_parse_batch == per-key pubkey_parse / pubkey_create_uncompressed
+    {
+        std::vector<std::uint8_t> in = pubs, valid(N), xs(N * 32), ys(N * 32), ref65(65);
+        in[7 * 33] = 0x05;                                   // bad prefix
+        std::memset(in.data() + 11 * 33 + 1, 0xFF, 32);      // x >= p
+        for (std::size_t i = 100; i < 140; ++i) {            // arbitrary x: ~half off-curve
+            std::memset(in.data() + i * 33 + 1, 0, 32);
+            in[i * 33 + 33] = static_cast<std::uint8_t>(i);
+        }
+        CHECK(ufsecp_pubkey_parse_batch(pctx, in.data(), N, valid.data(),
+                                        xs.data(), ys.data()) == UFSECP_OK,
+              "pubkey_parse_batch ok");
+        bool same_valid = true, coords_ok = true;
+        for (std::size_t i = 0; i < N; ++i) {
+            const bool ref = ufsecp_pubkey_parse(ctx, in.data() + i * 33, 33, ref33.data()) == UFSECP_OK;
+            same_valid &= valid[i] == (ref ? 1 : 0);
+            if (i % 37 == 0 && i < 100) {
+                coords_ok &= ufsecp_pubkey_create_uncompressed(ctx, keys.data() + i * 32,
+                                                               ref65.data()) == UFSECP_OK
+                          && std::memcmp(ref65.data() + 1, xs.data() + i * 32, 32) == 0
+                          && std::memcmp(ref65.data() + 33, ys.data() + i * 32, 32) == 0;
+            }
+        }
+        CHECK(same_valid && valid[7] == 0 && valid[11] == 0,
+              "pubkey_parse_batch validity matches pubkey_parse");
+        CHECK(coords_ok, "pubkey_parse_batch coordinates match uncompressed pubkey");
+        CHECK(std::vector<std::uint8_t>(32, 0) ==
+              std::vector<std::uint8_t>(xs.begin() + 7 * 32, xs.begin() + 8 * 32),
+              "pubkey_parse_batch: invalid key coordinates zeroed");
+        CHECK(ufsecp_pubkey_parse_batch(pctx, in.data(), 3, valid.data(), nullptr, nullptr) == UFSECP_OK
+           && ufsecp_pubkey_parse_batch(pctx, nullptr, 3, valid.data(), nullptr, nullptr) == UFSECP_ERR_NULL_ARG,
+              "pubkey_parse_batch: optional outputs, NULL input");
+    }
+
+    // Pooled sign_batch == serial sign_batch
+    std::vector<std::uint8_t> sig_p(N * 64), sig_s(N * 64);
+    CHECK(ufsecp_ecdsa_sign_batch(pctx, N, msgs.data(), keys.data(), sig_p.data()) == UFSECP_OK
+       && ufsecp_ecdsa_sign_batch(ctx, N, msgs.data(), keys.data(), sig_s.data()) == UFSECP_OK
+       && sig_p == sig_s, "ecdsa_sign_batch pooled == serial");
+
+    // ECDSA batch verify / identify_invalid on the pool
+    std::vector<std::uint8_t> ecdsa_entries(N * 129);
+    for (std::size_t i = 0; i < N; ++i) {
+        std::memcpy(&ecdsa_entries[i * 129], msgs.data() + i * 32, 32);
+        std::memcpy(&ecdsa_entries[i * 129 + 32], pubs.data() + i * 33, 33);
+        std::memcpy(&ecdsa_entries[i * 129 + 65], sig_p.data() + i * 64, 64);
+    }
+    CHECK(ufsecp_ecdsa_batch_verify(pctx, ecdsa_entries.data(), N) == UFSECP_OK,
+          "ecdsa_batch_verify pooled accepts valid batch");
+    ecdsa_entries[457 * 129] ^= 1;
+    CHECK(ufsecp_ecdsa_batch_verify(pctx, ecdsa_entries.data(), N) == UFSECP_ERR_VERIFY_FAIL,
+          "ecdsa_batch_verify pooled rejects one bad entry");
+    std::size_t bad_idx[4] = {};
+    std::size_t n_bad = 4;
+    CHECK(ufsecp_ecdsa_batch_identify_invalid(pctx, ecdsa_entries.data(), N, bad_idx, &n_bad) == UFSECP_OK
+       && n_bad == 1 && bad_idx[0] == 457, "ecdsa_batch_identify_invalid pooled finds index 457");
+
+    // Recoverable ECDSA batch: one MSM over (msg | pubkey | sig | recid)
+    {
+        constexpr std::size_t NR = 200;
+        std::vector<std::uint8_t> rec_entries(NR * 130);
+        bool sign_ok = true;
+        for (std::size_t i = 0; i < NR; ++i) {
+            std::uint8_t* e = &rec_entries[i * 130];
+            int recid = -1;
+            std::memcpy(e, msgs.data() + i * 32, 32);
+            std::memcpy(e + 32, pubs.data() + i * 33, 33);
+            sign_ok &= ufsecp_ecdsa_sign_recoverable(ctx, msgs.data() + i * 32, keys.data() + i * 32,
+                                                     e + 65, &recid) == UFSECP_OK;
+            e[129] = static_cast<std::uint8_t>(recid);
+        }
+        CHECK(sign_ok, "ecdsa_sign_recoverable for recoverable batch");
+        CHECK(ufsecp_ecdsa_batch_verify_recoverable(pctx, rec_entries.data(), NR) == UFSECP_OK
+           && ufsecp_ecdsa_batch_verify_recoverable(ctx, rec_entries.data(), NR) == UFSECP_OK,
+              "ecdsa_batch_verify_recoverable accepts valid batch (pooled + serial)");
+        rec_entries[150 * 130 + 129] ^= 1;
+        CHECK(ufsecp_ecdsa_batch_verify_recoverable(pctx, rec_entries.data(), NR) == UFSECP_ERR_VERIFY_FAIL,
+              "ecdsa_batch_verify_recoverable rejects flipped recid parity");
+        rec_entries[150 * 130 + 129] = 4;
+        CHECK(ufsecp_ecdsa_batch_verify_recoverable(pctx, rec_entries.data(), NR) == UFSECP_ERR_BAD_SIG,
+              "ecdsa_batch_verify_recoverable rejects recid > 3");
+        CHECK(ufsecp_ecdsa_batch_verify_recoverable(pctx, nullptr, 1) == UFSECP_ERR_NULL_ARG,
+              "ecdsa_batch_verify_recoverable NULL entries");
+    }
+
+    // Schnorr batch verify / identify_invalid on the pool
+    std::vector<std::uint8_t> ssig(N * 64);
+    CHECK(ufsecp_schnorr_sign_batch(pctx, N, msgs.data(), keys.data(), aux.data(), ssig.data()) == UFSECP_OK,
+          "schnorr_sign_batch pooled ok");
+    std::vector<std::uint8_t> schnorr_entries(N * 128);
+    for (std::size_t i = 0; i < N; ++i) {
+        std::memcpy(&schnorr_entries[i * 128], pubs.data() + i * 33 + 1, 32);
+        std::memcpy(&schnorr_entries[i * 128 + 32], msgs.data() + i * 32, 32);
+        std::memcpy(&schnorr_entries[i * 128 + 64], ssig.data() + i * 64, 64);
+    }
+    CHECK(ufsecp_schnorr_batch_verify(pctx, schnorr_entries.data(), N) == UFSECP_OK,
+          "schnorr_batch_verify pooled accepts valid batch");
+    schnorr_entries[12 * 128 + 40] ^= 1;
+    schnorr_entries[599 * 128 + 40] ^= 1;
+    CHECK(ufsecp_schnorr_batch_verify(pctx, schnorr_entries.data(), N) == UFSECP_ERR_VERIFY_FAIL,
+          "schnorr_batch_verify pooled rejects bad entries");
+    n_bad = 4;
+    CHECK(ufsecp_schnorr_batch_identify_invalid(pctx, schnorr_entries.data(), N, bad_idx, &n_bad) == UFSECP_OK
+       && n_bad == 2 && bad_idx[0] == 12 && bad_idx[1] == 599,
+          "schnorr_batch_identify_invalid pooled finds 12 and 599 in order");
+
+    // BIP-352 prefix scan: pooled == serial; bad tweak fails closed
+    std::uint8_t scan_key[32] = {};
+    scan_key[31] = 0x2a;
+    std::vector<std::uint64_t> pre_p(N), pre_s(N);
+    CHECK(ufsecp_silent_payment_scan_batch(pctx, scan_key, pubs.data(), pubs.data(), N, pre_p.data()) == UFSECP_OK
+       && ufsecp_silent_payment_scan_batch(ctx, scan_key, pubs.data(), pubs.data(), N, pre_s.data()) == UFSECP_OK
+       && pre_p == pre_s && pre_p[0] != 0, "silent_payment_scan_batch pooled == serial");
+    {
+        std::vector<std::uint8_t> bad_tweaks = pubs;
+        bad_tweaks[77 * 33] = 0x05;
+        CHECK(ufsecp_silent_payment_scan_batch(pctx, scan_key, pubs.data(), bad_tweaks.data(), N, pre_p.data())
+                  == UFSECP_ERR_BAD_PUBKEY
+           && pre_p == std::vector<std::uint64_t>(N, 0), "silent_payment_scan_batch: bad tweak fails closed");
+    }
+
+    CHECK(ufsecp_ctx_set_thread_pool(pctx, nullptr) == UFSECP_OK && ufsecp_ctx_threads(pctx) >= 1,
+          "ctx_set_thread_pool(NULL) reverts to global pool");
+    ufsecp_ctx_destroy(pctx);
+    CHECK(ufsecp_ctx_set_thread_pool(ctx, nullptr) == UFSECP_OK, "detach reference ctx pool");
+}
+
 // ============================================================================
 // Entry point
 // ============================================================================
@@ -591,6 +865,7 @@ int test_ffi_coverage_run() {
     test_btc_message_sign_small_buffer(ctx);
     test_bip144_nonminimal_compact_size(ctx);
     test_frost_aggregate_zero_partial_sig(ctx);
+    test_thread_pool_batch(ctx);
 
 #ifdef SECP256K1_BIP324
     test_aead_roundtrip();
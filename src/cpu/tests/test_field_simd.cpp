@@ -0,0 +1,278 @@
+// ============================================================================
+// Tests for the lane-parallel field / point kernels (field_simd.hpp)
+// ============================================================================
+// Strategy: every available tier is cross-checked against the scalar tier
+// (FieldElement operators) and the point kernels against Point::dbl/add.
+// Batch sizes are odd so the zero-padded tail group is always exercised.
+// Tiers the host cannot run are reported and skipped.
+// ============================================================================
+
+#include "secp256k1/field.hpp"
+#include "secp256k1/field_simd.hpp"
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using namespace secp256k1::fast;
+
+int g_tests_passed = 0;
+int g_tests_failed = 0;
+
+#define CHECK(cond, msg) do {                                      \
+    if (!(cond)) {                                                 \
+        (void)std::printf("  FAIL: %s (line %d)\n", msg, __LINE__);     \
+        g_tests_failed++;                                          \
+    } else {                                                       \
+        g_tests_passed++;                                          \
+    }                                                              \
+} while(0)
+
+constexpr FieldSimdTier kTiers[] = {FieldSimdTier::Scalar, FieldSimdTier::AVX2,
+                                    FieldSimdTier::IFMA};
+
+std::uint64_t g_rng = 0x243F6A8885A308D3ULL;
+
+std::uint64_t next_u64() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 7;
+    g_rng ^= g_rng << 17;
+    return g_rng;
+}
+
+// Random elements plus the boundary values 0, 1, p-1, p-2 and 2^255.
+std::vector<FieldElement> make_elements(std::size_t n) {
+    std::vector<FieldElement> v(n);
+    for (auto& e : v) e = FieldElement::from_limbs({next_u64(), next_u64(), next_u64(), next_u64()});
+    FieldElement::limbs_type const pm1 = {0xFFFFFFFEFFFFFC2EULL, ~0ULL, ~0ULL, ~0ULL};
+    FieldElement::limbs_type const pm2 = {0xFFFFFFFEFFFFFC2DULL, ~0ULL, ~0ULL, ~0ULL};
+    v[0] = FieldElement::zero();
+    v[1] = FieldElement::one();
+    v[2] = FieldElement::from_limbs(pm1);
+    v[3] = FieldElement::from_limbs(pm2);
+    v[4] = FieldElement::from_limbs({0, 0, 0, 0x8000000000000000ULL});
+    return v;
+}
+
+bool same_point(const Point& a, const Point& b) {
+    if (a.is_infinity() || b.is_infinity()) return a.is_infinity() == b.is_infinity();
+    return a.x() == b.x() && a.y() == b.y();
+}
+
+Point jacobian(const FieldElement& X, const FieldElement& Y, const FieldElement& Z) {
+    return Point::from_jacobian_coords(X, Y, Z, Z == FieldElement::zero());
+}
+
+void test_tier_selection() {
+    (void)std::printf("[FieldSimd] tier selection (default: %s)\n",
+                      field_simd_tier_name(field_simd_tier()));
+    CHECK(field_simd_available(FieldSimdTier::Scalar), "scalar always available");
+    CHECK(field_simd_available(field_simd_tier()), "default tier available");
+    for (FieldSimdTier t : kTiers) {
+        if (!field_simd_available(t)) {
+            (void)std::printf("  %s not available on this host, skipped\n", field_simd_tier_name(t));
+        }
+    }
+}
+
+void test_field_batches() {
+    (void)std::printf("[FieldSimd] mul / sqr vs scalar\n");
+    constexpr std::size_t N = 77;
+    std::vector<FieldElement> const a = make_elements(N);
+    std::vector<FieldElement> b = make_elements(N);
+    std::swap(b[0], b[N - 1]);   // boundary values against random ones too
+
+    std::vector<FieldElement> ref_mul(N), ref_sqr(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        ref_mul[i] = a[i] * b[i];
+        ref_sqr[i] = a[i].square();
+    }
+
+    for (FieldSimdTier t : kTiers) {
+        if (!field_simd_available(t)) continue;
+        std::vector<FieldElement> out(N);
+        field_mul_batch(a.data(), b.data(), out.data(), N, t);
+        CHECK(out == ref_mul, "mul matches scalar");
+        field_sqr_batch(a.data(), out.data(), N, t);
+        CHECK(out == ref_sqr, "sqr matches scalar");
+
+        // In place, and a chain of squarings that never leaves the batch API.
+        out = a;
+        field_mul_batch(out.data(), b.data(), out.data(), N, t);
+        CHECK(out == ref_mul, "mul in place");
+        out = a;
+        std::vector<FieldElement> chain = a;
+        for (int r = 0; r < 16; ++r) {
+            field_sqr_batch(out.data(), out.data(), N, t);
+            for (auto& c : chain) c = c.square();
+        }
+        CHECK(out == chain, "sqr chain");
+
+        // Lengths around the lane width.
+        for (std::size_t n : {std::size_t{1}, std::size_t{3}, std::size_t{4}, std::size_t{9}}) {
+            std::vector<FieldElement> part(N, FieldElement::one());
+            field_mul_batch(a.data(), b.data(), part.data(), n, t);
+            bool ok = true;
+            for (std::size_t i = 0; i < N; ++i) {
+                ok &= part[i] == (i < n ? ref_mul[i] : FieldElement::one());
+            }
+            CHECK(ok, "partial batch writes exactly n outputs");
+        }
+    }
+}
+
+void test_field_sqrt() {
+    (void)std::printf("[FieldSimd] sqrt vs scalar\n");
+    constexpr std::size_t N = 45;
+    std::vector<FieldElement> a = make_elements(N);
+    for (std::size_t i = 5; i < N; i += 2) a[i] = a[i].square();   // known squares
+
+    std::vector<FieldElement> ref(N);
+    std::vector<std::uint8_t> ref_ok(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        ref[i] = a[i].sqrt();
+        ref_ok[i] = ref[i].square() == a[i] ? 1 : 0;
+    }
+
+    for (FieldSimdTier t : kTiers) {
+        if (!field_simd_available(t)) continue;
+        std::vector<FieldElement> out(N);
+        std::vector<std::uint8_t> ok(N, 0xAA);
+        field_sqrt_batch(a.data(), out.data(), ok.data(), N, t);
+        CHECK(out == ref && ok == ref_ok, "sqrt and flags match scalar");
+        bool squares_ok = ok[0] == 1 && ok[1] == 1;
+        for (std::size_t i = 5; i < N; i += 2) squares_ok &= ok[i] == 1;
+        CHECK(squares_ok, "squares, 0 and 1 have roots");
+
+        out = a;
+        field_sqrt_batch(out.data(), out.data(), ok.data(), N, t);
+        CHECK(out == ref && ok == ref_ok, "sqrt in place");
+    }
+}
+
+void test_point_double() {
+    (void)std::printf("[FieldSimd] point_double_batch vs Point::dbl\n");
+    constexpr std::size_t N = 37;
+    std::vector<FieldElement> X(N), Y(N), Z(N);
+    Point p = Point::generator().scalar_mul(Scalar::from_uint64(0xd0b1e));
+    Point const step = Point::generator().scalar_mul(Scalar::from_uint64(0x57e9));
+    for (std::size_t i = 0; i < N; ++i) {
+        X[i] = p.X();
+        Y[i] = p.Y();
+        Z[i] = p.z();
+        p = p.add(step);
+    }
+    // Infinity lane.
+    Z[5] = FieldElement::zero();
+
+    for (FieldSimdTier t : kTiers) {
+        if (!field_simd_available(t)) continue;
+        std::vector<FieldElement> X3(N), Y3(N), Z3(N);
+        point_double_batch(X.data(), Y.data(), Z.data(), X3.data(), Y3.data(), Z3.data(), N, t);
+        bool ok = true;
+        for (std::size_t i = 0; i < N; ++i) {
+            ok &= same_point(jacobian(X3[i], Y3[i], Z3[i]), jacobian(X[i], Y[i], Z[i]).dbl());
+        }
+        CHECK(ok, "double matches Point::dbl");
+
+        // In place, twice: 4P.
+        X3 = X; Y3 = Y; Z3 = Z;
+        for (int r = 0; r < 2; ++r) {
+            point_double_batch(X3.data(), Y3.data(), Z3.data(), X3.data(), Y3.data(), Z3.data(), N, t);
+        }
+        ok = true;
+        for (std::size_t i = 0; i < N; ++i) {
+            ok &= same_point(jacobian(X3[i], Y3[i], Z3[i]), jacobian(X[i], Y[i], Z[i]).dbl().dbl());
+        }
+        CHECK(ok, "double in place");
+    }
+}
+
+void test_point_add_mixed() {
+    (void)std::printf("[FieldSimd] point_add_mixed_batch vs Point::add\n");
+    constexpr std::size_t N = 45;
+    std::vector<FieldElement> X(N), Y(N), Z(N), x2(N), y2(N);
+    Point p = Point::generator().scalar_mul(Scalar::from_uint64(0xadd5));
+    Point q = Point::generator().scalar_mul(Scalar::from_uint64(0x0ff5e7));
+    for (std::size_t i = 0; i < N; ++i) {
+        X[i] = p.X();
+        Y[i] = p.Y();
+        Z[i] = p.z();
+        x2[i] = q.x();
+        y2[i] = q.y();
+        p.dbl_inplace();
+        q.next_inplace();
+    }
+    // Edge lanes: P1 == P2 (Jacobian, Z != 1), P1 == -P2, P1 at infinity.
+    Point const e = Point::generator().scalar_mul(Scalar::from_uint64(0xe4e));
+    Point const e2 = e.add(e).add(e);   // non-trivial Z
+    x2[7] = e2.x();  y2[7] = e2.y();
+    X[7] = e2.X();   Y[7] = e2.Y();   Z[7] = e2.z();
+    x2[8] = e2.x();  y2[8] = FieldElement::zero() - e2.y();
+    X[8] = e2.X();   Y[8] = e2.Y();   Z[8] = e2.z();
+    Z[9] = FieldElement::zero();
+
+    for (FieldSimdTier t : kTiers) {
+        if (!field_simd_available(t)) continue;
+        std::vector<FieldElement> X3(N), Y3(N), Z3(N);
+        point_add_mixed_batch(X.data(), Y.data(), Z.data(), x2.data(), y2.data(),
+                              X3.data(), Y3.data(), Z3.data(), N, t);
+        bool ok = true;
+        for (std::size_t i = 0; i < N; ++i) {
+            Point const expect = jacobian(X[i], Y[i], Z[i]).add(Point::from_affine(x2[i], y2[i]));
+            ok &= same_point(jacobian(X3[i], Y3[i], Z3[i]), expect);
+        }
+        CHECK(ok, "mixed add matches Point::add");
+        CHECK(Z3[7] != FieldElement::zero(), "P == Q lane doubled");
+        CHECK(Z3[8] == FieldElement::zero(), "P == -Q lane is infinity");
+
+        // In place: the edge lanes must still see their original inputs.
+        X3 = X; Y3 = Y; Z3 = Z;
+        point_add_mixed_batch(X3.data(), Y3.data(), Z3.data(), x2.data(), y2.data(),
+                              X3.data(), Y3.data(), Z3.data(), N, t);
+        ok = true;
+        for (std::size_t i = 0; i < N; ++i) {
+            Point const expect = jacobian(X[i], Y[i], Z[i]).add(Point::from_affine(x2[i], y2[i]));
+            ok &= same_point(jacobian(X3[i], Y3[i], Z3[i]), expect);
+        }
+        CHECK(ok, "mixed add in place");
+    }
+}
+
+void test_unavailable_tier_falls_back() {
+    (void)std::printf("[FieldSimd] unavailable tier falls back to scalar\n");
+    std::vector<FieldElement> const a = make_elements(9);
+    std::vector<FieldElement> out(9), ref(9);
+    for (std::size_t i = 0; i < 9; ++i) ref[i] = a[i] * a[i];
+    // Every tier either runs natively or through the scalar fallback.
+    for (FieldSimdTier t : kTiers) {
+        field_mul_batch(a.data(), a.data(), out.data(), 9, t);
+        CHECK(out == ref, "mul result for every requested tier");
+    }
+}
+
+} // anonymous namespace
+
+#ifdef STANDALONE_TEST
+int main() {
+#else
+int test_field_simd_main() {
+#endif
+    (void)std::printf("\n=== Lane-parallel field arithmetic (field_simd) Tests ===\n\n");
+
+    test_tier_selection();
+    test_field_batches();
+    test_field_sqrt();
+    test_point_double();
+    test_point_add_mixed();
+    test_unavailable_tier_falls_back();
+
+    (void)std::printf("\n=== Results: %d passed, %d failed ===\n",
+               g_tests_passed, g_tests_failed);
+
+    return g_tests_failed > 0 ? 1 : 0;
+}
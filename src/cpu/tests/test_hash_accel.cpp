@@ -1,8 +1,9 @@
 // ============================================================================
 // Test: Accelerated Hashing -- SHA-256 / RIPEMD-160 / Hash160
 // ============================================================================
-// Validates correctness against known test vectors (NIST, Bitcoin).
-// Benchmarks scalar vs SHA-NI performance.
+// Validates correctness against known test vectors (NIST, Bitcoin) and the
+// AVX2/AVX-512 multi-buffer batch kernels against scalar.
+// Benchmarks scalar vs SHA-NI vs multi-buffer performance.
 
 #include <cstdio>
 #include <cstdlib>
@@ -290,6 +291,80 @@ static void test_batch_ops() {
     }
 }
 
+// -- Test 8b: Multi-buffer kernels vs scalar ----------------------------------
+
+static void test_multibuffer() {
+    (void)std::printf("[HashAccel] Multi-buffer batch (%s) vs scalar...\n",
+                      hash::hash_tier_name(hash::batch_hash_tier()));
+
+    // Arbitrary bytes (not just valid pubkeys) so every lane sees distinct
+    // data in every word, including the odd 33rd byte.
+    constexpr std::size_t MAX = 67;
+    std::array<std::uint8_t, MAX * 33> in{};
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<std::uint8_t>(i * 131u + (i >> 5) * 7u + 1u);
+    }
+    std::array<std::uint8_t, MAX * 32> sha_ref{};
+    std::array<std::uint8_t, MAX * 20> rmd_ref{}, h160_ref{};
+    for (std::size_t i = 0; i < MAX; ++i) {
+        hash::scalar::sha256_33(in.data() + i * 33, sha_ref.data() + i * 32);
+        hash::scalar::ripemd160_32(sha_ref.data() + i * 32, rmd_ref.data() + i * 20);
+        hash::scalar::hash160_33(in.data() + i * 33, h160_ref.data() + i * 20);
+    }
+
+    // Counts straddling the 8/16 lane widths exercise pass + tail splits.
+    const std::size_t counts[] = {1, 7, 8, 9, 15, 16, 17, 24, 31, 33, 48, MAX};
+    bool sha_ok = true, rmd_ok = true, h160_ok = true;
+    for (std::size_t n : counts) {
+        std::array<std::uint8_t, MAX * 32> sha{};
+        std::array<std::uint8_t, MAX * 20> rmd{}, h160{};
+        hash::sha256_33_batch(in.data(), sha.data(), n);
+        hash::ripemd160_32_batch(sha_ref.data(), rmd.data(), n);
+        hash::hash160_33_batch(in.data(), h160.data(), n);
+        sha_ok  &= std::memcmp(sha.data(), sha_ref.data(), n * 32) == 0;
+        rmd_ok  &= std::memcmp(rmd.data(), rmd_ref.data(), n * 20) == 0;
+        h160_ok &= std::memcmp(h160.data(), h160_ref.data(), n * 20) == 0;
+        // Nothing past n may be written.
+        if (n < MAX) {
+            sha_ok  &= sha[n * 32] == 0;
+            h160_ok &= h160[n * 20] == 0;
+        }
+    }
+    check(sha_ok, "sha256_33_batch == scalar for all pass/tail splits");
+    check(rmd_ok, "ripemd160_32_batch == scalar for all pass/tail splits");
+    check(h160_ok, "hash160_33_batch == scalar for all pass/tail splits");
+
+#ifdef SECP256K1_HASH_MULTIBUFFER
+    // Direct kernels, so the narrower tier is covered on AVX-512 hosts too.
+    if (hash::avx2_available()) {
+        std::array<std::uint8_t, 8 * 32> sha{};
+        std::array<std::uint8_t, 8 * 20> rmd{}, h160{};
+        hash::avx2::sha256_33_x8(in.data() + 33, sha.data());
+        hash::avx2::ripemd160_32_x8(sha_ref.data() + 32, rmd.data());
+        hash::avx2::hash160_33_x8(in.data() + 33, h160.data());
+        check(std::memcmp(sha.data(), sha_ref.data() + 32, sha.size()) == 0,
+              "avx2::sha256_33_x8 == scalar");
+        check(std::memcmp(rmd.data(), rmd_ref.data() + 20, rmd.size()) == 0,
+              "avx2::ripemd160_32_x8 == scalar");
+        check(std::memcmp(h160.data(), h160_ref.data() + 20, h160.size()) == 0,
+              "avx2::hash160_33_x8 == scalar");
+    }
+    if (hash::avx512_available()) {
+        std::array<std::uint8_t, 16 * 32> sha{};
+        std::array<std::uint8_t, 16 * 20> rmd{}, h160{};
+        hash::avx512::sha256_33_x16(in.data() + 2 * 33, sha.data());
+        hash::avx512::ripemd160_32_x16(sha_ref.data() + 2 * 32, rmd.data());
+        hash::avx512::hash160_33_x16(in.data() + 2 * 33, h160.data());
+        check(std::memcmp(sha.data(), sha_ref.data() + 2 * 32, sha.size()) == 0,
+              "avx512::sha256_33_x16 == scalar");
+        check(std::memcmp(rmd.data(), rmd_ref.data() + 2 * 20, rmd.size()) == 0,
+              "avx512::ripemd160_32_x16 == scalar");
+        check(std::memcmp(h160.data(), h160_ref.data() + 2 * 20, h160.size()) == 0,
+              "avx512::hash160_33_x16 == scalar");
+    }
+#endif
+}
+
 // -- Test 9: SHA-NI vs Scalar cross-check -------------------------------------
 
 static int test_shani_skip_code = 0; // set to 77 when SHA-NI unavailable so run() can propagate
@@ -441,8 +516,22 @@ static void test_benchmark() {
         auto t1 = std::chrono::high_resolution_clock::now();
         double const total_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
         double const per_key = total_ns / BATCH_ITERS / BATCH;
-        (void)std::printf("  Batch  Hash160_33 (%zu): %.1f ns/key, %.2f Mkeys/s\n",
-                    BATCH, per_key, 1e9 / per_key / 1e6);
+        (void)std::printf("  Batch  Hash160_33 (%zu, %s): %.1f ns/key, %.2f Mkeys/s\n",
+                    BATCH, hash::hash_tier_name(hash::batch_hash_tier()),
+                    per_key, 1e9 / per_key / 1e6);
+
+        // Same keys one at a time (the pre-multi-buffer batch path).
+        auto s0 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < BATCH_ITERS / 10; ++i) {
+            for (std::size_t k = 0; k < BATCH; ++k) {
+                hash::hash160_33(keys.data() + k * 33, hashes.data() + k * 20);
+            }
+        }
+        auto s1 = std::chrono::high_resolution_clock::now();
+        double const single_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(s1 - s0).count());
+        double const per_key_single = single_ns / (BATCH_ITERS / 10) / BATCH;
+        (void)std::printf("  Single Hash160_33 loop:   %.1f ns/key (%.2fx slower)\n",
+                    per_key_single, per_key_single / per_key);
     }
 
 }
@@ -476,6 +565,7 @@ int test_hash_accel_run() {
     test_hash160_pipeline();
     test_double_sha256();
     test_batch_ops();
+    test_multibuffer();
     test_shani_vs_scalar();
     test_benchmark();
 
@@ -4,7 +4,10 @@
 
 #include "secp256k1/multiscalar.hpp"
 #include "secp256k1/batch_verify.hpp"
+#include "secp256k1/pippenger.hpp"
+#include "secp256k1/thread_pool.hpp"
 #include "secp256k1/ecdsa.hpp"
+#include "secp256k1/recovery.hpp"
 #include "secp256k1/schnorr.hpp"
 #include "secp256k1/sha256.hpp"
 
@@ -214,6 +217,169 @@ static void test_schnorr_batch_verify() {
             "Schnorr batch cached identify: null pubkey reported invalid");
 }
 
+// -- Parallel MSM + pooled Schnorr batch -------------------------------------
+
+static void test_schnorr_batch_verify_pooled() {
+    printf("\n--- Parallel MSM + Pooled Schnorr Batch ---\n");
+
+    ThreadPool pool(4);
+    auto G = Point::generator();
+
+    // 5000 points: large enough for msm_parallel to use 2 slices.
+    {
+        constexpr std::size_t M = 5000;
+        std::vector<Scalar> scalars(M);
+        std::vector<Point> points(M);
+        for (std::size_t i = 0; i < M; ++i) {
+            scalars[i] = Scalar::from_uint64(0x9e3779b97f4a7c15ULL * (i + 1));
+            points[i] = G.scalar_mul(Scalar::from_uint64(3 + i * 7));
+        }
+        auto serial = msm(scalars.data(), points.data(), M);
+        auto pooled = msm_parallel(scalars.data(), points.data(), M, pool);
+        auto capped = msm_parallel(scalars.data(), points.data(), M, pool, 1);
+        CHECK(pooled.to_compressed() == serial.to_compressed(),
+              "msm_parallel(5000, 4 threads) == msm");
+        CHECK(capped.to_compressed() == serial.to_compressed(),
+              "msm_parallel(max_threads=1) == msm");
+
+        // PreparedMsm slices: c=6 keeps slices >= 256 points, so 4 slices.
+        constexpr std::size_t P = 2000;
+        PreparedMsm const prepared(points.data(), P, 6);
+        auto const prefix = msm(scalars.data(), points.data(), P);
+        CHECK(prepared.msm(scalars.data(), P, pool).to_compressed() == prefix.to_compressed(),
+              "PreparedMsm::msm(2000, pool) == msm");
+        CHECK(prepared.msm(scalars.data(), P).to_compressed() == prefix.to_compressed(),
+              "PreparedMsm::msm(2000) == msm");
+    }
+
+    // 2100 signatures -> 4201-point MSM, preprocessing split into 4 slices.
+    constexpr std::size_t N = 2100;
+    std::vector<SchnorrBatchEntry> entries(N);
+    std::vector<SchnorrXonlyPubkey> cached_pubkeys(N);
+    std::vector<SchnorrBatchCachedEntry> cached(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        // 64 distinct keys: repeated pubkeys as in real blocks.
+        Scalar const key = Scalar::from_uint64(1000 + (i % 64));
+        entries[i].pubkey_x = schnorr_pubkey(key);
+        uint8_t ibuf[4] = {
+            static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), 0x5a, 0xa5
+        };
+        entries[i].message = SHA256::hash(ibuf, 4);
+        std::array<uint8_t, 32> const aux{};
+        entries[i].signature = schnorr_sign(key, entries[i].message, aux);
+        (void)schnorr_xonly_pubkey_parse(cached_pubkeys[i], entries[i].pubkey_x);
+        cached[i] = {&cached_pubkeys[i], entries[i].message, entries[i].signature};
+    }
+
+    CHECK(schnorr_batch_verify(entries.data(), N, pool),
+          "Pooled Schnorr batch: 2100 valid signatures pass");
+    CHECK(schnorr_batch_verify(entries.data(), N, pool, 2),
+          "Pooled Schnorr batch: max_threads=2 passes");
+    CHECK(schnorr_batch_verify(cached.data(), N, pool),
+          "Pooled Schnorr batch cached: 2100 valid signatures pass");
+
+    // Corruptions land in the last preprocessing slice and in the MSM tail.
+    auto corrupted = entries;
+    corrupted[N - 3].signature.s = corrupted[N - 3].signature.s + Scalar::one();
+    CHECK(!schnorr_batch_verify(corrupted.data(), N, pool),
+          "Pooled Schnorr batch: corrupted sig #2097 detected");
+
+    auto bad_r = entries;
+    bad_r[700].signature.r[31] ^= 0x01;
+    CHECK(!schnorr_batch_verify(bad_r.data(), N, pool),
+          "Pooled Schnorr batch: tampered R in middle slice detected");
+
+    auto cached_corrupted = cached;
+    cached_corrupted[1].signature.s = cached_corrupted[1].signature.s + Scalar::one();
+    CHECK(!schnorr_batch_verify(cached_corrupted.data(), N, pool),
+          "Pooled Schnorr batch cached: corrupted sig #1 detected");
+
+    auto cached_missing = cached;
+    cached_missing[1500].pubkey = nullptr;
+    CHECK(!schnorr_batch_verify(cached_missing.data(), N, pool),
+          "Pooled Schnorr batch cached: null pubkey rejected");
+}
+
+// -- Bisection identify_invalid ----------------------------------------------
+
+static void test_batch_identify_bisect() {
+    printf("\n--- Bisection identify_invalid ---\n");
+
+    constexpr std::size_t N = 300;
+    std::vector<SchnorrBatchEntry> entries(N);
+    std::vector<SchnorrXonlyPubkey> xonly(N);
+    std::vector<SchnorrBatchCachedEntry> cached(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        Scalar const key = Scalar::from_uint64(500 + (i % 32));
+        entries[i].pubkey_x = schnorr_pubkey(key);
+        uint8_t ibuf[4] = {static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), 0x77, 0};
+        entries[i].message = SHA256::hash(ibuf, 4);
+        std::array<uint8_t, 32> const aux{};
+        entries[i].signature = schnorr_sign(key, entries[i].message, aux);
+        (void)schnorr_xonly_pubkey_parse(xonly[i], entries[i].pubkey_x);
+        cached[i] = {&xonly[i], entries[i].message, entries[i].signature};
+    }
+
+    auto both_modes_agree = [](const auto* batch, std::size_t n,
+                               const std::vector<std::size_t>& expect) {
+        std::vector<std::size_t> lin, bis;
+        schnorr_batch_identify_invalid(batch, n, lin, BatchIdentifyMode::Individual);
+        schnorr_batch_identify_invalid(batch, n, bis, BatchIdentifyMode::Bisect);
+        return lin == expect && bis == expect;
+    };
+
+    CHECK(both_modes_agree(entries.data(), N, {}), "Bisect: all-valid batch -> none");
+
+    auto one_bad = entries;
+    one_bad[299].signature.s = one_bad[299].signature.s + Scalar::one();
+    CHECK(both_modes_agree(one_bad.data(), N, {299}), "Bisect: last entry found");
+
+    // Adjacent bad entries, bad R (not on curve), bad pubkey, first entry.
+    auto many_bad = entries;
+    const std::size_t bad_s[] = {0, 150, 151, 212};
+    for (std::size_t i : bad_s) {
+        many_bad[i].signature.s = many_bad[i].signature.s + Scalar::one();
+    }
+    many_bad[37].signature.r.fill(0xFF);     // x >= p: R cannot be lifted
+    many_bad[88].message[5] ^= 0x10;         // wrong challenge
+    many_bad[260].pubkey_x.fill(0xFF);       // pubkey cannot be parsed
+    CHECK(both_modes_agree(many_bad.data(), N, {0, 37, 88, 150, 151, 212, 260}),
+          "Bisect: mixed failures found in order (== individual)");
+
+    auto cached_bad = cached;
+    cached_bad[5].signature.s = cached_bad[5].signature.s + Scalar::one();
+    cached_bad[144].pubkey = nullptr;
+    CHECK(both_modes_agree(cached_bad.data(), N, {5, 144}),
+          "Bisect cached: bad sig + null pubkey found");
+
+    std::vector<std::size_t> empty_out = {42};
+    schnorr_batch_identify_invalid(entries.data(), 0, empty_out, BatchIdentifyMode::Bisect);
+    CHECK(empty_out.empty(), "Bisect: n == 0 clears output");
+
+    // Recoverable ECDSA: wrong recid is only detectable through the exact
+    // per-entry equation, which is what bisection leaves check.
+    constexpr std::size_t M = 200;
+    std::vector<ECDSARecoverableBatchEntry> rec(M);
+    auto G = Point::generator();
+    for (std::size_t i = 0; i < M; ++i) {
+        Scalar const key = Scalar::from_uint64(900 + (i % 16));
+        rec[i].public_key = G.scalar_mul(key);
+        uint8_t ibuf[4] = {static_cast<uint8_t>(i), 0x91, 0, 0};
+        rec[i].msg_hash = SHA256::hash(ibuf, 4);
+        auto rsig = ecdsa_sign_recoverable(rec[i].msg_hash, key);
+        rec[i].signature = rsig.sig;
+        rec[i].recid = rsig.recid;
+    }
+    rec[17].recid ^= 1;
+    rec[120].recid = 7;
+    rec[199].signature.s = rec[199].signature.s + Scalar::one();
+    std::vector<std::size_t> lin, bis;
+    ecdsa_batch_identify_invalid(rec.data(), M, lin, BatchIdentifyMode::Individual);
+    ecdsa_batch_identify_invalid(rec.data(), M, bis, BatchIdentifyMode::Bisect);
+    CHECK(bis == std::vector<std::size_t>({17, 120, 199}) && lin == bis,
+          "Bisect recoverable ECDSA: wrong recid / bad recid / bad s found");
+}
+
 // -- ECDSA Batch Verification -------------------------------------------------
 
 static void test_ecdsa_batch_verify() {
@@ -253,6 +419,83 @@ static void test_ecdsa_batch_verify() {
           "ECDSA batch identify: correctly finds sig #1");
 }
 
+// -- Recoverable ECDSA Batch (single MSM) -------------------------------------
+
+static void test_ecdsa_recoverable_batch_verify() {
+    printf("\n--- Recoverable ECDSA Batch Verification ---\n");
+
+    constexpr std::size_t N = 40;
+    std::vector<ECDSARecoverableBatchEntry> entries(N);
+    auto G = Point::generator();
+    for (std::size_t i = 0; i < N; ++i) {
+        Scalar const key = Scalar::from_uint64(300 + i);
+        entries[i].public_key = G.scalar_mul(key);
+        uint8_t ibuf[4] = {static_cast<uint8_t>(i), 0x3c, 0, 0};
+        entries[i].msg_hash = SHA256::hash(ibuf, 4);
+        auto rsig = ecdsa_sign_recoverable(entries[i].msg_hash, key);
+        entries[i].signature = rsig.sig;
+        entries[i].recid = rsig.recid;
+    }
+
+    bool lift_ok = true;
+    for (std::size_t i = 0; i < N; ++i) {
+        auto [R, ok] = ecdsa_lift_r(entries[i].signature, entries[i].recid);
+        lift_ok &= ok && Scalar::from_bytes(R.x().to_bytes()) == entries[i].signature.r;
+    }
+    CHECK(lift_ok, "ecdsa_lift_r: x(R) mod n == r for all entries");
+
+    CHECK(ecdsa_batch_verify(entries), "Recoverable ECDSA batch: 40 valid pass");
+    std::vector<ECDSARecoverableBatchEntry> const pair(entries.begin(), entries.begin() + 2);
+    CHECK(ecdsa_batch_verify(pair), "Recoverable ECDSA batch: 2 valid pass");
+
+    // Wrong parity: signature is still a valid plain ECDSA sig, but R differs.
+    auto wrong_recid = entries;
+    wrong_recid[7].recid ^= 1;
+    CHECK(ecdsa_verify(wrong_recid[7].msg_hash, wrong_recid[7].public_key,
+                       wrong_recid[7].signature),
+          "Recoverable ECDSA batch: flipped-recid sig still plain-valid");
+    CHECK(!ecdsa_batch_verify(wrong_recid), "Recoverable ECDSA batch: wrong recid rejected");
+
+    auto corrupted = entries;
+    corrupted[31].signature.s = corrupted[31].signature.s + Scalar::one();
+    CHECK(!ecdsa_batch_verify(corrupted), "Recoverable ECDSA batch: corrupted s detected");
+
+    auto wrong_key = entries;
+    wrong_key[0].public_key = entries[1].public_key;
+    CHECK(!ecdsa_batch_verify(wrong_key), "Recoverable ECDSA batch: wrong pubkey detected");
+
+    auto high_s = entries;
+    high_s[3].signature.s = high_s[3].signature.s.negate();
+    high_s[3].recid ^= 1;  // (-s, -R) is the same signature equation
+    CHECK(!ecdsa_batch_verify(high_s), "Recoverable ECDSA batch: high-S rejected");
+
+    auto bad_recid = entries;
+    bad_recid[5].recid = 4;
+    CHECK(!ecdsa_batch_verify(bad_recid), "Recoverable ECDSA batch: recid 4 rejected");
+
+    auto invalid = ecdsa_batch_identify_invalid(wrong_recid.data(), N);
+    CHECK(invalid.size() == 1 && invalid[0] == 7,
+          "Recoverable ECDSA identify: finds wrong-recid #7");
+
+    // Pooled: 2100 signatures -> parallel lifting + msm_parallel.
+    {
+        constexpr std::size_t M = 2100;
+        std::vector<ECDSARecoverableBatchEntry> big(M);
+        for (std::size_t i = 0; i < M; ++i) {
+            big[i] = entries[i % N];
+        }
+        ThreadPool pool(4);
+        CHECK(ecdsa_batch_verify(big.data(), M, pool),
+              "Pooled recoverable ECDSA batch: 2100 valid pass");
+        big[1999].recid ^= 1;
+        CHECK(!ecdsa_batch_verify(big.data(), M, pool),
+              "Pooled recoverable ECDSA batch: wrong recid in last slice detected");
+    }
+
+    CHECK(!ecdsa_batch_verify(static_cast<const ECDSARecoverableBatchEntry*>(nullptr), 0),
+          "Recoverable ECDSA batch: empty = false (fail-closed)");
+}
+
 // -- Main ---------------------------------------------------------------------
 
 int test_multiscalar_batch_run() {
@@ -261,7 +504,10 @@ int test_multiscalar_batch_run() {
     test_shamir_trick();
     test_multi_scalar_mul();
     test_schnorr_batch_verify();
+    test_schnorr_batch_verify_pooled();
     test_ecdsa_batch_verify();
+    test_ecdsa_recoverable_batch_verify();
+    test_batch_identify_bisect();
 
     printf("\n=== Results: %d/%d passed ===\n", tests_passed, tests_run);
     return (tests_passed == tests_run) ? 0 : 1;
@@ -0,0 +1,258 @@
+// ============================================================================
+// Test: Persistent work-stealing ThreadPool
+// ============================================================================
+// Validates exactly-once coverage of the index space, work stealing under
+// skewed per-item cost, nested and concurrent callers (inline fallback),
+// exception propagation, and that the pooled BIP-352 scanners match their
+// serial counterparts bit-for-bit.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "secp256k1/thread_pool.hpp"
+#include "secp256k1/point.hpp"
+#include "secp256k1/scalar.hpp"
+#ifdef SECP256K1_HAS_BIP352
+#include "secp256k1/address.hpp"
+#include "secp256k1/schnorr.hpp"
+#endif
+
+using secp256k1::ThreadPool;
+
+static int g_pass = 0, g_fail = 0;
+
+static void check(bool cond, const char* name) {
+    if (cond) {
+        ++g_pass;
+    } else {
+        ++g_fail;
+        (void)std::printf("  FAIL: %s\n", name);
+    }
+}
+
+// -- Test 1: every index visited exactly once ---------------------------------
+
+static void test_coverage() {
+    (void)std::printf("[ThreadPool] Coverage (exactly-once)...\n");
+
+    ThreadPool pool(4);
+    check(pool.size() == 4, "size() == 4");
+
+    const std::size_t counts[] = {0, 1, 7, 64, 1000, 4097};
+    const std::size_t grains[] = {0, 1, 3, 100};
+    bool all_once = true;
+    for (std::size_t n : counts) {
+        for (std::size_t g : grains) {
+            std::vector<std::atomic<int>> hits(n);
+            for (auto& h : hits) h.store(0);
+            pool.parallel_for(n, g, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) hits[i].fetch_add(1);
+            });
+            for (auto& h : hits) {
+                if (h.load() != 1) all_once = false;
+            }
+        }
+    }
+    check(all_once, "all indices visited once for all (count, grain)");
+
+    // Pool reuse: many small jobs back-to-back must not deadlock or leak work.
+    std::atomic<std::size_t> total{0};
+    for (int r = 0; r < 500; ++r) {
+        pool.parallel_for(32, 1, [&](std::size_t b, std::size_t e) {
+            total.fetch_add(e - b);
+        });
+    }
+    check(total.load() == 500u * 32u, "500 back-to-back jobs complete");
+}
+
+// -- Test 2: skewed work is stolen --------------------------------------------
+
+static void test_stealing() {
+    (void)std::printf("[ThreadPool] Work stealing under skew...\n");
+
+    ThreadPool pool(4);
+    // All the expensive items sit in the first participant's slice. With
+    // stealing, more than one thread must end up processing that slice.
+    constexpr std::size_t N = 64;
+    std::vector<std::thread::id> who(N);
+    pool.parallel_for(N, 1, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) {
+            if (i < N / 4) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            who[i] = std::this_thread::get_id();
+        }
+    });
+    std::vector<std::thread::id> distinct;
+    for (std::size_t i = 0; i < N / 4; ++i) {
+        bool seen = false;
+        for (auto& d : distinct) seen |= (d == who[i]);
+        if (!seen) distinct.push_back(who[i]);
+    }
+    check(distinct.size() > 1, "first slice drained by more than one thread");
+}
+
+// -- Test 3: nested + concurrent callers run inline ---------------------------
+
+static void test_nested_and_concurrent() {
+    (void)std::printf("[ThreadPool] Nested and concurrent callers...\n");
+
+    ThreadPool pool(3);
+    std::atomic<std::size_t> inner_total{0};
+    pool.parallel_for(8, 1, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) {
+            pool.parallel_for(10, 1, [&](std::size_t ib, std::size_t ie) {
+                inner_total.fetch_add(ie - ib);
+            });
+        }
+    });
+    check(inner_total.load() == 80, "nested parallel_for completes (8 x 10)");
+
+    std::atomic<std::size_t> total{0};
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 4; ++t) {
+        callers.emplace_back([&] {
+            for (int r = 0; r < 50; ++r) {
+                pool.parallel_for(100, 0, [&](std::size_t b, std::size_t e) {
+                    total.fetch_add(e - b);
+                });
+            }
+        });
+    }
+    for (auto& c : callers) c.join();
+    check(total.load() == 4u * 50u * 100u, "concurrent callers all complete");
+}
+
+// -- Test 4: exceptions propagate to the caller -------------------------------
+
+static void test_exception() {
+    (void)std::printf("[ThreadPool] Exception propagation...\n");
+
+    ThreadPool pool(4);
+    bool caught = false;
+    try {
+        pool.parallel_for(1000, 1, [&](std::size_t b, std::size_t) {
+            if (b == 517) throw std::runtime_error("boom");
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    check(caught, "exception rethrown on caller");
+
+    // Pool stays usable afterwards.
+    std::atomic<std::size_t> total{0};
+    pool.parallel_for(1000, 0, [&](std::size_t b, std::size_t e) { total.fetch_add(e - b); });
+    check(total.load() == 1000, "pool usable after exception");
+}
+
+// -- Test 5: single-thread pool and affinity constructor ----------------------
+
+static void test_single_and_affinity() {
+    (void)std::printf("[ThreadPool] Serial pool and CPU pinning...\n");
+
+    ThreadPool serial(1);
+    const auto self = std::this_thread::get_id();
+    bool inline_only = true;
+    serial.parallel_for(100, 1, [&](std::size_t, std::size_t) {
+        inline_only &= (std::this_thread::get_id() == self);
+    });
+    check(serial.size() == 1 && inline_only, "size-1 pool runs on caller");
+
+    const int cpus[] = {0};
+    ThreadPool pinned(3, cpus, 1);
+    std::atomic<std::size_t> total{0};
+    pinned.parallel_for(300, 1, [&](std::size_t b, std::size_t e) { total.fetch_add(e - b); });
+    check(pinned.size() == 3 && total.load() == 300, "pinned pool completes");
+
+    check(ThreadPool::global().size() >= 1, "global() pool exists");
+}
+
+#ifdef SECP256K1_HAS_BIP352
+// -- Test 6: pooled BIP-352 scanners == serial --------------------------------
+
+static void test_bip352_pooled() {
+    (void)std::printf("[ThreadPool] BIP-352 pooled scan == serial...\n");
+    using secp256k1::fast::Point;
+    using secp256k1::fast::Scalar;
+
+    const Scalar scan  = Scalar::from_uint64(0x5ca115ca115ull);
+    const Scalar spend = Scalar::from_uint64(0x5e5e5e5e5e5ull);
+    const Point  spend_pub = Point::generator().scalar_mul(spend);
+
+    // 1500 txs: chunks of >= 512 so a 4-thread pool really splits the work.
+    constexpr std::size_t N = 1500;
+    std::vector<secp256k1::ScanTx> txs(N);
+    std::vector<Point> tweaks(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        tweaks[i] = Point::generator().scalar_mul(Scalar::from_uint64(1000 + i * 7919));
+        txs[i].a_eff = tweaks[i];
+        std::array<std::uint8_t, 32> junk{};
+        junk[0] = static_cast<std::uint8_t>(i);
+        txs[i].outputs.push_back(junk);
+    }
+    // Plant real outputs (k = 0) in a few transactions across chunk borders.
+    const std::size_t planted[] = {3, 511, 512, 1024, 1499};
+    for (std::size_t ti : planted) {
+        const auto s = tweaks[ti].scalar_mul(scan).to_compressed();
+        std::uint8_t ser[37] = {};
+        std::memcpy(ser, s.data(), 33);
+        const auto t = secp256k1::tagged_hash("BIP0352/SharedSecret", ser, sizeof(ser));
+        const Point cand = Point::generator().scalar_mul(Scalar::from_bytes(t)).add(spend_pub);
+        const auto comp = cand.to_compressed();
+        std::memcpy(txs[ti].outputs[0].data(), comp.data() + 1, 32);
+    }
+
+    ThreadPool pool(4);
+    const auto serial = secp256k1::fast_scan_batch(scan, spend, txs);
+    const auto pooled = secp256k1::fast_scan_batch(scan, spend, txs, pool);
+    bool same = serial.size() == pooled.size();
+    for (std::size_t i = 0; same && i < serial.size(); ++i) {
+        same = serial[i].tx_index == pooled[i].tx_index
+            && serial[i].output_index == pooled[i].output_index
+            && serial[i].tweaked_privkey == pooled[i].tweaked_privkey;
+    }
+    check(serial.size() == 5, "serial scan finds 5 planted outputs");
+    check(same, "pooled fast_scan_batch == serial (order + keys)");
+
+    std::vector<std::uint64_t> p_serial(N), p_pooled(N);
+    secp256k1::fast_scan_prefix_batch(scan, spend_pub, tweaks.data(), N, p_serial.data());
+    secp256k1::fast_scan_prefix_batch(scan, spend_pub, tweaks.data(), N, p_pooled.data(), &pool);
+    check(p_serial == p_pooled, "pooled prefix scan == serial");
+    bool prefix_ok = true;
+    for (std::size_t ti : planted) {
+        std::uint64_t want = 0;
+        for (int b = 0; b < 8; ++b) want = (want << 8) | txs[ti].outputs[0][b];
+        prefix_ok &= (p_serial[ti] == want);
+    }
+    check(prefix_ok, "prefix == first 8 bytes of planted output x");
+}
+#endif
+
+int test_thread_pool_run() {
+    (void)std::printf("\n=== ThreadPool Tests ===\n");
+
+    test_coverage();
+    test_stealing();
+    test_nested_and_concurrent();
+    test_exception();
+    test_single_and_affinity();
+#ifdef SECP256K1_HAS_BIP352
+    test_bip352_pooled();
+#endif
+
+    (void)std::printf("\n  ThreadPool: %d passed, %d failed\n", g_pass, g_fail);
+    return g_fail;
+}
+
+#ifdef STANDALONE_TEST
+int main() {
+    return test_thread_pool_run();
+}
+#endif
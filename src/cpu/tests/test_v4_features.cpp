@@ -2,6 +2,8 @@
 // Tests: Pedersen, FROST, Adaptor, Address, Silent Payments
 // ============================================================================
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <array>
@@ -18,6 +20,11 @@
 #include "secp256k1/scalar.hpp"
 #include "secp256k1/point.hpp"
 #include "secp256k1/field.hpp"
+#ifdef SECP256K1_HAS_BIP352
+#include "secp256k1/sp_chain_scan.hpp"
+#include "secp256k1/sp_multi_scan.hpp"
+#include "secp256k1/thread_pool.hpp"
+#endif
 
 using namespace secp256k1;
 using fast::Scalar;
@@ -576,6 +583,216 @@ static void test_silent_payment_multiple_outputs() {
     CHECK(detected.size() == 3, "sp_detected_three_outputs");
 }
 
+#ifdef SECP256K1_HAS_BIP352
+static void test_sp_chain_scan() {
+    std::printf("\n=== Silent Payment Chain Scan ===\n");
+    using secp256k1::SpChainScanner;
+    using secp256k1::SpScanCheckpoint;
+
+    const Scalar scan  = Scalar::from_uint64(0xc4a1c4a1ull);
+    const Point  spend_pub = Point::generator().scalar_mul(Scalar::from_uint64(0x5bed5bedull));
+
+    // 60 blocks of 0..47 tweaks (~1400 total); tweak 5 is not a curve point.
+    constexpr std::uint32_t kBlocks = 60;
+    constexpr std::uint32_t kFirstHeight = 840000;
+    std::vector<std::uint8_t> index;
+    std::vector<Point> tweaks;
+    std::vector<std::size_t> block_end;
+    for (std::uint32_t b = 0; b < kBlocks; ++b) {
+        std::uint32_t const count = (b * 37) % 48;
+        std::vector<std::uint8_t> raw(count * 33);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            Point p = Point::generator().scalar_mul(Scalar::from_uint64(77 + tweaks.size() * 104729));
+            auto comp = p.to_compressed();
+            if (tweaks.size() == 5) {
+                comp[0] = 0x05;
+                p = Point::infinity();
+            }
+            std::memcpy(raw.data() + i * 33, comp.data(), 33);
+            tweaks.push_back(p);
+        }
+        secp256k1::sp_tweak_index_append(index, kFirstHeight + b, raw.data(), count);
+        block_end.push_back(tweaks.size());
+    }
+    const std::size_t n = tweaks.size();
+    std::vector<std::uint64_t> want(n);
+    secp256k1::fast_scan_prefix_batch(scan, spend_pub, tweaks.data(), n, want.data());
+
+    struct Seen {
+        std::vector<std::uint32_t> heights;
+        std::vector<std::uint64_t> prefix;
+    };
+    auto collect = [](Seen& seen) {
+        return [&seen](std::uint32_t h, const std::array<std::uint8_t, 32>* x,
+                       const std::uint8_t* valid, std::size_t count) {
+            seen.heights.push_back(h);
+            for (std::size_t i = 0; i < count; ++i) {
+                std::uint64_t p = 0;
+                if (valid[i]) {
+                    for (int b = 0; b < 8; ++b) p = (p << 8) | x[i][b];
+                }
+                seen.prefix.push_back(p);
+            }
+        };
+    };
+
+    secp256k1::ThreadPool pool(4);
+    secp256k1::SpChainScanOptions opts;
+    opts.batch_tweaks = 600;
+    opts.pool = &pool;
+
+    // Full pass: every block in order, candidates == fast_scan_prefix_batch.
+    Seen full;
+    std::vector<SpScanCheckpoint> cps;
+    {
+        SpChainScanner sc(scan, spend_pub, collect(full), opts);
+        sc.set_checkpoint_callback([&](const SpScanCheckpoint& cp) { cps.push_back(cp); });
+        CHECK(sc.scan_index(index.data(), index.size()), "scan_index accepts a well-formed index");
+        CHECK(sc.stats().tweaks == n && sc.stats().blocks == kBlocks, "stats count every block and tweak");
+        CHECK(sc.checkpoint().index_offset == index.size()
+              && sc.checkpoint().next_height == kFirstHeight + kBlocks, "final checkpoint at end of index");
+    }
+    bool heights_ok = full.heights.size() == kBlocks;
+    for (std::uint32_t b = 0; heights_ok && b < kBlocks; ++b) heights_ok = full.heights[b] == kFirstHeight + b;
+    CHECK(heights_ok, "blocks reported once each, in height order");
+    CHECK(full.prefix == want, "chain scan candidates == fast_scan_prefix_batch");
+    CHECK(want[5] == 0 && full.prefix[5] == 0, "invalid tweak encoding reported invalid");
+    CHECK(cps.size() >= 2, "checkpoint after every batch");
+
+    // Resume from the first checkpoint (round-tripped through its bytes).
+    SpScanCheckpoint cp;
+    const auto bytes = cps.front().serialize();
+    CHECK(SpScanCheckpoint::parse(bytes.data(), bytes.size(), cp)
+          && cp.index_offset == cps.front().index_offset
+          && cp.next_height == cps.front().next_height, "checkpoint serialize/parse round trip");
+    Seen rest;
+    {
+        SpChainScanner sc(scan, spend_pub, collect(rest), opts);
+        sc.resume(cp);
+        CHECK(sc.scan_index(index.data(), index.size()), "resumed scan_index");
+    }
+    std::size_t const first_block = cp.next_height - kFirstHeight;
+    std::size_t const first_tweak = block_end[first_block - 1];
+    CHECK(cp.tweaks_scanned == first_tweak, "checkpoint counts scanned tweaks");
+    CHECK(!rest.heights.empty() && rest.heights.front() == cp.next_height
+          && rest.heights.size() == kBlocks - first_block, "resume starts at the first unreported block");
+    CHECK(std::equal(rest.prefix.begin(), rest.prefix.end(), full.prefix.begin() + first_tweak)
+          && rest.prefix.size() == n - first_tweak, "resumed candidates == full pass");
+
+    // Push model on the calling thread gives the same candidates.
+    Seen pushed;
+    {
+        SpChainScanner sc(scan, spend_pub, collect(pushed));
+        secp256k1::SpTweakIndexReader reader(index.data(), index.size());
+        secp256k1::SpTweakBlock blk;
+        while (reader.next(blk)) sc.add_block(blk.height, blk.tweaks33, blk.count);
+        sc.flush();
+    }
+    CHECK(pushed.prefix == want, "add_block + flush == scan_index");
+
+    // Truncated index: blocks before the cut are reported, then false.
+    Seen cut;
+    std::size_t const cut_at = index.size() - 10;
+    {
+        SpChainScanner sc(scan, spend_pub, collect(cut), opts);
+        CHECK(!sc.scan_index(index.data(), cut_at), "truncated record detected");
+        CHECK(sc.checkpoint().next_height == kFirstHeight + kBlocks - 1
+              && cut.heights.size() == kBlocks - 1, "blocks before the truncated record reported");
+    }
+
+    // Same index through a memory-mapped file.
+    const char* path = "test_sp_chain_scan.idx";
+    bool file_ok = false;
+    if (std::FILE* f = std::fopen(path, "wb")) {
+        file_ok = std::fwrite(index.data(), 1, index.size(), f) == index.size();
+        file_ok = (std::fclose(f) == 0) && file_ok;
+    }
+    Seen mapped;
+    if (file_ok) {
+        secp256k1::SpTweakIndexFile file;
+        file_ok = file.open(path) && file.size() == index.size();
+        SpChainScanner sc(scan, spend_pub, collect(mapped), opts);
+        file_ok = file_ok && sc.scan_index(file);
+    }
+    (void)std::remove(path);
+    CHECK(file_ok && mapped.prefix == want, "mapped index file == in-memory index");
+}
+
+static void test_sp_multi_scan() {
+    std::printf("\n=== Silent Payment Multi-Recipient Scan ===\n");
+    using secp256k1::SpMultiMatch;
+    using secp256k1::SpMultiScanner;
+
+    // 5 recipients, 700 tweaks (three 256-tweak work items); tweak 9 is invalid.
+    constexpr std::size_t M = 5, N = 700;
+    std::vector<secp256k1::SpRecipient> rcpt;
+    std::vector<Scalar> spend_sk;
+    for (std::size_t m = 0; m < M; ++m) {
+        std::array<std::uint8_t, 32> b{};
+        for (std::size_t i = 0; i < 32; ++i) b[i] = static_cast<std::uint8_t>(m * 59 + i * 113 + 1);
+        spend_sk.push_back(Scalar::from_uint64(0x5e4d0000ull + m));
+        rcpt.push_back({Scalar::from_bytes(b), Point::generator().scalar_mul(spend_sk[m])});
+    }
+    std::vector<std::uint8_t> tweaks33(N * 33);
+    std::vector<Point> tweaks(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        tweaks[i] = Point::generator().scalar_mul(Scalar::from_uint64(31337 + i * 65537));
+        const auto c = tweaks[i].to_compressed();
+        std::memcpy(tweaks33.data() + i * 33, c.data(), 33);
+    }
+    tweaks33[9 * 33] = 0x04;
+
+    // Output k of (recipient m, tweak i): x(t_k x G + B_spend_m).
+    auto output_for = [&](std::size_t m, std::size_t i, std::uint32_t k) {
+        const auto s = tweaks[i].scalar_mul(rcpt[m].scan_privkey).to_compressed();
+        std::uint8_t ser[37] = {};
+        std::memcpy(ser, s.data(), 33);
+        ser[36] = static_cast<std::uint8_t>(k);
+        const auto t = secp256k1::tagged_hash("BIP0352/SharedSecret", ser, sizeof(ser));
+        return Point::generator().scalar_mul(Scalar::from_bytes(t)).add(rcpt[m].spend_pubkey).x_only_bytes();
+    };
+    std::vector<std::array<std::uint8_t, 32>> outputs(40);
+    for (std::size_t j = 0; j < outputs.size(); ++j) outputs[j].fill(static_cast<std::uint8_t>(j + 1));
+    struct Plant { std::size_t m, i; std::uint32_t k; std::size_t slot; };
+    const Plant planted[] = {{0, 0, 0, 3}, {4, 699, 0, 7}, {2, 255, 0, 11}, {2, 255, 1, 12},
+                             {1, 256, 0, 20}, {3, 9, 0, 30}};
+    for (const Plant& p : planted) outputs[p.slot] = output_for(p.m, p.i, p.k);
+
+    secp256k1::ThreadPool pool(4);
+    SpMultiScanner const cached(rcpt);
+    SpMultiScanner const direct(rcpt, SIZE_MAX);
+    const auto a = cached.scan(tweaks33.data(), N, outputs.data(), outputs.size());
+    const auto b = direct.scan(tweaks33.data(), N, outputs.data(), outputs.size());
+    const auto c = cached.scan(tweaks33.data(), N, outputs.data(), outputs.size(), &pool);
+
+    auto same = [](const std::vector<SpMultiMatch>& x, const std::vector<SpMultiMatch>& y) {
+        if (x.size() != y.size()) return false;
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            if (x[i].recipient != y[i].recipient || x[i].tweak_index != y[i].tweak_index
+                || x[i].output_index != y[i].output_index || x[i].k != y[i].k
+                || !(x[i].tweak == y[i].tweak)) return false;
+        }
+        return true;
+    };
+    // Planted at the invalid tweak 9 is never found: 5 matches.
+    CHECK(a.size() == 5, "multi scan finds the planted outputs (k = 0 and k = 1)");
+    CHECK(same(a, b), "shared tweak tables == per-key fixed-k ladder");
+    CHECK(same(a, c), "pooled multi scan == serial");
+    bool keys_ok = true, order_ok = true;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const Point p = Point::generator().scalar_mul(spend_sk[a[i].recipient] + a[i].tweak);
+        keys_ok &= p.x_only_bytes() == outputs[a[i].output_index];
+        if (i != 0) order_ok &= a[i - 1].recipient <= a[i].recipient;
+    }
+    CHECK(keys_ok, "b_spend + t_k spends the matched output");
+    CHECK(order_ok && a.size() == 5 && a[2].recipient == 2 && a[2].k == 0 && a[3].k == 1,
+          "matches sorted by (recipient, tweak, k)");
+
+    const auto d = cached.scan(tweaks.data(), N, outputs.data(), outputs.size(), &pool);
+    CHECK(d.size() == 6, "Point overload scans the tweak encoded invalid above");
+}
+#endif
+
 // ===============================================================================
 // Edge Cases
 // ===============================================================================
@@ -676,6 +893,10 @@ int test_v4_features_run() {
     test_silent_payment_basic();
     test_silent_payment_flow();
     test_silent_payment_multiple_outputs();
+#ifdef SECP256K1_HAS_BIP352
+    test_sp_chain_scan();
+    test_sp_multi_scan();
+#endif
 
     std::printf("\n===========================================\n");
     std::printf("  Results: %d passed, %d failed\n", g_pass, g_fail);
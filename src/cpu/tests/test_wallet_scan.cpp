@@ -0,0 +1,247 @@
+// ============================================================================
+// Tests for the gap-limit wallet scanner (wallet_scan.hpp)
+// ============================================================================
+// Strategy: BIP-44 / BIP-84 / BIP-86 first-address vectors end to end, then
+// a seeded account whose expected outputs are built one child at a time
+// with derive_child + hash160 / taproot_output_key. The gap-limit walk is
+// checked through the hits it must and must not reach and the number of
+// children it derives.
+// ============================================================================
+
+#include "secp256k1/wallet_scan.hpp"
+#include "secp256k1/address.hpp"
+#include "secp256k1/bip32.hpp"
+#include "secp256k1/bip39.hpp"
+#include "secp256k1/taproot.hpp"
+#include "secp256k1/thread_pool.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace secp256k1;
+
+int g_tests_passed = 0;
+int g_tests_failed = 0;
+
+#define CHECK(cond, msg) do {                                      \
+    if (!(cond)) {                                                 \
+        (void)std::printf("  FAIL: %s (line %d)\n", msg, __LINE__);     \
+        g_tests_failed++;                                          \
+    } else {                                                       \
+        g_tests_passed++;                                          \
+    }                                                              \
+} while(0)
+
+std::vector<std::uint8_t> from_hex(const char* hex) {
+    std::vector<std::uint8_t> out;
+    for (std::size_t i = 0; hex[i] != 0 && hex[i + 1] != 0; i += 2) {
+        unsigned v = 0;
+        (void)std::sscanf(hex + i, "%2x", &v);
+        out.push_back(static_cast<std::uint8_t>(v));
+    }
+    return out;
+}
+
+std::vector<std::uint8_t> script_p2pkh(const ExtendedKey& key) {
+    auto const comp = key.public_key().to_compressed();
+    auto const h = hash160(comp.data(), comp.size());
+    std::vector<std::uint8_t> s = {0x76, 0xa9, 0x14};
+    s.insert(s.end(), h.begin(), h.end());
+    s.push_back(0x88);
+    s.push_back(0xac);
+    return s;
+}
+
+std::vector<std::uint8_t> script_p2wpkh(const ExtendedKey& key) {
+    auto const comp = key.public_key().to_compressed();
+    auto const h = hash160(comp.data(), comp.size());
+    std::vector<std::uint8_t> s = {0x00, 0x14};
+    s.insert(s.end(), h.begin(), h.end());
+    return s;
+}
+
+std::vector<std::uint8_t> script_p2tr(const ExtendedKey& key) {
+    auto const q = taproot_output_key(key.public_key().x().to_bytes()).first;
+    std::vector<std::uint8_t> s = {0x51, 0x20};
+    s.insert(s.end(), q.begin(), q.end());
+    return s;
+}
+
+ExtendedKey derive(const ExtendedKey& master, const char* path) {
+    return bip32_derive_path(master, path).first;
+}
+
+// "abandon x11 about": first receive address of the BIP-44/84/86 accounts.
+void test_bip_vectors() {
+    (void)std::printf("[1] BIP-44 / 84 / 86 first addresses\n");
+    auto [seed, ok_seed] = bip39_mnemonic_to_seed(
+        "abandon abandon abandon abandon abandon abandon abandon abandon "
+        "abandon abandon abandon about");
+    auto [master, ok_master] = bip32_master_key(seed.data(), seed.size());
+    CHECK(ok_seed && ok_master, "master key");
+
+    ExtendedKey const accounts[3] = {
+        derive(master, "m/44'/0'/0'").to_public(),
+        derive(master, "m/84'/0'/0'").to_public(),
+        derive(master, "m/86'/0'/0'").to_public(),
+    };
+    std::vector<std::vector<std::uint8_t>> scripts = {
+        script_p2pkh(derive(master, "m/44'/0'/0'/0/0")),
+        {0x00, 0x14},   // P2WPKH of m/84'/0'/0'/0/0, completed below
+        from_hex("5120a60869f0dbcf1dc659c9cecbaf8050135ea9e8cdc487053f1dc6880949dc684c"),
+    };
+    auto const pk84 = from_hex("0330d54fd0dd420a6e5f8d3624f5f3482cae350f79d5f0753bf5beef9c2d91af3c");
+    auto const h84 = hash160(pk84.data(), pk84.size());
+    scripts[1].insert(scripts[1].end(), h84.begin(), h84.end());
+
+    WalletScanOptions opt;
+    opt.gap_limit = 5;
+    WalletScanner const scanner(opt);
+    auto const hits = scanner.scan(accounts, 3, ScriptPubKeySet(scripts));
+
+    CHECK(hits.size() == 3, "one hit per account");
+    if (hits.size() != 3) return;
+    CHECK(hits[0].xpub_index == 0 && hits[0].branch == 0 && hits[0].child_index == 0 &&
+          hits[0].type == WalletOutputType::P2PKH && hits[0].script_index == 0 &&
+          hits[0].address == "1LqBGSKuX5yYUonjxT5qGfpUsXKYYWeabA", "BIP-44 m/44'/0'/0'/0/0");
+    CHECK(hits[1].xpub_index == 1 && hits[1].type == WalletOutputType::P2WPKH &&
+          hits[1].script_index == 1 &&
+          hits[1].address == "bc1qcr8te4kr609gcawutmrza0j4xv80jy8z306fyu", "BIP-84 m/84'/0'/0'/0/0");
+    CHECK(hits[2].xpub_index == 2 && hits[2].type == WalletOutputType::P2TR &&
+          hits[2].script_index == 2 &&
+          hits[2].address == "bc1p5cyxnuxmeuwuvkwfem96lqzszd02n6xdcjrs20cac6yqjjwudpxqkedrcr",
+          "BIP-86 m/86'/0'/0'/0/0");
+}
+
+// Outputs of a seeded account at chosen (branch, child, type) positions.
+struct Fixture {
+    ExtendedKey account;
+    ScriptPubKeySet set;
+    std::vector<std::vector<std::uint8_t>> scripts;
+};
+
+Fixture make_fixture() {
+    std::uint8_t seed[16];
+    for (std::uint8_t i = 0; i < 16; ++i) seed[i] = i;
+    Fixture f;
+    f.account = derive(bip32_master_key(seed, 16).first, "m/0'");
+    auto child = [&](std::uint32_t branch, std::uint32_t index) {
+        return f.account.derive_child(branch).first.derive_child(index).first;
+    };
+    // Receive chain, gap 20: 3 -> 22 -> 41 chain together, 70 is past the
+    // window that 41 opens (ends at 62). Change chain: 0, then 25 is past 21.
+    f.scripts = {
+        script_p2wpkh(child(0, 3)),
+        script_p2pkh(child(0, 22)),
+        script_p2tr(child(0, 41)),
+        script_p2wpkh(child(0, 70)),
+        script_p2tr(child(1, 0)),
+        script_p2pkh(child(1, 25)),
+        from_hex("a914000102030405060708090a0b0c0d0e0f1011121387"),   // P2SH: ignored
+    };
+    for (std::size_t i = 0; i < f.scripts.size(); ++i) {
+        f.set.add(f.scripts[i].data(), f.scripts[i].size(), static_cast<std::uint32_t>(i));
+    }
+    return f;
+}
+
+void test_gap_limit() {
+    (void)std::printf("[2] Gap-limit walk\n");
+    Fixture f = make_fixture();
+    CHECK(f.set.size() == 6 && !f.set.finalized(), "P2SH script not classified");
+
+    WalletScanner const scanner;
+    WalletScanStats stats;
+    // Unfinalized set: the scanner works on a sorted copy.
+    auto const hits = scanner.scan(&f.account, 1, f.set, nullptr, &stats);
+
+    CHECK(hits.size() == 4, "four reachable outputs");
+    if (hits.size() != 4) return;
+    CHECK(hits[0].branch == 0 && hits[0].child_index == 3 &&
+          hits[0].type == WalletOutputType::P2WPKH && hits[0].script_index == 0, "receive 3");
+    CHECK(hits[1].branch == 0 && hits[1].child_index == 22 &&
+          hits[1].type == WalletOutputType::P2PKH && hits[1].script_index == 1, "receive 22");
+    CHECK(hits[2].branch == 0 && hits[2].child_index == 41 &&
+          hits[2].type == WalletOutputType::P2TR && hits[2].script_index == 2, "receive 41");
+    CHECK(hits[3].branch == 1 && hits[3].child_index == 0 &&
+          hits[3].type == WalletOutputType::P2TR && hits[3].script_index == 4, "change 0");
+    CHECK(stats.chains == 2 && stats.derived == 62 + 21, "derives exactly the gap windows");
+
+    auto const addr = f.account.derive_child(0).first.derive_child(3).first.public_key();
+    CHECK(hits[0].address == address_p2wpkh(addr), "address formatted for the hit");
+
+    // A wider gap reaches 70 and 25.
+    WalletScanOptions wide;
+    wide.gap_limit = 30;
+    auto const wide_hits = WalletScanner(wide).scan(&f.account, 1, f.set);
+    CHECK(wide_hits.size() == 6, "gap 30 reaches every output");
+
+    // Type mask: P2TR only.
+    WalletScanOptions tr_only;
+    tr_only.types = static_cast<std::uint8_t>(WalletOutputType::P2TR);
+    auto const tr_hits = WalletScanner(tr_only).scan(&f.account, 1, f.set);
+    CHECK(tr_hits.size() == 1 && tr_hits[0].branch == 1,
+          "P2TR only: receive 3 unmatched, so 41 is out of reach");
+}
+
+void test_branches_and_pool() {
+    (void)std::printf("[3] Direct children, duplicates, thread pool\n");
+    Fixture f = make_fixture();
+    f.set.finalize();
+
+    // branches = {}: walk the receive chain key itself.
+    WalletScanOptions direct;
+    direct.branches.clear();
+    ExtendedKey const receive = f.account.derive_child(0).first;
+    auto const hits = WalletScanner(direct).scan(&receive, 1, f.set);
+    CHECK(hits.size() == 3 && hits[0].branch == WalletScanHit::kNoBranch &&
+          hits[2].child_index == 41, "direct children of the chain key");
+
+    // Duplicate script: the first index is reported.
+    ScriptPubKeySet dup;
+    dup.add(f.scripts[0].data(), f.scripts[0].size(), 7);
+    dup.add(f.scripts[0].data(), f.scripts[0].size(), 9);
+    dup.finalize();
+    auto const dup_hits = WalletScanner().scan(&f.account, 1, dup);
+    CHECK(dup_hits.size() == 1 && dup_hits[0].script_index == 7, "duplicate keeps first index");
+
+    // Many xpubs over a pool: same hits as the calling thread.
+    std::vector<ExtendedKey> xpubs(6, f.account.to_public());
+    ThreadPool pool(3);
+    auto const serial = WalletScanner().scan(xpubs.data(), xpubs.size(), f.set);
+    auto const pooled = WalletScanner().scan(xpubs.data(), xpubs.size(), f.set, &pool);
+    bool same = serial.size() == 24 && pooled.size() == serial.size();
+    for (std::size_t i = 0; same && i < serial.size(); ++i) {
+        same = serial[i].xpub_index == pooled[i].xpub_index &&
+               serial[i].child_index == pooled[i].child_index &&
+               serial[i].type == pooled[i].type && serial[i].address == pooled[i].address;
+    }
+    CHECK(same, "pooled scan matches serial scan");
+
+    CHECK(WalletScanner().scan(xpubs.data(), xpubs.size(), ScriptPubKeySet{}).empty(),
+          "empty set: no hits");
+}
+
+} // anonymous namespace
+
+#ifdef STANDALONE_TEST
+int main() {
+#else
+int test_wallet_scan_main() {
+#endif
+    (void)std::printf("\n=== Gap-limit wallet scanner Tests ===\n\n");
+
+    test_bip_vectors();
+    test_gap_limit();
+    test_branches_and_pool();
+
+    (void)std::printf("\n=== Results: %d passed, %d failed ===\n",
+               g_tests_passed, g_tests_failed);
+
+    return g_tests_failed > 0 ? 1 : 0;
+}
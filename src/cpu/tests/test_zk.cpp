@@ -14,6 +14,7 @@
 #include <cstdio>
 #include <cstring>
 #include <array>
+#include <stdexcept>
 
 using namespace secp256k1;
 using fast::Scalar;
@@ -339,6 +340,92 @@ static void test_range_proof_deterministic() {
 }
 
 
+// ============================================================================
+// Aggregated Range Proof Tests
+// ============================================================================
+
+static void test_aggregated_range_proof() {
+    std::printf("\n=== Aggregated Range Proof: m = 1..16 ===\n");
+
+    std::array<std::uint8_t, 32> aux{};
+    aux[0] = 0x10;
+
+    const std::size_t sizes[] = {1, 2, 3, 4, 16};
+    for (std::size_t m : sizes) {
+        std::uint64_t values[zk::AGG_RANGE_PROOF_MAX_M];
+        Scalar blindings[zk::AGG_RANGE_PROOF_MAX_M];
+        PedersenCommitment commitments[zk::AGG_RANGE_PROOF_MAX_M];
+        for (std::size_t j = 0; j < m; ++j) {
+            values[j] = (j == 1) ? UINT64_MAX : 1000 * j + 7;
+            blindings[j] = Scalar::from_uint64(5000 + j);
+            commitments[j] = pedersen_commit(Scalar::from_uint64(values[j]), blindings[j]);
+        }
+
+        auto proof = zk::range_prove_aggregated(values, blindings, commitments, m, aux);
+        char msg[64];
+        std::snprintf(msg, sizeof(msg), "aggregated_m%zu_valid", m);
+        CHECK(zk::range_verify_aggregated(commitments, m, proof), msg);
+
+        // Any change to a commitment or a response breaks it
+        PedersenCommitment const saved = commitments[m - 1];
+        commitments[m - 1] = pedersen_commit(Scalar::from_uint64(values[m - 1] + 1), blindings[m - 1]);
+        std::snprintf(msg, sizeof(msg), "aggregated_m%zu_wrong_commitment_fails", m);
+        CHECK(!zk::range_verify_aggregated(commitments, m, proof), msg);
+        commitments[m - 1] = saved;
+
+        auto bad = proof;
+        bad.tau_x = bad.tau_x + Scalar::one();
+        std::snprintf(msg, sizeof(msg), "aggregated_m%zu_bad_tau_x_fails", m);
+        CHECK(!zk::range_verify_aggregated(commitments, m, bad), msg);
+    }
+}
+
+static void test_aggregated_range_proof_shape() {
+    std::printf("\n=== Aggregated Range Proof: Shape ===\n");
+
+    const auto& gens = zk::get_generator_vectors();
+    const auto& agg = zk::get_aggregate_generator_vectors();
+    bool prefix_equal = agg.G.size() == zk::AGG_RANGE_PROOF_MAX_BITS &&
+                        agg.H.size() == zk::AGG_RANGE_PROOF_MAX_BITS;
+    for (std::size_t i = 0; prefix_equal && i < zk::RANGE_PROOF_BITS; ++i) {
+        prefix_equal = agg.G[i].to_compressed() == gens.G[i].to_compressed() &&
+                       agg.H[i].to_compressed() == gens.H[i].to_compressed();
+    }
+    CHECK(prefix_equal, "aggregate_generators_extend_single");
+
+    std::uint64_t values[3] = {1, 2, 3};
+    Scalar blindings[3] = {Scalar::from_uint64(11), Scalar::from_uint64(22), Scalar::from_uint64(33)};
+    PedersenCommitment commitments[3];
+    for (int j = 0; j < 3; ++j) {
+        commitments[j] = pedersen_commit(Scalar::from_uint64(values[j]), blindings[j]);
+    }
+    std::array<std::uint8_t, 32> aux{};
+    aux[0] = 0x11;
+
+    // m = 3 is padded to 4: log2(256) rounds
+    auto proof = zk::range_prove_aggregated(values, blindings, commitments, 3, aux);
+    CHECK(proof.rounds == zk::RANGE_PROOF_LOG2 + 2, "aggregated_m3_has_8_rounds");
+    CHECK(!zk::range_verify_aggregated(commitments, 2, proof), "aggregated_fewer_commitments_fails");
+
+    PedersenCommitment swapped[3] = {commitments[1], commitments[0], commitments[2]};
+    CHECK(!zk::range_verify_aggregated(swapped, 3, proof), "aggregated_reordered_commitments_fails");
+
+    auto proof2 = zk::range_prove_aggregated(values, blindings, commitments, 3, aux);
+    CHECK(proof.a.to_bytes() == proof2.a.to_bytes() &&
+          proof.A.to_compressed() == proof2.A.to_compressed(), "aggregated_deterministic");
+
+    bool threw = false;
+    try {
+        (void)zk::range_prove_aggregated(values, blindings, commitments, 0, aux);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    CHECK(threw, "aggregated_m0_throws");
+    CHECK(!zk::range_verify_aggregated(commitments, zk::AGG_RANGE_PROOF_MAX_M + 1, proof),
+          "aggregated_m_too_large_fails");
+}
+
+
 // ============================================================================
 // Batch Operations Tests
 // ============================================================================
@@ -375,6 +462,48 @@ static void test_batch_commit() {
 }
 
 
+static void test_batch_range_verify() {
+    std::printf("\n=== Batch Operations: batch_range_verify ===\n");
+
+    constexpr std::size_t N = 6;
+    PedersenCommitment commitments[N];
+    zk::RangeProof proofs[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        std::uint64_t const value = (i == 2) ? UINT64_MAX : 31 * i;
+        Scalar const blinding = Scalar::from_uint64(900 + i);
+        std::array<std::uint8_t, 32> aux{};
+        aux[0] = static_cast<std::uint8_t>(0x20 + i);
+        commitments[i] = pedersen_commit(Scalar::from_uint64(value), blinding);
+        proofs[i] = zk::range_prove(value, blinding, commitments[i], aux);
+    }
+
+    CHECK(zk::batch_range_verify(commitments, proofs, N), "batch_all_valid");
+    CHECK(zk::batch_range_verify(commitments, proofs, 0), "batch_empty_valid");
+
+    // One bad proof anywhere in the batch fails it
+    bool all_rejected = true;
+    for (std::size_t k = 0; k < N; ++k) {
+        zk::RangeProof bad[N];
+        for (std::size_t i = 0; i < N; ++i) bad[i] = proofs[i];
+        bad[k].t_hat = bad[k].t_hat + Scalar::one();
+        all_rejected &= !zk::batch_range_verify(commitments, bad, N);
+    }
+    CHECK(all_rejected, "batch_one_bad_t_hat_fails_at_every_position");
+
+    zk::RangeProof bad_b[N];
+    for (std::size_t i = 0; i < N; ++i) bad_b[i] = proofs[i];
+    bad_b[N - 1].b = bad_b[N - 1].b + Scalar::one();
+    CHECK(!zk::batch_range_verify(commitments, bad_b, N), "batch_bad_ipa_scalar_fails");
+
+    // Proofs valid on their own but paired with the wrong commitments
+    PedersenCommitment swapped[N];
+    for (std::size_t i = 0; i < N; ++i) swapped[i] = commitments[i];
+    swapped[0] = commitments[1];
+    swapped[1] = commitments[0];
+    CHECK(!zk::batch_range_verify(swapped, proofs, N), "batch_swapped_commitments_fails");
+}
+
+
 // ============================================================================
 // Entry points
 // ============================================================================
@@ -404,8 +533,13 @@ static int run_all_zk_tests() {
     test_range_proof_wrong_commitment();
     test_range_proof_deterministic();
 
+    // Aggregated Range Proofs
+    test_aggregated_range_proof();
+    test_aggregated_range_proof_shape();
+
     // Batch Operations
     test_batch_commit();
+    test_batch_range_verify();
 
     std::printf("\n=== Results: %d/%d passed ===\n", tests_passed, tests_run);
     return (tests_passed == tests_run) ? 0 : 1;